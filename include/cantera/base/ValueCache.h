@@ -6,6 +6,7 @@
 #define CT_VALUECACHE_H
 
 #include "ct_defs.h"
+#include <deque>
 #include <limits>
 
 namespace Cantera
@@ -126,7 +127,10 @@ typedef CachedValue<vector_fp>& CachedArray;
  *
  * Each method in the class that implements caching behavior needs a unique id
  * for its cached value. This id should be obtained by using the getId()
- * function to initialize a static variable within the function.
+ * function to initialize a static variable within the function. Ids are
+ * small consecutive integers which are assigned without locking, and are
+ * used directly as indices into the storage for the cached values, so
+ * looking up a cached value takes constant time.
  *
  * For cases where the property is a scalar or vector, the cached value can be
  * stored in the CachedValue object. If the data type of the cached value is
@@ -154,18 +158,26 @@ class ValueCache
 {
 public:
     //! Get a unique id for a cached value. Must be called exactly once for each
-    //! method that implements caching behavior.
-    int getId();
+    //! method that implements caching behavior. This method is thread safe.
+    static int getId();
 
     //! Get a reference to a CachedValue object representing a scalar
-    //! (doublereal) with the given id.
+    //! (doublereal) with the given id. The reference remains valid when
+    //! values with other ids are added to the cache.
     CachedScalar getScalar(int id) {
+        if (static_cast<size_t>(id) >= m_scalarCache.size()) {
+            m_scalarCache.resize(id + 1);
+        }
         return m_scalarCache[id];
     }
 
     //! Get a reference to a CachedValue object representing an array (vector_fp)
-    //! with the given id.
+    //! with the given id. The reference remains valid when values with other
+    //! ids are added to the cache.
     CachedArray getArray(int id) {
+        if (static_cast<size_t>(id) >= m_arrayCache.size()) {
+            m_arrayCache.resize(id + 1);
+        }
         return m_arrayCache[id];
     }
 
@@ -176,14 +188,12 @@ public:
     void clear();
 
 protected:
-    //! Cached scalar values
-    std::map<int, CachedValue<double> > m_scalarCache;
+    //! Cached scalar values, indexed by id. A deque is used so that growing
+    //! the cache does not invalidate references held by the callers.
+    std::deque<CachedValue<double> > m_scalarCache;
 
-    //! Cached array values
-    std::map<int, CachedValue<vector_fp> > m_arrayCache;
-
-    //! The last assigned id. Automatically incremented by the getId() method.
-    static int m_last_id;
+    //! Cached array values, indexed by id
+    std::deque<CachedValue<vector_fp> > m_arrayCache;
 };
 
 }
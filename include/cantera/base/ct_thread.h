@@ -11,6 +11,7 @@
 #ifdef THREAD_SAFE_CANTERA
 #include <boost/shared_ptr.hpp>
 #include <boost/thread/mutex.hpp>
+#include <boost/detail/atomic_count.hpp>
 
 #endif
 
@@ -40,6 +41,9 @@ public:
 typedef boost::mutex mutex_t;
 typedef boost::mutex::scoped_lock ScopedLock;
 
+//! A counter which can be incremented atomically without locking
+typedef boost::detail::atomic_count atomic_count_t;
+
 #else
 typedef int mutex_t;
 
@@ -50,6 +54,20 @@ public:
     int m_;
 };
 
+class atomic_count_t
+{
+public:
+    explicit atomic_count_t(long v) : m_(v) {}
+    long operator++() {
+        return ++m_;
+    }
+    operator long() const {
+        return m_;
+    }
+private:
+    long m_;
+};
+
 #endif // THREAD_SAFE_CANTERA
 
 }
@@ -780,6 +780,25 @@ Cantera::XML_Node getCtmlTree(const std::string& file);
  */
 void ct2ctml(const char* file, const int debug = 0);
 
+//! Convert an input file into the binary format read by get_XML_File()
+/*!
+ *  The binary file contains the same XML tree as the input file, but is
+ *  loaded without calling the CTI preprocessor or parsing any XML. Only the
+ *  time spent reading the file is saved: phases and kinetics managers are
+ *  still built from the XML tree by importPhase() and importKinetics(),
+ *  which for large mechanisms usually takes longer than parsing the XML.
+ *  Objects created from the binary file are identical to those created from
+ *  the input file.
+ *  The binary file is not updated automatically if the input file changes.
+ *
+ *  @param   file      Path to the input file in CTI or CTML format
+ *  @param   out_name  Name of the output file, which should have the
+ *      extension '.ctb'
+ *
+ *  @ingroup inputfiles
+ */
+void ct2ctb(const std::string& file, const std::string& out_name);
+
 //! Get a string with the ctml representation of a cti file.
 /*!
  *  @param   file    Path to the input file in CTI format
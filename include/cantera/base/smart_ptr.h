@@ -5,6 +5,7 @@
 namespace Cantera
 {
     using std::shared_ptr;
+    using std::weak_ptr;
 }
 
 #elif defined CT_USE_TR1_SHARED_PTR
@@ -12,6 +13,7 @@ namespace Cantera
 namespace Cantera
 {
     using std::tr1::shared_ptr;
+    using std::tr1::weak_ptr;
 }
 
 #elif defined CT_USE_MSFT_SHARED_PTR
@@ -19,13 +21,16 @@ namespace Cantera
 namespace Cantera
 {
     using std::tr1::shared_ptr;
+    using std::tr1::weak_ptr;
 }
 
 #elif defined CT_USE_BOOST_SHARED_PTR
 #include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
 namespace Cantera
 {
     using boost::shared_ptr;
+    using boost::weak_ptr;
 }
 
 #else
@@ -20,7 +20,10 @@ namespace Cantera
 {
 //!  Class XML_Reader reads an XML file into an XML_Node object.
 /*!
- *   Class XML_Reader is designed for internal use.
+ *   Class XML_Reader is designed for internal use. The input stream is read
+ *   in chunks of a fixed size, and tags and values are extracted directly
+ *   from the current chunk, so the memory used by the reader does not depend
+ *   on the size of the input.
  */
 class XML_Reader
 {
@@ -41,6 +44,9 @@ public:
      */
     void getchr(char& ch);
 
+    //! Returns true if the entire input has been read
+    bool eof();
+
     //!  Searches a string for the first occurrence of a valid
     //!  quoted string.
     /*!
@@ -84,14 +90,67 @@ public:
     std::string readValue();
 
 protected:
+    //! Read the next chunk of the input stream into #m_buffer
+    /*!
+     *  The characters before #m_pos are discarded.
+     *  @return  false if the end of the input stream has been reached
+     */
+    bool fill();
+
     //! Input stream containing the XML file
     std::istream& m_s;
 
+    //! The part of the input stream which is currently being read
+    std::string m_buffer;
+
+    //! Position of the next character to be read from #m_buffer
+    size_t m_pos;
+
 public:
     //! Line count
     int m_line;
 };
 
+//! Interface for receiving the contents of an XML file as it is parsed
+/*!
+ *  XML_Node::parse() reads an XML file without building a tree, and calls the
+ *  methods of a handler derived from this class for each element, in the
+ *  order in which the elements appear in the file. Only the names of the
+ *  currently open elements are kept, so this can be used to extract data
+ *  from large files, e.g. to scan the reactions of a mechanism, without
+ *  creating an XML_Node for every element. XML_Node::build() uses the same
+ *  parser to construct the tree.
+ */
+class XML_Handler
+{
+public:
+    virtual ~XML_Handler() {}
+
+    //! Called for each element, after its start tag and its value have been
+    //! read
+    /*!
+     *  @param name     Name of the element
+     *  @param value    Value of the element, i.e. the text between the start
+     *                  tag and the first child element or end tag, with
+     *                  leading and trailing whitespace removed. Empty for
+     *                  elements of the form `<name/>`.
+     *  @param attribs  Attributes of the element. The handler may modify the
+     *                  map or swap out its contents, which are cleared before
+     *                  the next element is read.
+     *  @param line     Line number of the start tag
+     */
+    virtual void startElement(const std::string& name, const std::string& value,
+                              std::map<std::string, std::string>& attribs,
+                              int line) = 0;
+
+    //! Called at the end of each element. For elements of the form
+    //! `<name/>`, this is called directly after startElement().
+    virtual void endElement(const std::string& name) = 0;
+
+    //! Called for each comment
+    virtual void comment(const std::string& text) {}
+};
+
 //! Class XML_Node is a tree-based representation of the contents of an XML file
 /*!
  * There are routines for adding to the tree, querying and searching the tree,
@@ -341,6 +400,9 @@ private:
      */
     std::map<std::string,std::string>& attribs();
 
+    //! The handler used by build() takes over the attributes read by parse()
+    friend class XML_TreeBuilder;
+
 public:
     //! Returns an unchangeable value of the attributes map for the current node
     /*!
@@ -632,6 +694,42 @@ public:
      */
     void build(std::istream& f);
 
+    //! Read an XML file without building a tree
+    /*!
+     *  The elements in the input are passed to `handler` as they are read.
+     *  The input is read in chunks of a fixed size, so apart from the data
+     *  kept by the handler, the memory used does not grow with the size of
+     *  the file. An exception is thrown if a start tag and end tag do not
+     *  match.
+     *
+     * @param f        Input stream containing the ascii input file
+     * @param handler  Handler which receives the contents of the file
+     */
+    static void parse(std::istream& f, XML_Handler& handler);
+
+    //! Write the XML tree rooted at this node in a compact binary format
+    /*!
+     *  The binary representation contains the same information as the text
+     *  representation written by write(), but can be read back by
+     *  buildBinary() without any parsing. Integers are stored as four bytes
+     *  in little-endian order, and strings are preceded by their length, so
+     *  the files are portable between platforms.
+     *
+     *  @param s  ostream to write to. Should be opened in binary mode.
+     */
+    void writeBinary(std::ostream& s) const;
+
+    //! Create the XML tree from a stream containing the binary representation
+    //! written by writeBinary()
+    /*!
+     *  The name, value, and attributes of this node are replaced by those of
+     *  the root node in the input, and the children in the input are added
+     *  to this node.
+     *
+     * @param f  Input stream, opened in binary mode
+     */
+    void buildBinary(std::istream& f);
+
     //! Copy all of the information in the current XML_Node tree
     //! into the destination XML_Node tree, doing a union operation as
     //! we go
@@ -675,6 +773,10 @@ private:
      */
     void write_int(std::ostream& s, int level = 0, int numRecursivesAllowed = 60000) const;
 
+    //! Write the binary representation of this node and its children,
+    //! without the header written by writeBinary()
+    void writeBinary_int(std::ostream& s) const;
+
 protected:
     //! XML node name of the node.
     /*!
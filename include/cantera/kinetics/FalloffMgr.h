@@ -9,6 +9,7 @@
 
 #include "reaction_defs.h"
 #include "FalloffFactory.h"
+#include "cantera/base/smart_ptr.h"
 
 namespace Cantera
 {
@@ -29,16 +30,7 @@ public:
         //else m_factory = f;
     }
 
-    //! Destructor. Deletes all installed falloff function calculators.
-    virtual ~FalloffMgr() {
-        for (size_t i = 0; i < m_falloff.size(); i++) {
-            delete m_falloff[i];
-        }
-        //if (m_factory) {
-        //FalloffFactory::deleteFalloffFactory();
-        //m_factory = 0;
-        //}
-    }
+    virtual ~FalloffMgr() {}
 
     //! Install a new falloff function calculator.
     /*
@@ -51,7 +43,7 @@ public:
     void install(size_t rxn, int falloffType, int reactionType,
                  const vector_fp& c) {
         m_rxn.push_back(rxn);
-        Falloff* f = m_factory->newFalloff(falloffType,c);
+        shared_ptr<Falloff> f(m_factory->newFalloff(falloffType,c));
         m_offset.push_back(m_worksize);
         m_worksize += f->workSize();
         m_falloff.push_back(f);
@@ -96,7 +88,9 @@ public:
 
 protected:
     std::vector<size_t> m_rxn;
-    std::vector<Falloff*> m_falloff;
+    //! Falloff function calculators. These are not modified after they are
+    //! installed, so copies of this FalloffMgr share them.
+    std::vector<shared_ptr<Falloff> > m_falloff;
     FalloffFactory* m_factory;
     vector_int m_loc;
     std::vector<vector_fp::difference_type> m_offset;
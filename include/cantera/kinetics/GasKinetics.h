@@ -48,6 +48,38 @@ public:
     virtual void getEquilibriumConstants(doublereal* kc);
     virtual void getFwdRateConstants(doublereal* kfwd);
 
+    //! @}
+    //! @name Species Production Rates
+    //! @{
+
+    //! Species net production rates for a batch of states. The thermo state
+    //! of each gas state is evaluated in turn, but the rate constants,
+    //! third-body concentrations, concentration products and species
+    //! production rates are computed for all states together, with the
+    //! innermost loops running over the states.
+    //! @see Kinetics::getNetProductionRatesBatch
+    virtual void getNetProductionRatesBatch(size_t nStates,
+                                            const doublereal* T,
+                                            const doublereal* P,
+                                            const doublereal* Y,
+                                            doublereal* wdot);
+
+    //! Jacobian of the species net production rates with respect to the
+    //! species concentrations and temperature. The concentration derivatives
+    //! of the mass-action terms and third-body concentrations are evaluated
+    //! analytically. For falloff reactions, the derivative of the falloff
+    //! function with respect to the reduced pressure is evaluated by
+    //! differencing the falloff function alone, and for P-log and Chebyshev
+    //! reactions, the pressure derivative of the rate constant is evaluated
+    //! by differencing the rate expression in log(P). The temperature
+    //! column is computed by a forward difference at constant
+    //! concentrations, requiring a single additional evaluation of the
+    //! production rates.
+    //! @see Kinetics::getNetProductionRatesJacobian
+    virtual void getNetProductionRatesJacobian(std::vector<size_t>& colStart,
+                                               std::vector<size_t>& rowIndex,
+                                               vector_fp& values);
+
     //! @}
     //! @name Reaction Mechanism Setup Routines
     //! @{
@@ -61,13 +93,20 @@ public:
     void updateROP();
 
     //! Update temperature-dependent portions of reaction rates and falloff
-    //! functions.
+    //! functions, and the pressure-dependent portion of P-log and Chebyshev
+    //! reactions.
+    /*!
+     *  Each part is only recomputed when the variable it depends on has
+     *  changed. For P-log and Chebyshev reactions, the temperature- and
+     *  pressure-dependent parts are cached separately, so a change in
+     *  pressure at constant temperature only requires the interpolation in
+     *  pressure to be repeated.
+     */
     virtual void update_rates_T();
 
     //! Update properties that depend on concentrations.
     //! Currently the enhanced collision partner concentrations are updated
-    //! here, as well as the pressure-dependent portion of P-log and Chebyshev
-    //! reactions.
+    //! here.
     virtual void update_rates_C();
 
 protected:
@@ -100,6 +139,80 @@ protected:
     vector_fp concm_falloff_values;
     //!@}
 
+    //! @name Work arrays used by getNetProductionRatesBatch
+    //! Arrays indexed by species or reaction hold the values for all states
+    //! in structure-of-arrays layout.
+    //!@{
+    vector_fp m_batch_logT;
+    vector_fp m_batch_recipT;
+    vector_fp m_batch_logStandConc;
+    vector_fp m_batch_ctot;
+    vector_fp m_batch_conc;
+    vector_fp m_batch_grt;
+    vector_fp m_batch_rfn;
+    vector_fp m_batch_rfn_low;
+    vector_fp m_batch_rfn_high;
+    vector_fp m_batch_rkcn;
+    vector_fp m_batch_ropf;
+    vector_fp m_batch_ropr;
+    vector_fp m_batch_concm_3b;
+    vector_fp m_batch_concm_falloff;
+    vector_fp m_batch_falloff_work;
+    //!@}
+
+    //! @name Data used by getNetProductionRatesJacobian
+    //!@{
+
+    //! Number of reactions when the Jacobian structure was built, or npos
+    size_t m_jac_nrxn;
+
+    //! Sparsity pattern of the Jacobian, in compressed sparse column format
+    std::vector<size_t> m_jac_colStart;
+    std::vector<size_t> m_jac_rowIndex;
+
+    //! Net stoichiometric coefficients of each reaction, in compressed
+    //! sparse row format
+    std::vector<size_t> m_jac_net_ptr;
+    std::vector<size_t> m_jac_net_k;
+    vector_fp m_jac_net_nu;
+
+    //! Reaction and species index of each sparse derivative of the rates of
+    //! progress: forward mass-action terms, reverse mass-action terms,
+    //! third-body efficiencies, and falloff efficiencies, in that order.
+    std::vector<size_t> m_jac_rxn;
+    std::vector<size_t> m_jac_sp;
+    size_t m_jac_nfwd; //!< Number of forward mass-action entries
+    size_t m_jac_nrev; //!< Number of reverse mass-action entries
+
+    //! Entries of #m_jac_rxn grouped by species, in compressed sparse
+    //! column format
+    std::vector<size_t> m_jac_entry_ptr;
+    std::vector<size_t> m_jac_entry_idx;
+
+    //! Species whose production rates depend on the concentrations of all
+    //! species, through default third-body efficiencies or pressure-dependent
+    //! rate expressions
+    std::vector<size_t> m_jac_dense_rows;
+
+    vector_fp m_jac_dval;
+    vector_fp m_jac_kf;
+    vector_fp m_jac_Pf;
+    vector_fp m_jac_Pr;
+    vector_fp m_jac_s;
+    vector_fp m_jac_u;
+    vector_fp m_jac_work;
+    vector_fp m_jac_wdot;
+    vector_fp m_jac_pr;
+    vector_fp m_jac_g0;
+    vector_fp m_jac_g1;
+    vector_fp m_jac_kp;
+    vector_fp m_jac_km;
+    //!@}
+
+    //! Build the sparsity pattern and index arrays used by
+    //! getNetProductionRatesJacobian().
+    void buildJacobianStructure();
+
     void processFalloffReactions();
 
     void addThreeBodyReaction(ReactionData& r);
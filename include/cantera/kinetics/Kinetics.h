@@ -596,6 +596,54 @@ public:
      */
     virtual void getNetProductionRates(doublereal* wdot);
 
+    /**
+     * Species net production rates [kmol/m^3/s] for a batch of states of a
+     * homogeneous phase. Input and output arrays are in structure-of-arrays
+     * layout: the value for species \a k in state \a j is stored at index
+     * `k*nStates + j`. The state of the phase is the same on return as on
+     * entry.
+     *
+     * The default implementation sets the state of the phase and calls
+     * getNetProductionRates() for each state in turn. Derived classes may
+     * override this method with implementations that evaluate all of the
+     * states together.
+     *
+     * @param nStates  Number of states
+     * @param T        Temperature of each state [K]. Length: nStates.
+     * @param P        Pressure of each state [Pa]. Length: nStates.
+     * @param Y        Species mass fractions. Length: m_kk * nStates.
+     * @param wdot     Output array of net production rates.
+     *                 Length: m_kk * nStates.
+     */
+    virtual void getNetProductionRatesBatch(size_t nStates,
+                                            const doublereal* T,
+                                            const doublereal* P,
+                                            const doublereal* Y,
+                                            doublereal* wdot);
+
+    /**
+     * Jacobian of the species net production rates with respect to the
+     * species molar concentrations and the temperature, in compressed
+     * sparse column format. Column `m < nTotalSpecies()` holds the
+     * derivatives @f$ \partial \dot\omega_k / \partial C_m @f$ at
+     * constant temperature and constant concentrations of the other
+     * species. Column `nTotalSpecies()` holds the derivatives
+     * @f$ \partial \dot\omega_k / \partial T @f$ at constant
+     * concentrations. The sparsity pattern depends only on the reaction
+     * mechanism, and entries within each column are sorted by species index.
+     *
+     * @param colStart  On return, the entries of column `m` are entries
+     *                  `colStart[m]` to `colStart[m+1] - 1` of `rowIndex`
+     *                  and `values`. Length: m_kk + 2.
+     * @param rowIndex  On return, the species index of each entry.
+     * @param values    On return, the value of each entry.
+     */
+    virtual void getNetProductionRatesJacobian(std::vector<size_t>& colStart,
+                                               std::vector<size_t>& rowIndex,
+                                               vector_fp& values) {
+        throw NotImplementedError("Kinetics::getNetProductionRatesJacobian");
+    }
+
     //! @}
     //! @name Reaction Mechanism Informational Query Routines
     //! @{
@@ -823,6 +871,21 @@ public:
         m_skipUndeclaredThirdBodies = skip;
     }
 
+    //! Select the storage used for the stoichiometric coefficient matrices.
+    //! If set to true, the reactant and product stoichiometry is stored as
+    //! compressed sparse row and column matrices, and the rates of progress
+    //! and species production rates are evaluated by looping over these
+    //! matrices rather than over per-reaction objects. This is usually faster
+    //! for large mechanisms. The matrices are (re)built by finalize() if
+    //! reactions are added after this method is called. The default is false.
+    void setSparseStoichiometry(bool sparse);
+
+    //! True if sparse stoichiometric matrices are in use.
+    //! @see setSparseStoichiometry()
+    bool sparseStoichiometry() const {
+        return m_reactantStoich.sparse();
+    }
+
     //! @deprecated To be removed after Cantera 2.2. No longer called as part
     //!     of addReaction.
     virtual void installReagents(const ReactionData& r) {
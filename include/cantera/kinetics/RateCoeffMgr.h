@@ -72,6 +72,20 @@ public:
         }
     }
 
+    /**
+     * Update the temperature-dependent parts of the rate coefficients, for
+     * rate types which cache them (Plog and ChebyshevRate). Subsequent
+     * calls to update() at the same temperature reuse the cached values, so
+     * that after a change in pressure only the pressure-dependent parts are
+     * recomputed.
+     */
+    void updateTemp(doublereal T, doublereal logT) {
+        doublereal recipT = 1.0/T;
+        for (size_t i = 0; i != m_rates.size(); i++) {
+            m_rates[i].updateTemp(logT, recipT);
+        }
+    }
+
     /**
      * Write the rate coefficients into array values. Each
      * calculator writes one entry in values, at the location
@@ -87,6 +101,31 @@ public:
         }
     }
 
+    /**
+     * Write the rate coefficients for a batch of states into array values.
+     * The rate coefficient for the reaction installed with reaction number
+     * `i` is written to `values[i*ld + j]` for each state `j`, so that the
+     * inner loop over the states has unit stride. As with update(), this
+     * method does not call update_C(), so it should only be used with more
+     * than one state for rate types which depend only on temperature.
+     *
+     * @param nStates number of states
+     * @param logT natural logarithm of the temperature for each state
+     * @param recipT inverse of the temperature for each state
+     * @param values output array of rate coefficients
+     * @param ld leading dimension of `values`, usually `nStates`
+     */
+    void update(size_t nStates, const doublereal* logT,
+                const doublereal* recipT, doublereal* values, size_t ld) {
+        for (size_t i = 0; i != m_rates.size(); i++) {
+            const R& rate = m_rates[i];
+            doublereal* v = values + m_rxn[i]*ld;
+            for (size_t j = 0; j < nStates; j++) {
+                v[j] = rate.updateRC(logT[j], recipT[j]);
+            }
+        }
+    }
+
     size_t nReactions() const {
         return m_rates.size();
     }
@@ -96,6 +135,99 @@ protected:
     std::vector<size_t>           m_rxn;
 };
 
+/**
+ * Rate coefficient manager for Arrhenius rate coefficients. Rather than
+ * storing an array of Arrhenius objects, the parameters of all rate
+ * coefficients are stored in separate contiguous arrays, so that the
+ * exponent, the exponential and the scaling by the pre-exponential factor
+ * are each evaluated in a single loop over all reactions which the compiler
+ * can vectorize. Rate coefficients with no temperature dependence (b = 0 and
+ * E = 0) are stored separately and are not evaluated at all.
+ */
+template<>
+class Rate1<Arrhenius>
+{
+public:
+    Rate1() {}
+    virtual ~Rate1() {}
+
+    size_t install(size_t rxnNumber, const ReactionData& rdata) {
+        if (rdata.rateCoeffType != Arrhenius::type())
+            throw CanteraError("Rate1::install",
+                               "incorrect rate coefficient type: "+int2str(rdata.rateCoeffType) + ". Was Expecting type: "+ int2str(Arrhenius::type()));
+        install(rxnNumber, Arrhenius(rdata));
+        return nReactions() - 1;
+    }
+
+    void install(size_t rxnNumber, const Arrhenius& rate) {
+        if (rate.temperatureExponent() == 0.0 &&
+                rate.activationEnergy_R() == 0.0) {
+            m_const_rxn.push_back(rxnNumber);
+            m_const_A.push_back(rate.preExponentialFactor());
+        } else {
+            m_rxn.push_back(rxnNumber);
+            m_A.push_back(rate.preExponentialFactor());
+            m_b.push_back(rate.temperatureExponent());
+            m_E.push_back(rate.activationEnergy_R());
+            m_work.push_back(0.0);
+        }
+    }
+
+    void update_C(const doublereal* c) {}
+
+    void update(doublereal T, doublereal logT, doublereal* values) {
+        doublereal recipT = 1.0/T;
+        size_t n = m_rxn.size();
+        doublereal* work = n ? &m_work[0] : 0;
+        for (size_t i = 0; i < n; i++) {
+            work[i] = m_b[i]*logT - m_E[i]*recipT;
+        }
+        for (size_t i = 0; i < n; i++) {
+            work[i] = std::exp(work[i]);
+        }
+        for (size_t i = 0; i < n; i++) {
+            values[m_rxn[i]] = m_A[i] * work[i];
+        }
+        for (size_t i = 0; i < m_const_rxn.size(); i++) {
+            values[m_const_rxn[i]] = m_const_A[i];
+        }
+    }
+
+    //! @see Rate1::update(size_t, const doublereal*, const doublereal*,
+    //!     doublereal*, size_t)
+    void update(size_t nStates, const doublereal* logT,
+                const doublereal* recipT, doublereal* values, size_t ld) {
+        for (size_t i = 0; i < m_rxn.size(); i++) {
+            doublereal A = m_A[i], b = m_b[i], E = m_E[i];
+            doublereal* v = values + m_rxn[i]*ld;
+            for (size_t j = 0; j < nStates; j++) {
+                v[j] = A * std::exp(b*logT[j] - E*recipT[j]);
+            }
+        }
+        for (size_t i = 0; i < m_const_rxn.size(); i++) {
+            std::fill(values + m_const_rxn[i]*ld,
+                      values + m_const_rxn[i]*ld + nStates, m_const_A[i]);
+        }
+    }
+
+    size_t nReactions() const {
+        return m_rxn.size() + m_const_rxn.size();
+    }
+
+protected:
+    //! Reaction numbers of the temperature-dependent rate coefficients
+    std::vector<size_t> m_rxn;
+    vector_fp m_A; //!< Pre-exponential factors
+    vector_fp m_b; //!< Temperature exponents
+    vector_fp m_E; //!< Activation temperatures [K]
+
+    //! Reaction numbers of the temperature-independent rate coefficients
+    std::vector<size_t> m_const_rxn;
+    vector_fp m_const_A; //!< Temperature-independent rate coefficients
+
+    vector_fp m_work; //!< Work array for the exponents
+};
+
 }
 
 #endif
@@ -355,6 +355,30 @@ public:
         }
 
         rDeltaP_ = 1.0 / (logP2_ - logP1_);
+
+        // Keep the cached rate constants consistent with the new
+        // interpolation pressures. recipT_ is NaN until updateTemp() has been
+        // called.
+        if (recipT_ > 0) {
+            evalLogK(logT_, recipT_, logk1_, logk2_);
+        }
+    }
+
+    //! Update the temperature-dependent parts of the rate coefficient.
+    /*!
+     *  The rate constants at the two reference pressures which bracket the
+     *  current pressure are computed and stored, so that subsequent calls to
+     *  updateRC() at the same temperature only need to interpolate in
+     *  pressure, even if the pressure has changed in the meantime.
+     */
+    void updateTemp(doublereal logT, doublereal recipT) {
+        logT_ = logT;
+        recipT_ = recipT;
+        // If the interpolation pressures have not been set yet, the cached
+        // values are computed by the first call to update_C().
+        if (m1_ != npos) {
+            evalLogK(logT, recipT, logk1_, logk2_);
+        }
     }
 
     /**
@@ -372,26 +396,12 @@ public:
      */
     doublereal updateRC(doublereal logT, doublereal recipT) const {
         double log_k1, log_k2;
-        if (m1_ == 1) {
-            log_k1 = A1_[0] + n1_[0] * logT - Ea1_[0] * recipT;
+        if (logT == logT_ && recipT == recipT_) {
+            log_k1 = logk1_;
+            log_k2 = logk2_;
         } else {
-            double k = 1e-300; // non-zero to make log(k) finite
-            for (size_t m = 0; m < m1_; m++) {
-                k += A1_[m] * std::exp(n1_[m] * logT - Ea1_[m] * recipT);
-            }
-            log_k1 = std::log(k);
+            evalLogK(logT, recipT, log_k1, log_k2);
         }
-
-        if (m2_ == 1) {
-            log_k2 = A2_[0] + n2_[0] * logT - Ea2_[0] * recipT;
-        } else {
-            double k = 1e-300; // non-zero to make log(k) finite
-            for (size_t m = 0; m < m2_; m++) {
-                k += A2_[m] * std::exp(n2_[m] * logT - Ea2_[m] * recipT);
-            }
-            log_k2 = std::log(k);
-        }
-
         return std::exp(log_k1 + (log_k2-log_k1) * (logP_-logP1_) * rDeltaP_);
     }
 
@@ -412,6 +422,31 @@ public:
     void validate(const std::string& equation);
 
 protected:
+    //! Compute the logarithms of the rate constants at the lower and upper
+    //! interpolation pressures
+    void evalLogK(doublereal logT, doublereal recipT,
+                  doublereal& log_k1, doublereal& log_k2) const {
+        if (m1_ == 1) {
+            log_k1 = A1_[0] + n1_[0] * logT - Ea1_[0] * recipT;
+        } else {
+            double k = 1e-300; // non-zero to make log(k) finite
+            for (size_t m = 0; m < m1_; m++) {
+                k += A1_[m] * std::exp(n1_[m] * logT - Ea1_[m] * recipT);
+            }
+            log_k1 = std::log(k);
+        }
+
+        if (m2_ == 1) {
+            log_k2 = A2_[0] + n2_[0] * logT - Ea2_[0] * recipT;
+        } else {
+            double k = 1e-300; // non-zero to make log(k) finite
+            for (size_t m = 0; m < m2_; m++) {
+                k += A2_[m] * std::exp(n2_[m] * logT - Ea2_[m] * recipT);
+            }
+            log_k2 = std::log(k);
+        }
+    }
+
     //! log(p) to (index range) in A_, n, Ea vectors
     std::map<double, std::pair<size_t, size_t> > pressures_;
     typedef std::map<double, std::pair<size_t, size_t> >::iterator pressureIter;
@@ -434,6 +469,12 @@ protected:
     double rDeltaP_; //!< reciprocal of (logP2 - logP1)
 
     size_t maxRates_; //!< The maximum number of rates at any given pressure
+
+    //! log(T) and 1/T at which #logk1_ and #logk2_ were last computed
+    double logT_, recipT_;
+
+    //! log(k) at the lower / upper pressure reference, evaluated at #logT_
+    double logk1_, logk2_;
 };
 
 
@@ -472,7 +513,10 @@ public:
         double Cn = Pr;
         double Cnp1;
         for (size_t j = 0; j < nT_; j++) {
-            dotProd_[j] = chebCoeffs_[nP_*j] + Pr * chebCoeffs_[nP_*j+1];
+            dotProd_[j] = chebCoeffs_[nP_*j];
+            if (nP_ > 1) {
+                dotProd_[j] += Pr * chebCoeffs_[nP_*j+1];
+            }
         }
         for (size_t i = 2; i < nP_; i++) {
             Cnp1 = 2 * Pr * Cn - Cnm1;
@@ -498,18 +542,48 @@ public:
      * This function returns the actual value of the rate constant.
      */
     doublereal updateRC(doublereal logT, doublereal recipT) const {
+        double logk;
+        if (recipT == recipT_) {
+            logk = dotProd_[0];
+            for (size_t i = 1; i < nT_; i++) {
+                logk += chebT_[i] * dotProd_[i];
+            }
+        } else {
+            double Tr = (2 * recipT + TrNum_) * TrDen_;
+            double Cnm1 = 1;
+            double Cn = Tr;
+            double Cnp1;
+            logk = dotProd_[0];
+            if (nT_ > 1) {
+                logk += Tr * dotProd_[1];
+            }
+            for (size_t i = 2; i < nT_; i++) {
+                Cnp1 = 2 * Tr * Cn - Cnm1;
+                logk += Cnp1 * dotProd_[i];
+                Cnm1 = Cn;
+                Cn = Cnp1;
+            }
+        }
+        return std::pow(10, logk);
+    }
+
+    //! Update the temperature-dependent parts of the rate coefficient.
+    /*!
+     *  The Chebyshev polynomials of the reduced temperature are stored, so
+     *  that subsequent calls to updateRC() at the same temperature only need
+     *  to evaluate their dot product with the pressure-dependent terms
+     *  computed by update_C().
+     */
+    void updateTemp(doublereal logT, doublereal recipT) {
+        recipT_ = recipT;
         double Tr = (2 * recipT + TrNum_) * TrDen_;
-        double Cnm1 = 1;
-        double Cn = Tr;
-        double Cnp1;
-        double logk = dotProd_[0] + Tr * dotProd_[1];
+        chebT_[0] = 1.0;
+        if (nT_ > 1) {
+            chebT_[1] = Tr;
+        }
         for (size_t i = 2; i < nT_; i++) {
-            Cnp1 = 2 * Tr * Cn - Cnm1;
-            logk += Cnp1 * dotProd_[i];
-            Cnm1 = Cn;
-            Cn = Cnp1;
+            chebT_[i] = 2 * Tr * chebT_[i-1] - chebT_[i-2];
         }
-        return std::pow(10, logk);
     }
 
     //! @deprecated. To be removed after Cantera 2.2
@@ -530,6 +604,9 @@ protected:
     size_t nT_; //!< number of points in the temperature direction
     vector_fp chebCoeffs_; //!< Chebyshev coefficients, length nP * nT
     vector_fp dotProd_; //!< dot product of chebCoeffs with the reduced pressure polynomial
+
+    double recipT_; //!< 1/T at which #chebT_ was last computed
+    vector_fp chebT_; //!< Chebyshev polynomials of the reduced temperature
 };
 
 }
@@ -9,6 +9,7 @@
 
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/ctexceptions.h"
+#include "cantera/base/smart_ptr.h"
 
 namespace Cantera
 {
@@ -119,6 +120,14 @@ namespace Cantera
  * products for a reaction separately. Bimolecular reactions involving the
  * identical species are treated as involving separate species.
  *
+ * Each of these operations also has a batched form, taking the number of
+ * states \a nStates as its first argument. In the batched form, the
+ * species and reaction arrays hold \a nStates values for each index in
+ * structure-of-arrays layout, i.e. the value for species \a k in state \a j
+ * is <tt>S[k*nStates + j]</tt>, and the value for reaction \a i in state
+ * \a j is <tt>R[i*nStates + j]</tt>. The innermost loop then runs over the
+ * states with unit stride, which allows the compiler to vectorize it.
+ *
  * @internal This class should be upgraded to include cases where
  * real stoichiometric coefficients are used. Shouldn't be that
  * hard to do, and they occur in engineering simulations with some
@@ -155,7 +164,7 @@ public:
         m_ic0(ic0) {
     }
 
-    size_t data(std::vector<size_t>& ic) {
+    size_t data(std::vector<size_t>& ic) const {
         ic.resize(1);
         ic[0] = m_ic0;
         return m_rxn;
@@ -173,6 +182,12 @@ public:
         R[m_rxn] *= S[m_ic0];
     }
 
+    //! Derivative of the concentration product with respect to the
+    //! concentration of the species returned by data()
+    void derivatives(const doublereal* S, doublereal* d) const {
+        d[0] = 1.0;
+    }
+
     void incrementReaction(const doublereal* S, doublereal* R) const {
         R[m_rxn] += S[m_ic0];
     }
@@ -181,6 +196,50 @@ public:
         R[m_rxn] -= S[m_ic0];
     }
 
+    void incrementSpecies(size_t nStates, const doublereal* R,
+                          doublereal* S) const {
+        const doublereal* r = R + m_rxn*nStates;
+        doublereal* s0 = S + m_ic0*nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            s0[j] += r[j];
+        }
+    }
+
+    void decrementSpecies(size_t nStates, const doublereal* R,
+                          doublereal* S) const {
+        const doublereal* r = R + m_rxn*nStates;
+        doublereal* s0 = S + m_ic0*nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            s0[j] -= r[j];
+        }
+    }
+
+    void multiply(size_t nStates, const doublereal* S, doublereal* R) const {
+        const doublereal* s0 = S + m_ic0*nStates;
+        doublereal* r = R + m_rxn*nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            r[j] *= s0[j];
+        }
+    }
+
+    void incrementReaction(size_t nStates, const doublereal* S,
+                           doublereal* R) const {
+        const doublereal* s0 = S + m_ic0*nStates;
+        doublereal* r = R + m_rxn*nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            r[j] += s0[j];
+        }
+    }
+
+    void decrementReaction(size_t nStates, const doublereal* S,
+                           doublereal* R) const {
+        const doublereal* s0 = S + m_ic0*nStates;
+        doublereal* r = R + m_rxn*nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            r[j] -= s0[j];
+        }
+    }
+
     size_t rxnNumber() const {
         return m_rxn;
     }
@@ -234,7 +293,7 @@ public:
     C2(size_t rxn = 0, size_t ic0 = 0, size_t ic1 = 0)
         : m_rxn(rxn), m_ic0(ic0), m_ic1(ic1) {}
 
-    size_t data(std::vector<size_t>& ic) {
+    size_t data(std::vector<size_t>& ic) const {
         ic.resize(2);
         ic[0] = m_ic0;
         ic[1] = m_ic1;
@@ -255,6 +314,13 @@ public:
         R[m_rxn] *= S[m_ic0] * S[m_ic1];
     }
 
+    //! Derivatives of the concentration product with respect to the
+    //! concentrations of the species returned by data()
+    void derivatives(const doublereal* S, doublereal* d) const {
+        d[0] = S[m_ic1];
+        d[1] = S[m_ic0];
+    }
+
     void incrementReaction(const doublereal* S, doublereal* R) const {
         R[m_rxn] += S[m_ic0] + S[m_ic1];
     }
@@ -263,6 +329,57 @@ public:
         R[m_rxn] -= (S[m_ic0] + S[m_ic1]);
     }
 
+    void incrementSpecies(size_t nStates, const doublereal* R,
+                          doublereal* S) const {
+        const doublereal* r = R + m_rxn*nStates;
+        doublereal* s0 = S + m_ic0*nStates;
+        doublereal* s1 = S + m_ic1*nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            s0[j] += r[j];
+            s1[j] += r[j];
+        }
+    }
+
+    void decrementSpecies(size_t nStates, const doublereal* R,
+                          doublereal* S) const {
+        const doublereal* r = R + m_rxn*nStates;
+        doublereal* s0 = S + m_ic0*nStates;
+        doublereal* s1 = S + m_ic1*nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            s0[j] -= r[j];
+            s1[j] -= r[j];
+        }
+    }
+
+    void multiply(size_t nStates, const doublereal* S, doublereal* R) const {
+        const doublereal* s0 = S + m_ic0*nStates;
+        const doublereal* s1 = S + m_ic1*nStates;
+        doublereal* r = R + m_rxn*nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            r[j] *= s0[j] * s1[j];
+        }
+    }
+
+    void incrementReaction(size_t nStates, const doublereal* S,
+                           doublereal* R) const {
+        const doublereal* s0 = S + m_ic0*nStates;
+        const doublereal* s1 = S + m_ic1*nStates;
+        doublereal* r = R + m_rxn*nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            r[j] += s0[j] + s1[j];
+        }
+    }
+
+    void decrementReaction(size_t nStates, const doublereal* S,
+                           doublereal* R) const {
+        const doublereal* s0 = S + m_ic0*nStates;
+        const doublereal* s1 = S + m_ic1*nStates;
+        doublereal* r = R + m_rxn*nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            r[j] -= (s0[j] + s1[j]);
+        }
+    }
+
     size_t rxnNumber() const {
         return m_rxn;
     }
@@ -321,7 +438,7 @@ public:
     C3(size_t rxn = 0, size_t ic0 = 0, size_t ic1 = 0, size_t ic2 = 0)
         : m_rxn(rxn), m_ic0(ic0), m_ic1(ic1), m_ic2(ic2) {}
 
-    size_t data(std::vector<size_t>& ic) {
+    size_t data(std::vector<size_t>& ic) const {
         ic.resize(3);
         ic[0] = m_ic0;
         ic[1] = m_ic1;
@@ -345,6 +462,14 @@ public:
         R[m_rxn] *= S[m_ic0] * S[m_ic1] * S[m_ic2];
     }
 
+    //! Derivatives of the concentration product with respect to the
+    //! concentrations of the species returned by data()
+    void derivatives(const doublereal* S, doublereal* d) const {
+        d[0] = S[m_ic1] * S[m_ic2];
+        d[1] = S[m_ic0] * S[m_ic2];
+        d[2] = S[m_ic0] * S[m_ic1];
+    }
+
     void incrementReaction(const doublereal* S, doublereal* R) const {
         R[m_rxn] += S[m_ic0] + S[m_ic1] + S[m_ic2];
     }
@@ -353,6 +478,64 @@ public:
         R[m_rxn] -= (S[m_ic0] + S[m_ic1] + S[m_ic2]);
     }
 
+    void incrementSpecies(size_t nStates, const doublereal* R,
+                          doublereal* S) const {
+        const doublereal* r = R + m_rxn*nStates;
+        doublereal* s0 = S + m_ic0*nStates;
+        doublereal* s1 = S + m_ic1*nStates;
+        doublereal* s2 = S + m_ic2*nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            s0[j] += r[j];
+            s1[j] += r[j];
+            s2[j] += r[j];
+        }
+    }
+
+    void decrementSpecies(size_t nStates, const doublereal* R,
+                          doublereal* S) const {
+        const doublereal* r = R + m_rxn*nStates;
+        doublereal* s0 = S + m_ic0*nStates;
+        doublereal* s1 = S + m_ic1*nStates;
+        doublereal* s2 = S + m_ic2*nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            s0[j] -= r[j];
+            s1[j] -= r[j];
+            s2[j] -= r[j];
+        }
+    }
+
+    void multiply(size_t nStates, const doublereal* S, doublereal* R) const {
+        const doublereal* s0 = S + m_ic0*nStates;
+        const doublereal* s1 = S + m_ic1*nStates;
+        const doublereal* s2 = S + m_ic2*nStates;
+        doublereal* r = R + m_rxn*nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            r[j] *= s0[j] * s1[j] * s2[j];
+        }
+    }
+
+    void incrementReaction(size_t nStates, const doublereal* S,
+                           doublereal* R) const {
+        const doublereal* s0 = S + m_ic0*nStates;
+        const doublereal* s1 = S + m_ic1*nStates;
+        const doublereal* s2 = S + m_ic2*nStates;
+        doublereal* r = R + m_rxn*nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            r[j] += s0[j] + s1[j] + s2[j];
+        }
+    }
+
+    void decrementReaction(size_t nStates, const doublereal* S,
+                           doublereal* R) const {
+        const doublereal* s0 = S + m_ic0*nStates;
+        const doublereal* s1 = S + m_ic1*nStates;
+        const doublereal* s2 = S + m_ic2*nStates;
+        doublereal* r = R + m_rxn*nStates;
+        for (size_t j = 0; j < nStates; j++) {
+            r[j] -= (s0[j] + s1[j] + s2[j]);
+        }
+    }
+
     size_t rxnNumber() const {
         return m_rxn;
     }
@@ -428,7 +611,7 @@ public:
         }
     }
 
-    size_t data(std::vector<size_t>& ic) {
+    size_t data(std::vector<size_t>& ic) const {
         ic.resize(m_n);
         for (size_t n = 0; n < m_n; n++) {
             ic[n] = m_ic[n];
@@ -445,6 +628,9 @@ public:
     size_t speciesIndex(size_t n) const {
         return m_ic[n];
     }
+    size_t nSpecies() const {
+        return m_n;
+    }
 
     void multiply(const doublereal* input, doublereal* output) const {
         doublereal oo;
@@ -456,6 +642,26 @@ public:
         }
     }
 
+    //! Derivatives of the concentration product with respect to the
+    //! concentrations of the species returned by data(). Species with zero
+    //! concentration and an order less than one are given a derivative of
+    //! zero.
+    void derivatives(const doublereal* S, doublereal* d) const {
+        for (size_t n = 0; n < m_n; n++) {
+            doublereal oo = m_order[n];
+            if (oo == 0.0) {
+                d[n] = 0.0;
+                continue;
+            }
+            d[n] = (oo == 1.0) ? 1.0 : oo * ppow(S[m_ic[n]], oo - 1.0);
+            for (size_t q = 0; q < m_n; q++) {
+                if (q != n && m_order[q] != 0.0) {
+                    d[n] *= ppow(S[m_ic[q]], m_order[q]);
+                }
+            }
+        }
+    }
+
     void incrementSpecies(const doublereal* input,
                           doublereal* output) const {
         doublereal x = input[m_rxn];
@@ -484,6 +690,68 @@ public:
             -= m_stoich[n]*input[m_ic[n]];
     }
 
+    void multiply(size_t nStates, const doublereal* input,
+                  doublereal* output) const {
+        doublereal* r = output + m_rxn*nStates;
+        for (size_t n = 0; n < m_n; n++) {
+            doublereal oo = m_order[n];
+            if (oo != 0.0) {
+                const doublereal* s = input + m_ic[n]*nStates;
+                for (size_t j = 0; j < nStates; j++) {
+                    r[j] *= ppow(s[j], oo);
+                }
+            }
+        }
+    }
+
+    void incrementSpecies(size_t nStates, const doublereal* input,
+                          doublereal* output) const {
+        const doublereal* r = input + m_rxn*nStates;
+        for (size_t n = 0; n < m_n; n++) {
+            doublereal* s = output + m_ic[n]*nStates;
+            doublereal nu = m_stoich[n];
+            for (size_t j = 0; j < nStates; j++) {
+                s[j] += nu*r[j];
+            }
+        }
+    }
+
+    void decrementSpecies(size_t nStates, const doublereal* input,
+                          doublereal* output) const {
+        const doublereal* r = input + m_rxn*nStates;
+        for (size_t n = 0; n < m_n; n++) {
+            doublereal* s = output + m_ic[n]*nStates;
+            doublereal nu = m_stoich[n];
+            for (size_t j = 0; j < nStates; j++) {
+                s[j] -= nu*r[j];
+            }
+        }
+    }
+
+    void incrementReaction(size_t nStates, const doublereal* input,
+                           doublereal* output) const {
+        doublereal* r = output + m_rxn*nStates;
+        for (size_t n = 0; n < m_n; n++) {
+            const doublereal* s = input + m_ic[n]*nStates;
+            doublereal nu = m_stoich[n];
+            for (size_t j = 0; j < nStates; j++) {
+                r[j] += nu*s[j];
+            }
+        }
+    }
+
+    void decrementReaction(size_t nStates, const doublereal* input,
+                           doublereal* output) const {
+        doublereal* r = output + m_rxn*nStates;
+        for (size_t n = 0; n < m_n; n++) {
+            const doublereal* s = input + m_ic[n]*nStates;
+            doublereal nu = m_stoich[n];
+            for (size_t j = 0; j < nStates; j++) {
+                r[j] -= nu*s[j];
+            }
+        }
+    }
+
     //! @deprecated To be removed after Cantera 2.2
     void writeMultiply(const std::string& r, std::map<size_t, std::string>& out) {
         out[m_rxn] = "";
@@ -616,6 +884,55 @@ inline static void _decrementReactions(InputIter begin,
     }
 }
 
+template<class InputIter, class Vec1, class Vec2>
+inline static void _multiply(InputIter begin, InputIter end, size_t nStates,
+                             const Vec1& input, Vec2& output)
+{
+    for (; begin != end; ++begin) {
+        begin->multiply(nStates, input, output);
+    }
+}
+
+template<class InputIter, class Vec1, class Vec2>
+inline static void _incrementSpecies(InputIter begin, InputIter end,
+                                     size_t nStates, const Vec1& input,
+                                     Vec2& output)
+{
+    for (; begin != end; ++begin) {
+        begin->incrementSpecies(nStates, input, output);
+    }
+}
+
+template<class InputIter, class Vec1, class Vec2>
+inline static void _decrementSpecies(InputIter begin, InputIter end,
+                                     size_t nStates, const Vec1& input,
+                                     Vec2& output)
+{
+    for (; begin != end; ++begin) {
+        begin->decrementSpecies(nStates, input, output);
+    }
+}
+
+template<class InputIter, class Vec1, class Vec2>
+inline static void _incrementReactions(InputIter begin, InputIter end,
+                                       size_t nStates, const Vec1& input,
+                                       Vec2& output)
+{
+    for (; begin != end; ++begin) {
+        begin->incrementReaction(nStates, input, output);
+    }
+}
+
+template<class InputIter, class Vec1, class Vec2>
+inline static void _decrementReactions(InputIter begin, InputIter end,
+                                       size_t nStates, const Vec1& input,
+                                       Vec2& output)
+{
+    for (; begin != end; ++begin) {
+        begin->decrementReaction(nStates, input, output);
+    }
+}
+
 //! @deprecated To be removed after Cantera 2.2
 template<class InputIter>
 inline static void _writeIncrementSpecies(InputIter begin, InputIter end,
@@ -722,7 +1039,8 @@ public:
      * DGG - the problem is that the number of reactions and species
      * are not known initially.
      */
-    StoichManagerN() {
+    StoichManagerN() :
+        m_data(new Data()) {
     }
 
     /**
@@ -763,6 +1081,8 @@ public:
      */
     void add(size_t rxn, const std::vector<size_t>& k, const vector_fp& order,
              const vector_fp& stoich) {
+        unshare();
+        m_data->sparse_ok = false;
         if (order.size() != k.size()) {
            throw CanteraError("StoichManagerN::add()", "size of order and species arrays differ");
         }
@@ -777,7 +1097,7 @@ public:
             }
         }
         if (frac || k.size() > 3) {
-            m_cn_list.push_back(C_AnyN(rxn, k, order, stoich));
+            m_data->cn_list.push_back(C_AnyN(rxn, k, order, stoich));
         } else {
             // Try to express the reaction with unity stoichiometric
             // coefficients (by repeating species when necessary) so that the
@@ -791,100 +1111,474 @@ public:
 
             switch (kRep.size()) {
             case 1:
-                m_c1_list.push_back(C1(rxn, kRep[0]));
+                m_data->c1_list.push_back(C1(rxn, kRep[0]));
                 break;
             case 2:
-                m_c2_list.push_back(C2(rxn, kRep[0], kRep[1]));
+                m_data->c2_list.push_back(C2(rxn, kRep[0], kRep[1]));
                 break;
             case 3:
-                m_c3_list.push_back(C3(rxn, kRep[0], kRep[1], kRep[2]));
+                m_data->c3_list.push_back(C3(rxn, kRep[0], kRep[1], kRep[2]));
                 break;
             default:
-                m_cn_list.push_back(C_AnyN(rxn, k, order, stoich));
+                m_data->cn_list.push_back(C_AnyN(rxn, k, order, stoich));
             }
         }
     }
 
     void multiply(const doublereal* input, doublereal* output) const {
-        _multiply(m_c1_list.begin(), m_c1_list.end(), input, output);
-        _multiply(m_c2_list.begin(), m_c2_list.end(), input, output);
-        _multiply(m_c3_list.begin(), m_c3_list.end(), input, output);
-        _multiply(m_cn_list.begin(), m_cn_list.end(), input, output);
+        if (m_data->sparse_ok) {
+            sparse_multiply(input, output);
+            return;
+        }
+        _multiply(m_data->c1_list.begin(), m_data->c1_list.end(), input, output);
+        _multiply(m_data->c2_list.begin(), m_data->c2_list.end(), input, output);
+        _multiply(m_data->c3_list.begin(), m_data->c3_list.end(), input, output);
+        _multiply(m_data->cn_list.begin(), m_data->cn_list.end(), input, output);
     }
 
     void incrementSpecies(const doublereal* input, doublereal* output) const {
-        _incrementSpecies(m_c1_list.begin(), m_c1_list.end(), input, output);
-        _incrementSpecies(m_c2_list.begin(), m_c2_list.end(), input, output);
-        _incrementSpecies(m_c3_list.begin(), m_c3_list.end(), input, output);
-        _incrementSpecies(m_cn_list.begin(), m_cn_list.end(), input, output);
+        if (m_data->sparse_ok) {
+            sparse_incrementSpecies(input, output);
+            return;
+        }
+        _incrementSpecies(m_data->c1_list.begin(), m_data->c1_list.end(), input, output);
+        _incrementSpecies(m_data->c2_list.begin(), m_data->c2_list.end(), input, output);
+        _incrementSpecies(m_data->c3_list.begin(), m_data->c3_list.end(), input, output);
+        _incrementSpecies(m_data->cn_list.begin(), m_data->cn_list.end(), input, output);
     }
 
     void decrementSpecies(const doublereal* input, doublereal* output) const {
-        _decrementSpecies(m_c1_list.begin(), m_c1_list.end(), input, output);
-        _decrementSpecies(m_c2_list.begin(), m_c2_list.end(), input, output);
-        _decrementSpecies(m_c3_list.begin(), m_c3_list.end(), input, output);
-        _decrementSpecies(m_cn_list.begin(), m_cn_list.end(), input, output);
+        if (m_data->sparse_ok) {
+            sparse_decrementSpecies(input, output);
+            return;
+        }
+        _decrementSpecies(m_data->c1_list.begin(), m_data->c1_list.end(), input, output);
+        _decrementSpecies(m_data->c2_list.begin(), m_data->c2_list.end(), input, output);
+        _decrementSpecies(m_data->c3_list.begin(), m_data->c3_list.end(), input, output);
+        _decrementSpecies(m_data->cn_list.begin(), m_data->cn_list.end(), input, output);
     }
 
     void incrementReactions(const doublereal* input, doublereal* output) const {
-        _incrementReactions(m_c1_list.begin(), m_c1_list.end(), input, output);
-        _incrementReactions(m_c2_list.begin(), m_c2_list.end(), input, output);
-        _incrementReactions(m_c3_list.begin(), m_c3_list.end(), input, output);
-        _incrementReactions(m_cn_list.begin(), m_cn_list.end(), input, output);
+        if (m_data->sparse_ok) {
+            sparse_incrementReactions(input, output);
+            return;
+        }
+        _incrementReactions(m_data->c1_list.begin(), m_data->c1_list.end(), input, output);
+        _incrementReactions(m_data->c2_list.begin(), m_data->c2_list.end(), input, output);
+        _incrementReactions(m_data->c3_list.begin(), m_data->c3_list.end(), input, output);
+        _incrementReactions(m_data->cn_list.begin(), m_data->cn_list.end(), input, output);
     }
 
     void decrementReactions(const doublereal* input, doublereal* output) const {
-        _decrementReactions(m_c1_list.begin(), m_c1_list.end(), input, output);
-        _decrementReactions(m_c2_list.begin(), m_c2_list.end(), input, output);
-        _decrementReactions(m_c3_list.begin(), m_c3_list.end(), input, output);
-        _decrementReactions(m_cn_list.begin(), m_cn_list.end(), input, output);
+        if (m_data->sparse_ok) {
+            sparse_decrementReactions(input, output);
+            return;
+        }
+        _decrementReactions(m_data->c1_list.begin(), m_data->c1_list.end(), input, output);
+        _decrementReactions(m_data->c2_list.begin(), m_data->c2_list.end(), input, output);
+        _decrementReactions(m_data->c3_list.begin(), m_data->c3_list.end(), input, output);
+        _decrementReactions(m_data->cn_list.begin(), m_data->cn_list.end(), input, output);
+    }
+
+    //! Get the reaction and species indices of the entries computed by
+    //! getDerivatives(). Entry `n` is the derivative of the concentration
+    //! product of reaction `rxn[n]` with respect to the concentration of
+    //! species `sp[n]`. A species may appear more than once for the same
+    //! reaction, in which case the entries should be summed.
+    void getDerivativeEntries(std::vector<size_t>& rxn,
+                              std::vector<size_t>& sp) const {
+        rxn.clear();
+        sp.clear();
+        std::vector<size_t> ic;
+        for (size_t i = 0; i < m_data->c1_list.size(); i++) {
+            rxn.push_back(m_data->c1_list[i].data(ic));
+            sp.push_back(ic[0]);
+        }
+        for (size_t i = 0; i < m_data->c2_list.size(); i++) {
+            size_t ir = m_data->c2_list[i].data(ic);
+            for (size_t n = 0; n < 2; n++) {
+                rxn.push_back(ir);
+                sp.push_back(ic[n]);
+            }
+        }
+        for (size_t i = 0; i < m_data->c3_list.size(); i++) {
+            size_t ir = m_data->c3_list[i].data(ic);
+            for (size_t n = 0; n < 3; n++) {
+                rxn.push_back(ir);
+                sp.push_back(ic[n]);
+            }
+        }
+        for (size_t i = 0; i < m_data->cn_list.size(); i++) {
+            size_t ir = m_data->cn_list[i].data(ic);
+            for (size_t n = 0; n < ic.size(); n++) {
+                rxn.push_back(ir);
+                sp.push_back(ic[n]);
+            }
+        }
+    }
+
+    //! Compute the derivatives of the concentration products (as computed
+    //! by multiply()) with respect to the species concentrations `S`. The
+    //! meaning of each entry of `d` is given by getDerivativeEntries().
+    void getDerivatives(const doublereal* S, doublereal* d) const {
+        for (size_t i = 0; i < m_data->c1_list.size(); i++) {
+            m_data->c1_list[i].derivatives(S, d++);
+        }
+        for (size_t i = 0; i < m_data->c2_list.size(); i++) {
+            m_data->c2_list[i].derivatives(S, d);
+            d += 2;
+        }
+        for (size_t i = 0; i < m_data->c3_list.size(); i++) {
+            m_data->c3_list[i].derivatives(S, d);
+            d += 3;
+        }
+        for (size_t i = 0; i < m_data->cn_list.size(); i++) {
+            m_data->cn_list[i].derivatives(S, d);
+            d += m_data->cn_list[i].nSpecies();
+        }
+    }
+
+    //! Select whether the compressed sparse representation of the
+    //! stoichiometric coefficients is used instead of the per-reaction
+    //! C1, C2, C3 and C_AnyN objects. If `sparse` is true, the compressed
+    //! matrices are built immediately from the reactions added so far, and
+    //! are rebuilt by finalize() after further reactions are added. Until
+    //! then, the per-reaction objects are used.
+    void setSparse(bool sparse) {
+        unshare();
+        m_data->sparse = sparse;
+        m_data->sparse_ok = false;
+        finalize();
+    }
+
+    //! True if the compressed sparse representation has been selected.
+    bool sparse() const {
+        return m_data->sparse;
+    }
+
+    //! Build the compressed sparse representation of the stoichiometric
+    //! coefficients if it has been selected and is out of date. Called by the
+    //! kinetics manager once all reactions have been added.
+    void finalize() {
+        if (!m_data->sparse || m_data->sparse_ok) {
+            return;
+        }
+        unshare();
+        // Collect (reaction, species, stoich, order) entries. Entries from
+        // C1, C2 and C3 objects are unit-order factors; entries from C_AnyN
+        // objects keep their (possibly non-integral) orders so that the
+        // results are the same as those of C_AnyN::multiply.
+        std::vector<size_t> rxn, sp, unit;
+        vector_fp nu, order;
+        std::vector<size_t> ic;
+        size_t nRxn = 0, nSp = 0;
+        for (size_t i = 0; i < m_data->c1_list.size(); i++) {
+            size_t ir = m_data->c1_list[i].data(ic);
+            addSparseEntries(ir, ic, rxn, sp, nu, order, unit);
+        }
+        for (size_t i = 0; i < m_data->c2_list.size(); i++) {
+            size_t ir = m_data->c2_list[i].data(ic);
+            addSparseEntries(ir, ic, rxn, sp, nu, order, unit);
+        }
+        for (size_t i = 0; i < m_data->c3_list.size(); i++) {
+            size_t ir = m_data->c3_list[i].data(ic);
+            addSparseEntries(ir, ic, rxn, sp, nu, order, unit);
+        }
+        for (size_t i = 0; i < m_data->cn_list.size(); i++) {
+            size_t ir = m_data->cn_list[i].data(ic);
+            for (size_t n = 0; n < ic.size(); n++) {
+                rxn.push_back(ir);
+                sp.push_back(ic[n]);
+                nu.push_back(m_data->cn_list[i].stoich(n));
+                order.push_back(m_data->cn_list[i].order(n));
+                unit.push_back(0);
+            }
+        }
+        for (size_t n = 0; n < rxn.size(); n++) {
+            nRxn = std::max(nRxn, rxn[n] + 1);
+            nSp = std::max(nSp, sp[n] + 1);
+        }
+
+        // Count the entries in each row / column
+        m_data->rxn_ptr.assign(nRxn + 1, 0);
+        m_data->mult_ptr.assign(nRxn + 1, 0);
+        m_data->pow_ptr.assign(nRxn + 1, 0);
+        m_data->sp_ptr.assign(nSp + 1, 0);
+        for (size_t n = 0; n < rxn.size(); n++) {
+            m_data->rxn_ptr[rxn[n] + 1]++;
+            m_data->sp_ptr[sp[n] + 1]++;
+            if (unit[n]) {
+                m_data->mult_ptr[rxn[n] + 1]++;
+            } else {
+                m_data->pow_ptr[rxn[n] + 1]++;
+            }
+        }
+        for (size_t i = 0; i < nRxn; i++) {
+            m_data->rxn_ptr[i+1] += m_data->rxn_ptr[i];
+            m_data->mult_ptr[i+1] += m_data->mult_ptr[i];
+            m_data->pow_ptr[i+1] += m_data->pow_ptr[i];
+        }
+        for (size_t k = 0; k < nSp; k++) {
+            m_data->sp_ptr[k+1] += m_data->sp_ptr[k];
+        }
+
+        // Fill the rows / columns, preserving the order in which the entries
+        // were added within each row.
+        m_data->rxn_idx.resize(rxn.size());
+        m_data->rxn_coeff.resize(rxn.size());
+        m_data->sp_idx.resize(rxn.size());
+        m_data->sp_coeff.resize(rxn.size());
+        m_data->mult_idx.resize(m_data->mult_ptr[nRxn]);
+        m_data->pow_idx.resize(m_data->pow_ptr[nRxn]);
+        m_data->pow_order.resize(m_data->pow_ptr[nRxn]);
+        std::vector<size_t> rpos(m_data->rxn_ptr.begin(), m_data->rxn_ptr.end() - 1);
+        std::vector<size_t> mpos(m_data->mult_ptr.begin(), m_data->mult_ptr.end() - 1);
+        std::vector<size_t> ppos(m_data->pow_ptr.begin(), m_data->pow_ptr.end() - 1);
+        std::vector<size_t> spos(m_data->sp_ptr.begin(), m_data->sp_ptr.end() - 1);
+        for (size_t n = 0; n < rxn.size(); n++) {
+            size_t i = rxn[n], k = sp[n];
+            m_data->rxn_idx[rpos[i]] = k;
+            m_data->rxn_coeff[rpos[i]++] = nu[n];
+            m_data->sp_idx[spos[k]] = i;
+            m_data->sp_coeff[spos[k]++] = nu[n];
+            if (unit[n]) {
+                m_data->mult_idx[mpos[i]++] = k;
+            } else {
+                m_data->pow_idx[ppos[i]] = k;
+                m_data->pow_order[ppos[i]++] = order[n];
+            }
+        }
+        m_data->sparse_ok = true;
+    }
+
+    //! @name Batched operations
+    //! Versions of the above methods operating on \a nStates states at once.
+    //! The input and output arrays are in structure-of-arrays layout; see
+    //! @ref Stoichiometry.
+    //! @{
+
+    void multiply(size_t nStates, const doublereal* input,
+                  doublereal* output) const {
+        _multiply(m_data->c1_list.begin(), m_data->c1_list.end(), nStates, input, output);
+        _multiply(m_data->c2_list.begin(), m_data->c2_list.end(), nStates, input, output);
+        _multiply(m_data->c3_list.begin(), m_data->c3_list.end(), nStates, input, output);
+        _multiply(m_data->cn_list.begin(), m_data->cn_list.end(), nStates, input, output);
     }
 
+    void incrementSpecies(size_t nStates, const doublereal* input,
+                          doublereal* output) const {
+        _incrementSpecies(m_data->c1_list.begin(), m_data->c1_list.end(), nStates, input, output);
+        _incrementSpecies(m_data->c2_list.begin(), m_data->c2_list.end(), nStates, input, output);
+        _incrementSpecies(m_data->c3_list.begin(), m_data->c3_list.end(), nStates, input, output);
+        _incrementSpecies(m_data->cn_list.begin(), m_data->cn_list.end(), nStates, input, output);
+    }
+
+    void decrementSpecies(size_t nStates, const doublereal* input,
+                          doublereal* output) const {
+        _decrementSpecies(m_data->c1_list.begin(), m_data->c1_list.end(), nStates, input, output);
+        _decrementSpecies(m_data->c2_list.begin(), m_data->c2_list.end(), nStates, input, output);
+        _decrementSpecies(m_data->c3_list.begin(), m_data->c3_list.end(), nStates, input, output);
+        _decrementSpecies(m_data->cn_list.begin(), m_data->cn_list.end(), nStates, input, output);
+    }
+
+    void incrementReactions(size_t nStates, const doublereal* input,
+                            doublereal* output) const {
+        _incrementReactions(m_data->c1_list.begin(), m_data->c1_list.end(), nStates, input, output);
+        _incrementReactions(m_data->c2_list.begin(), m_data->c2_list.end(), nStates, input, output);
+        _incrementReactions(m_data->c3_list.begin(), m_data->c3_list.end(), nStates, input, output);
+        _incrementReactions(m_data->cn_list.begin(), m_data->cn_list.end(), nStates, input, output);
+    }
+
+    void decrementReactions(size_t nStates, const doublereal* input,
+                            doublereal* output) const {
+        _decrementReactions(m_data->c1_list.begin(), m_data->c1_list.end(), nStates, input, output);
+        _decrementReactions(m_data->c2_list.begin(), m_data->c2_list.end(), nStates, input, output);
+        _decrementReactions(m_data->c3_list.begin(), m_data->c3_list.end(), nStates, input, output);
+        _decrementReactions(m_data->cn_list.begin(), m_data->cn_list.end(), nStates, input, output);
+    }
+    //! @}
+
     //! @deprecated To be removed after Cantera 2.2
     void writeIncrementSpecies(const std::string& r, std::map<size_t, std::string>& out) {
-        _writeIncrementSpecies(m_c1_list.begin(), m_c1_list.end(), r, out);
-        _writeIncrementSpecies(m_c2_list.begin(), m_c2_list.end(), r, out);
-        _writeIncrementSpecies(m_c3_list.begin(), m_c3_list.end(), r, out);
-        _writeIncrementSpecies(m_cn_list.begin(), m_cn_list.end(), r, out);
+        _writeIncrementSpecies(m_data->c1_list.begin(), m_data->c1_list.end(), r, out);
+        _writeIncrementSpecies(m_data->c2_list.begin(), m_data->c2_list.end(), r, out);
+        _writeIncrementSpecies(m_data->c3_list.begin(), m_data->c3_list.end(), r, out);
+        _writeIncrementSpecies(m_data->cn_list.begin(), m_data->cn_list.end(), r, out);
     }
 
     //! @deprecated To be removed after Cantera 2.2
     void writeDecrementSpecies(const std::string& r, std::map<size_t, std::string>& out) {
-        _writeDecrementSpecies(m_c1_list.begin(), m_c1_list.end(), r, out);
-        _writeDecrementSpecies(m_c2_list.begin(), m_c2_list.end(), r, out);
-        _writeDecrementSpecies(m_c3_list.begin(), m_c3_list.end(), r, out);
-        _writeDecrementSpecies(m_cn_list.begin(), m_cn_list.end(), r, out);
+        _writeDecrementSpecies(m_data->c1_list.begin(), m_data->c1_list.end(), r, out);
+        _writeDecrementSpecies(m_data->c2_list.begin(), m_data->c2_list.end(), r, out);
+        _writeDecrementSpecies(m_data->c3_list.begin(), m_data->c3_list.end(), r, out);
+        _writeDecrementSpecies(m_data->cn_list.begin(), m_data->cn_list.end(), r, out);
     }
 
     //! @deprecated To be removed after Cantera 2.2
     void writeIncrementReaction(const std::string& r, std::map<size_t, std::string>& out) {
-        _writeIncrementReaction(m_c1_list.begin(), m_c1_list.end(), r, out);
-        _writeIncrementReaction(m_c2_list.begin(), m_c2_list.end(), r, out);
-        _writeIncrementReaction(m_c3_list.begin(), m_c3_list.end(), r, out);
-        _writeIncrementReaction(m_cn_list.begin(), m_cn_list.end(), r, out);
+        _writeIncrementReaction(m_data->c1_list.begin(), m_data->c1_list.end(), r, out);
+        _writeIncrementReaction(m_data->c2_list.begin(), m_data->c2_list.end(), r, out);
+        _writeIncrementReaction(m_data->c3_list.begin(), m_data->c3_list.end(), r, out);
+        _writeIncrementReaction(m_data->cn_list.begin(), m_data->cn_list.end(), r, out);
     }
 
     //! @deprecated To be removed after Cantera 2.2
     void writeDecrementReaction(const std::string& r, std::map<size_t, std::string>& out) {
-        _writeDecrementReaction(m_c1_list.begin(), m_c1_list.end(), r, out);
-        _writeDecrementReaction(m_c2_list.begin(), m_c2_list.end(), r, out);
-        _writeDecrementReaction(m_c3_list.begin(), m_c3_list.end(), r, out);
-        _writeDecrementReaction(m_cn_list.begin(), m_cn_list.end(), r, out);
+        _writeDecrementReaction(m_data->c1_list.begin(), m_data->c1_list.end(), r, out);
+        _writeDecrementReaction(m_data->c2_list.begin(), m_data->c2_list.end(), r, out);
+        _writeDecrementReaction(m_data->c3_list.begin(), m_data->c3_list.end(), r, out);
+        _writeDecrementReaction(m_data->cn_list.begin(), m_data->cn_list.end(), r, out);
     }
 
     //! @deprecated To be removed after Cantera 2.2
     void writeMultiply(const std::string& r, std::map<size_t, std::string>& out) {
-        _writeMultiply(m_c1_list.begin(), m_c1_list.end(), r, out);
-        _writeMultiply(m_c2_list.begin(), m_c2_list.end(), r, out);
-        _writeMultiply(m_c3_list.begin(), m_c3_list.end(), r, out);
-        _writeMultiply(m_cn_list.begin(), m_cn_list.end(), r, out);
+        _writeMultiply(m_data->c1_list.begin(), m_data->c1_list.end(), r, out);
+        _writeMultiply(m_data->c2_list.begin(), m_data->c2_list.end(), r, out);
+        _writeMultiply(m_data->c3_list.begin(), m_data->c3_list.end(), r, out);
+        _writeMultiply(m_data->cn_list.begin(), m_data->cn_list.end(), r, out);
     }
 
 private:
-    std::vector<C1>     m_c1_list;
-    std::vector<C2>     m_c2_list;
-    std::vector<C3>     m_c3_list;
-    std::vector<C_AnyN> m_cn_list;
+    static void addSparseEntries(size_t ir, const std::vector<size_t>& ic,
+                                 std::vector<size_t>& rxn,
+                                 std::vector<size_t>& sp, vector_fp& nu,
+                                 vector_fp& order, std::vector<size_t>& unit) {
+        for (size_t n = 0; n < ic.size(); n++) {
+            rxn.push_back(ir);
+            sp.push_back(ic[n]);
+            nu.push_back(1.0);
+            order.push_back(1.0);
+            unit.push_back(1);
+        }
+    }
+
+    //! Fused kernel multiplying each reaction's entry in R by its
+    //! concentration product, using the reaction-major (CSR) order matrix
+    void sparse_multiply(const doublereal* S, doublereal* R) const {
+        size_t nRxn = m_data->mult_ptr.size() - 1;
+        for (size_t i = 0; i < nRxn; i++) {
+            size_t p = m_data->mult_ptr[i];
+            size_t pend = m_data->mult_ptr[i+1];
+            if (p != pend) {
+                doublereal prod = S[m_data->mult_idx[p]];
+                for (++p; p < pend; p++) {
+                    prod *= S[m_data->mult_idx[p]];
+                }
+                R[i] *= prod;
+            }
+            for (p = m_data->pow_ptr[i]; p < m_data->pow_ptr[i+1]; p++) {
+                if (m_data->pow_order[p] != 0.0) {
+                    R[i] *= ppow(S[m_data->pow_idx[p]], m_data->pow_order[p]);
+                }
+            }
+        }
+    }
+
+    //! Accumulate the rates of progress R into the species rates S, using
+    //! the species-major (CSC) stoichiometric matrix, so that each species
+    //! entry is written only once.
+    void sparse_incrementSpecies(const doublereal* R, doublereal* S) const {
+        size_t nSp = m_data->sp_ptr.size() - 1;
+        for (size_t k = 0; k < nSp; k++) {
+            doublereal sum = 0.0;
+            for (size_t p = m_data->sp_ptr[k]; p < m_data->sp_ptr[k+1]; p++) {
+                sum += m_data->sp_coeff[p] * R[m_data->sp_idx[p]];
+            }
+            S[k] += sum;
+        }
+    }
+
+    void sparse_decrementSpecies(const doublereal* R, doublereal* S) const {
+        size_t nSp = m_data->sp_ptr.size() - 1;
+        for (size_t k = 0; k < nSp; k++) {
+            doublereal sum = 0.0;
+            for (size_t p = m_data->sp_ptr[k]; p < m_data->sp_ptr[k+1]; p++) {
+                sum += m_data->sp_coeff[p] * R[m_data->sp_idx[p]];
+            }
+            S[k] -= sum;
+        }
+    }
+
+    void sparse_incrementReactions(const doublereal* S, doublereal* R) const {
+        size_t nRxn = m_data->rxn_ptr.size() - 1;
+        for (size_t i = 0; i < nRxn; i++) {
+            size_t p = m_data->rxn_ptr[i];
+            if (p != m_data->rxn_ptr[i+1]) {
+                doublereal sum = 0.0;
+                for (; p < m_data->rxn_ptr[i+1]; p++) {
+                    sum += m_data->rxn_coeff[p] * S[m_data->rxn_idx[p]];
+                }
+                R[i] += sum;
+            }
+        }
+    }
+
+    void sparse_decrementReactions(const doublereal* S, doublereal* R) const {
+        size_t nRxn = m_data->rxn_ptr.size() - 1;
+        for (size_t i = 0; i < nRxn; i++) {
+            size_t p = m_data->rxn_ptr[i];
+            if (p != m_data->rxn_ptr[i+1]) {
+                doublereal sum = 0.0;
+                for (; p < m_data->rxn_ptr[i+1]; p++) {
+                    sum += m_data->rxn_coeff[p] * S[m_data->rxn_idx[p]];
+                }
+                R[i] -= sum;
+            }
+        }
+    }
+
+    //! Copy the stoichiometric data if it is shared with another
+    //! StoichManagerN, so that it can be modified.
+    void unshare() {
+        if (m_data.use_count() != 1) {
+            m_data.reset(new Data(*m_data));
+        }
+    }
+
+    //! The stoichiometric data. This data does not change once all
+    //! reactions have been added, so copies of a StoichManagerN (made when
+    //! kinetics managers are duplicated) share it. Methods which modify it
+    //! call unshare() first.
+    struct Data {
+        Data() : sparse(false), sparse_ok(false) {}
+
+        std::vector<C1>     c1_list;
+        std::vector<C2>     c2_list;
+        std::vector<C3>     c3_list;
+        std::vector<C_AnyN> cn_list;
+
+        //! True if the compressed sparse representation has been selected
+        bool sparse;
+
+        //! True if the compressed sparse representation is up to date
+        bool sparse_ok;
+
+        //! @name Compressed sparse representation
+        //! Arrays named `*_ptr` hold the offsets of the start of each row, with
+        //! one extra entry at the end.
+        //! @{
+
+        //! Reaction-major stoichiometric coefficients: species indices and
+        //! coefficients for each reaction
+        std::vector<size_t> rxn_ptr, rxn_idx;
+        vector_fp rxn_coeff;
+
+        //! Species-major stoichiometric coefficients: reaction indices and
+        //! coefficients for each species
+        std::vector<size_t> sp_ptr, sp_idx;
+        vector_fp sp_coeff;
+
+        //! Species indices of the unit-order concentration factors for each
+        //! reaction. Species with a stoichiometric coefficient of 2 are repeated.
+        std::vector<size_t> mult_ptr, mult_idx;
+
+        //! Species indices and orders of the general power-law concentration
+        //! factors for each reaction
+        std::vector<size_t> pow_ptr, pow_idx;
+        vector_fp pow_order;
+        //! @}
+    };
+    shared_ptr<Data> m_data;
 };
 
 }
@@ -46,10 +46,66 @@ public:
                      output, m_reaction_index.begin());
     }
 
+    //! Batched version of update() for `nStates` states. The concentration
+    //! of species `k` in state `j` is `conc[k*nStates + j]`, and the
+    //! effective third-body concentration for the `i`-th installed reaction
+    //! is written to `work[i*nStates + j]`.
+    void update(size_t nStates, const double* conc, const double* ctot,
+                double* work) {
+        for (size_t i = 0; i < m_species.size(); i++) {
+            double* w = work + i*nStates;
+            std::fill(w, w + nStates, 0.0);
+            for (size_t n = 0; n < m_species[i].size(); n++) {
+                const double* c = conc + m_species[i][n]*nStates;
+                double eff = m_eff[i][n];
+                for (size_t j = 0; j < nStates; j++) {
+                    w[j] += eff * c[j];
+                }
+            }
+            double dflt = m_default[i];
+            for (size_t j = 0; j < nStates; j++) {
+                w[j] = dflt * ctot[j] + w[j];
+            }
+        }
+    }
+
+    //! Batched version of multiply(), using the same layout as the batched
+    //! version of update() for `output` (indexed by reaction) and `work`.
+    void multiply(size_t nStates, double* output, const double* work) {
+        for (size_t i = 0; i < m_reaction_index.size(); i++) {
+            double* out = output + m_reaction_index[i]*nStates;
+            const double* w = work + i*nStates;
+            for (size_t j = 0; j < nStates; j++) {
+                out[j] *= w[j];
+            }
+        }
+    }
+
     size_t workSize() {
         return m_reaction_index.size();
     }
 
+    //! Index (as given to install()) of the i-th installed reaction
+    size_t reactionIndex(size_t i) const {
+        return m_reaction_index[i];
+    }
+
+    //! Default third-body efficiency of the i-th installed reaction
+    double defaultEfficiency(size_t i) const {
+        return m_default[i];
+    }
+
+    //! Species with non-default efficiencies in the i-th installed reaction
+    const std::vector<size_t>& species(size_t i) const {
+        return m_species[i];
+    }
+
+    //! Efficiencies of the species returned by species(), relative to the
+    //! default efficiency
+    const vector_fp& relativeEfficiencies(size_t i) const {
+        return m_eff[i];
+    }
+
 protected:
     //! Indices of third-body reactions within the full reaction array
     std::vector<size_t> m_reaction_index;
@@ -8,6 +8,7 @@
 #define CT_FUNCEVAL_H
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/base/ctexceptions.h"
 
 namespace Cantera
 {
@@ -48,6 +49,35 @@ public:
     virtual size_t nparams() {
         return 0;
     }
+
+    //! Prepare a preconditioner for the iteration matrix
+    //! \f$ I - \gamma J \f$, where \f$ J = \partial F / \partial y \f$.
+    //! Called by integrators using a preconditioned Krylov linear solver.
+    /*!
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[in] gamma scalar multiplying the Jacobian
+     * @param[in] jok if true, a previously evaluated Jacobian may be reused
+     *     and only the iteration matrix needs to be formed again.
+     * @returns true if the Jacobian was evaluated again.
+     */
+    virtual bool preconditionerSetup(double t, double* y, double gamma,
+                                     bool jok) {
+        throw NotImplementedError("FuncEval::preconditionerSetup");
+    }
+
+    //! Solve \f$ P z = r \f$, where \f$ P \f$ is the preconditioner
+    //! computed by the most recent call to preconditionerSetup().
+    /*!
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[in] r right hand side, length neq()
+     * @param[out] z solution, length neq()
+     */
+    virtual void preconditionerSolve(double t, double* y, double* r,
+                                     double* z) {
+        throw NotImplementedError("FuncEval::preconditionerSolve");
+    }
 };
 
 }
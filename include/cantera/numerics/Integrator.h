@@ -23,6 +23,10 @@ const int NOJAC = 4;
 const int JAC   = 8;
 const int GMRES =16;
 const int BAND  =32;
+const int BICGSTAB = 64;
+//! Flag combined with GMRES or BICGSTAB to use the preconditioner provided
+//! by FuncEval::preconditionerSetup and FuncEval::preconditionerSolve
+const int PRECON = 128;
 
 /**
  * Specifies the method used to integrate the system of equations.
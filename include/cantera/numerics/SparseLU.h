@@ -0,0 +1,87 @@
+/**
+ *  @file SparseLU.h
+ *   Declarations for the class SparseLU, which computes and applies the LU
+ *   factorization of a sparse matrix.
+ */
+
+#ifndef CT_SPARSELU_H
+#define CT_SPARSELU_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+//! LU factorization of a sparse square matrix, without pivoting.
+/*!
+ *  The matrix is given in coordinate (triplet) form. The first call to
+ *  factor() computes the sparsity pattern of the factors, including fill-in,
+ *  and subsequent calls with the same pattern reuse it, so that refactoring
+ *  a matrix with new values only repeats the numerical factorization.
+ *
+ *  No pivoting is done, so this class is intended for matrices that are
+ *  known to have nonzero pivots, such as the diagonally dominant iteration
+ *  matrices \f$ I - \gamma J \f$ used to precondition implicit ODE
+ *  integrators.
+ *
+ *  @ingroup numerics
+ */
+class SparseLU
+{
+public:
+    SparseLU();
+
+    //! Compute the LU factorization of the `n` by `n` matrix whose nonzero
+    //! entries are `values[i]` at row `rows[i]` and column `cols[i]`.
+    //! Duplicate entries are summed. Every diagonal entry must be included
+    //! in the pattern.
+    /*!
+     *  @returns 0 on success, or `i+1` if a zero pivot was encountered in
+     *      row `i`.
+     */
+    int factor(size_t n, const std::vector<size_t>& rows,
+               const std::vector<size_t>& cols, const vector_fp& values);
+
+    //! Solve \f$ LU x = b \f$ in place using the most recent factorization.
+    //! @param[in,out] b  On entry, the right hand side; on return, the
+    //!     solution. Length n.
+    void solve(doublereal* b) const;
+
+    //! Number of nonzero entries in the combined L and U factors
+    size_t nnz() const {
+        return m_col.size();
+    }
+
+    //! Size of the factored matrix
+    size_t size() const {
+        return m_n;
+    }
+
+protected:
+    //! Compute the sparsity pattern of the factors
+    void analyze(size_t n, const std::vector<size_t>& rows,
+                 const std::vector<size_t>& cols);
+
+    size_t m_n;
+
+    //! Pattern of the matrix for which analyze() was last called
+    std::vector<size_t> m_rows, m_cols;
+
+    //! Position of each input entry in the factors
+    std::vector<size_t> m_pos;
+
+    //! Combined L and U factors in compressed sparse row format, with sorted
+    //! column indices. L has a unit diagonal which is not stored.
+    std::vector<size_t> m_rowStart, m_col;
+    vector_fp m_lu;
+
+    //! Position of the diagonal entry of each row
+    std::vector<size_t> m_diag;
+
+    //! Work array mapping column indices to positions in the current row
+    std::vector<size_t> m_work;
+};
+
+}
+
+#endif
@@ -536,6 +536,17 @@ protected:
 
 private:
     vector_fp m_ybar;
+
+    //! Temperatures, mean molecular weights and mole fractions at the
+    //! midpoints between grid points, used to evaluate transport properties.
+    //! The mole fractions are stored species-major for the range of points
+    //! being updated.
+    vector_fp m_tmid, m_wtmid, m_xmid;
+
+    //! Species-major diffusion coefficients returned by the transport
+    //! manager, before they are copied into m_diff, m_multidiff and
+    //! m_dthermal
+    vector_fp m_transwork;
 };
 
 /**
@@ -136,6 +136,15 @@ private:
 
     void clear(); //<! Delete owned SpeciesThermoInterpType objects.
 
+    //! Copy the coefficients of all NASA-7 species into #m_nasa_low and
+    //! #m_nasa_high
+    void packNasaCoeffs() const;
+
+    //! Evaluate the properties of all NASA-7 species, using the packed
+    //! coefficient arrays
+    void updateNasa(const doublereal* tt, doublereal* cp_R, doublereal* h_RT,
+                    doublereal* s_R) const;
+
 protected:
     typedef std::map<int, std::vector<SpeciesThermoInterpType*> > STIT_map;
     typedef std::map<int, std::vector<double> > tpoly_map;
@@ -161,6 +170,34 @@ protected:
     //! reference pressure (Pa)
     doublereal m_p0;
 
+    //! @name Packed NASA-7 coefficients
+    //! The properties of species using NasaPoly2 (the most common case by
+    //! far) are evaluated together in update(), using copies of their
+    //! coefficients stored in coefficient-major order, so that each term of
+    //! the polynomials is computed for all species in a single loop which the
+    //! compiler can vectorize. The arrays are rebuilt on demand after species
+    //! are installed or modified.
+    //! @{
+
+    //! True if the packed arrays are consistent with the NasaPoly2 objects
+    mutable bool m_nasa_ok;
+
+    //! Species index for each NASA-7 species, in the order of
+    //! `m_sp[NASA2]`
+    mutable std::vector<size_t> m_nasa_index;
+
+    //! Midpoint temperature for each NASA-7 species
+    mutable vector_fp m_nasa_tmid;
+
+    //! Coefficient `j` of the low / high temperature polynomial of the NASA-7
+    //! species `i` is stored at `[j*n + i]`, where `n` is the number of NASA-7
+    //! species.
+    mutable vector_fp m_nasa_low, m_nasa_high;
+
+    //! Work arrays holding cp_R, h_RT, and s_R of each NASA-7 species
+    mutable vector_fp m_nasa_cp, m_nasa_h, m_nasa_s;
+    //! @}
+
     //! Make the class VPSSMgr a friend because we need to access
     //! the function provideSTIT()
     friend class VPSSMgr;
@@ -2709,6 +2709,54 @@ private:
      */
     mutable vector_int m_CounterIJ;
 
+    //! A binary interaction between the solute species i and j, with i < j
+    struct PitzerPair {
+        size_t i;
+        size_t j;
+        //! Index into the binary interaction arrays
+        size_t counterIJ;
+        //! True if any of the beta2 coefficients are nonzero
+        bool hasBeta2;
+    };
+
+    //! A ternary interaction. For psi terms, i < j have the same sign
+    //! and k has the opposite sign. For zeta terms, i is the neutral species,
+    //! j is the cation and k is the anion.
+    struct PitzerTriplet {
+        size_t i;
+        size_t j;
+        size_t k;
+        //! Index into m_Psi_ijk
+        size_t n;
+    };
+
+    //! Cation-anion pairs with nonzero binary salt parameters
+    std::vector<PitzerPair> m_CationAnionPairs;
+
+    //! Like-charged pairs of ions with a nonzero theta parameter, or with
+    //! different charge magnitudes so that E-theta is nonzero
+    std::vector<PitzerPair> m_LikeChargePairs;
+
+    //! Ternary ion interactions with nonzero psi parameters
+    std::vector<PitzerTriplet> m_PsiTriplets;
+
+    //! Neutral-cation-anion interactions with nonzero zeta parameters
+    std::vector<PitzerTriplet> m_ZetaTriplets;
+
+    //! Neutral solute species with nonzero lambda or mu parameters
+    std::vector<size_t> m_NeutralSolutes;
+
+    //! All indices into m_Psi_ijk having a nonzero coefficient, including
+    //! the permuted duplicates of the psi entries
+    std::vector<size_t> m_PsiIndices;
+
+    //! Molar charge of the solution ("Z" in Pitzer's notation), computed
+    //! from the cropped molalities
+    mutable double m_molarCharge;
+
+    //! Sum of the cropped molalities of the solutes
+    mutable double m_molalitySumCropped;
+
     //! This is elambda, MEC
     mutable double elambda[17];
 
@@ -3142,6 +3190,45 @@ private:
      */
     void counterIJ_setup() const;
 
+    //! Set up the lists of the binary and ternary interactions which have
+    //! nonzero Pitzer parameters.
+    /*!
+     * This is called once all of the interaction parameters have been read
+     * in. The activity coefficient routines then only visit the entries in
+     * these lists, rather than looping over all pairs and triplets of
+     * solute species.
+     */
+    void interactionLists_setup();
+
+    //! Sum the binary, ternary and neutral species contributions to the
+    //! log of the activity coefficients, or to one of their derivatives
+    /*!
+     * The same sums make up the activity coefficients and their temperature
+     * and pressure derivatives, so this routine is shared between
+     * s_updatePitzer_lnMolalityActCoeff() and the derivative routines. All
+     * of the arrays passed in are either the Pitzer intermediate quantities
+     * or their derivatives of the same order.
+     *
+     * @param dF      The F term (Pitzer, Eqn. (65)), or its derivative
+     * @param BMX     BMX for the cation-anion pairs (index is counterIJ)
+     * @param CMX     CMX for the cation-anion pairs (index is counterIJ)
+     * @param BphiMX  BphiMX for the cation-anion pairs (index is counterIJ)
+     * @param Phi     Phi for the like-charged pairs (index is counterIJ)
+     * @param Phiphi  Phiphi for the like-charged pairs (index is counterIJ)
+     * @param psi     Ternary psi and zeta parameters
+     * @param lambda  Neutral species interaction parameters
+     * @param mu      Neutral species self-interaction parameters
+     * @param lnac    Output vector of length m_kk. The solute entries are
+     *                overwritten with the sums. The solvent entry is unchanged.
+     * @returns the interaction sum appearing in the osmotic coefficient
+     *          (Pitzer, Eqn. (62)), excluding the Debye-Huckel term.
+     */
+    double s_updatePitzer_interactionSums(double dF, const double* BMX,
+                                          const double* CMX, const double* BphiMX,
+                                          const double* Phi, const double* Phiphi,
+                                          const double* psi, const Array2D& lambda,
+                                          const vector_fp& mu, double* lnac) const;
+
     //! Calculate the cropped molalities
     /*!
      * This is an internal routine that calculates values
@@ -418,6 +418,23 @@ public:
      */
     virtual doublereal cv_mole() const;
 
+    //! Evaluate properties for a batch of states. See
+    //! ThermoPhase::getPropertiesBatch.
+    /*!
+     *  For an ideal gas, the properties of each state depend only on the
+     *  temperature, pressure, and composition, so they are evaluated directly
+     *  from the species reference state functions without setting the state
+     *  of the phase. The reference state functions are only re-evaluated
+     *  when the temperature differs from that of the previous state, so
+     *  ordering the states by temperature (e.g. grouping states with the
+     *  same temperature) reduces the cost.
+     */
+    virtual void getPropertiesBatch(size_t nStates, const doublereal* T,
+                                    const doublereal* P, const doublereal* Y,
+                                    doublereal* rho, doublereal* mmw,
+                                    doublereal* cp, doublereal* h,
+                                    doublereal* s, doublereal* h_RT);
+
     /**
      * @returns species translational/rotational specific heat at
      * constant volume.  Inferred from the species gas
@@ -850,6 +867,55 @@ public:
 
     //@}
 
+    //! @name Setting the State from the Enthalpy or Internal Energy
+    //!
+    //! For an ideal gas, the specific enthalpy and internal energy depend
+    //! only on the temperature and composition, so the temperature can be
+    //! found by a one-dimensional Newton iteration which uses the analytic
+    //! derivative of the species thermo parameterizations (the heat
+    //! capacity). Each iteration evaluates only the species reference state
+    //! functions. The iteration starts from the current temperature of the
+    //! phase (or the given initial temperatures for the batch methods), so
+    //! only one or two iterations are usually needed when the state changes
+    //! by a small amount. If a Newton step would leave the interval known to
+    //! contain the solution, a bisection step is taken instead.
+    //@{
+
+    //! Set the specific enthalpy (J/kg) and pressure (Pa) of the phase. See
+    //! ThermoPhase::setState_HP.
+    virtual void setState_HP(doublereal h, doublereal p, doublereal tol = 1.e-4);
+
+    //! Set the specific internal energy (J/kg) and specific volume (m^3/kg)
+    //! of the phase. See ThermoPhase::setState_UV.
+    virtual void setState_UV(doublereal u, doublereal v, doublereal tol = 1.e-4);
+
+    //! Compute the temperatures of many states from their specific
+    //! enthalpies and compositions, without changing the state of the phase.
+    /*!
+     *  @param nStates  Number of states
+     *  @param h        Specific enthalpy of each state [J/kg].
+     *                  Length: nStates.
+     *  @param Y        Species mass fractions, with the value for species
+     *                  \a k in state \a j at index `k*nStates + j`.
+     *                  Length: m_kk * nStates.
+     *  @param T        On entry, the initial estimate of the temperature of
+     *                  each state [K] (e.g. the temperature at the previous
+     *                  time step); on return, the solution. Length: nStates.
+     *  @param tol      Convergence tolerance for the temperature [K]
+     */
+    void getTemperatureBatch_HP(size_t nStates, const doublereal* h,
+                                const doublereal* Y, doublereal* T,
+                                doublereal tol = 1.e-4) const;
+
+    //! Compute the temperatures of many states from their specific internal
+    //! energies and compositions, without changing the state of the phase.
+    //! The arguments are the same as for getTemperatureBatch_HP(), with the
+    //! specific internal energies [J/kg] given in `u`.
+    void getTemperatureBatch_UV(size_t nStates, const doublereal* u,
+                                const doublereal* Y, doublereal* T,
+                                doublereal tol = 1.e-4) const;
+    //@}
+
     //! Initialize the ThermoPhase object after all species have been set up
     /*!
      * @internal Initialize.
@@ -924,6 +990,30 @@ private:
      *  (or equivalent) call is made.
      */
     void _updateThermo() const;
+
+    //! Find the temperature at which the specific enthalpy (or internal
+    //! energy, if `doUV` is true) of a mixture is equal to `e`.
+    /*!
+     *  @param e     Target specific enthalpy or internal energy [J/kg]
+     *  @param ym    Mass fraction divided by molecular weight for each
+     *               species [kmol/kg]
+     *  @param T     Initial estimate of the temperature [K]
+     *  @param doUV  True to solve for the internal energy
+     *  @param tol   Convergence tolerance for the temperature [K]
+     *  @param cp_R, h_RT, s_R  Work arrays of length m_kk. On return, they
+     *               hold the species reference state properties at the
+     *               last temperature evaluated during the iteration.
+     */
+    doublereal solveTemperature(doublereal e, const doublereal* ym,
+                                doublereal T, bool doUV, doublereal tol,
+                                doublereal* cp_R, doublereal* h_RT,
+                                doublereal* s_R) const;
+
+    //! Implementation of getTemperatureBatch_HP() and
+    //! getTemperatureBatch_UV()
+    void getTemperatureBatch(size_t nStates, const doublereal* e,
+                             const doublereal* Y, doublereal* T,
+                             bool doUV, doublereal tol) const;
 };
 }
 
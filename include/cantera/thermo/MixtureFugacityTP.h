@@ -780,6 +780,85 @@ protected:
 
     virtual void updateMixingExpressions();
 
+    //! Solve a cubic equation of state for the molar volume
+    /*!
+     *  Finds the real roots of
+     *
+     *     an V**3 + bn V**2 + cn V + dn = 0
+     *
+     *  using the closed-form solution of Nichols, followed by a few Newton
+     *  iterations to remove the roundoff error. If there is only one real
+     *  root and a guess for it is supplied, e.g. the molar volume at the
+     *  previous state, the root is found by Newton iteration starting from
+     *  the guess instead, which is cheaper than evaluating the closed-form
+     *  solution. Since the root is unique, the result is the same.
+     *
+     * @param TKelvin  temperature in kelvin. Only used for classifying the roots.
+     * @param pres     pressure (Pa). Only used in messages.
+     * @param an, bn, cn, dn  Coefficients of the cubic polynomial
+     * @param tc       critical temperature of the mixture (K)
+     * @param vc       critical molar volume of the mixture (m3/kmol)
+     * @param Vroot    On return, the roots in increasing order. Only the first
+     *                 abs(return value) entries are set.
+     * @param Vguess   Guess for the root, or -1.0 if there is none.
+     *
+     * @return  The number of real roots found. If there is only one root and
+     *          it is on the liquid branch, -1 is returned instead of 1.
+     *          If there are two roots and the double root is on the gas
+     *          branch, -2 is returned instead of 2.
+     */
+    int solveCubic(doublereal TKelvin, doublereal pres, doublereal an,
+                   doublereal bn, doublereal cn, doublereal dn, doublereal tc,
+                   doublereal vc, doublereal Vroot[3],
+                   doublereal Vguess=-1.0) const;
+
+    //! Evaluate the fugacity coefficients and their derivatives for a cubic
+    //! equation of state
+    /*!
+     *  The equation of state has the form
+     *  \f[
+     *      P = \frac{RT}{V - b} - \frac{A(T)}{(V + \delta_1 b)(V + \delta_2 b)}
+     *  \f]
+     *  with the mixing rules \f$ b = \sum_k X_k b_k \f$ and
+     *  \f$ A = \sum_i \sum_j X_i X_j A_{ij} \f$, which covers both the
+     *  Redlich-Kwong (\f$ \delta_1 = 1, \delta_2 = 0 \f$) and the
+     *  Peng-Robinson (\f$ \delta_{1,2} = 1 \pm \sqrt{2} \f$) equations of
+     *  state. All quantities are evaluated analytically from the derivatives
+     *  of the reduced residual Helmholtz energy (Michelsen and Mollerup,
+     *  "Thermodynamic Models: Fundamentals & Computational Aspects", 2007),
+     *  at the current temperature, pressure, molar volume and mole
+     *  fractions. Any of the output arrays may be null if the corresponding
+     *  quantity is not needed.
+     *
+     *  @param delta1, delta2  Parameters of the equation of state
+     *  @param b        Mixture value of b (m3/kmol)
+     *  @param A        Mixture value of A (Pa m6/kmol2)
+     *  @param dAdT     Temperature derivative of A
+     *  @param bk       Values of \f$ b_k \f$. Length m_kk.
+     *  @param Ak       Values of \f$ \sum_j X_j A_{kj} \f$. Length m_kk.
+     *  @param dAkdT    Temperature derivatives of `Ak`. Only needed if
+     *                  `dlnPhidT` is requested.
+     *  @param Akm      Matrix of the \f$ A_{km} \f$, with \f$ A_{km} \f$ at
+     *                  index `k*m_kk+m`. Only needed if `dlnPhidlnN` is
+     *                  requested.
+     *  @param[out] lnPhi  Log of the species fugacity coefficients
+     *  @param[out] vbar   Partial molar volumes (m3/kmol)
+     *  @param[out] dlnPhidT  Derivatives of `lnPhi` with respect to
+     *                  temperature at constant pressure and composition
+     *  @param ld       Leading dimension of `dlnPhidlnN`
+     *  @param[out] dlnPhidlnN  Derivatives of `lnPhi` for species `k` with
+     *                  respect to the log of the mole number of species `m`
+     *                  at constant temperature and pressure, stored at
+     *                  index `ld*m+k`.
+     */
+    void cubicFugacityCoeffs(doublereal delta1, doublereal delta2,
+                             doublereal b, doublereal A, doublereal dAdT,
+                             const doublereal* bk, const doublereal* Ak,
+                             const doublereal* dAkdT, const doublereal* Akm,
+                             doublereal* lnPhi, doublereal* vbar,
+                             doublereal* dlnPhidT, size_t ld,
+                             doublereal* dlnPhidlnN) const;
+
     //@}
 
     class spinodalFunc : public Cantera::ResidEval
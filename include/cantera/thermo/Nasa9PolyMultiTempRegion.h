@@ -161,6 +161,11 @@ public:
      */
     virtual void modifyParameters(doublereal* coeffs);
 
+    //! Lower temperature bound [K] of each temperature region
+    const vector_fp& lowerTempBounds() const {
+        return m_lowerTempBounds;
+    }
+
 protected:
     //! Number of temperature regions
     size_t m_numTempRegions;
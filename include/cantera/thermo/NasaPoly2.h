@@ -196,6 +196,22 @@ public:
         }
     }
 
+    //! Midpoint temperature [K] separating the low- and high-temperature
+    //! regions
+    doublereal midTemp() const {
+        return m_midT;
+    }
+
+    //! Report the coefficients of the low- and high-temperature polynomials,
+    //! each as a0, ..., a4, a5, a6 (7 elements).
+    void reportPolyCoeffs(doublereal* const low, doublereal* const high) const {
+        size_t n;
+        int type;
+        doublereal tlow, thigh, pref;
+        mnp_low.reportParameters(n, type, tlow, thigh, pref, low);
+        mnp_high.reportParameters(n, type, tlow, thigh, pref, high);
+    }
+
     doublereal reportHf298(doublereal* const h298 = 0) const {
         double h;
         if (298.15 <= m_midT) {
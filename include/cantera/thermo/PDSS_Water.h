@@ -209,6 +209,11 @@ public:
     virtual doublereal satPressure(doublereal t);
 
     //! Get a pointer to a changeable WaterPropsIAPWS object
+    /*!
+     * The density solves at each new state can be started from a table
+     * built with WaterPropsIAPWS::buildDensityTable(), e.g.
+     * `getWater()->buildDensityTable(273.16, 650.0, 1.0e3, 1.0e8)`.
+     */
     WaterPropsIAPWS* getWater() {
         return &m_sub;
     }
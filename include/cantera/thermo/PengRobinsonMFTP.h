@@ -0,0 +1,363 @@
+/**
+ *  @file PengRobinsonMFTP.h
+ * Definition file for a derived class of ThermoPhase that implements the
+ * Peng-Robinson cubic equation of state for a mixture (see \ref thermoprops
+ * and class \link Cantera::PengRobinsonMFTP PengRobinsonMFTP\endlink).
+ */
+
+#ifndef CT_PENGROBINSONMFTP_H
+#define CT_PENGROBINSONMFTP_H
+
+#include "MixtureFugacityTP.h"
+
+namespace Cantera
+{
+/**
+ * @ingroup thermoprops
+ *
+ * Implementation of a mixture of species obeying the Peng-Robinson
+ * equation of state,
+ *
+ * \f[
+ *    P = \frac{RT}{v - b_{mix}} - \frac{a_{mix}(T)}{v^2 + 2 b_{mix} v - b_{mix}^2}
+ * \f]
+ *
+ * with the mixing rules
+ *
+ * \f[
+ *    a_{mix} = \sum_i \sum_j X_i X_j a_{ij} \alpha_i^{1/2} \alpha_j^{1/2}
+ *    \qquad b_{mix} = \sum_i X_i b_i
+ * \f]
+ *
+ * where \f$ \alpha_i = \left[1 + \kappa_i (1 - \sqrt{T/T_{c,i}})\right]^2 \f$
+ * and \f$ \kappa_i \f$ is a function of the acentric factor of species
+ * \f$ i \f$. The critical temperature of each species is computed from its
+ * \f$ a \f$ and \f$ b \f$ parameters. By default, the cross terms are
+ * \f$ a_{ij} = \sqrt{a_i a_j} \f$.
+ *
+ * The phase is described in the input file by a thermo block with model
+ * "PengRobinson" or "PengRobinsonMFTP":
+ *
+ * @code
+ * <thermo model="PengRobinson">
+ *   <activityCoefficients>
+ *     <pureFluidParameters species="CO2">
+ *       <a_coeff units="Pa-m6/kmol2" model="constant"> 3.96e5 </a_coeff>
+ *       <b_coeff units="m3/kmol"> 0.02667 </b_coeff>
+ *       <acentric_factor> 0.2239 </acentric_factor>
+ *     </pureFluidParameters>
+ *     <crossFluidParameters species1="CO2" species2="H2O">
+ *       <a_coeff units="Pa-m6/kmol2" model="constant"> 4.4e5 </a_coeff>
+ *     </crossFluidParameters>
+ *   </activityCoefficients>
+ * </thermo>
+ * @endcode
+ *
+ * The volume root, the fugacity coefficients and their derivatives are
+ * evaluated by the functions shared with the other cubic equations of state
+ * in MixtureFugacityTP (see MixtureFugacityTP::solveCubic() and
+ * MixtureFugacityTP::cubicFugacityCoeffs()). The sums over the composition
+ * which enter into the mixing rules are only recomputed when the composition
+ * changes.
+ */
+class PengRobinsonMFTP : public MixtureFugacityTP
+{
+public:
+    //! @name Constructors and Duplicators
+    //! @{
+
+    //! Base constructor.
+    PengRobinsonMFTP();
+
+    //! Construct and initialize a PengRobinsonMFTP object directly from an
+    //! ASCII input file
+    /*!
+     * @param infile    Name of the input file containing the phase XML data
+     *                  to set up the object
+     * @param id        ID of the phase in the input file. Defaults to the empty string.
+     */
+    PengRobinsonMFTP(const std::string& infile, std::string id="");
+
+    //! Construct and initialize a PengRobinsonMFTP object directly from an
+    //! XML database
+    /*!
+     *  @param phaseRef XML phase node containing the description of the phase
+     *  @param id       id attribute containing the name of the phase.  (default is the empty string)
+     */
+    PengRobinsonMFTP(XML_Node& phaseRef, const std::string& id = "");
+
+    //! Copy Constructor
+    /*!
+     * @param right Object to be copied.
+     */
+    PengRobinsonMFTP(const PengRobinsonMFTP& right);
+
+    //! Assignment operator
+    /*!
+     * @param right Object to be copied.
+     */
+    PengRobinsonMFTP& operator=(const PengRobinsonMFTP& right);
+
+    virtual ThermoPhase* duplMyselfAsThermoPhase() const;
+
+    virtual int eosType() const;
+
+    //! @}
+    //! @name Molar Thermodynamic properties
+    //! @{
+
+    /// Molar enthalpy. Units: J/kmol.
+    virtual doublereal enthalpy_mole() const;
+
+    /// Molar entropy. Units: J/kmol/K.
+    virtual doublereal entropy_mole() const;
+
+    /// Molar heat capacity at constant pressure. Units: J/kmol/K.
+    virtual doublereal cp_mole() const;
+
+    /// Molar heat capacity at constant volume. Units: J/kmol/K.
+    virtual doublereal cv_mole() const;
+
+    //! @}
+    //! @name Mechanical Properties
+    //! @{
+
+    //! Return the thermodynamic pressure (Pa).
+    virtual doublereal pressure() const;
+
+    //! @}
+
+protected:
+    //! Calculate the density of the mixture using the partial molar volumes
+    //! and mole fractions as input
+    virtual void calcDensity();
+
+    virtual void setTemperature(const doublereal temp);
+    virtual void setMassFractions(const doublereal* const y);
+    virtual void setMassFractions_NoNorm(const doublereal* const y);
+    virtual void setMoleFractions(const doublereal* const x);
+    virtual void setMoleFractions_NoNorm(const doublereal* const x);
+    virtual void setConcentrations(const doublereal* const c);
+
+public:
+    //! @name Activities, Standard States, and Activity Concentrations
+    //! @{
+
+    virtual void getActivityConcentrations(doublereal* c) const;
+    virtual doublereal standardConcentration(size_t k=0) const;
+    virtual void getUnitsStandardConc(double* uA, int k = 0, int sizeUA = 6) const;
+
+    //! Get the array of non-dimensional activity coefficients at the current
+    //! solution temperature, pressure, and solution concentration. These are
+    //! the fugacity coefficients of the species.
+    /*!
+     * @param ac Output vector of activity coefficients. Length: m_kk.
+     */
+    virtual void getActivityCoefficients(doublereal* ac) const;
+
+    //! Get the temperature derivatives of the logarithms of the activity
+    //! coefficients at constant pressure and composition
+    /*!
+     * @param dlnActCoeffdT  Output vector of derivatives. Length: m_kk.
+     *                       Units: 1/K.
+     */
+    virtual void getdlnActCoeffdT(doublereal* dlnActCoeffdT) const;
+
+    //! Get the derivatives of the logarithms of the activity coefficients
+    //! with respect to the logarithms of the species mole numbers, at
+    //! constant temperature and pressure
+    /*!
+     * @param ld               Leading dimension of the output matrix
+     * @param dlnActCoeffdlnN  Output matrix. The derivative for species `k`
+     *                         with respect to the moles of species `m` is
+     *                         stored at `dlnActCoeffdlnN[ld*m + k]`.
+     */
+    virtual void getdlnActCoeffdlnN(const size_t ld, doublereal* const dlnActCoeffdlnN);
+
+    //! @}
+    //! @name  Partial Molar Properties of the Solution
+    //! @{
+
+    virtual void getChemPotentials_RT(doublereal* mu) const;
+    virtual void getChemPotentials(doublereal* mu) const;
+    virtual void getPartialMolarEnthalpies(doublereal* hbar) const;
+    virtual void getPartialMolarEntropies(doublereal* sbar) const;
+    virtual void getPartialMolarIntEnergies(doublereal* ubar) const;
+
+    //! Returns an array of partial molar heat capacities for the species in
+    //! the mixture. The reference state values are returned.
+    virtual void getPartialMolarCp(doublereal* cpbar) const;
+
+    virtual void getPartialMolarVolumes(doublereal* vbar) const;
+
+    //! @}
+    //! @name Critical State Properties.
+    //!
+    //! These are the pseudo-critical properties of the mixture, evaluated
+    //! from the mixture a and b parameters. For a pure species they are the
+    //! critical properties of the species.
+    //! @{
+
+    virtual doublereal critTemperature() const;
+    virtual doublereal critPressure() const;
+    virtual doublereal critVolume() const;
+    virtual doublereal critCompressibility() const;
+    virtual doublereal critDensity() const;
+
+    //! @}
+    //! @name Initialization Methods - For Internal use
+    //! @{
+
+    virtual void setParametersFromXML(const XML_Node& thermoNode);
+    virtual void initThermo();
+    void setToEquilState(const doublereal* lambda_RT);
+    virtual void initThermoXML(XML_Node& phaseNode, const std::string& id);
+
+    //! @}
+
+private:
+    //! Read the pure species Peng-Robinson input parameters
+    /*!
+     *  @param pureFluidParam   XML_Node for the pure fluid parameters
+     */
+    void readXMLPureFluid(XML_Node& pureFluidParam);
+
+    //! Read the cross species Peng-Robinson input parameters
+    /*!
+     *  @param crossFluidParam   XML_Node for the cross fluid parameters
+     */
+    void readXMLCrossFluid(XML_Node& crossFluidParam);
+
+    //!  @internal Initialize the internal lengths in this object.
+    void initLengths();
+
+protected:
+    virtual doublereal sresid() const;
+    virtual doublereal hresid() const;
+
+public:
+    //! Estimate for the molar volume of the liquid
+    /*!
+     *  @param TKelvin  temperature in kelvin
+     *  @param pres     Pressure in Pa. If the routine needs to change the
+     *                  pressure to find a stable liquid state, the new
+     *                  pressure is returned in this variable.
+     *  @return Returns the estimate of the liquid volume.
+     */
+    virtual doublereal liquidVolEst(doublereal TKelvin, doublereal& pres) const;
+
+    //! Calculates the density given the temperature and the pressure and a
+    //! guess at the density. See RedlichKwongMFTP::densityCalc().
+    virtual doublereal densityCalc(doublereal TKelvin, doublereal pressure, int phase, doublereal rhoguess);
+
+    virtual doublereal densSpinodalLiquid() const;
+    virtual doublereal densSpinodalGas() const;
+
+    virtual doublereal pressureCalc(doublereal TKelvin, doublereal molarVol) const;
+    virtual doublereal dpdVCalc(doublereal TKelvin, doublereal molarVol, doublereal& presCalc) const;
+
+    //! Calculate dpdV and dpdT at the current conditions
+    void pressureDerivatives() const;
+
+    virtual void updateMixingExpressions();
+
+    //! Update the a and b parameters and their temperature derivatives for
+    //! the current temperature and composition
+    void updateAB();
+
+    //! Calculate the a and the b parameters at the temperature `temp` and
+    //! the current composition. Doesn't change the state of the object.
+    void calculateAB(doublereal temp, doublereal& aCalc, doublereal& bCalc) const;
+
+    //! Solve the cubic equation of state for the molar volume
+    /*!
+     * @param TKelvin  Temperature (K)
+     * @param pres     Pressure (Pa)
+     * @param a        a parameter of the mixture at TKelvin
+     * @param b        b parameter of the mixture
+     * @param Vroot    Output roots, in increasing order
+     * @param Vguess   Guess for the molar volume (negative if none)
+     * @return the number of roots, as for MixtureFugacityTP::solveCubic()
+     */
+    int solveEOS(doublereal TKelvin, doublereal pres, doublereal a, doublereal b,
+                 doublereal Vroot[3], doublereal Vguess=-1.0) const;
+
+private:
+    //! Compute the fugacity coefficients and their derivatives at the
+    //! current state. See MixtureFugacityTP::cubicFugacityCoeffs().
+    void fugacityCoeffs(doublereal* lnPhi, doublereal* vbar,
+                        doublereal* dlnPhidT, size_t ld,
+                        doublereal* dlnPhidlnN) const;
+
+    //! Pseudo-critical pressure, temperature and molar volume of the mixture
+    //! at the current composition
+    void pseudoCritical(doublereal& pc, doublereal& tc, doublereal& vc) const;
+
+protected:
+    //! Pure species and cross term a parameters, \f$ a_{ij} \f$ =
+    //! `m_aij[i*m_kk + j]`. Units: Pa m^6 / kmol^2.
+    vector_fp m_aij;
+
+    //! Pure species b parameters. Units: m^3 / kmol.
+    vector_fp b_vec_Curr_;
+
+    //! Species acentric factors
+    vector_fp m_acentric;
+
+    //! Species \f$ \kappa_i \f$ parameters
+    vector_fp m_kappa;
+
+    //! Species critical temperatures computed from a and b
+    vector_fp m_tc_Species;
+
+    //! Coefficients of \f$ \alpha_i^{1/2} = c_i - d_i T^{1/2} \f$
+    vector_fp m_alphaC, m_alphaD;
+
+    //! Value of b for the current composition
+    doublereal m_b_current;
+
+    //! Value of a for the current state, and its first and second
+    //! temperature derivatives
+    doublereal m_a_current, m_dadt_current, m_d2adt2_current;
+
+    //! Value of \f$ \sum_i \sum_j X_i X_j a_{ij} \f$ for the current
+    //! composition
+    doublereal m_aMix0;
+
+    //! Sums \f$ \sum_j X_j a_{kj} c_j \f$ and \f$ \sum_j X_j a_{kj} d_j \f$
+    //! for the current composition
+    vector_fp m_u0, m_u1;
+
+    //! \f$ A_k = \sum_j X_j a_{kj} \alpha_k^{1/2} \alpha_j^{1/2} \f$ and its
+    //! temperature derivative at the current state
+    vector_fp m_aSum, m_dadtSum;
+
+    int NSolns_;
+
+    doublereal Vroot_[3];
+
+    //! Temporary storage - length = m_kk.
+    mutable vector_fp m_pp;
+
+    //! Temporary storage - length = m_kk.
+    mutable vector_fp m_tmpV;
+
+    //! The derivative of the pressure wrt the volume
+    mutable doublereal dpdV_;
+
+    //! The derivative of the pressure wrt the temperature
+    mutable doublereal dpdT_;
+
+public:
+    //! Omega constant for a
+    static const doublereal omega_a;
+
+    //! Omega constant for b
+    static const doublereal omega_b;
+
+    //! Critical compressibility factor
+    static const doublereal omega_vc;
+};
+}
+
+#endif
@@ -117,7 +117,8 @@ public:
      *  This function now stores the complete XML_Node tree as read into the code
      *  via a file. This is needed to move around within the XML tree during
      *  construction of transport and kinetics mechanisms after copy
-     *  construction operations.
+     *  construction operations. The stored tree is not modified afterwards,
+     *  so it is shared by all copies of this phase rather than duplicated.
      *
      *  @param xmlPhase Reference to the XML node corresponding to the phase
      */
@@ -851,6 +852,10 @@ protected:
 private:
     XML_Node* m_xml; //!< XML node containing the XML info for this phase
 
+    //! Root of the XML tree containing #m_xml. Shared with copies of this
+    //! phase.
+    shared_ptr<XML_Node> m_xmlRoot;
+
     //! ID of the phase. This is the value of the ID attribute of the XML
     //! phase node. The field will stay that way even if the name is changed.
     std::string m_id;
@@ -357,6 +357,29 @@ public:
      */
     virtual void getPartialMolarVolumes(doublereal* vbar) const;
 
+    //! Get the temperature derivatives of the logarithms of the activity
+    //! coefficients (fugacity coefficients) at constant pressure and
+    //! composition
+    /*!
+     * @param dlnActCoeffdT  Output vector of derivatives. Length: m_kk.
+     *                       Units: 1/K.
+     */
+    virtual void getdlnActCoeffdT(doublereal* dlnActCoeffdT) const;
+
+    //! Get the derivatives of the logarithms of the activity coefficients
+    //! with respect to the logarithms of the species mole numbers, at
+    //! constant temperature and pressure
+    /*!
+     * The derivatives are evaluated analytically from the residual Helmholtz
+     * energy of the equation of state.
+     *
+     * @param ld               Leading dimension of the output matrix
+     * @param dlnActCoeffdlnN  Output matrix. The derivative for species `k`
+     *                         with respect to the moles of species `m` is
+     *                         stored at `dlnActCoeffdlnN[ld*m + k]`.
+     */
+    virtual void getdlnActCoeffdlnN(const size_t ld, doublereal* const dlnActCoeffdlnN);
+
     //@}
     /// @name Critical State Properties.
     /// These methods are only implemented by some subclasses, and may
@@ -601,7 +624,8 @@ public:
     //!  Calculate the a and the b parameters given the temperature
     /*!
      *  This function doesn't change the internal state of the object, so it is a const
-     *  function.  It does use the stored mole fractions in the object.
+     *  function.  It uses the sums over the current composition which are
+     *  computed by updateAB().
      *
      *  @param temp  Temperature (TKelvin)
      *
@@ -612,6 +636,7 @@ public:
 
     // Special functions not inherited from MixtureFugacityTP
 
+    //! Temperature derivative of the a parameter for the current composition
     doublereal da_dt() const;
 
     void calcCriticalConditions(doublereal a, doublereal b, doublereal a0_coeff, doublereal aT_coeff,
@@ -625,10 +650,19 @@ public:
      *
      * Returns the number of solutions found. If it only finds the liquid
      * branch solution, it will return a -1 or a -2 instead of 1 or 2.  If it
-     * returns 0, then there is an error.
+     * returns 0, then there is an error. See MixtureFugacityTP::solveCubic().
+     *
+     * @param Vguess  Guess for the molar volume, used as the starting point
+     *                for a Newton iteration when there is only one real root.
+     *                A negative value indicates that there is no guess.
      */
     int NicholsSolve(double TKelvin, double pres, doublereal a, doublereal b,
-                     doublereal Vroot[3]) const;
+                     doublereal Vroot[3], doublereal Vguess=-1.0) const;
+
+private:
+    //! Critical pressure, temperature and molar volume of the mixture at the
+    //! current composition, in that order
+    const vector_fp& criticalConditions() const;
 
 protected:
     //! boolean indicating whether standard mixing rules are applied
@@ -657,7 +691,21 @@ protected:
      */
     doublereal m_a_current;
 
-    vector_fp a_vec_Curr_;
+    //! Temperature-independent part of m_a_current
+    doublereal m_a0_current;
+
+    //! Temperature derivative of m_a_current
+    doublereal m_dadt_current;
+
+    //! Sums \f$ \sum_i X_i a_{ik} \f$ at the current temperature
+    vector_fp m_aSum;
+
+    //! Temperature-independent part of #m_aSum
+    vector_fp m_a0Sum;
+
+    //! Temperature derivative of #m_aSum
+    vector_fp m_dadtSum;
+
     vector_fp b_vec_Curr_;
 
     Array2D  a_coeff_vec;
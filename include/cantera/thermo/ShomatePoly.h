@@ -442,6 +442,12 @@ public:
         }
     }
 
+    //! Midpoint temperature [K] separating the low- and high-temperature
+    //! regions
+    doublereal midTemp() const {
+        return m_midT;
+    }
+
     virtual void updatePropertiesTemp(const doublereal temp,
                                       doublereal* cp_R,
                                       doublereal* h_RT,
@@ -0,0 +1,184 @@
+/**
+ * @file TabulatedSpeciesThermo.h
+ *  Header for a species thermodynamic property manager which interpolates
+ *  the reference state properties of all species from tables (see \ref
+ *  mgrsrefcalc and \link Cantera::TabulatedSpeciesThermo
+ *  TabulatedSpeciesThermo\endlink).
+ */
+#ifndef CT_TABULATEDSPECIESTHERMO_H
+#define CT_TABULATEDSPECIESTHERMO_H
+
+#include "GeneralSpeciesThermo.h"
+
+namespace Cantera
+{
+
+//! A species thermodynamic property manager which evaluates the reference
+//! state properties of all species by interpolation in a table.
+/*!
+ * The species parameterizations are installed in the same way as for
+ * GeneralSpeciesThermo, which is used to evaluate them exactly. The first
+ * time that update() is called after the set of species has changed, the
+ * dimensionless properties \f$ c_p/R \f$, \f$ h/RT \f$ and \f$ s/R \f$ of
+ * all species are tabulated on a uniform temperature grid, along with their
+ * temperature derivatives, and converted to piecewise cubic Hermite
+ * polynomials. The polynomial coefficients for all species in one
+ * temperature interval are stored contiguously, so that update() only
+ * touches one block of memory and its inner loop over species contains no
+ * branches.
+ *
+ * The grid spacing is 100 K divided by a power of two, with the grid points
+ * at multiples of the spacing, so that the common midpoint temperatures of
+ * the NASA and Shomate polynomials (e.g. 1000 K) are grid points. The
+ * spacing is halved until the interpolation error at three points inside
+ * each interval is less than the tolerance for each of the three properties.
+ * For species which have a region boundary (e.g. a NASA midpoint
+ * temperature) strictly inside an interval, the properties within that
+ * interval are always evaluated from the original parameterization. This
+ * is done for NasaPoly2, ShomatePoly2 and Nasa9PolyMultiTempRegion.
+ *
+ * Outside the tabulated temperature range, which by default is the range
+ * over which all of the species parameterizations are valid, and by
+ * update_one(), the properties are evaluated from the original
+ * parameterizations.
+ *
+ * To use tabulated thermo for a phase that has already been constructed:
+ * @code
+ * GeneralSpeciesThermo& sp =
+ *     dynamic_cast<GeneralSpeciesThermo&>(gas.speciesThermo());
+ * gas.setSpeciesThermo(new TabulatedSpeciesThermo(sp, 1e-6));
+ * @endcode
+ *
+ * @ingroup mgrsrefcalc
+ */
+class TabulatedSpeciesThermo : public GeneralSpeciesThermo
+{
+public:
+    //! Constructor
+    /*!
+     * @param tol  Maximum absolute interpolation error in the dimensionless
+     *             properties \f$ c_p/R \f$, \f$ h/RT \f$ and \f$ s/R \f$.
+     */
+    explicit TabulatedSpeciesThermo(doublereal tol=1.0e-6);
+
+    //! Construct a tabulated manager for the species installed in `b`
+    /*!
+     * @param b    Species thermo manager whose species are copied
+     * @param tol  Maximum absolute interpolation error in the dimensionless
+     *             properties \f$ c_p/R \f$, \f$ h/RT \f$ and \f$ s/R \f$.
+     */
+    TabulatedSpeciesThermo(const GeneralSpeciesThermo& b,
+                           doublereal tol=1.0e-6);
+
+    TabulatedSpeciesThermo(const TabulatedSpeciesThermo& b);
+    TabulatedSpeciesThermo& operator=(const TabulatedSpeciesThermo& b);
+
+    virtual SpeciesThermo* duplMyselfAsSpeciesThermo() const;
+
+    virtual void install_STIT(SpeciesThermoInterpType* stit_ptr);
+
+    virtual void update(doublereal T, doublereal* cp_R,
+                        doublereal* h_RT, doublereal* s_R) const;
+
+    virtual void modifyOneHf298(const size_t k, const doublereal Hf298New);
+
+    //! Set the maximum absolute interpolation error in the dimensionless
+    //! properties. The table is rebuilt on the next call to update().
+    void setTolerance(doublereal tol);
+
+    //! Maximum absolute interpolation error in the dimensionless properties
+    doublereal tolerance() const {
+        return m_tol;
+    }
+
+    //! Set the temperature range [K] covered by the table. If either limit
+    //! is zero, the corresponding limit of the range over which all species
+    //! parameterizations are valid is used. The table is rebuilt on the next
+    //! call to update().
+    void setTemperatureRange(doublereal Tmin, doublereal Tmax);
+
+    //! Set the maximum number of temperature intervals in the table. If the
+    //! tolerance can not be met with this number of intervals, an exception
+    //! is thrown when the table is built. Default 16384.
+    void setMaxIntervals(size_t n);
+
+    //! Build the table now, rather than on the next call to update()
+    void buildTable() const;
+
+    //! Number of temperature intervals in the table (0 if the table has not
+    //! been built)
+    size_t nIntervals() const {
+        return m_nbins;
+    }
+
+    //! Temperature spacing [K] of the table
+    doublereal gridSpacing() const {
+        return m_dT;
+    }
+
+    //! Largest interpolation error found when the table was built
+    doublereal maxError() const {
+        return m_maxError;
+    }
+
+private:
+    //! Mark the table as out of date
+    void invalidate() {
+        m_table_ok = false;
+        m_nbins = 0;
+    }
+
+    //! Compute the Hermite coefficients for grid spacing `dT`. Returns false
+    //! if the table can not be used for the installed species.
+    bool fillTable(doublereal dT) const;
+
+    //! Largest interpolation error at the test points in each interval
+    doublereal tableError() const;
+
+    //! Evaluate the interpolating polynomials in interval `i` at the
+    //! normalized coordinate `t` in [0, 1]
+    void interpolate(size_t i, doublereal t, doublereal* cp_R,
+                     doublereal* h_RT, doublereal* s_R) const;
+
+    //! Maximum absolute interpolation error
+    doublereal m_tol;
+
+    //! User-specified temperature range (0 for the default)
+    doublereal m_Tmin_user, m_Tmax_user;
+
+    //! Maximum number of intervals
+    size_t m_maxBins;
+
+    mutable bool m_table_ok;
+
+    //! Number of species covered by the table
+    mutable size_t m_nsp;
+
+    //! Range of temperatures for which the table is used
+    mutable doublereal m_Tlow, m_Thigh;
+
+    //! Temperature of the first grid point, and grid spacing
+    mutable doublereal m_T0, m_dT;
+
+    //! Number of intervals
+    mutable size_t m_nbins;
+
+    //! Hermite polynomial coefficients. For interval `i`, the coefficient of
+    //! \f$ t^c \f$ for property `p` (0 = cp/R, 1 = h/RT, 2 = s/R) of species
+    //! `k` is at `m_coeffs[(12*i + 4*p + c)*m_nsp + k]`.
+    mutable vector_fp m_coeffs;
+
+    //! Species which are evaluated exactly within each interval, in
+    //! compressed form: the species for interval `i` are
+    //! `m_exact[m_exactStart[i]]` to `m_exact[m_exactStart[i+1]-1]`.
+    mutable std::vector<size_t> m_exactStart, m_exact;
+
+    mutable doublereal m_maxError;
+
+    //! Work arrays
+    mutable vector_fp m_cp, m_h, m_s;
+};
+
+}
+
+#endif
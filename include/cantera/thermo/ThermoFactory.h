@@ -154,6 +154,12 @@ ThermoPhase* newPhase(XML_Node& phase);
  *  in a file, and then instantiates the object, returning the pointer
  *  to the ThermoPhase object.
  *
+ *  The parsed file is cached, but each call constructs a new phase with its
+ *  own copy of the species data and thermo parameterizations. To make many
+ *  phases for the same mechanism, e.g. one for each thread, create one phase
+ *  and copy it with duplMyselfAsThermoPhase(), which shares the XML data of
+ *  the phase between the copies.
+ *
  * @param infile name of the input file
  * @param id     name of the phase id in the file.
  *               If this is blank, the first phase in the file is used.
@@ -926,6 +926,42 @@ public:
     doublereal cv_mass() const {
         return cv_mole()/meanMolecularWeight();
     }
+
+    //! Evaluate properties for a batch of states.
+    /*!
+     *  Input and output arrays are in structure-of-arrays layout: the value
+     *  for species \a k in state \a j is stored at index `k*nStates + j`.
+     *  Any of the output pointers may be 0, in which case that property is
+     *  not computed. The state of the phase is the same on return as on
+     *  entry.
+     *
+     *  The default implementation sets the state of the phase and evaluates
+     *  the properties for each state in turn. Derived classes may override
+     *  this method with implementations that evaluate all of the states
+     *  without setting the state of the phase.
+     *
+     *  @param nStates  Number of states
+     *  @param T        Temperature of each state [K]. Length: nStates.
+     *  @param P        Pressure of each state [Pa]. Length: nStates.
+     *  @param Y        Species mass fractions. Length: m_kk * nStates.
+     *  @param rho      Output array of densities [kg/m^3]. Length: nStates.
+     *  @param mmw      Output array of mean molecular weights [kg/kmol].
+     *                  Length: nStates.
+     *  @param cp       Output array of specific heats at constant pressure
+     *                  [J/kg/K]. Length: nStates.
+     *  @param h        Output array of specific enthalpies [J/kg].
+     *                  Length: nStates.
+     *  @param s        Output array of specific entropies [J/kg/K].
+     *                  Length: nStates.
+     *  @param h_RT     Output array of the nondimensional species standard
+     *                  state enthalpies (see getEnthalpy_RT()).
+     *                  Length: m_kk * nStates.
+     */
+    virtual void getPropertiesBatch(size_t nStates, const doublereal* T,
+                                    const doublereal* P, const doublereal* Y,
+                                    doublereal* rho, doublereal* mmw,
+                                    doublereal* cp, doublereal* h,
+                                    doublereal* s, doublereal* h_RT);
     //@}
 
     //! Return the Gas Constant multiplied by the current temperature
@@ -13,6 +13,7 @@
 #define WATERPROPSIAPWS_H
 
 #include "WaterPropsIAPWSphi.h"
+#include "cantera/base/ct_defs.h"
 
 namespace Cantera
 {
@@ -234,6 +235,12 @@ public:
      * WaterPropsIAPWSphi::dfind(), which does the iterative calculation to
      * find the density condition that matches the desired input pressure.
      *
+     * If no density guess is supplied and the current state is on the
+     * requested branch at a nearby temperature, the density is instead
+     * extrapolated from the current state and finished with a few Newton
+     * steps. If tables have been built with buildDensityTable(), they are
+     * used in the same way.
+     *
      *  @param  temperature: Kelvin
      *  @param  pressure   : Pressure in Pascals (Newton/m**2)
      *  @param  phase      : guessed phase of water
@@ -275,6 +282,60 @@ public:
      */
     doublereal density_const(doublereal pressure, int phase = -1, doublereal rhoguess = -1.0) const;
 
+    //! Build bicubic tables of the density of the liquid and gas branches as
+    //! a function of temperature and log pressure.
+    /*!
+     * Once the tables are built, density() interpolates an initial estimate
+     * from them and finishes with Newton steps on the full equation of state,
+     * replacing the iterative solve from a crude initial guess. The returned
+     * densities therefore have the same accuracy as without the tables. The
+     * liquid branch is used for requests of WATER_LIQUID, or for an initial
+     * density guess above the critical density; the gas branch covers
+     * everything else, including the supercritical region.
+     *
+     * Only the density solve is accelerated. All other properties are still
+     * evaluated from the full Helmholtz function at the solved state. For
+     * WaterSSTP and PDSS_Water, the tables are enabled through getWater().
+     *
+     * The nodes of each branch are computed with the same initial guesses
+     * used by density(), so each table reproduces the (possibly metastable)
+     * root the iterative solve would find. A cell is only used if the
+     * interpolated density at its center agrees with the full calculation to
+     * within the relative tolerance `rtol`. Cells that cross a discontinuity
+     * in the branch or that are too close to the critical point fail this
+     * check, and states in them fall back to the iterative solve.
+     *
+     * The internal state of the object is not changed.
+     *
+     * @param Tmin  Minimum temperature of the table (kelvin)
+     * @param Tmax  Maximum temperature of the table (kelvin)
+     * @param Pmin  Minimum pressure of the table (Pascal)
+     * @param Pmax  Maximum pressure of the table (Pascal)
+     * @param nT    Number of intervals in temperature
+     * @param nP    Number of intervals in log pressure
+     * @param rtol  Relative accuracy required of the interpolated density
+     */
+    void buildDensityTable(doublereal Tmin, doublereal Tmax,
+                           doublereal Pmin, doublereal Pmax,
+                           size_t nT = 100, size_t nP = 100,
+                           doublereal rtol = 1.0E-6);
+
+    //! Remove the density tables built by buildDensityTable()
+    void clearDensityTable();
+
+    //! True if density tables have been built by buildDensityTable()
+    bool hasDensityTable() const {
+        return !m_tabRho[0].empty();
+    }
+
+    //! Fraction of the cells of one branch of the density table that passed
+    //! the accuracy check.
+    /*!
+     * @param phase  WATER_LIQUID for the liquid branch; anything else for
+     *               the gas branch
+     */
+    doublereal densityTableCoverage(int phase) const;
+
     //! Returns the density (kg m-3)
     /*!
      * The density is an independent variable in the underlying equation of state
@@ -445,6 +506,65 @@ private:
     void corr1(doublereal temperature, doublereal pressure, doublereal& densLiq,
                doublereal& densGas, doublereal& pcorr);
 
+    //! Initial guess for the density used when none is supplied to density()
+    /*!
+     * @param temperature  temperature (kelvin)
+     * @param pressure     pressure (Pascal)
+     * @param phase        guessed phase of water, or -1 for none
+     */
+    doublereal densityGuess(doublereal temperature, doublereal pressure,
+                            int phase) const;
+
+    //! Solve for the density with the damped iteration in
+    //! WaterPropsIAPWSphi::dfind(), and set the internal state
+    /*!
+     * @return the density, or -1.0 if the iteration does not converge
+     */
+    doublereal solveDensity(doublereal temperature, doublereal pressure,
+                            doublereal rhoguess);
+
+    //! Solve for the density with a few undamped Newton steps from a close
+    //! initial guess, and set the internal state if they converge.
+    /*!
+     * The convergence criterion is the same as the one used by
+     * WaterPropsIAPWSphi::dfind(). The root has to be on the same side of
+     * the critical density as the guess.
+     *
+     * @return the density, or -1.0 if the steps do not converge
+     */
+    doublereal newtonDensity(doublereal temperature, doublereal pressure,
+                             doublereal rhoguess);
+
+    //! Estimate the density at (T,P) by extrapolating from the current state
+    /*!
+     * Used as the initial guess when only the temperature and pressure have
+     * changed slightly since the last call, and the current state is on the
+     * requested branch.
+     *
+     * @return the estimated density, or -1.0 if the current state is not
+     *         suitable
+     */
+    doublereal warmStartDensity(doublereal temperature, doublereal pressure,
+                                int phase) const;
+
+    //! Interpolate the density from the tables built by buildDensityTable()
+    /*!
+     * @param branch  0 for the liquid branch, 1 for the gas branch
+     * @return the interpolated density, or -1.0 if (T,P) is outside of the
+     *         table or in a cell which failed the accuracy check
+     */
+    doublereal tableDensity(doublereal temperature, doublereal pressure,
+                            int branch) const;
+
+    //! Compute the density and its derivatives at one node of the table
+    /*!
+     * @param[out] f  ln(rho), d(ln rho)/dT, d(ln rho)/d(ln P) and the cross
+     *                derivative
+     * @return false if the density could not be found on this branch
+     */
+    bool tableNode(doublereal temperature, doublereal pressure, int branch,
+                   doublereal* f);
+
     //! pointer to the underlying object that does the calculations.
     WaterPropsIAPWSphi* m_phi;
 
@@ -462,6 +582,40 @@ private:
 
     //! Current state of the system
     mutable int iState;
+
+    //! @name Density tables
+    //! See buildDensityTable(). The tables hold the log of the density, which
+    //! is nearly linear in log pressure in the vapor region. Index 0 is the liquid branch, and 1 is the
+    //! gas branch.
+    //! @{
+
+    //! Minimum temperature of the table
+    doublereal m_tabTmin;
+
+    //! Temperature interval of the table
+    doublereal m_tabDT;
+
+    //! Minimum log pressure of the table
+    doublereal m_tabLnPmin;
+
+    //! Log pressure interval of the table
+    doublereal m_tabDlnP;
+
+    //! Number of temperature intervals
+    size_t m_tabNT;
+
+    //! Number of log pressure intervals
+    size_t m_tabNP;
+
+    //! ln(rho) and its derivatives d/dT, d/d(ln P) and d2/dT d(ln P) at each
+    //! node, scaled by the cell size. Stored four values per node, with node
+    //! (i,j) at `4*(i*(m_tabNP+1) + j)`
+    vector_fp m_tabRho[2];
+
+    //! Flag for each cell (i,j) at `i*m_tabNP + j` which is true if the cell
+    //! passed the accuracy check
+    std::vector<int> m_tabValid[2];
+    //! @}
 };
 
 }
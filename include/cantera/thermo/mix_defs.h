@@ -80,6 +80,7 @@ const int cIdealSolnGasVPSS_iscv = 501;
 //! Fugacity Models
 const int cMixtureFugacityTP = 700;
 const int cRedlichKwongMFTP = 701;
+const int cPengRobinsonMFTP = 702;
 
 const int cMargulesVPSSTP = 301;
 
@@ -12,7 +12,7 @@
 
 // Cantera includes
 #include "TransportBase.h"
-#include "cantera/numerics/DenseMatrix.h"
+#include "cantera/numerics/SquareMatrix.h"
 
 namespace Cantera
 {
@@ -136,6 +136,32 @@ public:
                                 const doublereal* const state2, const doublereal delta,
                                 doublereal* const fluxes);
 
+    //! Get the molar fluxes [kmol/m^2/s] between each of a set of pairs of
+    //! nearby states.
+    /*!
+     *  This is intended for porous electrode models, which need the fluxes
+     *  across every control volume face at every Newton iteration. The LU
+     *  factorization of the H matrix is kept from one pair to the next, and
+     *  is only recomputed when the mean temperature, pressure, or mole
+     *  fractions change, so for each pair with an unchanged mean state the
+     *  fluxes are found by a single back substitution. The state of the
+     *  phase is restored on return.
+     *
+     * @param  npoints  Number of pairs of states
+     * @param  states1  Temperature, density, and mass fractions for the first
+     *                  state of each pair. Length npoints*(nsp+2).
+     * @param  states2  Temperature, density, and mass fractions for the second
+     *                  state of each pair. Length npoints*(nsp+2).
+     * @param  delta    Distance from state 1 to state 2 (m) for each pair.
+     *                  Length npoints.
+     * @param  fluxes   Output species molar fluxes. The fluxes for pair `n`
+     *                  start at `fluxes[n*nsp]`. Length npoints*nsp.
+     */
+    void getMolarFluxes(size_t npoints, const doublereal* const states1,
+                        const doublereal* const states2,
+                        const doublereal* const delta,
+                        doublereal* const fluxes);
+
     //-----------------------------------------------------------
     // new methods added in this class
 
@@ -216,9 +242,9 @@ private:
 
     //! Update concentration-dependent quantities within the object
     /*!
-     *  The object keeps a value m_temp, which is the temperature at which
-     *  quantities were last evaluated at. If the temperature is changed,
-     *  update Booleans are set false, triggering recomputation.
+     *  The mole fractions and pressure are compared with the values at which
+     *  the H matrix and the binary diffusion coefficients were last
+     *  evaluated, and the update Booleans are set false if they have changed.
      */
     void updateTransport_C();
 
@@ -238,10 +264,14 @@ private:
      */
     void updateBinaryDiffCoeffs();
 
+    //! Evaluate and factor the H matrix, if the state has changed since it
+    //! was last factored
+    void updateHMatrix();
+
     //! Update the Multicomponent diffusion coefficients that are used in the
     //! approximation
     /*!
-     *  This routine updates the H matrix and then inverts it.
+     *  This routine updates the factored H matrix and then inverts it.
      */
     void updateMultiDiffCoeffs();
 
@@ -294,7 +324,10 @@ private:
     //! temperature
     doublereal m_temp;
 
-    //! Multicomponent diffusion coefficients
+    //! pressure at which the binary diffusion coefficients were evaluated
+    doublereal m_press;
+
+    //! LU factorization of the multicomponent diffusion H matrix
     /*!
      *  The multicomponent diffusion matrix \f$  H_{k,l} \f$ is given by the following form
      *
@@ -305,6 +338,9 @@ private:
      *        H_{k,k} = \frac{1}{\mathcal(D)^{knud}_{k}} + \sum_{j \ne k}^N{ \frac{X_j}{D_{k,j}} }
      *     \f]
      */
+    SquareMatrix m_hmatrix;
+
+    //! Multicomponent diffusion coefficients, the inverse of the H matrix
     DenseMatrix  m_multidiff;
 
     //!  work space of size m_nsp;
@@ -313,6 +349,9 @@ private:
     //!  work space of size m_nsp;
     vector_fp  m_spwork2;
 
+    //!  work space of size m_nsp;
+    vector_fp  m_spwork3;
+
     //! Pressure Gradient
     doublereal m_gradP;
 
@@ -322,6 +361,12 @@ private:
     //! Update-to-date variable for Binary diffusion coefficients
     bool m_bulk_ok;
 
+    //! Update-to-date variable for the factored H matrix
+    bool m_hmatrix_ok;
+
+    //! Update-to-date variable for the multicomponent diffusion coefficients
+    bool m_multidiff_ok;
+
     //! Porosity
     doublereal m_porosity;
 
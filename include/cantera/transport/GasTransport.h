@@ -7,12 +7,65 @@
 
 #include "TransportBase.h"
 #include "cantera/numerics/DenseMatrix.h"
+#include "cantera/base/smart_ptr.h"
 
 namespace Cantera
 {
 
 class MMCollisionInt;
 
+//! Polynomial fits to the pure species viscosities and thermal
+//! conductivities and to the binary diffusion coefficients
+/*!
+ * The fits depend only on the species parameters, the temperature range of
+ * the phase and the type of fits, and are not modified once they have been
+ * made. They are therefore shared by copies of a GasTransport object, and by
+ * all transport managers in a process which are made from the same inputs.
+ * @see GasTransport::fitProperties()
+ */
+struct GasTransportFits
+{
+    //! Polynomial fits to the viscosity of each species. visccoeffs[k] is
+    //! the vector of polynomial coefficients for species k that fits the
+    //! viscosity as a function of temperature.
+    std::vector<vector_fp> visccoeffs;
+
+    //! temperature fits of the heat conduction
+    /*!
+     *  Dimensions are number of species (nsp) polynomial order of the
+     *  collision integral fit (degree+1).
+     */
+    std::vector<vector_fp> condcoeffs;
+
+    //! Polynomial fits to the binary diffusivity of each species
+    /*!
+     *  diffcoeffs[ic] is vector of polynomial coefficients for species  i
+     *  species  j that fits the binary diffusion coefficient. The
+     *  relationship between i j and ic is determined from the following
+     *  algorithm:
+     *
+     *      int ic = 0;
+     *      for (i = 0; i < m_nsp; i++) {
+     *         for (j = i; j < m_nsp; j++) {
+     *           ic++;
+     *         }
+     *      }
+     */
+    std::vector<vector_fp> diffcoeffs;
+
+    //! @name Coefficient-major polynomial fits
+    //! Copies of #visccoeffs, #condcoeffs and #diffcoeffs used to evaluate
+    //! the fits. Coefficient n of the fit for species (or species pair) k is
+    //! stored at `[n*m + k]`, where `m` is the number of species (or pairs),
+    //! so that each term is added for all species in one loop which the
+    //! compiler can vectorize.
+    //! @{
+    vector_fp visccoeffs_cm;
+    vector_fp condcoeffs_cm;
+    vector_fp diffcoeffs_cm;
+    //! @}
+};
+
 //! Class GasTransport implements some functions and properties that are
 //! shared by the MixTransport and MultiTransport classes.
 //! @ingroup tranprops
@@ -53,7 +106,9 @@ public:
 
     //! Returns the matrix of binary diffusion coefficients.
     /*!
-     *        d[ld*j + i] = rp * m_bdiff(i,j);
+     *  `d[ld*j + i]` is the binary diffusion coefficient of species i and j
+     *  at the current temperature and pressure. All pairs are evaluated,
+     *  regardless of the trace species threshold.
      *
      * @param ld   offset of rows in the storage
      * @param d    output vector of diffusion coefficients. Units of m**2 / s
@@ -109,6 +164,74 @@ public:
 
     virtual void init(thermo_t* thermo, int mode=0, int log_level=0);
 
+    //! Return the polynomial fit to the viscosity of species i
+    /*!
+     * @param i      species index
+     * @param coeffs coefficients of the fit in ln(T), lowest order first.
+     *               Length 4 in CK mode and 5 otherwise.
+     * @see fitProperties()
+     */
+    void getViscosityPolynomial(size_t i, doublereal* coeffs) const;
+
+    //! Return the polynomial fit to the thermal conductivity of species i
+    //! @see getViscosityPolynomial()
+    void getConductivityPolynomial(size_t i, doublereal* coeffs) const;
+
+    //! Return the polynomial fit to the binary diffusion coefficient of
+    //! species i and j
+    //! @see getViscosityPolynomial()
+    void getBinDiffusivityPolynomial(size_t i, size_t j,
+                                     doublereal* coeffs) const;
+
+    //! Set the directory used to cache the polynomial fits to the transport
+    //! properties
+    /*!
+     * Generating the fits in init() takes a time proportional to the square
+     * of the number of species. If a directory is set, the fits are saved
+     * there in a file named using a hash of the species transport
+     * parameters, molecular weights and heat capacities, and are read back
+     * when a transport manager is created for the same species again. The
+     * file also contains these inputs, and the fits are regenerated if they
+     * do not match. The directory is not created, and errors writing the
+     * file are ignored. An empty string, the default, disables the cache.
+     */
+    static void setFitCacheDirectory(const std::string& dir);
+
+    //! The directory used to cache the polynomial fits
+    //! @see setFitCacheDirectory()
+    static std::string fitCacheDirectory();
+
+    //! Name of the cache file from which the polynomial fits were read, or
+    //! to which they were saved. Empty if the cache was disabled when the
+    //! fits were made.
+    const std::string& fitCacheFile() const {
+        return m_fitCacheFile;
+    }
+
+    //! Set the mole fraction below which species are treated as trace
+    //! species by the mixture-averaged diffusion coefficients
+    /*!
+     * The binary diffusion coefficient of a pair of species which are both
+     * trace species is neither evaluated nor included in the mixture rules
+     * for getMixDiffCoeffs(), getMixDiffCoeffsMole() and
+     * getMixDiffCoeffsMass(). The other binary diffusion coefficients are
+     * only evaluated when they are first needed at each temperature. Since
+     * the neglected terms are weighted by the mole fraction of a trace
+     * species, the relative error in each mixture-averaged diffusion
+     * coefficient is at most of the order of the threshold times the number
+     * of trace species. For large mechanisms, where most species are present
+     * only in trace amounts, this avoids evaluating most of the K^2 binary
+     * diffusion coefficients. The default threshold of zero includes all
+     * pairs.
+     */
+    void setTraceThreshold(doublereal xtrace);
+
+    //! The mole fraction below which species are treated as trace species
+    //! @see setTraceThreshold()
+    doublereal traceThreshold() const {
+        return m_trace_threshold;
+    }
+
 protected:
     GasTransport(ThermoPhase* thermo=0);
 
@@ -137,10 +260,65 @@ protected:
     //! Update the binary diffusion coefficients
     /*!
      * These are evaluated from the polynomial fits of the temperature at the
-     * unit pressure of 1 Pa.
+     * unit pressure of 1 Pa, for all species pairs.
      */
     virtual void updateDiff_T();
 
+    //! Update the binary diffusion coefficients needed by the mixture rules
+    //! for the mole fractions in #m_molefracs
+    /*!
+     * These are the pairs which include at least one species with a mole
+     * fraction above the trace species threshold. Pairs which have already
+     * been evaluated at the current temperature are not evaluated again.
+     * @see setTraceThreshold()
+     */
+    void updateDiffMix();
+
+    //! Evaluate the binary diffusion coefficients of the pairs `begin` to
+    //! `end - 1`, in the order of GasTransportFits::diffcoeffs, at the
+    //! current temperature
+    void evalBinDiff(size_t begin, size_t end);
+
+    //! Sums over the binary diffusion coefficients used in the mixture rules
+    /*!
+     * Computes
+     * \f[
+     *     s_k = \sum_{j \ne k} \frac{w_j}{\mathcal{D}_{kj}}
+     * \f]
+     * at unit pressure, excluding pairs of trace species. Each pair is
+     * visited once, and contributes to the sums for both of its species.
+     *
+     * @param w    weights, length m_nsp
+     * @param sums output array of length m_nsp
+     */
+    void evalMixDiffSums(const doublereal* w, doublereal* sums);
+
+    //! Index of the pair of species `i` and `j` in the order of
+    //! GasTransportFits::diffcoeffs and #m_bdiff_packed
+    size_t pairIndex(size_t i, size_t j) const {
+        if (i > j) {
+            std::swap(i, j);
+        }
+        return i*m_nsp - (i*(i-1))/2 + (j-i);
+    }
+
+    //! Evaluate the mixture viscosity from the current temperature-dependent
+    //! terms and the mole fractions in #m_molefracs
+    /*!
+     * The viscosity weighting functions are updated first if necessary.
+     */
+    doublereal evalMixViscosity();
+
+    //! Evaluate the mixture-averaged diffusion coefficients returned by
+    //! getMixDiffCoeffs() from the current binary diffusion coefficients and
+    //! the mole fractions in #m_molefracs
+    /*!
+     * @param p    pressure [Pa]
+     * @param mmw  mean molecular weight [kg/kmol]
+     * @param d    output array of length nSpecies()
+     */
+    void evalMixDiffCoeffs(doublereal p, doublereal mmw, doublereal* const d);
+
     //! @name Initialization
     //! @{
 
@@ -159,6 +337,24 @@ protected:
      */
     void getTransportData();
 
+    //! Copy the polynomial fits into the coefficient-major arrays
+    //! GasTransportFits::visccoeffs_cm, condcoeffs_cm and diffcoeffs_cm
+    void packFitCoeffs(GasTransportFits& fits) const;
+
+    //! Evaluate polynomial fits in ln(T) at the current temperature
+    /*!
+     * @param coeffs coefficient-major fits, e.g.
+     *               GasTransportFits::visccoeffs_cm
+     * @param m      number of fits
+     * @param out    values of the `m` polynomials
+     * @param begin  index of the first fit to evaluate
+     * @param end    index past the last fit to evaluate. The default, npos,
+     *               evaluates the fits up to `m`. Only the elements `begin`
+     *               to `end - 1` of `out` are set.
+     */
+    void evalFits(const vector_fp& coeffs, size_t m, doublereal* out,
+                  size_t begin=0, size_t end=npos) const;
+
     //! Corrections for polar-nonpolar binary diffusion coefficients
     /*!
      * Calculate corrections to the well depth parameter and the diameter for
@@ -200,10 +396,71 @@ protected:
      *          D(i,j)/sqrt(k_BT)) = \sum_{n = 0}^4 a_n(i,j) (\log T)^n
      *     \f]
      *
+     *  Species pairs with the same well depth and reduced dipole moment
+     *  have binary diffusion coefficients that differ only by a constant
+     *  factor, so only one fit is made for each group of such pairs. These
+     *  fits are divided among several threads if Cantera was compiled with
+     *  thread safety enabled. If another transport manager in this process
+     *  already has fits made from the same inputs, these are shared instead.
+     *  Otherwise, the fits are read from and saved to the cache set by
+     *  setFitCacheDirectory(), if any.
+     *
      *  @param integrals interpolator for the collision integrals
      */
     void fitProperties(MMCollisionInt& integrals);
 
+    //! Fit the binary diffusion coefficients of a range of species pairs
+    /*!
+     * Called by fitProperties(), possibly from several threads at once for
+     * different ranges.
+     *
+     * @param integrals interpolator for the collision integrals
+     * @param pairs   species pairs (k, j) with fits of the form given for
+     *                fitProperties()
+     * @param begin   index in `pairs` of the first pair to fit
+     * @param end     index in `pairs` past the last pair to fit
+     * @param coeffs  output polynomial coefficients, degree + 1 for each pair
+     * @param errors  output maximum absolute and relative errors of the fits
+     *                at the fitted temperatures, 2 for each pair
+     */
+    void fitDiffCoeffs(const MMCollisionInt* integrals,
+                       const std::vector<std::pair<size_t, size_t> >* pairs,
+                       size_t begin, size_t end, doublereal* coeffs,
+                       doublereal* errors) const;
+
+    //! Run fitDiffCoeffs() on a worker thread started by fitProperties(), and
+    //! release the thread's message storage when it is done. Not called on
+    //! the caller's thread, whose logger and error stack must be kept.
+    void fitDiffCoeffsThread(const MMCollisionInt* integrals,
+                             const std::vector<std::pair<size_t, size_t> >* pairs,
+                             size_t begin, size_t end, doublereal* coeffs,
+                             doublereal* errors) const;
+
+    //! Read the polynomial fits from a cache file
+    /*!
+     * @param fname  name of the file
+     * @param key    inputs to the fits, which must match those in the file
+     * @param fits   the fits which are read. Only the per-species and
+     *               per-pair fits are set.
+     * @returns true if the fits were read
+     * @see setFitCacheDirectory()
+     */
+    bool readFitCache(const std::string& fname, const vector_fp& key,
+                      GasTransportFits& fits) const;
+
+    //! Save the polynomial fits and the inputs `key` to a cache file
+    //! @see readFitCache()
+    void writeFitCache(const std::string& fname, const vector_fp& key,
+                       const GasTransportFits& fits) const;
+
+    //! Pack new fits, and use them unless another transport manager has
+    //! made fits from the same inputs in the meantime
+    /*!
+     * @param key   inputs to the fits
+     * @param fits  the fits made by fitProperties()
+     */
+    void shareFits(const vector_fp& key, shared_ptr<GasTransportFits> fits);
+
     //! Second-order correction to the binary diffusion coefficients
     /*!
      * Calculate second-order corrections to binary diffusion coefficient pair
@@ -265,10 +522,9 @@ protected:
     //! rule to calculate the viscosity of the solution. length = m_kk.
     vector_fp m_visc;
 
-    //! Polynomial fits to the viscosity of each species. m_visccoeffs[k] is
-    //! the vector of polynomial coefficients for species k that fits the
-    //! viscosity as a function of temperature.
-    std::vector<vector_fp> m_visccoeffs;
+    //! Polynomial fits to the transport properties. Shared with other
+    //! transport managers; see GasTransportFits.
+    shared_ptr<const GasTransportFits> m_fits;
 
     //! Local copy of the species molecular weights.
     vector_fp m_mw;
@@ -319,31 +575,39 @@ protected:
     //! Current value of temperature to the 3/2 power
     doublereal m_t32;
 
-    //! Polynomial fits to the binary diffusivity of each species
-    /*!
-     *  m_diffcoeff[ic] is vector of polynomial coefficients for species  i
-     *  species  j that fits the binary diffusion coefficient. The relationship
-     *  between i j and ic is determined from the following algorithm:
-     *
-     *      int ic = 0;
-     *      for (i = 0; i < m_nsp; i++) {
-     *         for (j = i; j < m_nsp; j++) {
-     *           ic++;
-     *         }
-     *      }
-     */
-    std::vector<vector_fp> m_diffcoeffs;
+    //! Binary diffusion coefficients at unit pressure and the current
+    //! temperature for each species pair, in the order of
+    //! GasTransportFits::diffcoeffs. The
+    //! coefficients are symmetric, so only the pairs (i,j) with j >= i are
+    //! stored. Length m_nsp*(m_nsp+1)/2.
+    vector_fp m_bdiff_packed;
 
-    //! Matrix of binary diffusion coefficients at the reference pressure and
-    //! the current temperature Size is nsp x nsp.
-    DenseMatrix m_bdiff;
+    //! Reciprocals of the binary diffusion coefficients in #m_bdiff_packed
+    vector_fp m_bdiff_inv_packed;
 
-    //! temperature fits of the heat conduction
+    //! Counter which is incremented whenever the temperature changes, so
+    //! that the binary diffusion coefficients evaluated at any earlier
+    //! temperature, including one which is later revisited, are not reused
+    size_t m_bdiff_gen;
+
+    //! Value of #m_bdiff_gen when the binary diffusion coefficients of all
+    //! pairs including species k were last evaluated. Length m_nsp.
+    std::vector<size_t> m_bdiff_row_gen;
+
+    //! Mole fraction below which species are treated as trace species.
+    //! @see setTraceThreshold()
+    doublereal m_trace_threshold;
+
+    //! Indices of the species which are not trace species, used by
+    //! evalMixDiffSums()
+    std::vector<size_t> m_major;
+
+    //! Molecular weight factors in the viscosity weighting function
     /*!
-     *  Dimensions are number of species (nsp) polynomial order of the collision
-     *  integral fit (degree+1).
+     *  `m_phi_wrat(k,j) = (mw[j]/mw[k])^(1/4)` and
+     *  `m_phi_scale(k,j) = 1/sqrt(8*(1 + mw[k]/mw[j]))` for all k and j.
      */
-    std::vector<vector_fp> m_condcoeffs;
+    DenseMatrix m_phi_wrat, m_phi_scale;
 
     //! Indices for the (i,j) interaction in collision integral fits
     /*!
@@ -479,6 +743,9 @@ protected:
      */
     vector_fp m_w_ac;
 
+    //! Cache file for the polynomial fits. @see fitCacheFile()
+    std::string m_fitCacheFile;
+
     //! Level of verbose printing during initialization
     int m_log_level;
 };
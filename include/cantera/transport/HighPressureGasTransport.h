@@ -66,6 +66,18 @@ public:
 
     virtual doublereal viscosity();
 
+    //! Uses the generic implementation, which applies the high pressure
+    //! corrections at each state.
+    //! @see Transport::getMultiTransportProperties()
+    virtual void getMultiTransportProperties(size_t npoints,
+                                             const doublereal* T, doublereal P,
+                                             const doublereal* X,
+                                             doublereal* visc, doublereal* cond,
+                                             doublereal* d, doublereal* dt) {
+        Transport::getMultiTransportProperties(npoints, T, P, X, visc, cond,
+                                               d, dt);
+    }
+
     friend class TransportFactory;
 
 protected:
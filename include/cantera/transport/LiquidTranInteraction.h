@@ -131,7 +131,7 @@ public:
         throw NotImplementedError("LiquidTranInteraction::getMixTransProp");
     }
 
-    virtual doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs) {
+    virtual doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs) {
         throw NotImplementedError("LiquidTranInteraction::getMixTransProp");
     }
 
@@ -140,7 +140,37 @@ public:
         throw NotImplementedError("LiquidTranInteraction::getMixTransProp");
     }
 
+    //! True if the matrix returned by getMatrixTransProp() depends on the
+    //! composition of the phase. Otherwise, it depends only on temperature,
+    //! and callers may keep it until the temperature changes.
+    virtual bool compositionDependent() const {
+        return false;
+    }
+
 protected:
+    //! Sum of the interaction terms of the mixing rule
+    /*!
+     *  Evaluates
+     *  \f[
+     *     \sum_i \sum_j x_i x_j \sum_k c_{k,i,j}(T) x_i^k
+     *  \f]
+     *  where the sum runs over the species pairs that have interaction
+     *  parameters, and the temperature-dependent coefficients
+     *  \f$ c_{k,i,j}(T) \f$ are those given by updateInteractionCoeffs().
+     *  The coefficients are only re-evaluated when the temperature of the
+     *  phase changes.
+     *
+     *  @param x  weighted mole or mass fractions of the species
+     */
+    doublereal interactionSum(const doublereal* x);
+
+    //! Evaluate the coefficients of the interaction polynomials in
+    //! #m_pairCoeffs at temperature T
+    /*!
+     *  The default is \f$ c_k = A_{k,i,j} + B_{k,i,j} T \f$.
+     */
+    virtual void updateInteractionCoeffs(doublereal T);
+
     //! Model for species interaction effects
     //! Takes enum LiquidTranMixingModel
     LiquidTranMixingModel m_model;
@@ -174,6 +204,22 @@ protected:
 
     //! Matrix of interactions
     DenseMatrix  m_Dij;
+
+    //! Species pairs (i,j) that have nonzero interaction parameters
+    std::vector<std::pair<size_t, size_t> > m_pairs;
+
+    //! Number of terms in the interaction polynomials
+    size_t m_nterms;
+
+    //! Coefficients of the interaction polynomial of each pair in #m_pairs
+    //! at temperature #m_pair_tlast. Length m_pairs.size() * m_nterms.
+    vector_fp m_pairCoeffs;
+
+    //! Temperature at which #m_pairCoeffs was evaluated
+    doublereal m_pair_tlast;
+
+    //! Work space for the weighted mole or mass fractions (length nsp)
+    vector_fp m_fracs;
 };
 
 class LTI_Solvent : public LiquidTranInteraction
@@ -193,7 +239,7 @@ public:
      * does not know what transport property it is at this point).
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs) ;
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -232,7 +278,7 @@ public:
      * does not know what transport property it is at this point.
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs) ;
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -274,7 +320,7 @@ public:
      * does not know what transport property it is at this point.
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs) ;
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -345,7 +391,7 @@ public:
      * does not know what transport property it is at this point.
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs) ;
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -355,6 +401,10 @@ public:
     void getMatrixTransProp(DenseMatrix& mat, doublereal* speciesValues = 0) {
         mat = m_Eij;
     }
+
+protected:
+    //! The coefficients are \f$ c_k = H_{k,i,j} / T - S_{k,i,j} \f$
+    virtual void updateInteractionCoeffs(doublereal T);
 };
 
 //! Transport properties that act like pairwise interactions
@@ -400,7 +450,7 @@ public:
      * does not know what transport property it is at this point.
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs) ;
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -506,7 +556,7 @@ public:
      * does not know what transport property it is at this point.
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs) ;
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -515,6 +565,12 @@ public:
      */
     void getMatrixTransProp(DenseMatrix& mat, doublereal* speciesValues = 0) ;
 
+    //! The Stefan-Maxwell coefficients depend on the mole fractions of the
+    //! two salts
+    virtual bool compositionDependent() const {
+        return true;
+    }
+
 protected:
     doublereal m_ionCondMix;
     LiquidTranInteraction* m_ionCondMixModel;
@@ -553,7 +609,7 @@ public:
      * transport property it is at this point.
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs) ;
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -595,7 +651,7 @@ public:
      * does not know what transport property it is at this point.
      */
     doublereal getMixTransProp(doublereal* valueSpecies, doublereal* weightSpecies = 0);
-    doublereal getMixTransProp(std::vector<LTPspecies*> LTPptrs) ;
+    doublereal getMixTransProp(const std::vector<LTPspecies*>& LTPptrs);
 
     //! Return the matrix of binary interaction parameters.
     /**
@@ -605,6 +661,10 @@ public:
     void getMatrixTransProp(DenseMatrix& mat, doublereal* speciesValues = 0) {
         mat = (*m_Aij[0]);
     }
+
+protected:
+    //! The coefficients are \f$ c_k = A_{k,i,j} \exp(B_{k,i,j} T) \f$
+    virtual void updateInteractionCoeffs(doublereal T);
 };
 
 }
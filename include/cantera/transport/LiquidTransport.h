@@ -234,6 +234,39 @@ public:
      */
     virtual void getBinaryDiffCoeffs(const size_t ld, doublereal* const d);
 
+    //! Get the liquid transport properties at a set of states
+    /*!
+     *  This is intended for models that need the properties at every cell
+     *  of a discretized electrolyte. The phase is set to each state in turn,
+     *  and its original state is restored on return. The temperature-
+     *  dependent parts of the properties are kept from one state to the
+     *  next, so that for states at the same temperature only the
+     *  composition-dependent parts are evaluated. As in
+     *  Transport::getMixTransportProperties(), per-species arrays are stored
+     *  species-major.
+     *
+     *  @param npoints  Number of states
+     *  @param T        Temperatures [K]. Length npoints.
+     *  @param P        Pressure [Pa]
+     *  @param X        Mole fractions. Length nsp*npoints, with the value
+     *                  for species `k` at state `n` in `X[k*npoints + n]`.
+     *  @param visc     Mixture viscosities [Pa-s]. Length npoints. Not
+     *                  computed if NULL.
+     *  @param ionCond  Ionic conductivities [S/m]. Length npoints. Not
+     *                  computed if NULL.
+     *  @param cond     Thermal conductivities [W/m/K]. Length npoints. Not
+     *                  computed if NULL.
+     *  @param d        Binary diffusion coefficients [m^2/s]. Length
+     *                  nsp*nsp*npoints. Element `i = nsp*j + k` of the
+     *                  matrix returned by getBinaryDiffCoeffs() with
+     *                  `ld = nsp` is in `d[i*npoints + n]` for state `n`.
+     *                  Not computed if NULL.
+     */
+    void getLiquidTransportProperties(size_t npoints, const doublereal* T,
+                                      doublereal P, const doublereal* X,
+                                      doublereal* visc, doublereal* ionCond,
+                                      doublereal* cond, doublereal* d);
+
     //! Get the Mixture diffusion coefficients
     /*!
      *  The mixture diffusion coefficients are not well defined
@@ -158,6 +158,20 @@ public:
                                   size_t ldx, const doublereal* const grad_X,
                                   size_t ldf, doublereal* const fluxes);
 
+    //! Get mixture-averaged transport properties at a set of states
+    /*!
+     *  The properties are evaluated directly from the given temperatures and
+     *  mole fractions. Only the temperature of the phase is changed while
+     *  the properties are evaluated, and it is reset on return.
+     *
+     *  @see Transport::getMixTransportProperties()
+     */
+    virtual void getMixTransportProperties(size_t npoints,
+                                           const doublereal* T, doublereal P,
+                                           const doublereal* X,
+                                           doublereal* visc, doublereal* cond,
+                                           doublereal* d);
+
     virtual void init(thermo_t* thermo, int mode=0, int log_level=0);
 
 private:
@@ -175,6 +189,10 @@ private:
      */
     void updateCond_T();
 
+    //! Evaluate the mixture thermal conductivity #m_lambda from the species
+    //! conductivities and the mole fractions in #m_molefracs
+    void evalMixConductivity();
+
 private:
     //! vector of species thermal conductivities (W/m /K)
     /*!
@@ -55,6 +55,22 @@ public:
 
     virtual void getMultiDiffCoeffs(const size_t ld, doublereal* const d);
 
+    //! Get multicomponent transport properties at a set of states
+    /*!
+     *  The properties are evaluated directly from the given temperatures and
+     *  mole fractions, and the thermal conductivity and thermal diffusion
+     *  coefficients at each state share one solution of the L matrix
+     *  equations. Only the temperature of the phase is changed while the
+     *  properties are evaluated, and it is reset on return.
+     *
+     *  @see Transport::getMultiTransportProperties()
+     */
+    virtual void getMultiTransportProperties(size_t npoints,
+                                             const doublereal* T, doublereal P,
+                                             const doublereal* X,
+                                             doublereal* visc, doublereal* cond,
+                                             doublereal* d, doublereal* dt);
+
     //! Get the species diffusive mass fluxes wrt to  the mass averaged velocity,
     //! given the gradients in mole fraction and temperature
     /*!
@@ -117,6 +133,46 @@ public:
 
     virtual void init(ThermoPhase* thermo, int mode=0, int log_level=0);
 
+    //! Select the method used to solve the transport linear systems
+    /*!
+     * By default, the L matrix equations for the thermal conductivity and
+     * thermal diffusion coefficients are solved by LU decomposition of the
+     * full 3K x 3K matrix, and the multicomponent diffusion coefficients are
+     * found by inverting the K x K L00,00 block. Both scale as K^3 in the
+     * number of species K.
+     *
+     * The iterative method follows A. Ern and V. Giovangigli, "Fast and
+     * Accurate Multicomponent Transport Property Evaluation," J. Comput.
+     * Phys. 120:105-116, 1995. The L matrix equations are solved by the
+     * conjugate gradient method with a diagonal preconditioner, starting
+     * from the previous solution, at a cost of order K^2 per iteration. The
+     * multicomponent diffusion coefficients are found from a truncated
+     * series built on the Stefan-Maxwell matrix, where the zeroth order term
+     * corresponds to the mixture-averaged approximation. The zeroth and first
+     * order terms cost order K^2, and each further term costs order K^3.
+     *
+     * @param iterative    If true, use the iterative method. If false, use
+     *                     the direct method.
+     * @param maxIter      Maximum number of conjugate gradient iterations
+     * @param rtol         Relative tolerance on the preconditioned residual
+     *                     of the conjugate gradient iterations
+     * @param seriesOrder  Order at which the series for the multicomponent
+     *                     diffusion coefficients is truncated
+     */
+    void setIterativeSolver(bool iterative, size_t maxIter=50,
+                            doublereal rtol=1.0e-8, size_t seriesOrder=2);
+
+    //! True if the iterative method is used. @see setIterativeSolver()
+    bool iterativeSolver() const {
+        return m_iterative;
+    }
+
+    //! Number of conjugate gradient iterations taken by the last iterative
+    //! solution of the L matrix equations
+    size_t lastIterationCount() const {
+        return m_cg_iterations;
+    }
+
 protected:
     //! Update basic temperature-dependent quantities if the temperature has changed.
     void update_T();
@@ -128,8 +184,28 @@ protected:
     //! conductivity and thermal diffusion coefficients.
     void updateThermal_T();
 
+    //! Update the binary diffusion coefficients of all species pairs, and
+    //! copy them into #m_bdiff
+    virtual void updateDiff_T();
+
+    //! Evaluate the multicomponent diffusion coefficients returned by
+    //! getMultiDiffCoeffs() from the current temperature-dependent terms and
+    //! the mole fractions in #m_molefracs
+    /*!
+     * @param p    pressure [Pa]
+     * @param mmw  mean molecular weight [kg/kmol]
+     * @param ld   leading dimension of `d`
+     * @param d    output array
+     */
+    void evalMultiDiffCoeffs(doublereal p, doublereal mmw, size_t ld,
+                             doublereal* const d);
+
     doublereal m_thermal_tlast;
 
+    //! Matrix of binary diffusion coefficients at unit pressure and the
+    //! current temperature. Size is nsp x nsp.
+    DenseMatrix m_bdiff;
+
     //! Dense matrix for astar
     DenseMatrix          m_astar;
 
@@ -199,7 +275,53 @@ protected:
         return m_thermo->molarDensity() * GasConstant * m_thermo->temperature();
     }
 
+    //! Solve the L matrix equations for the current temperature and
+    //! #m_molefracs, if they have changed since the last solution
     virtual void solveLMatrixEquation();
+
+    //! Evaluate the upper-left block of the L matrix in symmetric form
+    /*!
+     *  The L00,00 block is the sum of a rank-one matrix and the negative of
+     *  the Stefan-Maxwell matrix. The rank-one part only fixes the constant
+     *  added to the first block of the solution, so it is dropped here, and
+     *  the constant is fixed afterwards by the condition that the thermal
+     *  diffusion coefficients sum to zero.
+     *  @param x vector of species mole fractions
+     */
+    void eval_L0000_sym(const doublereal* const x);
+
+    //! Solve the L matrix equations in #m_a by the preconditioned conjugate
+    //! gradient method. The L matrix must have been evaluated in symmetric
+    //! form.
+    void solveLMatrixCG();
+
+    //! Evaluate the multicomponent diffusion coefficients from the truncated
+    //! series. Arguments are as for evalMultiDiffCoeffs().
+    void evalMultiDiffCoeffsSeries(doublereal p, doublereal mmw, size_t ld,
+                                   doublereal* const d);
+
+    //! Use the iterative method. @see setIterativeSolver()
+    bool m_iterative;
+
+    //! Maximum number of conjugate gradient iterations
+    size_t m_cg_maxiter;
+
+    //! Relative tolerance for the conjugate gradient iterations
+    doublereal m_cg_rtol;
+
+    //! Number of iterations taken by the last conjugate gradient solution
+    size_t m_cg_iterations;
+
+    //! Order of the series for the multicomponent diffusion coefficients
+    size_t m_series_order;
+
+    //! Work space for the conjugate gradient iterations (length 12*m_nsp)
+    vector_fp m_cgwork;
+
+    //! Stefan-Maxwell matrix and the terms of the series for the
+    //! multicomponent diffusion coefficients (m_nsp by m_nsp)
+    DenseMatrix m_smatrix, m_vmatrix, m_rmatrix;
+
     DenseMatrix incl;
     bool m_debug;
 };
@@ -670,6 +670,73 @@ public:
         throw NotImplementedError("Transport::getMixDiffCoeffsMass");
     }
 
+    //! @name Properties at multiple states
+    //! These methods evaluate transport properties at a set of `npoints`
+    //! states which share a common pressure. Each state is given by its
+    //! temperature `T[n]` and its mole fractions. Like
+    //! ThermoPhase::getPropertiesBatch(), arrays with a value for each
+    //! species at each state are stored species-major (struct of arrays):
+    //! the mole fraction of species `k` at state `n` is `X[k*npoints + n]`,
+    //! where `nsp` is the number of species. The state of the associated
+    //! ThermoPhase object is the same on return as on entry.
+    //!
+    //! The base class implementations set the state of the phase for each
+    //! point in turn and call the single-state methods. Transport managers
+    //! which can evaluate the properties directly from `T` and `X` override
+    //! them.
+    //! @{
+
+    //! Get mixture-averaged transport properties at a set of states
+    /*!
+     *  @param npoints  Number of states
+     *  @param T        Temperatures [K]. Length npoints.
+     *  @param P        Pressure [Pa]
+     *  @param X        Mole fractions. Length nsp*npoints, with the value
+     *                  for species `k` at state `n` in `X[k*npoints + n]`.
+     *  @param visc     Mixture viscosities [Pa-s], as returned by
+     *                  viscosity(). Length npoints. Not computed if NULL.
+     *  @param cond     Thermal conductivities [W/m/K], as returned by
+     *                  thermalConductivity(). Length npoints. Not computed
+     *                  if NULL.
+     *  @param d        Mixture-averaged diffusion coefficients [m^2/s], as
+     *                  returned by getMixDiffCoeffs(). Length nsp*npoints,
+     *                  with the value for species `k` at state `n` in
+     *                  `d[k*npoints + n]`. Not computed if NULL.
+     */
+    virtual void getMixTransportProperties(size_t npoints,
+                                           const doublereal* T, doublereal P,
+                                           const doublereal* X,
+                                           doublereal* visc, doublereal* cond,
+                                           doublereal* d);
+
+    //! Get multicomponent transport properties at a set of states
+    /*!
+     *  @param npoints  Number of states
+     *  @param T        Temperatures [K]. Length npoints.
+     *  @param P        Pressure [Pa]
+     *  @param X        Mole fractions. Length nsp*npoints, with the value
+     *                  for species `k` at state `n` in `X[k*npoints + n]`.
+     *  @param visc     Mixture viscosities [Pa-s]. Length npoints. Not
+     *                  computed if NULL.
+     *  @param cond     Thermal conductivities [W/m/K]. Length npoints. Not
+     *                  computed if NULL.
+     *  @param d        Multicomponent diffusion coefficients [m^2/s]. Length
+     *                  nsp*nsp*npoints. Element `i = nsp*j + k` of the
+     *                  matrix returned by getMultiDiffCoeffs() with
+     *                  `ld = nsp` is in `d[i*npoints + n]` for state `n`.
+     *                  Not computed if NULL.
+     *  @param dt       Thermal diffusion coefficients [kg/m/s], as returned
+     *                  by getThermalDiffCoeffs(). Length nsp*npoints, with
+     *                  the value for species `k` at state `n` in
+     *                  `dt[k*npoints + n]`. Not computed if NULL.
+     */
+    virtual void getMultiTransportProperties(size_t npoints,
+                                             const doublereal* T, doublereal P,
+                                             const doublereal* X,
+                                             doublereal* visc, doublereal* cond,
+                                             doublereal* d, doublereal* dt);
+    //! @}
+
     //! Set model parameters for derived classes
     /*!
      *  This method may be derived in subclasses to set model-specific
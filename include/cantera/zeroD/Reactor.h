@@ -146,6 +146,21 @@ public:
     //! name of a homogeneous phase species, or the name of a surface species.
     virtual size_t componentIndex(const std::string& nm) const;
 
+    //! Get the derivatives of the species and temperature equations of this
+    //! reactor due to homogeneous chemistry with respect to the species and
+    //! temperature state variables, evaluated at the current state.
+    /*!
+     *  The nonzero entries are appended in coordinate form, with row and
+     *  column indices relative to the start of this reactor's state vector.
+     *  Used by ReactorNet to construct preconditioners for the Krylov linear
+     *  solvers. Terms due to walls, flow devices, and the coupling between
+     *  the species equations and the mass, volume or energy equations are
+     *  neglected.
+     */
+    virtual void getChemistryJacobian(std::vector<size_t>& rows,
+                                      std::vector<size_t>& cols,
+                                      vector_fp& values);
+
 protected:
     //! Set reaction rate multipliers based on the sensitivity variables in
     //! *params*.
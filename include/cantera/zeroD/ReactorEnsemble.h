@@ -0,0 +1,196 @@
+/**
+ *  @file ReactorEnsemble.h
+ *  Header file for class ReactorEnsemble, which integrates many independent
+ *  reactors with different initial conditions in parallel.
+ */
+
+#ifndef CT_REACTORENSEMBLE_H
+#define CT_REACTORENSEMBLE_H
+
+#include "cantera/base/ct_thread.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+namespace Cantera
+{
+
+class Kinetics;
+class XML_Node;
+
+//! Integrate an ensemble of independent constant-pressure, adiabatic reactors
+//! which use the same reaction mechanism but different initial states.
+/*!
+ *  This class is intended for parameter sweeps which require a large number
+ *  of ignition simulations. The work is distributed over a pool of worker
+ *  threads. Each worker makes its own copy of the ThermoPhase and Kinetics
+ *  objects once, sharing the immutable mechanism data with the prototype
+ *  objects, and reuses them for every case it integrates. Workers take the
+ *  next unsolved case from a shared counter whenever they finish a case, so
+ *  the load is balanced even when the integration cost varies strongly
+ *  between cases.
+ *
+ *  Multiple threads are only used if Cantera was compiled with thread safety
+ *  enabled (build_thread_safe = 'y'). Otherwise, all cases are integrated
+ *  sequentially in the calling thread. The tests in test/zeroD/ensemble.cpp
+ *  only exercise the worker threads in a thread safe build.
+ *
+ *  Example:
+ *  @code
+ *  ReactorEnsemble ens("gri30.xml", "gri30");
+ *  for (size_t i = 0; i < 100; i++) {
+ *      ens.addInitialState(1000 + 5*i, OneAtm, "CH4:1, O2:2, N2:7.52");
+ *  }
+ *  ens.setEndTime(1.0);
+ *  ens.run();
+ *  double tau = ens.ignitionDelay(0);
+ *  @endcode
+ *
+ *  @ingroup reactor0
+ */
+class ReactorEnsemble
+{
+public:
+    //! Constructor.
+    //! @param infile  Input file containing the phase definition
+    //! @param id  ID of the phase in `infile`. If empty, the first phase in
+    //!     the file is used.
+    ReactorEnsemble(const std::string& infile, const std::string& id="");
+    virtual ~ReactorEnsemble();
+
+    //! Add a case with the given temperature [K], pressure [Pa], and mole
+    //! fractions.
+    void addInitialState(double T, double P, const std::string& X);
+
+    //! Add a case with the given temperature [K], pressure [Pa], and mole
+    //! fractions (array of length nSpecies()).
+    void addInitialState(double T, double P, const doublereal* X);
+
+    //! Number of cases in the ensemble
+    size_t nStates() const {
+        return m_T0.size();
+    }
+
+    //! Number of species in the reaction mechanism
+    size_t nSpecies() const {
+        return m_thermo->nSpecies();
+    }
+
+    //! Set the time [s] to which each reactor is integrated. Default 1.0 s.
+    void setEndTime(double t) {
+        m_tEnd = t;
+    }
+
+    //! Set the relative and absolute tolerances for the integrator.
+    void setTolerances(double rtol, double atol) {
+        m_rtol = rtol;
+        m_atol = atol;
+    }
+
+    //! Set the linear solver used by the integrator. See
+    //! ReactorNet::setLinearSolverType.
+    void setLinearSolverType(const std::string& type) {
+        m_solverType = type;
+    }
+
+    //! Set the number of worker threads. The default is the number of
+    //! hardware threads available.
+    void setNumThreads(size_t n) {
+        m_nThreads = std::max<size_t>(n, 1);
+    }
+
+    //! Number of worker threads used by run()
+    size_t numThreads() const {
+        return m_nThreads;
+    }
+
+    //! If `save` is true, the state of each reactor is stored after every
+    //! integrator time step and can be retrieved with trajectory().
+    void setSaveTrajectories(bool save) {
+        m_saveTrajectories = save;
+    }
+
+    //! Integrate all cases to the end time.
+    /*!
+     *  Failures of individual cases do not stop the other cases from being
+     *  integrated. Use succeeded() to check the status of each case.
+     */
+    void run();
+
+    //! Returns `true` if case `i` was integrated successfully by the last
+    //! call to run().
+    bool succeeded(size_t i) const {
+        return m_errors.at(i).empty();
+    }
+
+    //! Error message for case `i` if it failed, or an empty string otherwise
+    const std::string& errorMessage(size_t i) const {
+        return m_errors.at(i);
+    }
+
+    //! Ignition delay [s] of case `i`, defined as the time at which the rate
+    //! of temperature rise is largest. NaN if the temperature never
+    //! increases or the case failed.
+    double ignitionDelay(size_t i) const {
+        return m_tau.at(i);
+    }
+
+    //! Final temperature [K] of case `i`
+    double finalTemperature(size_t i) const {
+        return m_Tfinal.at(i);
+    }
+
+    //! Times [s] at which the state of case `i` was saved
+    const vector_fp& trajectoryTimes(size_t i) const {
+        return m_times.at(i);
+    }
+
+    //! States of case `i`, one for each entry in trajectoryTimes(). Each state
+    //! consists of the temperature followed by the nSpecies() mass fractions.
+    const vector_fp& trajectory(size_t i) const {
+        return m_states.at(i);
+    }
+
+protected:
+    //! Integrate cases until none are left. Run by each worker thread.
+    void runWorker();
+
+    //! Integrate case `i` using the given phase and kinetics manager.
+    void solve(size_t i, ThermoPhase& thermo, Kinetics& kin);
+
+    //! Index of the next case to integrate, or npos if all have been taken
+    size_t nextCase();
+
+    //! Phase definition. Owned by the Application XML file cache.
+    XML_Node* m_phase_xml;
+
+    //! Phase used to set the initial states, and prototype for the phases
+    //! used by the workers
+    ThermoPhase* m_thermo;
+
+    //! Prototype for the kinetics managers used by the workers
+    Kinetics* m_kin;
+
+    // Initial states
+    vector_fp m_T0, m_P0;
+    std::vector<vector_fp> m_X0;
+
+    double m_tEnd;
+    double m_rtol, m_atol;
+    std::string m_solverType;
+    size_t m_nThreads;
+    bool m_saveTrajectories;
+
+    // Results
+    vector_fp m_tau, m_Tfinal;
+    std::vector<std::string> m_errors;
+    std::vector<vector_fp> m_times, m_states;
+
+    //! Index of the next case to be integrated
+    size_t m_next;
+
+    //! Mutex for m_next and for object construction by the workers
+    mutex_t m_mutex;
+};
+
+}
+
+#endif
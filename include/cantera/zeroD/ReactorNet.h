@@ -9,6 +9,7 @@
 #include "Reactor.h"
 #include "cantera/numerics/FuncEval.h"
 #include "cantera/numerics/Integrator.h"
+#include "cantera/numerics/SparseLU.h"
 #include "cantera/base/Array.h"
 
 namespace Cantera
@@ -75,6 +76,16 @@ public:
         m_init = false;
     }
 
+    //! Set the linear solver used by the integrator.
+    /*!
+     *  @param type  "DENSE" (the default) uses a direct solver with a
+     *      finite difference Jacobian. "GMRES" and "BICGSTAB" use the
+     *      corresponding Krylov iterative solvers, preconditioned with a
+     *      sparse LU factorization of the chemistry part of the Jacobian,
+     *      which is much less expensive for large mechanisms.
+     */
+    void setLinearSolverType(const std::string& type);
+
     //! Current value of the simulation time.
     doublereal time() {
         return m_time;
@@ -200,6 +211,10 @@ public:
     virtual size_t nparams() {
         return m_ntotpar;
     }
+    virtual bool preconditionerSetup(double t, double* y, double gamma,
+                                     bool jok);
+    virtual void preconditionerSolve(double t, double* y, double* r,
+                                     double* z);
 
     //! Return the index corresponding to the component named *component* in the
     //! reactor with index *reactor* in the global state vector for the
@@ -269,6 +284,16 @@ protected:
 
     vector_fp m_ydot;
 
+    //! Chemistry part of the Jacobian, in coordinate form. Used to construct
+    //! the preconditioner for the Krylov linear solvers.
+    std::vector<size_t> m_jac_rows, m_jac_cols;
+    vector_fp m_jac_values;
+
+    //! Preconditioner matrix \f$ I - \gamma J \f$ and its factorization
+    std::vector<size_t> m_precon_rows, m_precon_cols;
+    vector_fp m_precon_values;
+    SparseLU m_precon;
+
     std::vector<bool> m_iown;
 };
 }
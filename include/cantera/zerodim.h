@@ -9,5 +9,6 @@
 #include "zeroD/ConstPressureReactor.h"
 #include "zeroD/IdealGasReactor.h"
 #include "zeroD/IdealGasConstPressureReactor.h"
+#include "zeroD/ReactorEnsemble.h"
 
 #endif
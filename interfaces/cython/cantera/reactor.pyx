@@ -801,6 +801,16 @@ cdef class ReactorNet:
         def __set__(self, n):
             self.net.setMaxErrTestFails(n)
 
+    property linear_solver_type:
+        """
+        The linear solver used by the integrator. One of ``'DENSE'`` (the
+        default), or ``'GMRES'`` or ``'BICGSTAB'``, which use iterative
+        solvers preconditioned with a sparse factorization of the chemistry
+        Jacobian and are faster for large mechanisms.
+        """
+        def __set__(self, solver_type):
+            self.net.setLinearSolverType(stringify(solver_type))
+
     property rtol:
         """
         The relative error tolerance used while integrating the reactor
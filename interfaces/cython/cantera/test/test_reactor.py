@@ -284,6 +284,21 @@ class TestReactor(utilities.CanteraTest):
         self.assertNear(self.r1.T, 500)
         self.assertNear(self.r2.T, 500)
 
+    def test_linear_solver_type(self):
+        states = []
+        for solver in ('DENSE', 'GMRES', 'BICGSTAB'):
+            self.make_reactors(T1=1200, X1='H2:2.0, O2:1.0, AR:4.0', T2=300)
+            self.add_wall(A=0.1, U=100)
+            self.net.linear_solver_type = solver
+            self.net.advance(0.01)
+            states.append((self.r1.T, self.r2.T, self.r1.thermo['H2O'].Y[0]))
+
+        for state in states[1:]:
+            self.assertArrayNear(state, states[0], 1e-5)
+
+        with self.assertRaises(Exception):
+            self.net.linear_solver_type = 'spam'
+
     def test_heat_flux_func(self):
         self.make_reactors(T1=500, T2=300)
         self.r1.volume = 0.5
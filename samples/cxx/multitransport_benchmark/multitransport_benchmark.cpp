@@ -0,0 +1,175 @@
+/*!
+ * @file multitransport_benchmark.cpp
+ *
+ * Benchmark for the multicomponent transport properties of mechanisms of
+ * increasing size. Compares the direct solution of the transport linear
+ * systems with the iterative method selected by
+ * MultiTransport::setIterativeSolver, for the thermal conductivity and
+ * thermal diffusion coefficients, and for the multicomponent diffusion
+ * coefficients.
+ *
+ * Larger mechanisms are made from copies of the GRI-Mech 3.0 species, with
+ * the Lennard-Jones parameters of each copy shifted slightly so that the
+ * copies are distinct. The states span a premixed methane flame, with the
+ * mole fractions of each species split evenly between its copies, and are
+ * evaluated in sequence as they would be across a flame grid.
+ *
+ * Usage: multitransport_benchmark [max. number of copies] [number of states]
+ */
+
+#include "cantera/IdealGasMix.h"
+#include "cantera/thermo/Species.h"
+#include "cantera/transport/MultiTransport.h"
+#include "cantera/transport/TransportData.h"
+#include "cantera/base/stringUtils.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+using namespace Cantera;
+
+static double elapsed(clock_t t0)
+{
+    return double(clock() - t0) / CLOCKS_PER_SEC;
+}
+
+//! Create a phase containing `ncopies` copies of each species in `gas`
+IdealGasPhase* makePhase(IdealGasMix& gas, size_t ncopies)
+{
+    IdealGasPhase* phase = new IdealGasPhase();
+    for (size_t m = 0; m < gas.nElements(); m++) {
+        phase->addElement(gas.elementName(m), gas.atomicWeight(m));
+    }
+    for (size_t n = 0; n < ncopies; n++) {
+        for (size_t k = 0; k < gas.nSpecies(); k++) {
+            Species sp = gas.species(gas.speciesName(k));
+            GasTransportData* tr = new GasTransportData(
+                dynamic_cast<GasTransportData&>(*sp.transport));
+            tr->diameter *= 1.0 + 0.02 * n;
+            tr->well_depth *= 1.0 + 0.05 * n;
+            sp.transport.reset(tr);
+            if (n) {
+                sp.name += "_" + int2str(n);
+            }
+            phase->addSpecies(sp);
+        }
+    }
+    phase->initThermo();
+    return phase;
+}
+
+void runBenchmark(size_t maxCopies, size_t nStates)
+{
+    IdealGasMix gas("gri30.xml", "gri30");
+    size_t K0 = gas.nSpecies();
+
+    // States between the unburned and burned mixtures
+    vector_fp T(nStates), X0(nStates*K0), xu(K0), xb(K0);
+    gas.setState_TPX(300.0, OneAtm, "CH4:1, O2:2, N2:7.52");
+    gas.getMoleFractions(&xu[0]);
+    gas.setState_TP(2200.0, OneAtm);
+    gas.equilibrate("TP");
+    gas.getMoleFractions(&xb[0]);
+    for (size_t n = 0; n < nStates; n++) {
+        double f = (nStates > 1) ? double(n) / (nStates - 1) : 0.5;
+        T[n] = 300.0 + 1900.0 * f;
+        for (size_t k = 0; k < K0; k++) {
+            X0[n*K0 + k] = (1 - f) * xu[k] + f * xb[k];
+        }
+    }
+
+    printf("%d states, times in ms per state\n\n", static_cast<int>(nStates));
+    printf("%6s %32s %7s %54s\n", "", "conductivity and thermal diffusion",
+           "", "multicomponent diffusion coefficients");
+    printf("%6s %10s %10s %10s %7s %10s %10s %10s %10s %10s\n", "K",
+           "direct", "CG", "error", "CG its", "direct", "series(1)", "error",
+           "series(2)", "error");
+
+    for (size_t ncopies = 1; ncopies <= maxCopies; ncopies *= 2) {
+        std::auto_ptr<IdealGasPhase> phase(makePhase(gas, ncopies));
+        size_t K = phase->nSpecies();
+        vector_fp X(K), dt(K), d(K*K), dIter(K*K);
+        vector_fp cond(nStates), dtDirect(nStates*K);
+        MultiTransport tran;
+        tran.init(phase.get());
+
+        double times[5], dErr[2];
+        double condErr = 0.0;
+        size_t iterations = 0;
+        for (int method = 0; method < 2; method++) {
+            tran.setIterativeSolver(method == 1);
+            clock_t t0 = clock();
+            for (size_t n = 0; n < nStates; n++) {
+                for (size_t k = 0; k < K; k++) {
+                    X[k] = X0[n*K0 + k % K0] / ncopies;
+                }
+                phase->setState_TPX(T[n], OneAtm, &X[0]);
+                double lambda = tran.thermalConductivity();
+                tran.getThermalDiffCoeffs(&dt[0]);
+                if (method == 0) {
+                    cond[n] = lambda;
+                    copy(dt.begin(), dt.end(), dtDirect.begin() + n*K);
+                } else {
+                    iterations += tran.lastIterationCount();
+                    condErr = std::max(condErr,
+                                       std::abs(lambda - cond[n]) / cond[n]);
+                    double dtmax = 0.0, err = 0.0;
+                    for (size_t k = 0; k < K; k++) {
+                        dtmax = std::max(dtmax, std::abs(dtDirect[n*K + k]));
+                        err = std::max(err, std::abs(dt[k] - dtDirect[n*K + k]));
+                    }
+                    condErr = std::max(condErr, err / dtmax);
+                }
+            }
+            times[method] = elapsed(t0);
+        }
+
+        // The multicomponent diffusion coefficients are compared at the
+        // middle state, for the direct method and the first and second
+        // order series
+        for (size_t k = 0; k < K; k++) {
+            X[k] = X0[(nStates/2)*K0 + k % K0] / ncopies;
+        }
+        phase->setState_TPX(T[nStates/2], OneAtm, &X[0]);
+        for (int method = 0; method < 3; method++) {
+            tran.setIterativeSolver(method != 0, 50, 1.0e-8, method);
+            clock_t t0 = clock();
+            for (size_t n = 0; n < nStates; n++) {
+                tran.getMultiDiffCoeffs(K, (method == 0) ? &d[0] : &dIter[0]);
+            }
+            times[method + 2] = elapsed(t0);
+            if (method != 0) {
+                double dmax = 0.0, err = 0.0;
+                for (size_t i = 0; i < K*K; i++) {
+                    dmax = std::max(dmax, std::abs(d[i]));
+                    err = std::max(err, std::abs(dIter[i] - d[i]));
+                }
+                dErr[method - 1] = err / dmax;
+            }
+        }
+
+        printf("%6d %10.3f %10.3f %10.2g %7.1f %10.3f %10.3f %10.2g "
+               "%10.3f %10.2g\n", static_cast<int>(K),
+               1e3 * times[0] / nStates, 1e3 * times[1] / nStates, condErr,
+               double(iterations) / nStates, 1e3 * times[2] / nStates,
+               1e3 * times[3] / nStates, dErr[0], 1e3 * times[4] / nStates,
+               dErr[1]);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t maxCopies = (argc > 1) ? std::atoi(argv[1]) : 8;
+    size_t nStates = (argc > 2) ? std::atoi(argv[2]) : 10;
+    try {
+        runBenchmark(maxCopies, nStates);
+        appdelete();
+        return 0;
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        std::cout << " terminating... " << std::endl;
+        appdelete();
+        return 1;
+    }
+}
@@ -0,0 +1,114 @@
+/*!
+ * @file setstate_benchmark.cpp
+ *
+ * Benchmark for recovering the temperature from the specific enthalpy, as is
+ * done by CFD codes for every cell at every time step. Compares the general
+ * iteration in ThermoPhase::setState_HP, the ideal gas specialization in
+ * IdealGasPhase::setState_HP, and the batched method
+ * IdealGasPhase::getTemperatureBatch_HP.
+ *
+ * Usage: setstate_benchmark [number of cells]
+ */
+
+#include "cantera/IdealGasMix.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+using namespace Cantera;
+
+static double elapsed(clock_t t0)
+{
+    return double(clock() - t0) / CLOCKS_PER_SEC;
+}
+
+void runBenchmark(size_t nCells)
+{
+    IdealGasMix gas("gri30.xml", "gri30");
+    size_t K = gas.nSpecies();
+
+    // Cell states: temperatures and compositions spanning a premixed flame.
+    // The previous temperature of each cell, used as the initial estimate,
+    // differs from the solution by a few kelvin, as it would between two
+    // time steps.
+    vector_fp T(nCells), Tprev(nCells), h(nCells), Y(K*nCells), y(K);
+    std::srand(1);
+    for (size_t j = 0; j < nCells; j++) {
+        double z = double(j) / nCells;
+        T[j] = 300.0 + 1900.0 * z;
+        Tprev[j] = T[j] + 10.0 * (double(std::rand()) / RAND_MAX - 0.5);
+        gas.setState_TPX(T[j], OneAtm, "CH4:1, O2:2, N2:7.52");
+        if (z > 0.5) {
+            gas.equilibrate("TP");
+        }
+        gas.getMassFractions(&y[0]);
+        for (size_t k = 0; k < K; k++) {
+            Y[k*nCells + j] = y[k];
+        }
+        h[j] = gas.enthalpy_mass();
+    }
+
+    const char* names[3] = {"ThermoPhase::setState_HP",
+                            "IdealGasPhase::setState_HP",
+                            "IdealGasPhase::getTemperatureBatch_HP"};
+    printf("%d cells\n", static_cast<int>(nCells));
+
+    // Warm start from the previous temperature, and cold start from 300 K
+    for (int start = 0; start < 2; start++) {
+        vector_fp T0 = Tprev;
+        if (start == 1) {
+            T0.assign(nCells, 300.0);
+        }
+        double err[3] = {0.0, 0.0, 0.0};
+        double times[3];
+        for (int method = 0; method < 2; method++) {
+            clock_t t0 = clock();
+            for (size_t j = 0; j < nCells; j++) {
+                for (size_t k = 0; k < K; k++) {
+                    y[k] = Y[k*nCells + j];
+                }
+                gas.setState_TPY(T0[j], OneAtm, &y[0]);
+                if (method == 0) {
+                    gas.ThermoPhase::setState_HP(h[j], OneAtm);
+                } else {
+                    gas.setState_HP(h[j], OneAtm);
+                }
+                err[method] = std::max(err[method],
+                                       std::abs(gas.temperature() - T[j]));
+            }
+            times[method] = elapsed(t0);
+        }
+
+        vector_fp Tout(T0);
+        clock_t t0 = clock();
+        gas.getTemperatureBatch_HP(nCells, &h[0], &Y[0], &Tout[0]);
+        times[2] = elapsed(t0);
+        for (size_t j = 0; j < nCells; j++) {
+            err[2] = std::max(err[2], std::abs(Tout[j] - T[j]));
+        }
+
+        printf("\n%s start\n", (start == 0) ? "Warm" : "Cold");
+        printf("%-40s %12s %12s %12s\n", "method", "time (s)", "us/cell",
+               "max |dT|");
+        for (int i = 0; i < 3; i++) {
+            printf("%-40s %12.4f %12.3f %12.3g\n", names[i], times[i],
+                   1e6 * times[i] / nCells, err[i]);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t nCells = (argc > 1) ? std::atoi(argv[1]) : 20000;
+    try {
+        runBenchmark(nCells);
+        appdelete();
+        return 0;
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        std::cout << " terminating... " << std::endl;
+        appdelete();
+        return 1;
+    }
+}
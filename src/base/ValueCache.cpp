@@ -7,24 +7,28 @@
 
 namespace
 {
-Cantera::mutex_t id_mutex;
+//! The last assigned id. Incremented atomically by ValueCache::getId().
+Cantera::atomic_count_t last_id(0);
 }
 
 namespace Cantera
 {
 
-int ValueCache::m_last_id = 0;
-
 int ValueCache::getId()
 {
-    ScopedLock lock(id_mutex);
-    return ++m_last_id;
+    return static_cast<int>(++last_id);
 }
 
 void ValueCache::clear()
 {
-    m_scalarCache.clear();
-    m_arrayCache.clear();
+    // Reset the entries rather than erasing them, so that references to
+    // cached values which are currently held remain valid
+    for (size_t i = 0; i < m_scalarCache.size(); i++) {
+        m_scalarCache[i] = CachedValue<double>();
+    }
+    for (size_t i = 0; i < m_arrayCache.size(); i++) {
+        m_arrayCache[i] = CachedValue<vector_fp>();
+    }
 }
 
 }
@@ -295,6 +295,10 @@ public:
      *  file has already been processed, then just the pointer will
      *  be returned.
      *
+     *  Files with the extension '.ctb' are read as binary files created with
+     *  ctml::ct2ctb(). These are read without parsing, but produce the same
+     *  XML tree as the equivalent CTI or XML files.
+     *
      * @param file String containing the relative or absolute file name
      * @param debug Debug flag
      */
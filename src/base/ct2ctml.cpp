@@ -7,6 +7,7 @@
 
 #include "cantera/base/ctml.h"
 #include "cantera/base/stringUtils.h"
+#include "cantera/base/global.h"
 #include "../../ext/libexecstream/exec-stream.h"
 
 #include <fstream>
@@ -77,6 +78,16 @@ void ct2ctml(const char* file, const int debug)
     out << xml;
 }
 
+void ct2ctb(const std::string& file, const std::string& out_name)
+{
+    XML_Node* x = get_XML_File(file);
+    std::ofstream out(out_name.c_str(), std::ios::out | std::ios::binary);
+    if (!out) {
+        throw CanteraError("ct2ctb", "cannot open " + out_name + " for writing.");
+    }
+    x->writeBinary(out);
+}
+
 static std::string call_ctml_writer(const std::string& text, bool isfile)
 {
     std::string file, arg;
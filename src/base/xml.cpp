@@ -12,6 +12,7 @@
 #include "cantera/base/utilities.h"
 
 #include <sstream>
+#include <algorithm>
 
 using namespace std;
 
@@ -107,20 +108,44 @@ public:
 
 //////////////////// XML_Reader methods ///////////////////////
 
+//! Number of characters read from the input stream at a time by XML_Reader
+static const size_t XML_ReaderChunkSize = 65536;
+
 XML_Reader::XML_Reader(std::istream& input) :
     m_s(input),
+    m_pos(0),
     m_line(0)
 {
 }
 
+bool XML_Reader::fill()
+{
+    // Discard the characters which have already been read, and append the
+    // next chunk of the input
+    m_buffer.erase(0, m_pos);
+    m_pos = 0;
+    size_t n = m_buffer.size();
+    m_buffer.resize(n + XML_ReaderChunkSize);
+    m_s.read(&m_buffer[n], XML_ReaderChunkSize);
+    m_buffer.resize(n + static_cast<size_t>(m_s.gcount()));
+    return m_buffer.size() > n;
+}
+
 void XML_Reader::getchr(char& ch)
 {
-    m_s.get(ch);
-    if (ch == '\n') {
-        m_line++;
+    if (m_pos < m_buffer.size() || fill()) {
+        ch = m_buffer[m_pos++];
+        if (ch == '\n') {
+            m_line++;
+        }
     }
 }
 
+bool XML_Reader::eof()
+{
+    return m_pos >= m_buffer.size() && !fill();
+}
+
 //! Find the first position of a character, q, in string, s, which is not
 //! immediately preceded by the backslash character
 /*!
@@ -234,15 +259,23 @@ std::string XML_Reader::readTag(std::map<std::string, std::string>& attribs)
 {
     string name, tag = "";
     bool incomment = false;
-    char ch  = '-';
-    while (1) {
-        if (m_s.eof() || (getchr(ch), ch == '<')) {
+
+    // Skip to the start of the next tag
+    while (true) {
+        size_t istart = m_buffer.find('<', m_pos);
+        bool found = (istart != npos);
+        istart = (found) ? istart + 1 : m_buffer.size();
+        m_line += static_cast<int>(std::count(m_buffer.begin() + m_pos,
+                                              m_buffer.begin() + istart, '\n'));
+        m_pos = istart;
+        if (found || !fill()) {
             break;
         }
     }
-    char ch1 = ' ', ch2 = ' ';
+
+    char ch = '<', ch1 = ' ', ch2 = ' ';
     while (1) {
-        if (m_s.eof()) {
+        if (eof()) {
             tag = "EOF";
             break;
         }
@@ -278,30 +311,35 @@ std::string XML_Reader::readTag(std::map<std::string, std::string>& attribs)
 
 std::string XML_Reader::readValue()
 {
-    string tag = "";
-    char ch, lastch;
-    ch = '\n';
+    // The value extends up to the start of the next tag, which may be in a
+    // later chunk of the input
+    string tag;
+    char ch = '\n', lastch;
     bool front = true;
-    while (1) {
-        if (m_s.eof()) {
-            break;
+    while (true) {
+        size_t iend = m_buffer.find('<', m_pos);
+        bool found = (iend != npos);
+        if (!found) {
+            iend = m_buffer.size();
         }
-        lastch = ch;
-        getchr(ch);
-        if (ch == '\n') {
-            front = true;
-        } else if (ch != ' ') {
-            front = false;
+        tag.reserve(tag.size() + iend - m_pos);
+        for (; m_pos < iend; m_pos++) {
+            lastch = ch;
+            ch = m_buffer[m_pos];
+            if (ch == '\n') {
+                m_line++;
+                front = true;
+            } else if (ch != ' ') {
+                front = false;
+            }
+            // Collapse the indentation at the start of each line
+            if (!(front && lastch == ' ' && ch == ' ')) {
+                tag += ch;
+            }
         }
-        if (ch == '<') {
-            m_s.putback(ch);
+        if (found || !fill()) {
             break;
         }
-        if (front && lastch == ' ' && ch == ' ') {
-            ;
-        } else {
-            tag += ch;
-        }
     }
     return stripws(tag);
 }
@@ -751,51 +789,232 @@ void XML_Node::writeHeader(std::ostream& s)
     s << "<?xml version=\"1.0\"?>" << endl;
 }
 
+//! Handler which adds the elements read by XML_Node::parse() to a tree
+class XML_TreeBuilder : public XML_Handler
+{
+public:
+    //! @param top  Node to which the elements at the top level are added
+    XML_TreeBuilder(XML_Node* top) :
+        m_top(top),
+        m_node(top) {
+    }
+
+    virtual void startElement(const std::string& name, const std::string& value,
+                              std::map<std::string, std::string>& attribs,
+                              int line) {
+        m_node = &m_node->addChild(name);
+        m_node->addValue(value);
+        m_node->attribs().swap(attribs);
+        m_node->setLineNumber(line);
+    }
+
+    virtual void endElement(const std::string& name) {
+        m_node = m_node->parent();
+    }
+
+    virtual void comment(const std::string& text) {
+        // Empty comments are not added to a default-named root node
+        if (text.empty() && m_top->name() == "--" && &m_top->root() == m_top) {
+            return;
+        }
+        m_node->addComment(text);
+    }
+
+protected:
+    //! Node on which build() was called
+    XML_Node* m_top;
+
+    //! Node to which the next element is added
+    XML_Node* m_node;
+};
+
 void XML_Node::build(std::istream& f)
+{
+    XML_TreeBuilder builder(this);
+    parse(f, builder);
+}
+
+void XML_Node::parse(std::istream& f, XML_Handler& handler)
 {
     XML_Reader r(f);
-    string nm, nm2, val;
-    XML_Node* node = this;
-    map<string, string> node_attribs;
-    while (!f.eof()) {
-        node_attribs.clear();
-        nm = r.readTag(node_attribs);
+    string nm, val;
+    map<string, string> attribs;
+    vector<string> open;
+    while (true) {
+        attribs.clear();
+        nm = r.readTag(attribs);
 
         if (nm == "EOF") {
             break;
         }
-        if (nm == "--" && m_name == "--" && m_root == this) {
-            continue;
-        }
         int lnum = r.m_line;
         if (nm[nm.size() - 1] == '/') {
-            nm2 = nm.substr(0,nm.size()-1);
-            node = &node->addChild(nm2);
-            node->addValue("");
-            node->attribs() = node_attribs;
-            node->setLineNumber(lnum);
-            node = node->parent();
+            nm.erase(nm.size() - 1);
+            handler.startElement(nm, "", attribs, lnum);
+            handler.endElement(nm);
         } else if (nm[0] != '/') {
             if (nm[0] != '!' && nm[0] != '-' && nm[0] != '?') {
-                node = &node->addChild(nm);
                 val = r.readValue();
-                node->addValue(val);
-                node->attribs() = node_attribs;
-                node->setLineNumber(lnum);
+                handler.startElement(nm, val, attribs, lnum);
+                open.push_back(nm);
             } else if (nm.substr(0,2) == "--") {
                 if (nm.substr(nm.size()-2,2) == "--") {
-                    node->addComment(nm.substr(2,nm.size()-4));
+                    handler.comment(nm.substr(2,nm.size()-4));
                 }
             }
         } else {
-            if (node->name() != nm.substr(1,nm.size()-1)) {
-                throw XML_TagMismatch(node->name(), nm.substr(1,nm.size()-1), lnum);
+            nm.erase(0, 1);
+            if (open.empty() || open.back() != nm) {
+                throw XML_TagMismatch(open.empty() ? "" : open.back(), nm, lnum);
             }
-            node = node->parent();
+            handler.endElement(nm);
+            open.pop_back();
         }
     }
 }
 
+//! Magic number identifying the binary representation of an XML tree
+static const char binaryMagic[] = "CTBX";
+
+//! Version of the binary format written by XML_Node::writeBinary
+static const unsigned int binaryVersion = 1;
+
+//! Write an unsigned integer as four bytes, least significant byte first
+static void writeBinaryInt(std::ostream& s, unsigned int n)
+{
+    char b[4];
+    for (int i = 0; i < 4; i++) {
+        b[i] = static_cast<char>((n >> (8*i)) & 0xff);
+    }
+    s.write(b, 4);
+}
+
+static void writeBinaryString(std::ostream& s, const std::string& str)
+{
+    writeBinaryInt(s, static_cast<unsigned int>(str.size()));
+    s.write(str.data(), str.size());
+}
+
+//! Sequential reader for a buffer containing a binary XML tree
+class XML_BinaryReader
+{
+public:
+    XML_BinaryReader(const std::string& buf) :
+        m_data(buf.data()),
+        m_end(buf.data() + buf.size()) {
+    }
+
+    unsigned int readInt() {
+        require(4);
+        unsigned int n = 0;
+        for (int i = 0; i < 4; i++) {
+            n |= static_cast<unsigned int>(
+                     static_cast<unsigned char>(m_data[i])) << (8*i);
+        }
+        m_data += 4;
+        return n;
+    }
+
+    void readString(std::string& str) {
+        size_t n = readInt();
+        require(n);
+        str.assign(m_data, n);
+        m_data += n;
+    }
+
+    void require(size_t n) {
+        if (static_cast<size_t>(m_end - m_data) < n) {
+            throw CanteraError("XML_Node::buildBinary",
+                               "Unexpected end of binary data");
+        }
+    }
+
+    const char* m_data;
+    const char* m_end;
+};
+
+void XML_Node::writeBinary(std::ostream& s) const
+{
+    s.write(binaryMagic, 4);
+    writeBinaryInt(s, binaryVersion);
+    writeBinary_int(s);
+}
+
+void XML_Node::writeBinary_int(std::ostream& s) const
+{
+    writeBinaryString(s, m_name);
+    writeBinaryString(s, m_value);
+    writeBinaryInt(s, static_cast<unsigned int>(m_linenum));
+    writeBinaryInt(s, static_cast<unsigned int>(m_attribs.size()));
+    map<string,string>::const_iterator b = m_attribs.begin();
+    for (; b != m_attribs.end(); ++b) {
+        writeBinaryString(s, b->first);
+        writeBinaryString(s, b->second);
+    }
+    writeBinaryInt(s, static_cast<unsigned int>(m_children.size()));
+    for (size_t i = 0; i < m_children.size(); i++) {
+        m_children[i]->writeBinary_int(s);
+    }
+}
+
+//! Read the contents of a node, following its name, and all of its children
+static void readBinaryNode(XML_BinaryReader& r, XML_Node& node)
+{
+    std::string str, key;
+    r.readString(str);
+    node.addValue(str);
+    node.setLineNumber(static_cast<int>(r.readInt()));
+    size_t nAttribs = r.readInt();
+    for (size_t i = 0; i < nAttribs; i++) {
+        r.readString(key);
+        r.readString(str);
+        node.addAttribute(key, str);
+    }
+    size_t nChildren = r.readInt();
+    for (size_t i = 0; i < nChildren; i++) {
+        r.readString(str);
+        readBinaryNode(r, node.addChild(str));
+    }
+}
+
+void XML_Node::buildBinary(std::istream& f)
+{
+    // Read the whole file in a single operation, and then decode it from
+    // memory.
+    std::string buf;
+    f.seekg(0, std::ios::end);
+    std::streamoff size = f.tellg();
+    if (size < 0) {
+        throw CanteraError("XML_Node::buildBinary", "Error reading input");
+    }
+    buf.resize(static_cast<size_t>(size));
+    f.seekg(0, std::ios::beg);
+    if (size) {
+        f.read(&buf[0], size);
+    }
+    XML_BinaryReader r(buf);
+    r.require(4);
+    if (buf.compare(0, 4, binaryMagic) != 0) {
+        throw CanteraError("XML_Node::buildBinary",
+                           "Input is not a binary Cantera input file");
+    }
+    r.m_data += 4;
+    unsigned int version = r.readInt();
+    if (version != binaryVersion) {
+        throw CanteraError("XML_Node::buildBinary",
+                           "Unsupported binary format version " +
+                           int2str(static_cast<int>(version)));
+    }
+    std::string name;
+    r.readString(name);
+    setName(name);
+    readBinaryNode(r, *this);
+    if (r.m_data != r.m_end) {
+        throw CanteraError("XML_Node::buildBinary",
+                           "Unexpected data after the end of the XML tree");
+    }
+}
+
 void XML_Node::copyUnion(XML_Node* const node_dest) const
 {
     XML_Node* sc, *dc;
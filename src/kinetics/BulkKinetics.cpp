@@ -174,6 +174,9 @@ void BulkKinetics::init()
 void BulkKinetics::finalize()
 {
     m_finalized = true;
+    m_reactantStoich.finalize();
+    m_revProductStoich.finalize();
+    m_irrevProductStoich.finalize();
 
     // Guarantee that these arrays can be converted to double* even in the
     // special case where there are no reactions defined.
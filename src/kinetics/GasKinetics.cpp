@@ -18,7 +18,10 @@ GasKinetics::GasKinetics(thermo_t* thermo) :
     m_logp_ref(0.0),
     m_logc_ref(0.0),
     m_logStandConc(0.0),
-    m_pres(0.0)
+    m_pres(0.0),
+    m_jac_nrxn(npos),
+    m_jac_nfwd(0),
+    m_jac_nrev(0)
 {
 }
 
@@ -36,6 +39,8 @@ void GasKinetics::update_rates_T()
     m_logStandConc = log(thermo().standardConcentration());
     doublereal logT = log(T);
 
+    // Quantities which depend only on temperature are evaluated once for each
+    // temperature
     if (T != m_temp) {
         if (!m_rfn.empty()) {
             m_rates.update(T, logT, &m_rfn[0]);
@@ -48,10 +53,30 @@ void GasKinetics::update_rates_T()
         if (!falloff_work.empty()) {
             m_falloffn.updateTemp(T, &falloff_work[0]);
         }
+        if (m_plog_rates.nReactions()) {
+            m_plog_rates.updateTemp(T, logT);
+        }
+        if (m_cheb_rates.nReactions()) {
+            m_cheb_rates.updateTemp(T, logT);
+        }
         updateKc();
         m_ROP_ok = false;
     }
 
+    // The pressure-dependent parts of P-log and Chebyshev reactions are only
+    // updated when the pressure changes
+    if (P != m_pres) {
+        if (m_plog_rates.nReactions()) {
+            double logP = log(P);
+            m_plog_rates.update_C(&logP);
+        }
+        if (m_cheb_rates.nReactions()) {
+            double log10P = log10(P);
+            m_cheb_rates.update_C(&log10P);
+        }
+    }
+
+    // Combine the cached temperature- and pressure-dependent parts
     if (T != m_temp || P != m_pres) {
         if (m_plog_rates.nReactions()) {
             m_plog_rates.update(T, logT, &m_rfn[0]);
@@ -82,18 +107,6 @@ void GasKinetics::update_rates_C()
         m_falloff_concm.update(m_conc, ctot, &concm_falloff_values[0]);
     }
 
-    // P-log reactions
-    if (m_plog_rates.nReactions()) {
-        double logP = log(thermo().pressure());
-        m_plog_rates.update_C(&logP);
-    }
-
-    // Chebyshev reactions
-    if (m_cheb_rates.nReactions()) {
-        double log10P = log10(thermo().pressure());
-        m_cheb_rates.update_C(&log10P);
-    }
-
     m_ROP_ok = false;
 }
 
@@ -240,6 +253,473 @@ void GasKinetics::getFwdRateConstants(doublereal* kfwd)
     }
 }
 
+void GasKinetics::getNetProductionRatesBatch(size_t nStates,
+                                             const doublereal* T,
+                                             const doublereal* P,
+                                             const doublereal* Y,
+                                             doublereal* wdot)
+{
+    size_t n = nStates;
+    if (n == 0) {
+        return;
+    } else if (m_ii == 0) {
+        fill(wdot, wdot + m_kk * n, 0.0);
+        return;
+    }
+    vector_fp state;
+    thermo().saveState(state);
+
+    m_batch_logT.resize(n);
+    m_batch_recipT.resize(n);
+    m_batch_logStandConc.resize(n);
+    m_batch_ctot.resize(n);
+    m_batch_conc.resize(m_kk * n);
+    m_batch_grt.resize(m_kk * n);
+    m_batch_rfn.resize(m_ii * n);
+    m_batch_rkcn.resize(m_ii * n);
+    m_batch_ropf.resize(m_ii * n);
+    m_batch_ropr.resize(m_ii * n);
+    m_batch_rfn_low.resize(m_nfall * n);
+    m_batch_rfn_high.resize(m_nfall * n);
+    m_batch_concm_3b.resize(concm_3b_values.size() * n);
+    m_batch_concm_falloff.resize(concm_falloff_values.size() * n);
+    size_t nwork = falloff_work.size();
+    m_batch_falloff_work.resize(nwork * n);
+
+    // Evaluate the thermodynamic properties and the pressure-dependent rate
+    // expressions one state at a time, scattering the results into the
+    // batch arrays.
+    vector_fp y(m_kk);
+    for (size_t j = 0; j < n; j++) {
+        for (size_t k = 0; k < m_kk; k++) {
+            y[k] = Y[k*n + j];
+        }
+        thermo().setState_TPY(T[j], P[j], &y[0]);
+        thermo().getActivityConcentrations(&m_conc[0]);
+        thermo().getStandardChemPotentials(&m_grt[0]);
+        for (size_t k = 0; k < m_kk; k++) {
+            m_batch_conc[k*n + j] = m_conc[k];
+            m_batch_grt[k*n + j] = m_grt[k];
+        }
+        m_batch_ctot[j] = thermo().molarDensity();
+        m_batch_logStandConc[j] = log(thermo().standardConcentration());
+        m_batch_logT[j] = log(T[j]);
+        m_batch_recipT[j] = 1.0 / T[j];
+
+        if (nwork) {
+            m_falloffn.updateTemp(T[j], &m_batch_falloff_work[j*nwork]);
+        }
+        if (m_plog_rates.nReactions()) {
+            double logP = log(P[j]);
+            m_plog_rates.update_C(&logP);
+            m_plog_rates.update(1, &m_batch_logT[j], &m_batch_recipT[j],
+                                &m_batch_rfn[j], n);
+        }
+        if (m_cheb_rates.nReactions()) {
+            double log10P = log10(P[j]);
+            m_cheb_rates.update_C(&log10P);
+            m_cheb_rates.update(1, &m_batch_logT[j], &m_batch_recipT[j],
+                                &m_batch_rfn[j], n);
+        }
+    }
+
+    // Temperature-dependent rate coefficients
+    m_rates.update(n, &m_batch_logT[0], &m_batch_recipT[0],
+                   &m_batch_rfn[0], n);
+    if (m_nfall) {
+        m_falloff_low_rates.update(n, &m_batch_logT[0], &m_batch_recipT[0],
+                                   &m_batch_rfn_low[0], n);
+        m_falloff_high_rates.update(n, &m_batch_logT[0], &m_batch_recipT[0],
+                                    &m_batch_rfn_high[0], n);
+    }
+
+    // Reciprocals of the equilibrium constants
+    fill(m_batch_rkcn.begin(), m_batch_rkcn.end(), 0.0);
+    m_revProductStoich.incrementReactions(n, &m_batch_grt[0], &m_batch_rkcn[0]);
+    m_reactantStoich.decrementReactions(n, &m_batch_grt[0], &m_batch_rkcn[0]);
+    for (size_t i = 0; i < m_revindex.size(); i++) {
+        size_t irxn = m_revindex[i];
+        doublereal* rkc = &m_batch_rkcn[irxn*n];
+        for (size_t j = 0; j < n; j++) {
+            doublereal rrt = 1.0 / (GasConstant * T[j]);
+            rkc[j] = std::min(exp(rkc[j]*rrt - m_dn[irxn]*m_batch_logStandConc[j]),
+                              BigNumber);
+        }
+    }
+    for (size_t i = 0; i != m_irrev.size(); ++i) {
+        fill(&m_batch_rkcn[m_irrev[i]*n], &m_batch_rkcn[m_irrev[i]*n] + n, 0.0);
+    }
+
+    // Forward rate constants, including third-body and falloff effects
+    copy(m_batch_rfn.begin(), m_batch_rfn.end(), m_batch_ropf.begin());
+    if (!concm_3b_values.empty()) {
+        m_3b_concm.update(n, &m_batch_conc[0], &m_batch_ctot[0],
+                          &m_batch_concm_3b[0]);
+        m_3b_concm.multiply(n, &m_batch_ropf[0], &m_batch_concm_3b[0]);
+    }
+    if (m_nfall) {
+        m_falloff_concm.update(n, &m_batch_conc[0], &m_batch_ctot[0],
+                               &m_batch_concm_falloff[0]);
+        vector_fp& pr = m_ropr;
+        for (size_t j = 0; j < n; j++) {
+            for (size_t i = 0; i < m_nfall; i++) {
+                pr[i] = m_batch_concm_falloff[i*n + j] * m_batch_rfn_low[i*n + j]
+                        / (m_batch_rfn_high[i*n + j] + SmallNumber);
+            }
+            double* work = nwork ? &m_batch_falloff_work[j*nwork] : 0;
+            m_falloffn.pr_to_falloff(&pr[0], work);
+            for (size_t i = 0; i < m_nfall; i++) {
+                if (m_rxntype[m_fallindx[i]] == FALLOFF_RXN) {
+                    pr[i] *= m_batch_rfn_high[i*n + j];
+                } else { // CHEMACT_RXN
+                    pr[i] *= m_batch_rfn_low[i*n + j];
+                }
+                m_batch_ropf[m_fallindx[i]*n + j] = pr[i];
+            }
+        }
+    }
+    for (size_t i = 0; i < m_ii; i++) {
+        doublereal* ropf = &m_batch_ropf[i*n];
+        doublereal* ropr = &m_batch_ropr[i*n];
+        const doublereal* rkc = &m_batch_rkcn[i*n];
+        for (size_t j = 0; j < n; j++) {
+            ropf[j] *= m_perturb[i];
+            ropr[j] = ropf[j] * rkc[j];
+        }
+    }
+
+    // Rates of progress
+    m_reactantStoich.multiply(n, &m_batch_conc[0], &m_batch_ropf[0]);
+    m_revProductStoich.multiply(n, &m_batch_conc[0], &m_batch_ropr[0]);
+    for (size_t i = 0; i < m_ii * n; i++) {
+        m_batch_ropf[i] -= m_batch_ropr[i];
+    }
+
+    // Species production rates
+    fill(wdot, wdot + m_kk * n, 0.0);
+    m_revProductStoich.incrementSpecies(n, &m_batch_ropf[0], wdot);
+    m_irrevProductStoich.incrementSpecies(n, &m_batch_ropf[0], wdot);
+    m_reactantStoich.decrementSpecies(n, &m_batch_ropf[0], wdot);
+
+    // The cached single-state rate data are no longer valid.
+    thermo().restoreState(state);
+    m_temp = 0.0;
+    m_pres = 0.0;
+    m_ROP_ok = false;
+}
+
+void GasKinetics::buildJacobianStructure()
+{
+    // Net stoichiometric coefficients of each reaction
+    std::vector<std::map<size_t, double> > net(m_ii);
+    for (size_t k = 0; k < m_kk; k++) {
+        for (std::map<size_t, doublereal>::const_iterator iter = m_rrxn[k].begin();
+             iter != m_rrxn[k].end(); ++iter) {
+            net[iter->first][k] -= iter->second;
+        }
+        for (std::map<size_t, doublereal>::const_iterator iter = m_prxn[k].begin();
+             iter != m_prxn[k].end(); ++iter) {
+            net[iter->first][k] += iter->second;
+        }
+    }
+    m_jac_net_ptr.assign(1, 0);
+    m_jac_net_k.clear();
+    m_jac_net_nu.clear();
+    for (size_t i = 0; i < m_ii; i++) {
+        for (std::map<size_t, double>::const_iterator iter = net[i].begin();
+             iter != net[i].end(); ++iter) {
+            if (iter->second != 0.0) {
+                m_jac_net_k.push_back(iter->first);
+                m_jac_net_nu.push_back(iter->second);
+            }
+        }
+        m_jac_net_ptr.push_back(m_jac_net_k.size());
+    }
+
+    // Sparse derivatives of the rates of progress
+    std::vector<size_t> rxn, sp;
+    m_reactantStoich.getDerivativeEntries(m_jac_rxn, m_jac_sp);
+    m_jac_nfwd = m_jac_rxn.size();
+    m_revProductStoich.getDerivativeEntries(rxn, sp);
+    m_jac_nrev = rxn.size();
+    m_jac_rxn.insert(m_jac_rxn.end(), rxn.begin(), rxn.end());
+    m_jac_sp.insert(m_jac_sp.end(), sp.begin(), sp.end());
+
+    // Reactions whose rates depend on the concentrations of all species
+    std::vector<int> dense(m_ii, 0);
+    for (size_t n = 0; n < m_3b_concm.workSize(); n++) {
+        size_t i = m_3b_concm.reactionIndex(n);
+        const std::vector<size_t>& species = m_3b_concm.species(n);
+        const vector_fp& eff = m_3b_concm.relativeEfficiencies(n);
+        for (size_t j = 0; j < species.size(); j++) {
+            if (eff[j] != 0.0) {
+                m_jac_rxn.push_back(i);
+                m_jac_sp.push_back(species[j]);
+            }
+        }
+        dense[i] = (m_3b_concm.defaultEfficiency(n) != 0.0);
+    }
+    for (size_t n = 0; n < m_nfall; n++) {
+        size_t i = m_fallindx[n];
+        const std::vector<size_t>& species = m_falloff_concm.species(n);
+        const vector_fp& eff = m_falloff_concm.relativeEfficiencies(n);
+        for (size_t j = 0; j < species.size(); j++) {
+            if (eff[j] != 0.0) {
+                m_jac_rxn.push_back(i);
+                m_jac_sp.push_back(species[j]);
+            }
+        }
+        dense[i] = (m_falloff_concm.defaultEfficiency(n) != 0.0);
+    }
+    for (size_t i = 0; i < m_ii; i++) {
+        if (m_rxntype[i] == PLOG_RXN || m_rxntype[i] == CHEBYSHEV_RXN) {
+            dense[i] = 1;
+        }
+    }
+
+    // Group the sparse entries by species
+    size_t nEntries = m_jac_rxn.size();
+    m_jac_entry_ptr.assign(m_kk + 1, 0);
+    for (size_t e = 0; e < nEntries; e++) {
+        m_jac_entry_ptr[m_jac_sp[e] + 1]++;
+    }
+    for (size_t k = 0; k < m_kk; k++) {
+        m_jac_entry_ptr[k+1] += m_jac_entry_ptr[k];
+    }
+    m_jac_entry_idx.resize(nEntries);
+    std::vector<size_t> pos(m_jac_entry_ptr.begin(), m_jac_entry_ptr.end() - 1);
+    for (size_t e = 0; e < nEntries; e++) {
+        m_jac_entry_idx[pos[m_jac_sp[e]]++] = e;
+    }
+
+    // Rows that are structurally nonzero in every column
+    std::vector<int> mark(m_kk, 0);
+    std::vector<int> active(m_kk, 0);
+    for (size_t i = 0; i < m_ii; i++) {
+        for (size_t p = m_jac_net_ptr[i]; p < m_jac_net_ptr[i+1]; p++) {
+            active[m_jac_net_k[p]] = 1;
+            if (dense[i]) {
+                mark[m_jac_net_k[p]] = 1;
+            }
+        }
+    }
+    m_jac_dense_rows.clear();
+    for (size_t k = 0; k < m_kk; k++) {
+        if (mark[k]) {
+            m_jac_dense_rows.push_back(k);
+        }
+    }
+
+    // Sparsity pattern of each column
+    m_jac_colStart.assign(1, 0);
+    m_jac_rowIndex.clear();
+    for (size_t m = 0; m < m_kk; m++) {
+        std::vector<int> col(mark);
+        for (size_t q = m_jac_entry_ptr[m]; q < m_jac_entry_ptr[m+1]; q++) {
+            size_t i = m_jac_rxn[m_jac_entry_idx[q]];
+            for (size_t p = m_jac_net_ptr[i]; p < m_jac_net_ptr[i+1]; p++) {
+                col[m_jac_net_k[p]] = 1;
+            }
+        }
+        for (size_t k = 0; k < m_kk; k++) {
+            if (col[k]) {
+                m_jac_rowIndex.push_back(k);
+            }
+        }
+        m_jac_colStart.push_back(m_jac_rowIndex.size());
+    }
+    // temperature column
+    for (size_t k = 0; k < m_kk; k++) {
+        if (active[k]) {
+            m_jac_rowIndex.push_back(k);
+        }
+    }
+    m_jac_colStart.push_back(m_jac_rowIndex.size());
+
+    m_jac_dval.resize(nEntries);
+    m_jac_kf.resize(m_ii);
+    m_jac_Pf.resize(m_ii);
+    m_jac_Pr.resize(m_ii);
+    m_jac_s.resize(m_ii);
+    m_jac_kp.resize(m_ii);
+    m_jac_km.resize(m_ii);
+    m_jac_u.resize(m_kk);
+    m_jac_work.assign(m_kk, 0.0);
+    m_jac_wdot.resize(m_kk);
+    m_jac_pr.resize(m_nfall);
+    m_jac_g0.resize(m_nfall);
+    m_jac_g1.resize(m_nfall);
+    m_jac_nrxn = m_ii;
+}
+
+void GasKinetics::getNetProductionRatesJacobian(std::vector<size_t>& colStart,
+                                                std::vector<size_t>& rowIndex,
+                                                vector_fp& values)
+{
+    if (m_jac_nrxn != m_ii) {
+        buildJacobianStructure();
+    }
+    colStart = m_jac_colStart;
+    rowIndex = m_jac_rowIndex;
+    values.assign(m_jac_rowIndex.size(), 0.0);
+    if (m_ii == 0) {
+        return;
+    }
+
+    // Forward rate constants, including third-body concentrations, falloff
+    // functions and perturbation factors. This also updates the
+    // concentrations and the temperature-dependent rate data.
+    getFwdRateConstants(&m_jac_kf[0]);
+
+    // Concentration products
+    fill(m_jac_Pf.begin(), m_jac_Pf.end(), 1.0);
+    fill(m_jac_Pr.begin(), m_jac_Pr.end(), 1.0);
+    m_reactantStoich.multiply(&m_conc[0], &m_jac_Pf[0]);
+    m_revProductStoich.multiply(&m_conc[0], &m_jac_Pr[0]);
+
+    // Derivatives of the mass-action terms
+    size_t nEntries = m_jac_rxn.size();
+    doublereal* dval = (nEntries) ? &m_jac_dval[0] : 0;
+    m_reactantStoich.getDerivatives(&m_conc[0], dval);
+    m_revProductStoich.getDerivatives(&m_conc[0], dval + m_jac_nfwd);
+    for (size_t e = 0; e < m_jac_nfwd; e++) {
+        dval[e] *= m_jac_kf[m_jac_rxn[e]];
+    }
+    for (size_t e = m_jac_nfwd; e < m_jac_nfwd + m_jac_nrev; e++) {
+        size_t i = m_jac_rxn[e];
+        dval[e] *= -m_jac_kf[i] * m_rkcn[i];
+    }
+
+    // Derivatives of the rate constants. Contributions that are the same
+    // for all species are accumulated in m_jac_s.
+    fill(m_jac_s.begin(), m_jac_s.end(), 0.0);
+    size_t e = m_jac_nfwd + m_jac_nrev;
+    for (size_t n = 0; n < m_3b_concm.workSize(); n++) {
+        size_t i = m_3b_concm.reactionIndex(n);
+        double c = m_rfn[i] * m_perturb[i] *
+                   (m_jac_Pf[i] - m_rkcn[i] * m_jac_Pr[i]);
+        m_jac_s[i] += c * m_3b_concm.defaultEfficiency(n);
+        const vector_fp& eff = m_3b_concm.relativeEfficiencies(n);
+        for (size_t j = 0; j < eff.size(); j++) {
+            if (eff[j] != 0.0) {
+                dval[e++] = c * eff[j];
+            }
+        }
+    }
+
+    if (m_nfall) {
+        // Derivative of the falloff function with respect to the reduced
+        // pressure, by differencing the falloff function alone
+        double* work = (falloff_work.empty()) ? 0 : &falloff_work[0];
+        for (size_t n = 0; n < m_nfall; n++) {
+            m_jac_pr[n] = concm_falloff_values[n] * m_rfn_low[n] /
+                          (m_rfn_high[n] + SmallNumber);
+            m_jac_g0[n] = m_jac_pr[n];
+            m_jac_g1[n] = m_jac_pr[n] + 1.0e-7 * std::max(m_jac_pr[n], 1.0e-20);
+        }
+        m_falloffn.pr_to_falloff(&m_jac_g0[0], work);
+        m_falloffn.pr_to_falloff(&m_jac_g1[0], work);
+        for (size_t n = 0; n < m_nfall; n++) {
+            size_t i = m_fallindx[n];
+            double dgdpr = (m_jac_g1[n] - m_jac_g0[n]) /
+                           (1.0e-7 * std::max(m_jac_pr[n], 1.0e-20));
+            double kref = (m_rxntype[i] == FALLOFF_RXN) ? m_rfn_high[n]
+                                                         : m_rfn_low[n];
+            double c = m_perturb[i] * kref * dgdpr * m_rfn_low[n] /
+                       (m_rfn_high[n] + SmallNumber) *
+                       (m_jac_Pf[i] - m_rkcn[i] * m_jac_Pr[i]);
+            m_jac_s[i] += c * m_falloff_concm.defaultEfficiency(n);
+            const vector_fp& eff = m_falloff_concm.relativeEfficiencies(n);
+            for (size_t j = 0; j < eff.size(); j++) {
+                if (eff[j] != 0.0) {
+                    dval[e++] = c * eff[j];
+                }
+            }
+        }
+    }
+
+    if (m_plog_rates.nReactions() || m_cheb_rates.nReactions()) {
+        // Pressure derivatives of the rate constants, by central differences
+        // in log(P). For an ideal gas, dP/dC_k = RT for all species.
+        double T = thermo().temperature();
+        double logT = log(T);
+        double P = thermo().pressure();
+        double logP = log(P);
+        const double h = 1.0e-5;
+        copy(m_rfn.begin(), m_rfn.end(), m_jac_kp.begin());
+        copy(m_rfn.begin(), m_rfn.end(), m_jac_km.begin());
+        if (m_plog_rates.nReactions()) {
+            double logPp = logP + h;
+            double logPm = logP - h;
+            m_plog_rates.update_C(&logPp);
+            m_plog_rates.update(T, logT, &m_jac_kp[0]);
+            m_plog_rates.update_C(&logPm);
+            m_plog_rates.update(T, logT, &m_jac_km[0]);
+            m_plog_rates.update_C(&logP);
+        }
+        if (m_cheb_rates.nReactions()) {
+            double log10Pp = (logP + h) / log(10.0);
+            double log10Pm = (logP - h) / log(10.0);
+            double log10P = log10(P);
+            m_cheb_rates.update_C(&log10Pp);
+            m_cheb_rates.update(T, logT, &m_jac_kp[0]);
+            m_cheb_rates.update_C(&log10Pm);
+            m_cheb_rates.update(T, logT, &m_jac_km[0]);
+            m_cheb_rates.update_C(&log10P);
+        }
+        double dPdC = GasConstant * T;
+        for (size_t i = 0; i < m_ii; i++) {
+            if (m_rxntype[i] == PLOG_RXN || m_rxntype[i] == CHEBYSHEV_RXN) {
+                double dkdP = (m_jac_kp[i] - m_jac_km[i]) / (2 * h * P);
+                m_jac_s[i] += m_perturb[i] * dkdP * dPdC *
+                              (m_jac_Pf[i] - m_rkcn[i] * m_jac_Pr[i]);
+            }
+        }
+    }
+
+    // Species-independent contributions to each species production rate
+    fill(m_jac_u.begin(), m_jac_u.end(), 0.0);
+    for (size_t i = 0; i < m_ii; i++) {
+        if (m_jac_s[i] != 0.0) {
+            for (size_t p = m_jac_net_ptr[i]; p < m_jac_net_ptr[i+1]; p++) {
+                m_jac_u[m_jac_net_k[p]] += m_jac_net_nu[p] * m_jac_s[i];
+            }
+        }
+    }
+
+    // Assemble the concentration columns
+    for (size_t m = 0; m < m_kk; m++) {
+        for (size_t q = m_jac_entry_ptr[m]; q < m_jac_entry_ptr[m+1]; q++) {
+            size_t ie = m_jac_entry_idx[q];
+            size_t i = m_jac_rxn[ie];
+            for (size_t p = m_jac_net_ptr[i]; p < m_jac_net_ptr[i+1]; p++) {
+                m_jac_work[m_jac_net_k[p]] += m_jac_net_nu[p] * dval[ie];
+            }
+        }
+        for (size_t n = 0; n < m_jac_dense_rows.size(); n++) {
+            size_t k = m_jac_dense_rows[n];
+            m_jac_work[k] += m_jac_u[k];
+        }
+        for (size_t p = colStart[m]; p < colStart[m+1]; p++) {
+            values[p] = m_jac_work[rowIndex[p]];
+            m_jac_work[rowIndex[p]] = 0.0;
+        }
+    }
+
+    // Temperature column, by a forward difference at constant concentrations
+    double T = thermo().temperature();
+    double dT = 1.0e-7 * T;
+    getNetProductionRates(&m_jac_wdot[0]);
+    thermo().setTemperature(T + dT);
+    getNetProductionRates(&m_jac_work[0]);
+    thermo().setTemperature(T);
+    for (size_t p = colStart[m_kk]; p < colStart[m_kk+1]; p++) {
+        size_t k = rowIndex[p];
+        values[p] = (m_jac_work[k] - m_jac_wdot[k]) / dT;
+    }
+    fill(m_jac_work.begin(), m_jac_work.end(), 0.0);
+}
+
 void GasKinetics::addReaction(ReactionData& r)
 {
     switch (r.reactionType) {
@@ -265,6 +745,11 @@ void GasKinetics::addReaction(ReactionData& r)
 
     // operations common to all reaction types
     BulkKinetics::addReaction(r);
+
+    // Force the rate coefficients, including the cached pressure-dependent
+    // parts, to be recomputed
+    m_temp = 0.0;
+    m_pres = 0.0;
 }
 
 void GasKinetics::addReaction(shared_ptr<Reaction> r)
@@ -293,6 +778,11 @@ void GasKinetics::addReaction(shared_ptr<Reaction> r)
 
     // operations common to all reaction types
     BulkKinetics::addReaction(r);
+
+    // Force the rate coefficients, including the cached pressure-dependent
+    // parts, to be recomputed
+    m_temp = 0.0;
+    m_pres = 0.0;
 }
 
 void GasKinetics::addFalloffReaction(ReactionData& r)
@@ -510,6 +510,33 @@ void Kinetics::getNetProductionRates(doublereal* net)
     m_reactantStoich.decrementSpecies(&m_ropnet[0], net);
 }
 
+void Kinetics::getNetProductionRatesBatch(size_t nStates, const doublereal* T,
+                                          const doublereal* P,
+                                          const doublereal* Y,
+                                          doublereal* wdot)
+{
+    if (nPhases() != 1) {
+        throw CanteraError("Kinetics::getNetProductionRatesBatch",
+                           "Only implemented for single-phase kinetics");
+    }
+    thermo_t& phase = thermo(0);
+    vector_fp state;
+    phase.saveState(state);
+
+    vector_fp y(m_kk), w(m_kk);
+    for (size_t j = 0; j < nStates; j++) {
+        for (size_t k = 0; k < m_kk; k++) {
+            y[k] = Y[k*nStates + j];
+        }
+        phase.setState_TPY(T[j], P[j], &y[0]);
+        getNetProductionRates(&w[0]);
+        for (size_t k = 0; k < m_kk; k++) {
+            wdot[k*nStates + j] = w[k];
+        }
+    }
+    phase.restoreState(state);
+}
+
 void Kinetics::addPhase(thermo_t& thermo)
 {
     // if not the first thermo object, set the start position
@@ -552,6 +579,16 @@ void Kinetics::finalize()
         size_t nsp = m_thermo[n]->nSpecies();
         m_kk += nsp;
     }
+    m_reactantStoich.finalize();
+    m_revProductStoich.finalize();
+    m_irrevProductStoich.finalize();
+}
+
+void Kinetics::setSparseStoichiometry(bool sparse)
+{
+    m_reactantStoich.setSparse(sparse);
+    m_revProductStoich.setSparse(sparse);
+    m_irrevProductStoich.setSparse(sparse);
 }
 
 void Kinetics::addReaction(ReactionData& r) {
@@ -3,6 +3,8 @@
 #include "cantera/kinetics/RxnRates.h"
 #include "cantera/base/Array.h"
 
+#include <limits>
+
 namespace Cantera
 {
 Arrhenius::Arrhenius()
@@ -141,6 +143,10 @@ Plog::Plog(const ReactionData& rdata)
     , m2_(npos)
     , rDeltaP_(-1.0)
     , maxRates_(1)
+    , logT_(std::numeric_limits<double>::quiet_NaN())
+    , recipT_(std::numeric_limits<double>::quiet_NaN())
+    , logk1_(0.0)
+    , logk2_(0.0)
 {
     typedef std::multimap<double, vector_fp>::const_iterator iter_t;
 
@@ -203,6 +209,10 @@ Plog::Plog(const std::multimap<double, Arrhenius>& rates)
     , m2_(npos)
     , rDeltaP_(-1.0)
     , maxRates_(1)
+    , logT_(std::numeric_limits<double>::quiet_NaN())
+    , recipT_(std::numeric_limits<double>::quiet_NaN())
+    , logk1_(0.0)
+    , logk2_(0.0)
 {
     size_t j = 0;
     size_t rateCount = 0;
@@ -278,6 +288,8 @@ ChebyshevRate::ChebyshevRate(const ReactionData& rdata)
     , nT_(rdata.chebDegreeT)
     , chebCoeffs_(rdata.chebCoeffs)
     , dotProd_(rdata.chebDegreeT)
+    , recipT_(std::numeric_limits<double>::quiet_NaN())
+    , chebT_(rdata.chebDegreeT)
 {
     double logPmin = std::log10(rdata.chebPmin);
     double logPmax = std::log10(rdata.chebPmax);
@@ -296,6 +308,8 @@ ChebyshevRate::ChebyshevRate(double Pmin, double Pmax, double Tmin, double Tmax,
     , nT_(coeffs.nRows())
     , chebCoeffs_(coeffs.nColumns() * coeffs.nRows(), 0.0)
     , dotProd_(coeffs.nRows())
+    , recipT_(std::numeric_limits<double>::quiet_NaN())
+    , chebT_(coeffs.nRows())
 {
     double logPmin = std::log10(Pmin);
     double logPmax = std::log10(Pmax);
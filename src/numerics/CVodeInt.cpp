@@ -18,6 +18,8 @@ using namespace std;
 
 #include "cantera/base/stringUtils.h"
 
+#include <iostream>
+
 extern "C" {
 
     /**
@@ -38,6 +40,48 @@ extern "C" {
         f->eval(t, ydata, ydotdata, NULL);
     }
 
+    /**
+     *  Function called by cvode to prepare the preconditioner used by the
+     *  SPGMR linear solver. The work is delegated to
+     *  FuncEval::preconditionerSetup.
+     *  @ingroup odeGroup
+     */
+    static int cvode_precond(integer N, real t, N_Vector y, N_Vector fy,
+                             boole jok, boole* jcurPtr, real gamma,
+                             N_Vector ewt, real h, real uround,
+                             long int* nfePtr, void* P_data,
+                             N_Vector vtemp1, N_Vector vtemp2, N_Vector vtemp3)
+    {
+        Cantera::FuncEval* f = (Cantera::FuncEval*)P_data;
+        try {
+            *jcurPtr = f->preconditionerSetup(t, N_VDATA(y), gamma, jok != 0);
+        } catch (Cantera::CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return 1; // possibly recoverable error
+        }
+        return 0;
+    }
+
+    /**
+     *  Function called by cvode to apply the preconditioner computed by
+     *  cvode_precond.
+     *  @ingroup odeGroup
+     */
+    static int cvode_psolve(integer N, real t, N_Vector y, N_Vector fy,
+                            N_Vector vtemp, real gamma, N_Vector ewt,
+                            real delta, long int* nfePtr, N_Vector r,
+                            int lr, void* P_data, N_Vector z)
+    {
+        Cantera::FuncEval* f = (Cantera::FuncEval*)P_data;
+        try {
+            f->preconditionerSolve(t, N_VDATA(y), N_VDATA(r), N_VDATA(z));
+        } catch (Cantera::CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return 1; // possibly recoverable error
+        }
+        return 0;
+    }
+
     /**
      *  Function called by cvode to evaluate the Jacobian matrix.
      *  (temporary)
@@ -240,6 +284,9 @@ void CVodeInt::initialize(double t0, FuncEval& func)
     } else if (m_type == GMRES) {
         CVSpgmr(m_cvode_mem, NONE, MODIFIED_GS, 0, 0.0,
                 NULL, NULL, NULL);
+    } else if (m_type == GMRES + PRECON) {
+        CVSpgmr(m_cvode_mem, LEFT, MODIFIED_GS, 0, 0.0,
+                cvode_precond, cvode_psolve, m_data);
     } else {
         throw CVodeErr("unsupported option");
     }
@@ -283,6 +330,9 @@ void CVodeInt::reinitialize(double t0, FuncEval& func)
     } else if (m_type == GMRES) {
         CVSpgmr(m_cvode_mem, NONE, MODIFIED_GS, 0, 0.0,
                 NULL, NULL, NULL);
+    } else if (m_type == GMRES + PRECON) {
+        CVSpgmr(m_cvode_mem, LEFT, MODIFIED_GS, 0, 0.0,
+                cvode_precond, cvode_psolve, m_data);
     } else {
         throw CVodeErr("unsupported option");
     }
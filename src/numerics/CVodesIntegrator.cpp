@@ -22,6 +22,7 @@ using namespace std;
 #endif
 #include "cvodes/cvodes_diag.h"
 #include "cvodes/cvodes_spgmr.h"
+#include "cvodes/cvodes_spbcgs.h"
 
 
 #define CV_SS 1
@@ -78,6 +79,50 @@ extern "C" {
         return 0; // successful evaluation
     }
 
+    //! Function called by CVodes to prepare the preconditioner used by the
+    //! Krylov linear solvers. The work is delegated to
+    //! FuncEval::preconditionerSetup.
+    static int cvodes_prec_setup(realtype t, N_Vector y, N_Vector fy,
+                                 booleantype jok, booleantype* jcurPtr,
+                                 realtype gamma, void* f_data, N_Vector tmp1,
+                                 N_Vector tmp2, N_Vector tmp3)
+    {
+        try {
+            Cantera::FuncData* d = (Cantera::FuncData*)f_data;
+            bool jcur = d->m_func->preconditionerSetup(t, NV_DATA_S(y), gamma,
+                                                       jok != 0);
+            *jcurPtr = jcur ? TRUE : FALSE;
+        } catch (Cantera::CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return 1; // possibly recoverable error
+        } catch (...) {
+            std::cerr << "cvodes_prec_setup: unhandled exception" << std::endl;
+            return -1; // unrecoverable error
+        }
+        return 0;
+    }
+
+    //! Function called by CVodes to apply the preconditioner computed by
+    //! cvodes_prec_setup.
+    static int cvodes_prec_solve(realtype t, N_Vector y, N_Vector fy,
+                                 N_Vector r, N_Vector z, realtype gamma,
+                                 realtype delta, int lr, void* f_data,
+                                 N_Vector tmp)
+    {
+        try {
+            Cantera::FuncData* d = (Cantera::FuncData*)f_data;
+            d->m_func->preconditionerSolve(t, NV_DATA_S(y), NV_DATA_S(r),
+                                           NV_DATA_S(z));
+        } catch (Cantera::CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return 1; // possibly recoverable error
+        } catch (...) {
+            std::cerr << "cvodes_prec_solve: unhandled exception" << std::endl;
+            return -1; // unrecoverable error
+        }
+        return 0;
+    }
+
     //! Function called by CVodes when an error is encountered instead of
     //! writing to stdout. Here, save the error message provided by CVodes so
     //! that it can be included in the subsequently raised CanteraError.
@@ -368,6 +413,16 @@ void CVodesIntegrator::applyOptions()
         CVDiag(m_cvode_mem);
     } else if (m_type == GMRES) {
         CVSpgmr(m_cvode_mem, PREC_NONE, 0);
+    } else if (m_type == GMRES + PRECON) {
+        CVSpgmr(m_cvode_mem, PREC_LEFT, 0);
+        CVSpilsSetPreconditioner(m_cvode_mem, cvodes_prec_setup,
+                                 cvodes_prec_solve);
+    } else if (m_type == BICGSTAB) {
+        CVSpbcg(m_cvode_mem, PREC_NONE, 0);
+    } else if (m_type == BICGSTAB + PRECON) {
+        CVSpbcg(m_cvode_mem, PREC_LEFT, 0);
+        CVSpilsSetPreconditioner(m_cvode_mem, cvodes_prec_setup,
+                                 cvodes_prec_solve);
     } else if (m_type == BAND + NOJAC) {
         long int N = m_neq;
         long int nu = m_mupper;
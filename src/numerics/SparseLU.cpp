@@ -0,0 +1,153 @@
+/**
+ *  @file SparseLU.cpp
+ *
+ *  LU factorization of sparse matrices.
+ */
+
+#include "cantera/numerics/SparseLU.h"
+#include "cantera/base/ctexceptions.h"
+#include "cantera/base/stringUtils.h"
+
+#include <set>
+
+using namespace std;
+
+namespace Cantera
+{
+
+SparseLU::SparseLU() :
+    m_n(0)
+{
+}
+
+void SparseLU::analyze(size_t n, const std::vector<size_t>& rows,
+                       const std::vector<size_t>& cols)
+{
+    // Pattern of each row of the input matrix
+    std::vector<std::set<size_t> > pattern(n);
+    for (size_t i = 0; i < rows.size(); i++) {
+        if (rows[i] >= n || cols[i] >= n) {
+            throw CanteraError("SparseLU::analyze", "Index out of range");
+        }
+        pattern[rows[i]].insert(cols[i]);
+    }
+
+    // Symbolic elimination: the pattern of row i of the factors is the union
+    // of the pattern of row i of the matrix with the upper-triangular
+    // patterns of each row k < i for which entry (i,k) is nonzero, including
+    // entries created by fill-in.
+    m_rowStart.assign(1, 0);
+    m_col.clear();
+    m_diag.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        std::set<size_t>& row = pattern[i];
+        if (!row.count(i)) {
+            throw CanteraError("SparseLU::analyze",
+                               "Missing diagonal entry in row " + int2str(i));
+        }
+        for (std::set<size_t>::iterator k = row.begin(); *k < i; ++k) {
+            // Entries inserted here are greater than *k, so they are visited
+            // by later iterations of this loop.
+            for (size_t p = m_diag[*k] + 1; p < m_rowStart[*k + 1]; p++) {
+                row.insert(m_col[p]);
+            }
+        }
+        for (std::set<size_t>::iterator k = row.begin(); k != row.end(); ++k) {
+            if (*k == i) {
+                m_diag[i] = m_col.size();
+            }
+            m_col.push_back(*k);
+        }
+        m_rowStart.push_back(m_col.size());
+        row.clear();
+    }
+
+    // Position of each input entry within the factors
+    m_work.assign(n, npos);
+    m_pos.resize(rows.size());
+    std::vector<size_t> order(rows.size());
+    std::vector<size_t> count(n + 1, 0);
+    for (size_t i = 0; i < rows.size(); i++) {
+        count[rows[i] + 1]++;
+    }
+    for (size_t i = 0; i < n; i++) {
+        count[i+1] += count[i];
+    }
+    for (size_t i = 0; i < rows.size(); i++) {
+        order[count[rows[i]]++] = i;
+    }
+    size_t q = 0;
+    for (size_t i = 0; i < n; i++) {
+        for (size_t p = m_rowStart[i]; p < m_rowStart[i+1]; p++) {
+            m_work[m_col[p]] = p;
+        }
+        for (; q < rows.size() && rows[order[q]] == i; q++) {
+            m_pos[order[q]] = m_work[cols[order[q]]];
+        }
+        for (size_t p = m_rowStart[i]; p < m_rowStart[i+1]; p++) {
+            m_work[m_col[p]] = npos;
+        }
+    }
+
+    m_n = n;
+    m_rows = rows;
+    m_cols = cols;
+    m_lu.resize(m_col.size());
+}
+
+int SparseLU::factor(size_t n, const std::vector<size_t>& rows,
+                     const std::vector<size_t>& cols, const vector_fp& values)
+{
+    if (n != m_n || rows != m_rows || cols != m_cols) {
+        analyze(n, rows, cols);
+    }
+
+    fill(m_lu.begin(), m_lu.end(), 0.0);
+    for (size_t i = 0; i < values.size(); i++) {
+        m_lu[m_pos[i]] += values[i];
+    }
+
+    // Row-oriented (IKJ) Gaussian elimination
+    for (size_t i = 0; i < m_n; i++) {
+        for (size_t p = m_rowStart[i]; p < m_rowStart[i+1]; p++) {
+            m_work[m_col[p]] = p;
+        }
+        for (size_t p = m_rowStart[i]; p < m_diag[i]; p++) {
+            size_t k = m_col[p];
+            double lik = m_lu[p] / m_lu[m_diag[k]];
+            m_lu[p] = lik;
+            for (size_t q = m_diag[k] + 1; q < m_rowStart[k+1]; q++) {
+                m_lu[m_work[m_col[q]]] -= lik * m_lu[q];
+            }
+        }
+        for (size_t p = m_rowStart[i]; p < m_rowStart[i+1]; p++) {
+            m_work[m_col[p]] = npos;
+        }
+        if (m_lu[m_diag[i]] == 0.0) {
+            return static_cast<int>(i) + 1;
+        }
+    }
+    return 0;
+}
+
+void SparseLU::solve(doublereal* b) const
+{
+    // Forward substitution with the unit lower triangular factor
+    for (size_t i = 0; i < m_n; i++) {
+        double sum = b[i];
+        for (size_t p = m_rowStart[i]; p < m_diag[i]; p++) {
+            sum -= m_lu[p] * b[m_col[p]];
+        }
+        b[i] = sum;
+    }
+    // Back substitution with the upper triangular factor
+    for (size_t i = m_n; i-- > 0;) {
+        double sum = b[i];
+        for (size_t p = m_diag[i] + 1; p < m_rowStart[i+1]; p++) {
+            sum -= m_lu[p] * b[m_col[p]];
+        }
+        b[i] = sum / m_lu[m_diag[i]];
+    }
+}
+
+}
@@ -112,6 +112,9 @@ void StFlow::resize(size_t ncomponents, size_t points)
     m_cp.resize(m_points, 0.0);
     m_visc.resize(m_points, 0.0);
     m_tcon.resize(m_points, 0.0);
+    m_tmid.resize(m_points, 0.0);
+    m_wtmid.resize(m_points, 0.0);
+    m_xmid.resize(m_nsp*m_points, 0.0);
 
     if (m_transport_option ==  c_Mixav_Transport) {
         m_diff.resize(m_nsp*m_points);
@@ -477,30 +480,67 @@ void StFlow::eval(size_t jg, doublereal* xg,
 
 void StFlow::updateTransport(doublereal* x, size_t j0, size_t j1)
 {
+    size_t npts = j1 - j0;
+    if (npts == 0) {
+        return;
+    }
+
+    // Temperatures and mole fractions at the midpoints between grid points,
+    // which are passed to the transport manager for all points at once. The
+    // mole fractions are stored species-major, as the transport manager
+    // expects: X_k at midpoint j is in m_xmid[k*npts + j - j0].
+    for (size_t j = j0; j < j1; j++) {
+        m_tmid[j] = 0.5*(T(x,j)+T(x,j+1));
+        const doublereal* yyj = x + m_nv*j + c_offset_Y;
+        const doublereal* yyjp = x + m_nv*(j+1) + c_offset_Y;
+        doublereal* xx = &m_xmid[j - j0];
+        doublereal sum = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            xx[k*npts] = 0.5*(yyj[k] + yyjp[k]) / m_wt[k];
+            sum += xx[k*npts];
+        }
+        m_wtmid[j] = 1.0/sum;
+        for (size_t k = 0; k < m_nsp; k++) {
+            xx[k*npts] *= m_wtmid[j];
+        }
+    }
+
+    doublereal* visc = (m_dovisc ? &m_visc[j0] : 0);
+    if (!m_dovisc) {
+        std::fill(m_visc.begin() + j0, m_visc.begin() + j1, 0.0);
+    }
     if (m_transport_option == c_Mixav_Transport) {
+        m_transwork.resize(m_nsp*npts);
+        m_trans->getMixTransportProperties(npts, &m_tmid[j0], m_press,
+                                           &m_xmid[0], visc, &m_tcon[j0],
+                                           &m_transwork[0]);
         for (size_t j = j0; j < j1; j++) {
-            setGasAtMidpoint(x,j);
-            m_visc[j] = (m_dovisc ? m_trans->viscosity() : 0.0);
-            m_trans->getMixDiffCoeffs(DATA_PTR(m_diff) + j*m_nsp);
-            m_tcon[j] = m_trans->thermalConductivity();
+            for (size_t k = 0; k < m_nsp; k++) {
+                m_diff[k+j*m_nsp] = m_transwork[k*npts + j - j0];
+            }
         }
     } else if (m_transport_option == c_Multi_Transport) {
+        size_t nd = m_nsp*m_nsp;
+        m_transwork.resize((nd + m_nsp)*npts);
+        doublereal* dthermal = (m_do_soret ? &m_transwork[nd*npts] : 0);
+        m_trans->getMultiTransportProperties(npts, &m_tmid[j0], m_press,
+                                             &m_xmid[0], visc, &m_tcon[j0],
+                                             &m_transwork[0], dthermal);
         for (size_t j = j0; j < j1; j++) {
-            setGasAtMidpoint(x,j);
-            doublereal wtm = m_thermo->meanMolecularWeight();
-            doublereal rho = m_thermo->density();
-            m_visc[j] = (m_dovisc ? m_trans->viscosity() : 0.0);
-            m_trans->getMultiDiffCoeffs(m_nsp, &m_multidiff[mindex(0,0,j)]);
-
+            for (size_t i = 0; i < nd; i++) {
+                m_multidiff[i+j*nd] = m_transwork[i*npts + j - j0];
+            }
+            if (m_do_soret) {
+                for (size_t k = 0; k < m_nsp; k++) {
+                    m_dthermal(k,j) = dthermal[k*npts + j - j0];
+                }
+            }
+            doublereal wtm = m_wtmid[j];
+            doublereal rho = m_press * wtm / (GasConstant * m_tmid[j]);
             // Use m_diff as storage for the factor outside the summation
             for (size_t k = 0; k < m_nsp; k++) {
                 m_diff[k+j*m_nsp] = m_wt[k] * rho / (wtm*wtm);
             }
-
-            m_tcon[j] = m_trans->thermalConductivity();
-            if (m_do_soret) {
-                m_trans->getThermalDiffCoeffs(m_dthermal.ptrColumn(0) + j*m_nsp);
-            }
         }
     }
 }
@@ -8,13 +8,15 @@
 
 #include "cantera/thermo/GeneralSpeciesThermo.h"
 #include "cantera/thermo/SpeciesThermoFactory.h"
+#include "cantera/thermo/NasaPoly2.h"
 
 namespace Cantera
 {
 GeneralSpeciesThermo::GeneralSpeciesThermo() :
     m_tlow_max(0.0),
     m_thigh_min(1.0E30),
-    m_p0(OneAtm)
+    m_p0(OneAtm),
+    m_nasa_ok(false)
 {
 }
 
@@ -24,7 +26,8 @@ GeneralSpeciesThermo::GeneralSpeciesThermo(const GeneralSpeciesThermo& b) :
     m_speciesLoc(b.m_speciesLoc),
     m_tlow_max(b.m_tlow_max),
     m_thigh_min(b.m_thigh_min),
-    m_p0(b.m_p0)
+    m_p0(b.m_p0),
+    m_nasa_ok(false)
 {
     clear();
     // Copy SpeciesThermoInterpTypes from 'b'
@@ -62,6 +65,7 @@ GeneralSpeciesThermo::operator=(const GeneralSpeciesThermo& b)
     m_tlow_max = b.m_tlow_max;
     m_thigh_min = b.m_thigh_min;
     m_p0 = b.m_p0;
+    m_nasa_ok = false;
 
     return *this;
 }
@@ -132,6 +136,7 @@ void GeneralSpeciesThermo::install_STIT(SpeciesThermoInterpType* stit_ptr)
     // Calculate max and min T
     m_tlow_max = std::max(stit_ptr->minTemp(), m_tlow_max);
     m_thigh_min = std::min(stit_ptr->maxTemp(), m_thigh_min);
+    m_nasa_ok = false;
     markInstalled(index);
 }
 
@@ -160,12 +165,84 @@ void GeneralSpeciesThermo::update(doublereal t, doublereal* cp_R,
         const std::vector<SpeciesThermoInterpType*>& species = iter->second;
         double* tpoly = &jter->second[0];
         species[0]->updateTemperaturePoly(t, tpoly);
-        for (size_t k = 0; k < species.size(); k++) {
-            species[k]->updateProperties(tpoly, cp_R, h_RT, s_R);
+        if (iter->first == NASA2) {
+            updateNasa(tpoly, cp_R, h_RT, s_R);
+        } else {
+            for (size_t k = 0; k < species.size(); k++) {
+                species[k]->updateProperties(tpoly, cp_R, h_RT, s_R);
+            }
         }
     }
 }
 
+void GeneralSpeciesThermo::packNasaCoeffs() const
+{
+    const std::vector<SpeciesThermoInterpType*>& species = getValue(m_sp, NASA2);
+    size_t n = species.size();
+    m_nasa_index.resize(n);
+    m_nasa_tmid.resize(n);
+    m_nasa_low.resize(7*n);
+    m_nasa_high.resize(7*n);
+    m_nasa_cp.resize(n);
+    m_nasa_h.resize(n);
+    m_nasa_s.resize(n);
+    double low[7], high[7];
+    for (size_t i = 0; i < n; i++) {
+        const NasaPoly2* sp = dynamic_cast<const NasaPoly2*>(species[i]);
+        if (!sp) {
+            throw CanteraError("GeneralSpeciesThermo::packNasaCoeffs",
+                               "Unexpected species thermo type");
+        }
+        m_nasa_index[i] = sp->speciesIndex();
+        m_nasa_tmid[i] = sp->midTemp();
+        sp->reportPolyCoeffs(low, high);
+        for (size_t j = 0; j < 7; j++) {
+            m_nasa_low[j*n + i] = low[j];
+            m_nasa_high[j*n + i] = high[j];
+        }
+    }
+    m_nasa_ok = true;
+}
+
+void GeneralSpeciesThermo::updateNasa(const doublereal* tt, doublereal* cp_R,
+                                      doublereal* h_RT, doublereal* s_R) const
+{
+    if (!m_nasa_ok) {
+        packNasaCoeffs();
+    }
+    // This evaluates the same expressions as NasaPoly1::updateProperties,
+    // selecting the coefficients for the low- or high-temperature region of
+    // each species. None of the loops contain branches, so each can be
+    // vectorized.
+    size_t n = m_nasa_index.size();
+    const doublereal* tmid = &m_nasa_tmid[0];
+    const doublereal* lo = &m_nasa_low[0];
+    const doublereal* hi = &m_nasa_high[0];
+    doublereal* cp = &m_nasa_cp[0];
+    doublereal* h = &m_nasa_h[0];
+    doublereal* s = &m_nasa_s[0];
+    doublereal T = tt[0];
+    for (size_t i = 0; i < n; i++) {
+        bool low = (T <= tmid[i]);
+        doublereal ct0 = low ? lo[i] : hi[i];
+        doublereal ct1 = (low ? lo[n+i] : hi[n+i]) * tt[0];
+        doublereal ct2 = (low ? lo[2*n+i] : hi[2*n+i]) * tt[1];
+        doublereal ct3 = (low ? lo[3*n+i] : hi[3*n+i]) * tt[2];
+        doublereal ct4 = (low ? lo[4*n+i] : hi[4*n+i]) * tt[3];
+        doublereal a5 = low ? lo[5*n+i] : hi[5*n+i];
+        doublereal a6 = low ? lo[6*n+i] : hi[6*n+i];
+        cp[i] = ct0 + ct1 + ct2 + ct3 + ct4;
+        h[i] = ct0 + 0.5*ct1 + 1.0/3.0*ct2 + 0.25*ct3 + 0.2*ct4 + a5*tt[4];
+        s[i] = ct0*tt[5] + ct1 + 0.5*ct2 + 1.0/3.0*ct3 + 0.25*ct4 + a6;
+    }
+    const size_t* index = &m_nasa_index[0];
+    for (size_t i = 0; i < n; i++) {
+        cp_R[index[i]] = cp[i];
+        h_RT[index[i]] = h[i];
+        s_R[index[i]] = s[i];
+    }
+}
+
 int GeneralSpeciesThermo::reportType(size_t index) const
 {
     const SpeciesThermoInterpType* sp = provideSTIT(index);
@@ -262,6 +339,7 @@ void GeneralSpeciesThermo::modifyOneHf298(const size_t k, const doublereal Hf298
     SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
     if (sp_ptr) {
         sp_ptr->modifyOneHf298(k, Hf298New);
+        m_nasa_ok = false;
     }
 }
 
@@ -25,6 +25,22 @@
 #include "cantera/base/stringUtils.h"
 #include <cstdio>
 
+namespace
+{
+
+//! Returns true if any of the temperature coefficients in column n are nonzero
+bool hasNonzeroCoeff(const Cantera::Array2D& coeffs, size_t n)
+{
+    for (size_t i = 0; i < coeffs.nRows(); i++) {
+        if (coeffs(i, n) != 0.0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}
+
 namespace Cantera
 {
 
@@ -42,6 +58,8 @@ HMWSoln::HMWSoln() :
     m_densWaterSS(1000.),
     m_waterProps(0),
     m_molalitiesAreCropped(false),
+    m_molarCharge(0.0),
+    m_molalitySumCropped(0.0),
     IMS_typeCutoff_(0),
     IMS_X_o_cutoff_(0.2),
     IMS_gamma_o_min_(1.0E-5),
@@ -92,6 +110,8 @@ HMWSoln::HMWSoln(const std::string& inputFile, const std::string& id_) :
     m_densWaterSS(1000.),
     m_waterProps(0),
     m_molalitiesAreCropped(false),
+    m_molarCharge(0.0),
+    m_molalitySumCropped(0.0),
     IMS_typeCutoff_(0),
     IMS_X_o_cutoff_(0.2),
     IMS_gamma_o_min_(1.0E-5),
@@ -143,6 +163,8 @@ HMWSoln::HMWSoln(XML_Node& phaseRoot, const std::string& id_) :
     m_densWaterSS(1000.),
     m_waterProps(0),
     m_molalitiesAreCropped(false),
+    m_molarCharge(0.0),
+    m_molalitySumCropped(0.0),
     IMS_typeCutoff_(0),
     IMS_X_o_cutoff_(0.2),
     IMS_gamma_o_min_(1.0E-5),
@@ -194,6 +216,8 @@ HMWSoln::HMWSoln(const HMWSoln& b) :
     m_densWaterSS(1000.),
     m_waterProps(0),
     m_molalitiesAreCropped(false),
+    m_molarCharge(0.0),
+    m_molalitySumCropped(0.0),
     IMS_typeCutoff_(0),
     IMS_X_o_cutoff_(0.2),
     IMS_gamma_o_min_(1.0E-5),
@@ -322,6 +346,14 @@ HMWSoln& HMWSoln::operator=(const HMWSoln& b)
         m_molalitiesCropped    = b.m_molalitiesCropped;
         m_molalitiesAreCropped = b.m_molalitiesAreCropped;
         m_CounterIJ            = b.m_CounterIJ;
+        m_CationAnionPairs     = b.m_CationAnionPairs;
+        m_LikeChargePairs      = b.m_LikeChargePairs;
+        m_PsiTriplets          = b.m_PsiTriplets;
+        m_ZetaTriplets         = b.m_ZetaTriplets;
+        m_NeutralSolutes       = b.m_NeutralSolutes;
+        m_PsiIndices           = b.m_PsiIndices;
+        m_molarCharge          = b.m_molarCharge;
+        m_molalitySumCropped   = b.m_molalitySumCropped;
 
         m_gfunc_IJ            = b.m_gfunc_IJ;
         m_g2func_IJ           = b.m_g2func_IJ;
@@ -1399,8 +1431,92 @@ void HMWSoln::counterIJ_setup(void) const
     }
 }
 
+void HMWSoln::interactionLists_setup()
+{
+    m_CationAnionPairs.clear();
+    m_LikeChargePairs.clear();
+    m_PsiTriplets.clear();
+    m_ZetaTriplets.clear();
+    m_NeutralSolutes.clear();
+    m_PsiIndices.clear();
+
+    for (size_t i = 1; i < (m_kk - 1); i++) {
+        for (size_t j = (i+1); j < m_kk; j++) {
+            PitzerPair pair;
+            pair.i = i;
+            pair.j = j;
+            pair.counterIJ = m_CounterIJ[m_kk*i + j];
+            pair.hasBeta2 = hasNonzeroCoeff(m_Beta2MX_ij_coeff, pair.counterIJ);
+            if (charge(i)*charge(j) < 0.0) {
+                if (hasNonzeroCoeff(m_Beta0MX_ij_coeff, pair.counterIJ) ||
+                    hasNonzeroCoeff(m_Beta1MX_ij_coeff, pair.counterIJ) ||
+                    hasNonzeroCoeff(m_CphiMX_ij_coeff, pair.counterIJ) ||
+                    pair.hasBeta2) {
+                    m_CationAnionPairs.push_back(pair);
+                }
+            } else if (charge(i)*charge(j) > 0.0) {
+                /*
+                 * E-theta is nonzero for ions with unequal charges, even
+                 * if theta itself is zero
+                 */
+                if (hasNonzeroCoeff(m_Theta_ij_coeff, pair.counterIJ) ||
+                    fabs(charge(i)) != fabs(charge(j))) {
+                    m_LikeChargePairs.push_back(pair);
+                }
+            }
+        }
+    }
+
+    /*
+     * The psi parameters are stored for all permutations of each triplet,
+     * so only one ordering of each is added to m_PsiTriplets. The zeta
+     * parameters are only stored in the (neutral, cation, anion) order.
+     */
+    for (size_t i = 1; i < m_kk; i++) {
+        for (size_t j = 1; j < m_kk; j++) {
+            for (size_t k = 1; k < m_kk; k++) {
+                size_t n = i * m_kk * m_kk + j * m_kk + k;
+                if (!hasNonzeroCoeff(m_Psi_ijk_coeff, n)) {
+                    continue;
+                }
+                m_PsiIndices.push_back(n);
+                PitzerTriplet trip = {i, j, k, n};
+                if (charge(i) == 0.0) {
+                    if (charge(j) > 0.0 && charge(k) < 0.0) {
+                        m_ZetaTriplets.push_back(trip);
+                    }
+                } else if (j > i && charge(i)*charge(j) > 0.0 &&
+                           charge(i)*charge(k) < 0.0) {
+                    m_PsiTriplets.push_back(trip);
+                }
+            }
+        }
+    }
+
+    for (size_t i = 1; i < m_kk; i++) {
+        if (charge(i) != 0.0) {
+            continue;
+        }
+        bool active = hasNonzeroCoeff(m_Mu_nnn_coeff, i);
+        for (size_t j = 1; j < m_kk; j++) {
+            active = active || hasNonzeroCoeff(m_Lambda_nj_coeff, i*m_kk + j);
+        }
+        if (active) {
+            m_NeutralSolutes.push_back(i);
+        }
+    }
+}
+
 void HMWSoln::s_updatePitzer_CoeffWRTemp(int doDerivs) const
 {
+    // The coefficients and all of their derivatives depend only on the
+    // temperature
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature())) {
+        return;
+    }
+
     double T = temperature();
     const double twoT = 2.0 * T;
     const double invT = 1.0 / T;
@@ -1619,58 +1735,39 @@ void HMWSoln::s_updatePitzer_CoeffWRTemp(int doDerivs) const
         }
     }
 
-    switch(m_formPitzerTemp) {
-    case PITZER_TEMP_CONSTANT:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k ;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n] = Psi_coeff[0];
-              }
-          }
-      }
-      break;
-    case PITZER_TEMP_LINEAR:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k ;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n]      = Psi_coeff[0] + Psi_coeff[1]*tlin;
-                  m_Psi_ijk_L[n]    = Psi_coeff[1];
-                  m_Psi_ijk_LL[n]   = 0.0;
-              }
-          }
-      }
-      break;
-    case PITZER_TEMP_COMPLEX1:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k ;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n] = Psi_coeff[0]
-                                 + Psi_coeff[1]*tlin
-                                 + Psi_coeff[2]*tquad
-                                 + Psi_coeff[3]*tinv
-                                 + Psi_coeff[4]*tln;
-
-                  m_Psi_ijk_L[n] = Psi_coeff[1]
-                                   + Psi_coeff[2]*twoT
-                                   - Psi_coeff[3]*invT2
-                                   + Psi_coeff[4]*invT;
-
-                  m_Psi_ijk_LL[n] =
-                      Psi_coeff[2]*2.0
-                      + Psi_coeff[3]*twoinvT3
-                      - Psi_coeff[4]*invT2;
-              }
-          }
-      }
-      break;
-    }
+    // Only the psi and zeta entries with nonzero coefficients need to be
+    // updated; the rest stay zero
+    for (size_t m = 0; m < m_PsiIndices.size(); m++) {
+        size_t n = m_PsiIndices[m];
+        const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
+        switch (m_formPitzerTemp) {
+        case PITZER_TEMP_CONSTANT:
+            m_Psi_ijk[n] = Psi_coeff[0];
+            break;
+        case PITZER_TEMP_LINEAR:
+            m_Psi_ijk[n]      = Psi_coeff[0] + Psi_coeff[1]*tlin;
+            m_Psi_ijk_L[n]    = Psi_coeff[1];
+            m_Psi_ijk_LL[n]   = 0.0;
+            break;
+        case PITZER_TEMP_COMPLEX1:
+            m_Psi_ijk[n] = Psi_coeff[0]
+                           + Psi_coeff[1]*tlin
+                           + Psi_coeff[2]*tquad
+                           + Psi_coeff[3]*tinv
+                           + Psi_coeff[4]*tln;
 
+            m_Psi_ijk_L[n] = Psi_coeff[1]
+                             + Psi_coeff[2]*twoT
+                             - Psi_coeff[3]*invT2
+                             + Psi_coeff[4]*invT;
+
+            m_Psi_ijk_LL[n] =
+                Psi_coeff[2]*2.0
+                + Psi_coeff[3]*twoinvT3
+                - Psi_coeff[4]*invT2;
+            break;
+        }
+    }
 }
 
 void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
@@ -1702,10 +1799,7 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
     const double* alpha2MX =  DATA_PTR(m_Alpha2MX_ij);
 
     const double* psi_ijk =  DATA_PTR(m_Psi_ijk);
-    //n = k + j * m_kk + i * m_kk * m_kk;
-
 
-    double* gamma_Unscaled = DATA_PTR(m_gamma_tmp);
     /*
      * Local variables defined by Coltrin
      */
@@ -1724,6 +1818,7 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
      * even those with zero charge.
      */
     double molalitysumUncropped = 0.0;
+    double molalitysum = 0.0;
 
     double* gfunc    =  DATA_PTR(m_gfunc_IJ);
     double* g2func   =  DATA_PTR(m_g2func_IJ);
@@ -1740,10 +1835,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
         printf("\n Debugging information from hmw_act \n");
     }
-    /*
-     * Make sure the counter variables are setup
-     */
-    counterIJ_setup();
 
     /*
      * ---------- Calculate common sums over solutes ---------------------
@@ -1754,13 +1845,17 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
         //      total molar charge
         molarcharge +=  fabs(charge(n)) * molality[n];
         molalitysumUncropped += m_molalities[n];
+        molalitysum += molality[n];
     }
     Is *= 0.5;
 
     /*
-     * Store the ionic molality in the object for reference.
+     * Store the ionic molality and the other sums in the object, for
+     * reference and for use by the derivative routines.
      */
     m_IionicMolality = Is;
+    m_molarCharge = molarcharge;
+    m_molalitySumCropped = molalitysum;
     sqrtIs = sqrt(Is);
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
         printf(" Step 1: \n");
@@ -1793,151 +1888,81 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
         }
     }
 
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 3: \n");
-        printf(" Species          Species            g(x) "
-               " hfunc(x)   \n");
-    }
-
     /*
-     *  calculate g(x) and hfunc(x) for each cation-anion pair MX
-     *   In the original literature, hfunc, was called gprime. However,
-     *   it's not the derivative of g(x), so I renamed it.
+     * ------------- SUBSECTION FOR CALCULATION OF F ----------------------
+     * ------------ Agrees with Pitzer Eqn. (65) --------------------------
+     *
+     * The binary terms are added in below, as the binary intermediates
+     * are calculated.
      */
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            /*
-             * Only loop over oppositely charge species
-             */
-            if (charge(i)*charge(j) < 0) {
-                /*
-                 * x is a reduced function variable
-                 */
-                double x1 = sqrtIs * alpha1MX[counterIJ];
-                if (x1 > 1.0E-100) {
-                    gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    hfunc[counterIJ] = -2.0 *
-                                       (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    gfunc[counterIJ] = 0.0;
-                    hfunc[counterIJ] = 0.0;
-                }
+    double Aphi = A_Debye_TP() / 3.0;
+    double F = -Aphi * (sqrt(Is) / (1.0 + 1.2*sqrt(Is))
+                 + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
 
-                if (beta2MX[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * alpha2MX[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        h2func[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        g2func[counterIJ] = 0.0;
-                        h2func[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                gfunc[counterIJ] = 0.0;
-                hfunc[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
-                       gfunc[counterIJ], hfunc[counterIJ]);
-            }
-        }
+    if (DEBUG_MODE_ENABLED && m_debugCalc) {
+        printf(" Steps 3, 4, 5: \n");
+        printf(" Species          Species            g(x) "
+               " hfunc(x)    BMX    BprimeMX    BphiMX    CMX \n");
     }
 
     /*
-     * --------- SUBSECTION TO CALCULATE BMX, BprimeMX, BphiMX ----------
-     * --------- Agrees with Pitzer, Eq. (49), (51), (55)
+     * For each cation-anion pair MX, calculate g(x) and hfunc(x), and from
+     * them BMX, BprimeMX, BphiMX (Pitzer, Eq. (49), (51), (55)) and CMX
+     * (Pitzer, Eq. (53)). In the original literature, hfunc, was called
+     * gprime. However, it's not the derivative of g(x), so I renamed it.
+     *
+     * The g and h functions only depend on the ionic strength, and are
+     * reused by the derivative routines. g2 and h2 are therefore
+     * calculated whenever any of the beta2 coefficients are nonzero.
      */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 4: \n");
-        printf(" Species          Species            BMX    "
-               "BprimeMX    BphiMX   \n");
-    }
-
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        const PitzerPair& pair = m_CationAnionPairs[p];
+        size_t counterIJ = pair.counterIJ;
+        /*
+         * x is a reduced function variable
+         */
+        double x1 = sqrtIs * alpha1MX[counterIJ];
+        if (x1 > 1.0E-100) {
+            gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
+            hfunc[counterIJ] = -2.0 *
+                               (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
+        } else {
+            gfunc[counterIJ] = 0.0;
+            hfunc[counterIJ] = 0.0;
+        }
 
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                BMX[counterIJ]  = beta0MX[counterIJ]
-                                  + beta1MX[counterIJ] * gfunc[counterIJ]
-                                  + beta2MX[counterIJ] * g2func[counterIJ];
-
-                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                    printf("%d %g: %g %g %g %g\n",
-                           (int) counterIJ,  BMX[counterIJ], beta0MX[counterIJ],
-                           beta1MX[counterIJ], beta2MX[counterIJ], gfunc[counterIJ]);
-                }
-                if (Is > 1.0E-150) {
-                    BprimeMX[counterIJ] = (beta1MX[counterIJ] * hfunc[counterIJ]/Is +
-                                           beta2MX[counterIJ] * h2func[counterIJ]/Is);
-                } else {
-                    BprimeMX[counterIJ] = 0.0;
-                }
-                BphiMX[counterIJ]   = BMX[counterIJ] + Is*BprimeMX[counterIJ];
+        if (pair.hasBeta2) {
+            double x2 = sqrtIs * alpha2MX[counterIJ];
+            if (x2 > 1.0E-100) {
+                g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
+                h2func[counterIJ] = -2.0 *
+                                    (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
             } else {
-                BMX[counterIJ]      = 0.0;
-                BprimeMX[counterIJ] = 0.0;
-                BphiMX[counterIJ]   = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
-                       sni.c_str(), snj.c_str(),
-                       BMX[counterIJ], BprimeMX[counterIJ], BphiMX[counterIJ]);
+                g2func[counterIJ] = 0.0;
+                h2func[counterIJ] = 0.0;
             }
         }
-    }
 
-    /*
-     * --------- SUBSECTION TO CALCULATE CMX ----------
-     * --------- Agrees with Pitzer, Eq. (53).
-     */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 5: \n");
-        printf(" Species          Species            CMX \n");
-    }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                CMX[counterIJ] = CphiMX[counterIJ]/
-                                 (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                CMX[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
-                       CMX[counterIJ]);
-            }
+        BMX[counterIJ]  = beta0MX[counterIJ]
+                          + beta1MX[counterIJ] * gfunc[counterIJ]
+                          + beta2MX[counterIJ] * g2func[counterIJ];
+        if (Is > 1.0E-150) {
+            BprimeMX[counterIJ] = (beta1MX[counterIJ] * hfunc[counterIJ]/Is +
+                                   beta2MX[counterIJ] * h2func[counterIJ]/Is);
+        } else {
+            BprimeMX[counterIJ] = 0.0;
+        }
+        BphiMX[counterIJ]   = BMX[counterIJ] + Is*BprimeMX[counterIJ];
+        CMX[counterIJ] = CphiMX[counterIJ]/
+                         (2.0* sqrt(fabs(charge(pair.i)*charge(pair.j))));
+        F += molality[pair.i]*molality[pair.j] * BprimeMX[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(pair.i);
+            std::string snj = speciesName(pair.j);
+            printf(" %-16s %-16s %9.5f %9.5f %11.7f %11.7f %11.7f %11.7f \n",
+                   sni.c_str(), snj.c_str(), gfunc[counterIJ], hfunc[counterIJ],
+                   BMX[counterIJ], BprimeMX[counterIJ], BphiMX[counterIJ],
+                   CMX[counterIJ]);
         }
     }
 
@@ -1950,610 +1975,201 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
         printf(" Species          Species            Phi_ij "
                " Phiprime_ij  Phi^phi_ij \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) > 0) {
-                int z1 = (int) fabs(charge(i));
-                int z2 = (int) fabs(charge(j));
-                Phi[counterIJ] = thetaij[counterIJ] + etheta[z1][z2];
-                Phiprime[counterIJ] = etheta_prime[z1][z2];
-                Phiphi[counterIJ] = Phi[counterIJ] + Is * Phiprime[counterIJ];
-            } else {
-                Phi[counterIJ]      = 0.0;
-                Phiprime[counterIJ] = 0.0;
-                Phiphi[counterIJ]   = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
-                       sni.c_str(), snj.c_str(),
-                       Phi[counterIJ], Phiprime[counterIJ], Phiphi[counterIJ]);
-            }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        const PitzerPair& pair = m_LikeChargePairs[p];
+        size_t counterIJ = pair.counterIJ;
+        int z1 = (int) fabs(charge(pair.i));
+        int z2 = (int) fabs(charge(pair.j));
+        Phi[counterIJ] = thetaij[counterIJ] + etheta[z1][z2];
+        Phiprime[counterIJ] = etheta_prime[z1][z2];
+        Phiphi[counterIJ] = Phi[counterIJ] + Is * Phiprime[counterIJ];
+        F += molality[pair.i]*molality[pair.j] * Phiprime[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(pair.i);
+            std::string snj = speciesName(pair.j);
+            printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
+                   sni.c_str(), snj.c_str(),
+                   Phi[counterIJ], Phiprime[counterIJ], Phiphi[counterIJ]);
         }
     }
+    if (DEBUG_MODE_ENABLED && m_debugCalc) {
+        printf(" Step 7: F = %10.6f \n", F);
+        printf(" Step 8: Summing in All Contributions to Activity Coefficients \n");
+    }
 
     /*
-     * ------------- SUBSECTION FOR CALCULATION OF F ----------------------
-     * ------------ Agrees with Pitzer Eqn. (65) --------------------------
+     * -------- SUBSECTION FOR CALCULATING THE ACTCOEFF FOR THE SOLUTES ----
+     * -------- -> equations agree with my notes, Eqn. (118), (119).
+     *          -> Equations agree with Pitzer, eqn.(63), (64)
      */
+    double sumInteractions =
+        s_updatePitzer_interactionSums(F, BMX, CMX, BphiMX, Phi, Phiphi, psi_ijk,
+                                       m_Lambda_nj, m_Mu_nnn,
+                                       DATA_PTR(m_lnActCoeffMolal_Unscaled));
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 7: \n");
+        for (size_t i = 1; i < m_kk; i++) {
+            std::string sni = speciesName(i);
+            printf("      Net %-16s                        lngamma[i] =  %9.5f         gamma[i]=%10.6f \n",
+                   sni.c_str(), m_lnActCoeffMolal_Unscaled[i],
+                   exp(m_lnActCoeffMolal_Unscaled[i]));
+        }
+        printf(" Step 9: \n");
     }
-    double Aphi = A_Debye_TP() / 3.0;
-    double F = -Aphi * (sqrt(Is) / (1.0 + 1.2*sqrt(Is))
-                 + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" initial value of F = %10.6f \n", F);
+    /*
+     * -------- SUBSECTION FOR CALCULATING THE OSMOTIC COEFF ---------
+     * -------- -> equations agree with my notes, Eqn. (117).
+     *          -> Equations agree with Pitzer, eqn.(62)
+     *
+     * term1 is the DH term in the osmotic coefficient expression
+     * b = 1.2 sqrt(kg/gmol) <- arbitrarily set in all Pitzer
+     *                          implementations.
+     * Is = Ionic strength on the molality scale (units of (gmol/kg))
+     * Aphi = A_Debye / 3   (units of sqrt(kg/gmol))
+     */
+    double term1 = -Aphi * pow(Is,1.5) / (1.0 + 1.2 * sqrt(Is));
+    double sum_m_phi_minus_1 = 2.0 * (term1 + sumInteractions);
+    /*
+     * Calculate the osmotic coefficient from
+     *       osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
+     */
+    double osmotic_coef;
+    if (molalitysumUncropped > 1.0E-150) {
+        osmotic_coef = 1.0 + (sum_m_phi_minus_1 / molalitysumUncropped);
+    } else {
+        osmotic_coef = 1.0;
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0) {
-                F = F + molality[i]*molality[j] * BprimeMX[counterIJ];
-            }
-            /*
-             * Both species have a non-zero charge, and they
-             * have the same sign
-             */
-            if (charge(i)*charge(j) > 0) {
-                F = F + molality[i]*molality[j] * Phiprime[counterIJ];
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf(" F = %10.6f \n", F);
-            }
-        }
+    if (DEBUG_MODE_ENABLED && m_debugCalc) {
+        printf(" term1=%10.6f sum=%10.6f\n", term1, sumInteractions);
+        printf("     sum_m_phi_minus_1=%10.6f        osmotic_coef=%10.6f\n",
+               sum_m_phi_minus_1, osmotic_coef);
+        printf(" Step 10: \n");
     }
+    double lnwateract = -(m_weightSolvent/1000.0) * molalitysumUncropped * osmotic_coef;
+
+    /*
+     * In Cantera, we define the activity coefficient of the solvent as
+     *
+     *     act_0 = actcoeff_0 * Xmol_0
+     *
+     * We have just computed act_0. However, this routine returns
+     *  ln(actcoeff[]). Therefore, we must calculate ln(actcoeff_0).
+     */
+    double xmolSolvent = moleFraction(m_indexSolvent);
+    double xx = std::max(m_xmolSolventMIN, xmolSolvent);
+    m_lnActCoeffMolal_Unscaled[0] = lnwateract - log(xx);
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 8: Summing in All Contributions to Activity Coefficients \n");
+        double wateract = exp(lnwateract);
+        printf(" Weight of Solvent = %16.7g\n", m_weightSolvent);
+        printf(" molalitySumUncropped = %16.7g\n", molalitysumUncropped);
+        printf(" ln_a_water=%10.6f a_water=%10.6f\n\n",
+               lnwateract, wateract);
     }
+}
+
+double HMWSoln::s_updatePitzer_interactionSums(double dF, const double* BMX,
+        const double* CMX, const double* BphiMX, const double* Phi,
+        const double* Phiphi, const double* psi, const Array2D& lambda,
+        const vector_fp& mu, double* lnac) const
+{
+    const double* molality = DATA_PTR(m_molalitiesCropped);
+    double molarcharge = m_molarCharge;
 
+    /*
+     * Unary term: z_i^2 F
+     */
     for (size_t i = 1; i < m_kk; i++) {
+        lnac[i] = charge(i) * charge(i) * dF;
+    }
 
-        /*
-         * -------- SUBSECTION FOR CALCULATING THE ACTCOEFF FOR CATIONS -----
-         * -------- -> equations agree with my notes, Eqn. (118).
-         *          -> Equations agree with Pitzer, eqn.(63)
-         */
-        if (charge(i) > 0.0) {
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                printf("  Contributions to ln(ActCoeff_%s):\n", sni.c_str());
-            }
-            // species i is the cation (positive) to calc the actcoeff
-            double zsqF = charge(i)*charge(i)*F;
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf("      Unary term:                                      z*z*F = %10.5f\n", zsqF);
-            }
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                /*
-                 * Find the counterIJ for the symmetric binary interaction
-                 */
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
-
-                if (charge(j) < 0.0) {
-                    // sum over all anions
-                    sum1 = sum1 + molality[j]*
-                           (2.0*BMX[counterIJ] + molarcharge*CMX[counterIJ]);
-                    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                        std::string snj = speciesName(j) + ":";
-                        printf("      Bin term with %-13s                  2 m_j BMX = %10.5f\n", snj.c_str(),
-                               molality[j]*2.0*BMX[counterIJ]);
-                        printf("                                                   m_j Z CMX = %10.5f\n",
-                               molality[j]* molarcharge*CMX[counterIJ]);
-                    }
-                    if (j < m_kk-1) {
-                        /*
-                         * This term is the ternary interaction involving the
-                         * non-duplicate sum over double anions, j, k, with
-                         * respect to the cation, i.
-                         */
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk[n];
-                                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                    if (psi_ijk[n] != 0.0) {
-                                        std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                        printf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
-                                               molality[j]*molality[k]*psi_ijk[n]);
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
+    /*
+     * Binary cation-anion terms: m_j (2 BMX + Z CMX) for each ion of the
+     * pair, and m_c m_a (BphiMX + Z CMX) in the osmotic coefficient.
+     * sumCMX is the ternary sum over all cation-anion pairs, m_c m_a CMX,
+     * which is multiplied by abs(z_i) for each ion.
+     */
+    double sum = 0.0;
+    double sumCMX = 0.0;
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        const PitzerPair& pair = m_CationAnionPairs[p];
+        size_t c = pair.counterIJ;
+        double mi = molality[pair.i];
+        double mj = molality[pair.j];
+        double term = 2.0*BMX[c] + molarcharge*CMX[c];
+        lnac[pair.i] += mj * term;
+        lnac[pair.j] += mi * term;
+        sum += mi * mj * (BphiMX[c] + molarcharge*CMX[c]);
+        sumCMX += mi * mj * CMX[c];
+    }
+    for (size_t i = 1; i < m_kk; i++) {
+        lnac[i] += fabs(charge(i)) * sumCMX;
+    }
 
+    /*
+     * Binary terms between ions of the same sign
+     */
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        const PitzerPair& pair = m_LikeChargePairs[p];
+        size_t c = pair.counterIJ;
+        double mi = molality[pair.i];
+        double mj = molality[pair.j];
+        lnac[pair.i] += 2.0 * mj * Phi[c];
+        lnac[pair.j] += 2.0 * mi * Phi[c];
+        sum += mi * mj * Phiphi[c];
+    }
 
-                if (charge(j) > 0.0) {
-                    // sum over all cations
-                    if (j != i) {
-                        sum2 = sum2 + molality[j]*(2.0*Phi[counterIJ]);
-                        if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                            if ((molality[j] * Phi[counterIJ])!= 0.0) {
-                                std::string snj = speciesName(j) + ":";
-                                printf("      Phi term with %-12s                2 m_j Phi_cc = %10.5f\n", snj.c_str(),
-                                       molality[j]*(2.0*Phi[counterIJ]));
-                            }
-                        }
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            // two inner sums over anions
-
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk[n];
-                            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                if (psi_ijk[n] != 0.0) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
-                                           molality[j]*molality[k]*psi_ijk[n]);
-                                }
-                            }
-                            /*
-                             * Find the counterIJ for the j,k interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 + (fabs(charge(i))*
-                                           molality[j]*molality[k]*CMX[counterIJ2]);
-                            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                if ((molality[j]*molality[k]*CMX[counterIJ2]) != 0.0) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Tern CMX term on %-16s abs(z_i) m_j m_k CMX = %10.5f\n", snj.c_str(),
-                                           fabs(charge(i))* molality[j]*molality[k]*CMX[counterIJ2]);
-                                }
-                            }
-                        }
-                    }
-                }
+    /*
+     * Ternary psi terms, and the ternary zeta terms between a neutral
+     * species and a cation-anion pair. Each triplet contributes to the
+     * activity coefficients of all three of its species.
+     */
+    for (size_t t = 0; t < m_PsiTriplets.size(); t++) {
+        const PitzerTriplet& trip = m_PsiTriplets[t];
+        double mi = molality[trip.i];
+        double mj = molality[trip.j];
+        double mk = molality[trip.k];
+        double p = psi[trip.n];
+        lnac[trip.i] += mj * mk * p;
+        lnac[trip.j] += mi * mk * p;
+        lnac[trip.k] += mi * mj * p;
+        sum += mi * mj * mk * p;
+    }
+    for (size_t t = 0; t < m_ZetaTriplets.size(); t++) {
+        const PitzerTriplet& trip = m_ZetaTriplets[t];
+        double mi = molality[trip.i];
+        double mj = molality[trip.j];
+        double mk = molality[trip.k];
+        double zeta = psi[trip.n];
+        lnac[trip.i] += mj * mk * zeta;
+        lnac[trip.j] += mi * mk * zeta;
+        lnac[trip.k] += mi * mj * zeta;
+        sum += mi * mj * mk * zeta;
+    }
 
-                /*
-                 * Handle neutral j species
-                 */
-                if (charge(j) == 0) {
-                    sum5 = sum5 + molality[j]*2.0*m_Lambda_nj(j,i);
-                    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                        if ((molality[j]*2.0*m_Lambda_nj(j,i)) != 0.0) {
-                            std::string snj = speciesName(j) + ":";
-                            printf("      Lambda term with %-12s                 2 m_j lam_ji = %10.5f\n", snj.c_str(),
-                                   molality[j]*2.0*m_Lambda_nj(j,i));
-                        }
-                    }
-                    /*
-                     * Zeta interaction term
-                     */
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                            double zeta = psi_ijk[n];
-                            if (zeta != 0.0) {
-                                sum5 = sum5 + molality[j]*molality[k]*zeta;
-                                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Zeta term on %-16s         m_n m_a zeta_nMa = %10.5f\n", snj.c_str(),
-                                           molality[j]*molality[k]*psi_ijk[n]);
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-            /*
-             * Add all of the contributions up to yield the log of the
-             * solute activity coefficients (molality scale)
-             */
-            m_lnActCoeffMolal_Unscaled[i] = zsqF + sum1 + sum2 + sum3 + sum4 + sum5;
-            gamma_Unscaled[i] = exp(m_lnActCoeffMolal_Unscaled[i]);
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                printf("      Net %-16s                        lngamma[i] =  %9.5f         gamma[i]=%10.6f \n",
-                       sni.c_str(), m_lnActCoeffMolal_Unscaled[i], gamma_Unscaled[i]);
-            }
-        }
-
-        /*
-         * -------- SUBSECTION FOR CALCULATING THE ACTCOEFF FOR ANIONS ------
-         * -------- -> equations agree with my notes, Eqn. (119).
-         *          -> Equations agree with Pitzer, eqn.(64)
-         */
-        if (charge(i) < 0) {
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                printf("  Contributions to ln(ActCoeff_%s):\n", sni.c_str());
-            }
-            //          species i is an anion (negative)
-            double zsqF = charge(i)*charge(i)*F;
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf("      Unary term:                                      z*z*F = %10.5f\n", zsqF);
-            }
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                /*
-                 * Find the counterIJ for the symmetric binary interaction
-                 */
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
-
-                /*
-                 * For Anions, do the cation interactions.
-                 */
-                if (charge(j) > 0) {
-                    sum1 = sum1 + molality[j]*
-                           (2.0*BMX[counterIJ]+molarcharge*CMX[counterIJ]);
-                    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                        std::string snj = speciesName(j) + ":";
-                        printf("      Bin term with %-13s                  2 m_j BMX = %10.5f\n", snj.c_str(),
-                               molality[j]*2.0*BMX[counterIJ]);
-                        printf("                                                   m_j Z CMX = %10.5f\n",
-                               molality[j]* molarcharge*CMX[counterIJ]);
-                    }
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk[n];
-                                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                    if (psi_ijk[n] != 0.0) {
-                                        std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                        printf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
-                                               molality[j]*molality[k]*psi_ijk[n]);
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-
-                /*
-                 * For Anions, do the other anion interactions.
-                 */
-                if (charge(j) < 0.0) {
-                    //  sum over all anions
-                    if (j != i) {
-                        sum2 = sum2 + molality[j]*(2.0*Phi[counterIJ]);
-                        if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                            if ((molality[j] * Phi[counterIJ])!= 0.0) {
-                                std::string snj = speciesName(j) + ":";
-                                printf("      Phi term with %-12s                2 m_j Phi_aa = %10.5f\n", snj.c_str(),
-                                       molality[j]*(2.0*Phi[counterIJ]));
-                            }
-                        }
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk[n];
-                            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                if (psi_ijk[n] != 0.0) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
-                                           molality[j]*molality[k]*psi_ijk[n]);
-                                }
-                            }
-                            /*
-                             * Find the counterIJ for the symmetric binary interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 +
-                                   (fabs(charge(i))*
-                                    molality[j]*molality[k]*CMX[counterIJ2]);
-                            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                if ((molality[j]*molality[k]*CMX[counterIJ2]) != 0.0) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Tern CMX term on %-16s abs(z_i) m_j m_k CMX = %10.5f\n", snj.c_str(),
-                                           fabs(charge(i))* molality[j]*molality[k]*CMX[counterIJ2]);
-                                }
-                            }
-                        }
-                    }
-                }
-
-                /*
-                 * for Anions, do the neutral species interaction
-                 */
-                if (charge(j) == 0.0) {
-                    sum5 = sum5 + molality[j]*2.0*m_Lambda_nj(j,i);
-                    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                        if ((molality[j]*2.0*m_Lambda_nj(j,i)) != 0.0) {
-                            std::string snj = speciesName(j) + ":";
-                            printf("      Lambda term with %-12s                 2 m_j lam_ji = %10.5f\n", snj.c_str(),
-                                   molality[j]*2.0*m_Lambda_nj(j,i));
-                        }
-                    }
-                    /*
-                     * Zeta interaction term
-                     */
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta = psi_ijk[n];
-                            if (zeta != 0.0) {
-                                sum5 = sum5 + molality[j]*molality[k]*zeta;
-                                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Zeta term on %-16s         m_n m_c zeta_ncX = %10.5f\n", snj.c_str(),
-                                           molality[j]*molality[k]*psi_ijk[n]);
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-            m_lnActCoeffMolal_Unscaled[i] = zsqF + sum1 + sum2 + sum3 + sum4 + sum5;
-            gamma_Unscaled[i] = exp(m_lnActCoeffMolal_Unscaled[i]);
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                printf("      Net %-16s                        lngamma[i] =  %9.5f             gamma[i]=%10.6f\n",
-                       sni.c_str(), m_lnActCoeffMolal_Unscaled[i], gamma_Unscaled[i]);
-            }
-        }
-        /*
-         * ------ SUBSECTION FOR CALCULATING NEUTRAL SOLUTE ACT COEFF -------
-         * ------ -> equations agree with my notes,
-         *        -> Equations agree with Pitzer,
-         */
-        if (charge(i) == 0.0) {
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                printf("  Contributions to ln(ActCoeff_%s):\n", sni.c_str());
-            }
-            double sum1 = 0.0;
-            double sum3 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                sum1 = sum1 + molality[j]*2.0*m_Lambda_nj(i,j);
-                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                    if (m_Lambda_nj(i,j) != 0.0) {
-                        std::string snj = speciesName(j) + ":";
-                        printf("      Lambda_n term on %-16s     2 m_j lambda_n_j = %10.5f\n", snj.c_str(),
-                               molality[j]*2.0*m_Lambda_nj(i,j));
-                    }
-                }
-                /*
-                 * Zeta term -> we piggyback on the psi term
-                 */
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 = sum3 + molality[j]*molality[k]*psi_ijk[n];
-                            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                if (psi_ijk[n] != 0.0) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Zeta term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
-                                           molality[j]*molality[k]*psi_ijk[n]);
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-            double sum2 = 3.0 * molality[i]* molality[i] * m_Mu_nnn[i];
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                if (m_Mu_nnn[i] != 0.0) {
-                    printf("      Mu_nnn term              3 m_n m_n Mu_n_n = %10.5f\n",
-                           3.0 * molality[i]* molality[i] * m_Mu_nnn[i]);
-                }
-            }
-            m_lnActCoeffMolal_Unscaled[i] = sum1 + sum2 + sum3;
-            gamma_Unscaled[i] = exp(m_lnActCoeffMolal_Unscaled[i]);
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                printf("      Net %-16s                        lngamma[i] =  %9.5f             gamma[i]=%10.6f\n",
-                       sni.c_str(), m_lnActCoeffMolal_Unscaled[i], gamma_Unscaled[i]);
-            }
-        }
-
-    }
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 9: \n");
-    }
-    /*
-     * -------- SUBSECTION FOR CALCULATING THE OSMOTIC COEFF ---------
-     * -------- -> equations agree with my notes, Eqn. (117).
-     *          -> Equations agree with Pitzer, eqn.(62)
-     */
-    double sum1 = 0.0;
-    double sum2 = 0.0;
-    double sum3 = 0.0;
-    double sum4 = 0.0;
-    double sum5 = 0.0;
-    double sum6 = 0.0;
-    double sum7 = 0.0;
     /*
-     * term1 is the DH term in the osmotic coefficient expression
-     * b = 1.2 sqrt(kg/gmol) <- arbitrarily set in all Pitzer
-     *                          implementations.
-     * Is = Ionic strength on the molality scale (units of (gmol/kg))
-     * Aphi = A_Debye / 3   (units of sqrt(kg/gmol))
+     * Neutral species interactions: lambda_nj and mu_nnn
      */
-    double term1 = -Aphi * pow(Is,1.5) / (1.0 + 1.2 * sqrt(Is));
-
-    for (size_t j = 1; j < m_kk; j++) {
-        /*
-         * Loop Over Cations
-         */
-        if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum1 = sum1 + molality[j]*molality[k]*
-                           (BphiMX[counterIJ] + molarcharge*CMX[counterIJ]);
-                }
-            }
-
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == (m_kk-1)) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_lnMolalityActCoeff",
-                                       "logic error 1 in Step 9 of hmw_act");
-                }
-                if (charge(k) > 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between 2 cations.
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum2 = sum2 + molality[j]*molality[k]*Phiphi[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 = sum2 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk[n];
-                        }
-                    }
-                }
-            }
-        }
-
-        /*
-         * Loop Over Anions
-         */
-        if (charge(j) < 0) {
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == m_kk-1) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_lnMolalityActCoeff",
-                                       "logic error 2 in Step 9 of hmw_act");
-                }
-                if (charge(k) < 0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between two anions
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum3 = sum3 + molality[j]*molality[k]*Phiphi[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 = sum3 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk[n];
-                        }
-                    }
-                }
+    for (size_t p = 0; p < m_NeutralSolutes.size(); p++) {
+        size_t n = m_NeutralSolutes[p];
+        double mn = molality[n];
+        for (size_t j = 1; j < m_kk; j++) {
+            double lam = lambda(n,j);
+            if (lam == 0.0) {
+                continue;
             }
-        }
-
-        /*
-         * Loop Over Neutral Species
-         */
-        if (charge(j) == 0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    sum4 = sum4 + molality[j]*molality[k]*m_Lambda_nj(j,k);
-                }
-                if (charge(k) > 0.0) {
-                    sum5 = sum5 + molality[j]*molality[k]*m_Lambda_nj(j,k);
-                }
-                if (charge(k) == 0.0) {
-                    if (k > j) {
-                        sum6 = sum6 + molality[j]*molality[k]*m_Lambda_nj(j,k);
-                    } else if (k == j) {
-                        sum6 = sum6 + 0.5 * molality[j]*molality[k]*m_Lambda_nj(j,k);
-                    }
-                }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta = psi_ijk[n];
-                            if (zeta != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta;
-                            }
-                        }
-                    }
-                }
+            lnac[n] += 2.0 * molality[j] * lam;
+            if (charge(j) != 0.0) {
+                lnac[j] += 2.0 * mn * lam;
+                sum += mn * molality[j] * lam;
+            } else if (j > n) {
+                sum += mn * molality[j] * lam;
+            } else if (j == n) {
+                sum += 0.5 * mn * mn * lam;
             }
-            sum7 += molality[j]*molality[j]*molality[j]*m_Mu_nnn[j];
         }
+        lnac[n] += 3.0 * mn * mn * mu[n];
+        sum += mn * mn * mn * mu[n];
     }
-    double sum_m_phi_minus_1 = 2.0 *
-                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7);
-    /*
-     * Calculate the osmotic coefficient from
-     *       osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
-     */
-    double osmotic_coef;
-    if (molalitysumUncropped > 1.0E-150) {
-        osmotic_coef = 1.0 + (sum_m_phi_minus_1 / molalitysumUncropped);
-    } else {
-        osmotic_coef = 1.0;
-    }
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" term1=%10.6f sum1=%10.6f sum2=%10.6f "
-               "sum3=%10.6f sum4=%10.6f sum5=%10.6f\n",
-               term1, sum1, sum2, sum3, sum4, sum5);
-        printf("     sum_m_phi_minus_1=%10.6f        osmotic_coef=%10.6f\n",
-               sum_m_phi_minus_1, osmotic_coef);
-        printf(" Step 10: \n");
-    }
-    double lnwateract = -(m_weightSolvent/1000.0) * molalitysumUncropped * osmotic_coef;
-
-    /*
-     * In Cantera, we define the activity coefficient of the solvent as
-     *
-     *     act_0 = actcoeff_0 * Xmol_0
-     *
-     * We have just computed act_0. However, this routine returns
-     *  ln(actcoeff[]). Therefore, we must calculate ln(actcoeff_0).
-     */
-    double xmolSolvent = moleFraction(m_indexSolvent);
-    double xx = std::max(m_xmolSolventMIN, xmolSolvent);
-    m_lnActCoeffMolal_Unscaled[0] = lnwateract - log(xx);
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        double wateract = exp(lnwateract);
-        printf(" Weight of Solvent = %16.7g\n", m_weightSolvent);
-        printf(" molalitySumUncropped = %16.7g\n", molalitysumUncropped);
-        printf(" ln_a_water=%10.6f a_water=%10.6f\n\n",
-               lnwateract, wateract);
-    }
+    return sum;
 }
 
 void HMWSoln::s_update_dlnMolalityActCoeff_dT() const
@@ -2596,7 +2212,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
     /*
      * It may be assumed that the Pitzer activity coefficient routine is
      * called immediately preceding the calling of this routine. Therefore,
-     * some quantities do not need to be recalculated in this routine.
+     * the ionic strength, the molar charge, and the g(x) and h(x) functions
+     * of the cation-anion pairs do not need to be recalculated here.
      */
 
     /*
@@ -2617,565 +2234,116 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
     const double* beta2MX_L =  DATA_PTR(m_Beta2MX_ij_L);
     const double* CphiMX_L  =  DATA_PTR(m_CphiMX_ij_L);
     const double* thetaij_L =  DATA_PTR(m_Theta_ij_L);
-    const double* alpha1MX   =  DATA_PTR(m_Alpha1MX_ij);
-    const double* alpha2MX   =  DATA_PTR(m_Alpha2MX_ij);
     const double* psi_ijk_L =  DATA_PTR(m_Psi_ijk_L);
-    double* d_gamma_dT_Unscaled   =  DATA_PTR(m_gamma_tmp);
-    /*
-     * Local variables defined by Coltrin
-     */
-    double etheta[5][5], etheta_prime[5][5], sqrtIs;
-    /*
-     * Molality based ionic strength of the solution
-     */
-    double Is = 0.0;
-    /*
-     * Molarcharge of the solution: In Pitzer's notation,
-     * this is his variable called "Z".
-     */
-    double molarcharge = 0.0;
-    /*
-     * molalitysum is the sum of the molalities over all solutes,
-     * even those with zero charge.
-     */
-    double molalitysum = 0.0;
 
-    double* gfunc    =  DATA_PTR(m_gfunc_IJ);
-    double* g2func   =  DATA_PTR(m_g2func_IJ);
-    double* hfunc    =  DATA_PTR(m_hfunc_IJ);
-    double* h2func   =  DATA_PTR(m_h2func_IJ);
+    const double* gfunc    =  DATA_PTR(m_gfunc_IJ);
+    const double* g2func   =  DATA_PTR(m_g2func_IJ);
+    const double* hfunc    =  DATA_PTR(m_hfunc_IJ);
+    const double* h2func   =  DATA_PTR(m_h2func_IJ);
     double* BMX_L    =  DATA_PTR(m_BMX_IJ_L);
     double* BprimeMX_L= DATA_PTR(m_BprimeMX_IJ_L);
     double* BphiMX_L =  DATA_PTR(m_BphiMX_IJ_L);
     double* Phi_L    =  DATA_PTR(m_Phi_IJ_L);
-    double* Phiprime =  DATA_PTR(m_Phiprime_IJ);
     double* Phiphi_L =  DATA_PTR(m_PhiPhi_IJ_L);
     double* CMX_L    =  DATA_PTR(m_CMX_IJ_L);
 
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf("\n Debugging information from "
-               "s_Pitzer_dlnMolalityActCoeff_dT()\n");
-    }
     /*
-     * Make sure the counter variables are setup
+     * Molality based ionic strength of the solution
      */
-    counterIJ_setup();
-
+    double Is = m_IionicMolality;
+    double sqrtIs = sqrt(Is);
     /*
-     * ---------- Calculate common sums over solutes ---------------------
+     * molalitysum is the sum of the molalities over all solutes,
+     * even those with zero charge.
      */
-    for (size_t n = 1; n < m_kk; n++) {
-        //      ionic strength
-        Is += charge(n) * charge(n) * molality[n];
-        //      total molar charge
-        molarcharge +=  fabs(charge(n)) * molality[n];
-        molalitysum += molality[n];
-    }
-    Is *= 0.5;
+    double molalitysum = m_molalitySumCropped;
 
-    /*
-     * Store the ionic molality in the object for reference.
-     */
-    m_IionicMolality = Is;
-    sqrtIs = sqrt(Is);
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 1: \n");
+        printf("\n Debugging information from "
+               "s_Pitzer_dlnMolalityActCoeff_dT()\n");
         printf(" ionic strenth      = %14.7le \n total molar "
-               "charge = %14.7le \n", Is, molarcharge);
+               "charge = %14.7le \n", Is, m_molarCharge);
     }
 
     /*
-     * The following call to calc_lambdas() calculates all 16 elements
-     * of the elambda and elambda1 arrays, given the value of the
-     * ionic strength (Is)
+     * ----------- SUBSECTION FOR CALCULATION OF dFdT ---------------------
+     *
+     * The binary terms are added in below. The E-theta terms are treated
+     * as independent of temperature, so there is no Phiprime contribution.
      */
-    calc_lambdas(Is);
+    double dAphidT = dA_DebyedT_TP() / 3.0;
+    double dFdT = -dAphidT * (sqrt(Is) / (1.0 + 1.2*sqrt(Is))
+                       + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
 
     /*
-     * ----- Step 2:  Find the coefficients E-theta and -------------------
-     *                E-thetaprime for all combinations of positive
-     *                unlike charges up to 4
+     * ------- SUBSECTION TO CALCULATE BMX_L, BprimeMX_L, BphiMX_L, CMX_L ----
+     * ------- These are now temperature derivatives of the
+     *         previously calculated quantities.
      */
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 2: \n");
-    }
-    for (int z1 = 1; z1 <=4; z1++) {
-        for (int z2 =1; z2 <=4; z2++) {
-            calc_thetas(z1, z2, &etheta[z1][z2], &etheta_prime[z1][z2]);
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf(" z1=%3d z2=%3d E-theta(I) = %f, E-thetaprime(I) = %f\n",
-                       z1, z2, etheta[z1][z2], etheta_prime[z1][z2]);
-            }
+        printf(" Steps 4, 5: \n");
+        printf(" Species          Species            BMX    "
+               "BprimeMX    BphiMX    CMX \n");
+    }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        const PitzerPair& pair = m_CationAnionPairs[p];
+        size_t counterIJ = pair.counterIJ;
+        BMX_L[counterIJ]  = beta0MX_L[counterIJ]
+                          + beta1MX_L[counterIJ] * gfunc[counterIJ]
+                          + beta2MX_L[counterIJ] * g2func[counterIJ];
+        if (Is > 1.0E-150) {
+            BprimeMX_L[counterIJ] = (beta1MX_L[counterIJ] * hfunc[counterIJ]/Is +
+                                     beta2MX_L[counterIJ] * h2func[counterIJ]/Is);
+        } else {
+            BprimeMX_L[counterIJ] = 0.0;
+        }
+        BphiMX_L[counterIJ] = BMX_L[counterIJ] + Is*BprimeMX_L[counterIJ];
+        CMX_L[counterIJ] = CphiMX_L[counterIJ]/
+                           (2.0* sqrt(fabs(charge(pair.i)*charge(pair.j))));
+        dFdT += molality[pair.i]*molality[pair.j] * BprimeMX_L[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(pair.i);
+            std::string snj = speciesName(pair.j);
+            printf(" %-16s %-16s %11.7f %11.7f %11.7f %11.7f \n",
+                   sni.c_str(), snj.c_str(),
+                   BMX_L[counterIJ], BprimeMX_L[counterIJ], BphiMX_L[counterIJ],
+                   CMX_L[counterIJ]);
         }
     }
 
+    /*
+     * ------- SUBSECTION TO CALCULATE Phi_L and PhiPhi_L ----------
+     */
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t counterIJ = m_LikeChargePairs[p].counterIJ;
+        Phi_L[counterIJ] = thetaij_L[counterIJ];
+        Phiphi_L[counterIJ] = Phi_L[counterIJ];
+    }
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 3: \n");
-        printf(" Species          Species            g(x) "
-               " hfunc(x)   \n");
+        printf(" Step 7: dFdT = %10.6f \n", dFdT);
+        printf(" Step 8: \n");
     }
 
     /*
-     *  calculate g(x) and hfunc(x) for each cation-anion pair MX
-     *   In the original literature, hfunc, was called gprime. However,
-     *   it's not the derivative of g(x), so I renamed it.
+     * -------- SUBSECTION FOR CALCULATING THE dACTCOEFFdT FOR THE SOLUTES -----
      */
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * Only loop over oppositely charge species
-             */
-            if (charge(i)*charge(j) < 0) {
-                /*
-                 * x is a reduced function variable
-                 */
-                double x1 = sqrtIs * alpha1MX[counterIJ];
-                if (x1 > 1.0E-100) {
-                    gfunc[counterIJ]     =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    hfunc[counterIJ] = -2.0 *
-                                       (1.0-(1.0 + x1 + 0.5 * x1 *x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    gfunc[counterIJ] = 0.0;
-                    hfunc[counterIJ] = 0.0;
-                }
-
-                if (beta2MX_L[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * alpha2MX[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        h2func[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        g2func[counterIJ] = 0.0;
-                        h2func[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                gfunc[counterIJ] = 0.0;
-                hfunc[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
-                       gfunc[counterIJ], hfunc[counterIJ]);
-            }
+    double sumInteractions =
+        s_updatePitzer_interactionSums(dFdT, BMX_L, CMX_L, BphiMX_L, Phi_L,
+                                       Phiphi_L, psi_ijk_L, m_Lambda_nj_L,
+                                       m_Mu_nnn_L,
+                                       DATA_PTR(m_dlnActCoeffMolaldT_Unscaled));
+    if (DEBUG_MODE_ENABLED && m_debugCalc) {
+        for (size_t i = 1; i < m_kk; i++) {
+            std::string sni = speciesName(i);
+            printf(" %-16s dlngammadT[i]=%10.6f \n",
+                   sni.c_str(), m_dlnActCoeffMolaldT_Unscaled[i]);
         }
+        printf(" Step 9: \n");
     }
 
-    /*
-     * ------- SUBSECTION TO CALCULATE BMX_L, BprimeMX_L, BphiMX_L ----------
-     * ------- These are now temperature derivatives of the
-     *         previously calculated quantities.
-     */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 4: \n");
-        printf(" Species          Species            BMX    "
-               "BprimeMX    BphiMX   \n");
-    }
-
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                BMX_L[counterIJ]  = beta0MX_L[counterIJ]
-                                    + beta1MX_L[counterIJ] * gfunc[counterIJ]
-                                    + beta2MX_L[counterIJ] * gfunc[counterIJ];
-                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                    printf("%d %g: %g %g %g %g\n",
-                           (int) counterIJ,  BMX_L[counterIJ], beta0MX_L[counterIJ],
-                           beta1MX_L[counterIJ],  beta2MX_L[counterIJ], gfunc[counterIJ]);
-                }
-                if (Is > 1.0E-150) {
-                    BprimeMX_L[counterIJ] = (beta1MX_L[counterIJ] * hfunc[counterIJ]/Is +
-                                             beta2MX_L[counterIJ] * h2func[counterIJ]/Is);
-                } else {
-                    BprimeMX_L[counterIJ] = 0.0;
-                }
-                BphiMX_L[counterIJ] = BMX_L[counterIJ] + Is*BprimeMX_L[counterIJ];
-            } else {
-                BMX_L[counterIJ]      = 0.0;
-                BprimeMX_L[counterIJ] = 0.0;
-                BphiMX_L[counterIJ]     = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
-                       sni.c_str(), snj.c_str(),
-                       BMX_L[counterIJ], BprimeMX_L[counterIJ], BphiMX_L[counterIJ]);
-            }
-        }
-    }
-
-    /*
-     * --------- SUBSECTION TO CALCULATE CMX_L ----------
-     * ---------
-     */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 5: \n");
-        printf(" Species          Species            CMX \n");
-    }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                CMX_L[counterIJ] = CphiMX_L[counterIJ]/
-                                   (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                CMX_L[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
-                       CMX_L[counterIJ]);
-            }
-        }
-    }
-
-    /*
-     * ------- SUBSECTION TO CALCULATE Phi, PhiPrime, and PhiPhi ----------
-     * --------
-     */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 6: \n");
-        printf(" Species          Species            Phi_ij "
-               " Phiprime_ij  Phi^phi_ij \n");
-    }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) > 0) {
-                Phi_L[counterIJ] = thetaij_L[counterIJ];
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_L[counterIJ] = Phi_L[counterIJ] + Is * Phiprime[counterIJ];
-            } else {
-                Phi_L[counterIJ]      = 0.0;
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_L[counterIJ]   = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
-                       sni.c_str(), snj.c_str(),
-                       Phi_L[counterIJ], Phiprime[counterIJ], Phiphi_L[counterIJ]);
-            }
-        }
-    }
-
-    /*
-     * ----------- SUBSECTION FOR CALCULATION OF dFdT ---------------------
-     */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 7: \n");
-    }
-    double dA_DebyedT = dA_DebyedT_TP();
-    double dAphidT = dA_DebyedT /3.0;
-    double dFdT = -dAphidT * (sqrt(Is) / (1.0 + 1.2*sqrt(Is))
-                       + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" initial value of dFdT = %10.6f \n", dFdT);
-    }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0) {
-                dFdT = dFdT + molality[i]*molality[j] * BprimeMX_L[counterIJ];
-            }
-            /*
-             * Both species have a non-zero charge, and they
-             * have the same sign, e.g., both positive or both negative.
-             */
-            if (charge(i)*charge(j) > 0) {
-                dFdT = dFdT + molality[i]*molality[j] * Phiprime[counterIJ];
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf(" dFdT = %10.6f \n", dFdT);
-            }
-        }
-    }
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 8: \n");
-    }
-
-    for (size_t i = 1; i < m_kk; i++) {
-        /*
-         * -------- SUBSECTION FOR CALCULATING THE dACTCOEFFdT FOR CATIONS -----
-         * --
-         */
-        if (charge(i) > 0) {
-            // species i is the cation (positive) to calc the actcoeff
-            double zsqdFdT = charge(i)*charge(i)*dFdT;
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                /*
-                 * Find the counterIJ for the symmetric binary interaction
-                 */
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
-
-                if (charge(j) < 0.0) {
-                    // sum over all anions
-                    sum1 = sum1 + molality[j]*
-                           (2.0*BMX_L[counterIJ] + molarcharge*CMX_L[counterIJ]);
-                    if (j < m_kk-1) {
-                        /*
-                         * This term is the ternary interaction involving the
-                         * non-duplicate sum over double anions, j, k, with
-                         * respect to the cation, i.
-                         */
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk_L[n];
-                            }
-                        }
-                    }
-                }
-
-
-                if (charge(j) > 0.0) {
-                    // sum over all cations
-                    if (j != i) {
-                        sum2 = sum2 + molality[j]*(2.0*Phi_L[counterIJ]);
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            // two inner sums over anions
-
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk_L[n];
-                            /*
-                             * Find the counterIJ for the j,k interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 + (fabs(charge(i))*
-                                           molality[j]*molality[k]*CMX_L[counterIJ2]);
-                        }
-                    }
-                }
-
-                /*
-                 * Handle neutral j species
-                 */
-                if (charge(j) == 0) {
-                    sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_L(j,i);
-                }
-                /*
-                 * Zeta interaction term
-                 */
-                for (size_t k = 1; k < m_kk; k++) {
-                    if (charge(k) < 0.0) {
-                        size_t izeta = j;
-                        size_t jzeta = i;
-                        n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                        double zeta_L = psi_ijk_L[n];
-                        if (zeta_L != 0.0) {
-                            sum5 = sum5 + molality[j]*molality[k]*zeta_L;
-                        }
-                    }
-                }
-            }
-            /*
-             * Add all of the contributions up to yield the log of the
-             * solute activity coefficients (molality scale)
-             */
-            m_dlnActCoeffMolaldT_Unscaled[i] =
-                zsqdFdT + sum1 + sum2 + sum3 + sum4 + sum5;
-            d_gamma_dT_Unscaled[i] = exp(m_dlnActCoeffMolaldT_Unscaled[i]);
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                printf(" %-16s lngamma[i]=%10.6f gamma[i]=%10.6f \n",
-                       sni.c_str(), m_dlnActCoeffMolaldT_Unscaled[i], d_gamma_dT_Unscaled[i]);
-                printf("                   %12g %12g %12g %12g %12g %12g\n",
-                       zsqdFdT, sum1, sum2, sum3, sum4, sum5);
-            }
-        }
-
-        /*
-         * ------ SUBSECTION FOR CALCULATING THE dACTCOEFFdT FOR ANIONS ------
-         *
-         */
-        if (charge(i) < 0) {
-            //          species i is an anion (negative)
-            double zsqdFdT = charge(i)*charge(i)*dFdT;
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                /*
-                 * Find the counterIJ for the symmetric binary interaction
-                 */
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
-
-                /*
-                 * For Anions, do the cation interactions.
-                 */
-                if (charge(j) > 0) {
-                    sum1 = sum1 + molality[j]*
-                           (2.0*BMX_L[counterIJ] + molarcharge*CMX_L[counterIJ]);
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk_L[n];
-                            }
-                        }
-                    }
-                }
-
-                /*
-                 * For Anions, do the other anion interactions.
-                 */
-                if (charge(j) < 0.0) {
-                    //  sum over all anions
-                    if (j != i) {
-                        sum2 = sum2 + molality[j]*(2.0*Phi_L[counterIJ]);
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk_L[n];
-                            /*
-                             * Find the counterIJ for the symmetric binary interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 +
-                                   (fabs(charge(i))*
-                                    molality[j]*molality[k]*CMX_L[counterIJ2]);
-                        }
-                    }
-                }
-
-                /*
-                 * for Anions, do the neutral species interaction
-                 */
-                if (charge(j) == 0.0) {
-                    sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_L(j,i);
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta_L = psi_ijk_L[n];
-                            if (zeta_L != 0.0) {
-                                sum5 = sum5 + molality[j]*molality[k]*zeta_L;
-                            }
-                        }
-                    }
-                }
-            }
-            m_dlnActCoeffMolaldT_Unscaled[i] =
-                zsqdFdT + sum1 + sum2 + sum3 + sum4 + sum5;
-            d_gamma_dT_Unscaled[i] = exp(m_dlnActCoeffMolaldT_Unscaled[i]);
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                printf(" %-16s lngamma[i]=%10.6f gamma[i]=%10.6f\n",
-                       sni.c_str(), m_dlnActCoeffMolaldT_Unscaled[i], d_gamma_dT_Unscaled[i]);
-                printf("                   %12g %12g %12g %12g %12g %12g\n",
-                       zsqdFdT, sum1, sum2, sum3, sum4, sum5);
-            }
-        }
-        /*
-         * ------ SUBSECTION FOR CALCULATING NEUTRAL SOLUTE ACT COEFF -------
-         * ------ -> equations agree with my notes,
-         *        -> Equations agree with Pitzer,
-         */
-        if (charge(i) == 0.0) {
-            double sum1 = 0.0;
-            double sum3 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                sum1 = sum1 + molality[j]*2.0*m_Lambda_nj_L(i,j);
-                /*
-                 * Zeta term -> we piggyback on the psi term
-                 */
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 = sum3 + molality[j]*molality[k]*psi_ijk_L[n];
-                        }
-                    }
-                }
-            }
-            double sum2 = 3.0 * molality[i] * molality[i] * m_Mu_nnn_L[i];
-            m_dlnActCoeffMolaldT_Unscaled[i] = sum1 + sum2 + sum3;
-            d_gamma_dT_Unscaled[i] = exp(m_dlnActCoeffMolaldT_Unscaled[i]);
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                printf(" %-16s lngamma[i]=%10.6f gamma[i]=%10.6f \n",
-                       sni.c_str(), m_dlnActCoeffMolaldT_Unscaled[i], d_gamma_dT_Unscaled[i]);
-            }
-        }
-
-    }
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 9: \n");
-    }
     /*
      * ------ SUBSECTION FOR CALCULATING THE d OSMOTIC COEFF dT ---------
      *
-     */
-    double sum1 = 0.0;
-    double sum2 = 0.0;
-    double sum3 = 0.0;
-    double sum4 = 0.0;
-    double sum5 = 0.0;
-    double sum6 = 0.0;
-    double sum7 = 0.0;
-    /*
      * term1 is the temperature derivative of the
      * DH term in the osmotic coefficient expression
      * b = 1.2 sqrt(kg/gmol) <- arbitrarily set in all Pitzer
@@ -3184,118 +2352,7 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
      * Aphi = A_Debye / 3   (units of sqrt(kg/gmol))
      */
     double term1 = -dAphidT * Is * sqrt(Is) / (1.0 + 1.2 * sqrt(Is));
-
-    for (size_t j = 1; j < m_kk; j++) {
-        /*
-         * Loop Over Cations
-         */
-        if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum1 = sum1 + molality[j]*molality[k]*
-                           (BphiMX_L[counterIJ] + molarcharge*CMX_L[counterIJ]);
-                }
-            }
-
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == (m_kk-1)) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT",
-                                       "logic error 1 in Step 9 of hmw_act");
-                }
-                if (charge(k) > 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between 2 cations.
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum2 = sum2 + molality[j]*molality[k]*Phiphi_L[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 = sum2 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk_L[n];
-                        }
-                    }
-                }
-            }
-        }
-
-        /*
-         * Loop Over Anions
-         */
-        if (charge(j) < 0) {
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == m_kk-1) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT",
-                                       "logic error 2 in Step 9 of hmw_act");
-                }
-                if (charge(k) < 0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between two anions
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum3 = sum3 + molality[j]*molality[k]*Phiphi_L[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 = sum3 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk_L[n];
-                        }
-                    }
-                }
-            }
-        }
-
-        /*
-         * Loop Over Neutral Species
-         */
-        if (charge(j) == 0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    sum4 = sum4 + molality[j]*molality[k]*m_Lambda_nj_L(j,k);
-                }
-                if (charge(k) > 0.0) {
-                    sum5 = sum5 + molality[j]*molality[k]*m_Lambda_nj_L(j,k);
-                }
-                if (charge(k) == 0.0) {
-                    if (k > j) {
-                        sum6 = sum6 + molality[j]*molality[k]*m_Lambda_nj_L(j,k);
-                    } else if (k == j) {
-                        sum6 = sum6 + 0.5 * molality[j]*molality[k]*m_Lambda_nj_L(j,k);
-                    }
-                }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta_L = psi_ijk_L[n];
-                            if (zeta_L != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta_L;
-                            }
-                        }
-                    }
-                }
-            }
-            sum7 += molality[j]*molality[j]*molality[j]*m_Mu_nnn_L[j];
-        }
-    }
-    double sum_m_phi_minus_1 = 2.0 *
-                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7);
+    double sum_m_phi_minus_1 = 2.0 * (term1 + sumInteractions);
     /*
      * Calculate the osmotic coefficient from
      *       osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
@@ -3308,9 +2365,7 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
     }
 
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" term1=%10.6f sum1=%10.6f sum2=%10.6f "
-               "sum3=%10.6f sum4=%10.6f sum5=%10.6f\n",
-               term1, sum1, sum2, sum3, sum4, sum5);
+        printf(" term1=%10.6f sum=%10.6f\n", term1, sumInteractions);
         printf("     sum_m_phi_minus_1=%10.6f        d_osmotic_coef_dT =%10.6f\n",
                sum_m_phi_minus_1, d_osmotic_coef_dT);
         printf(" Step 10: \n");
@@ -3327,9 +2382,7 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
      */
     m_dlnActCoeffMolaldT_Unscaled[0] = d_lnwateract_dT;
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        double d_wateract_dT = exp(d_lnwateract_dT);
-        printf(" d_ln_a_water_dT = %10.6f d_a_water_dT=%10.6f\n\n",
-               d_lnwateract_dT, d_wateract_dT);
+        printf(" d_lnwateract_dT = %10.6f\n\n", d_lnwateract_dT);
     }
 }
 
@@ -3369,7 +2422,15 @@ void HMWSoln::s_update_d2lnMolalityActCoeff_dT2() const
 void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
 {
     /*
-     * HKM -> Assumption is made that the solvent is species 0.
+     * It may be assumed that the Pitzer activity coefficient routine is
+     * called immediately preceding the calling of this routine. Therefore,
+     * the ionic strength, the molar charge, and the g(x) and h(x) functions
+     * of the cation-anion pairs do not need to be recalculated here.
+     */
+
+    /*
+     * HKM -> Assumption is made that the solvent is
+     *        species 0.
      */
 #ifdef DEBUG_MODE
     m_debugCalc = 0;
@@ -3380,1338 +2441,325 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
     }
 
     const double* molality  =  DATA_PTR(m_molalitiesCropped);
-    const double* beta0MX_LL=  DATA_PTR(m_Beta0MX_ij_LL);
-    const double* beta1MX_LL=  DATA_PTR(m_Beta1MX_ij_LL);
-    const double* beta2MX_LL=  DATA_PTR(m_Beta2MX_ij_LL);
-    const double* CphiMX_LL =  DATA_PTR(m_CphiMX_ij_LL);
-    const double* thetaij_LL=  DATA_PTR(m_Theta_ij_LL);
-    const double* alpha1MX  =  DATA_PTR(m_Alpha1MX_ij);
-    const double* alpha2MX  =  DATA_PTR(m_Alpha2MX_ij);
-    const double* psi_ijk_LL=  DATA_PTR(m_Psi_ijk_LL);
+    const double* beta0MX_LL =  DATA_PTR(m_Beta0MX_ij_LL);
+    const double* beta1MX_LL =  DATA_PTR(m_Beta1MX_ij_LL);
+    const double* beta2MX_LL =  DATA_PTR(m_Beta2MX_ij_LL);
+    const double* CphiMX_LL  =  DATA_PTR(m_CphiMX_ij_LL);
+    const double* thetaij_LL =  DATA_PTR(m_Theta_ij_LL);
+    const double* psi_ijk_LL =  DATA_PTR(m_Psi_ijk_LL);
+
+    const double* gfunc    =  DATA_PTR(m_gfunc_IJ);
+    const double* g2func   =  DATA_PTR(m_g2func_IJ);
+    const double* hfunc    =  DATA_PTR(m_hfunc_IJ);
+    const double* h2func   =  DATA_PTR(m_h2func_IJ);
+    double* BMX_LL    =  DATA_PTR(m_BMX_IJ_LL);
+    double* BprimeMX_LL= DATA_PTR(m_BprimeMX_IJ_LL);
+    double* BphiMX_LL =  DATA_PTR(m_BphiMX_IJ_LL);
+    double* Phi_LL    =  DATA_PTR(m_Phi_IJ_LL);
+    double* Phiphi_LL =  DATA_PTR(m_PhiPhi_IJ_LL);
+    double* CMX_LL    =  DATA_PTR(m_CMX_IJ_LL);
 
-    /*
-     * Local variables defined by Coltrin
-     */
-    double etheta[5][5], etheta_prime[5][5], sqrtIs;
     /*
      * Molality based ionic strength of the solution
      */
-    double Is = 0.0;
-    /*
-     * Molarcharge of the solution: In Pitzer's notation,
-     * this is his variable called "Z".
-     */
-    double molarcharge = 0.0;
+    double Is = m_IionicMolality;
+    double sqrtIs = sqrt(Is);
     /*
      * molalitysum is the sum of the molalities over all solutes,
      * even those with zero charge.
      */
-    double molalitysum = 0.0;
-
-    double* gfunc    =  DATA_PTR(m_gfunc_IJ);
-    double* g2func   =  DATA_PTR(m_g2func_IJ);
-    double* hfunc    =  DATA_PTR(m_hfunc_IJ);
-    double* h2func   =  DATA_PTR(m_h2func_IJ);
-    double* BMX_LL   =  DATA_PTR(m_BMX_IJ_LL);
-    double* BprimeMX_LL=DATA_PTR(m_BprimeMX_IJ_LL);
-    double* BphiMX_LL=  DATA_PTR(m_BphiMX_IJ_LL);
-    double* Phi_LL   =  DATA_PTR(m_Phi_IJ_LL);
-    double* Phiprime =  DATA_PTR(m_Phiprime_IJ);
-    double* Phiphi_LL=  DATA_PTR(m_PhiPhi_IJ_LL);
-    double* CMX_LL   =  DATA_PTR(m_CMX_IJ_LL);
+    double molalitysum = m_molalitySumCropped;
 
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
         printf("\n Debugging information from "
                "s_Pitzer_d2lnMolalityActCoeff_dT2()\n");
+        printf(" ionic strenth      = %14.7le \n total molar "
+               "charge = %14.7le \n", Is, m_molarCharge);
     }
+
     /*
-     * Make sure the counter variables are setup
+     * ----------- SUBSECTION FOR CALCULATION OF d2FdT2 ---------------------
+     *
+     * The binary terms are added in below. The E-theta terms are treated
+     * as independent of temperature, so there is no Phiprime contribution.
      */
-    counterIJ_setup();
-
+    double d2AphidT2 = d2A_DebyedT2_TP() / 3.0;
+    double d2FdT2 = -d2AphidT2 * (sqrt(Is) / (1.0 + 1.2*sqrt(Is))
+                       + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
 
     /*
-     * ---------- Calculate common sums over solutes ---------------------
+     * ------- SUBSECTION TO CALCULATE BMX_LL, BprimeMX_LL, BphiMX_LL, CMX_LL ----
+     * ------- These are now second temperature derivatives of the
+     *         previously calculated quantities.
      */
-    for (size_t n = 1; n < m_kk; n++) {
-        //      ionic strength
-        Is += charge(n) * charge(n) * molality[n];
-        //      total molar charge
-        molarcharge +=  fabs(charge(n)) * molality[n];
-        molalitysum += molality[n];
-    }
-    Is *= 0.5;
-
-    /*
-     * Store the ionic molality in the object for reference.
-     */
-    m_IionicMolality = Is;
-    sqrtIs = sqrt(Is);
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 1: \n");
-        printf(" ionic strenth      = %14.7le \n total molar "
-               "charge = %14.7le \n", Is, molarcharge);
-    }
-
-    /*
-     * The following call to calc_lambdas() calculates all 16 elements
-     * of the elambda and elambda1 arrays, given the value of the
-     * ionic strength (Is)
-     */
-    calc_lambdas(Is);
-
-    /*
-     * ----- Step 2:  Find the coefficients E-theta and -------------------
-     *                E-thetaprime for all combinations of positive
-     *                unlike charges up to 4
-     */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 2: \n");
-    }
-    for (int z1 = 1; z1 <=4; z1++) {
-        for (int z2 =1; z2 <=4; z2++) {
-            calc_thetas(z1, z2, &etheta[z1][z2], &etheta_prime[z1][z2]);
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf(" z1=%3d z2=%3d E-theta(I) = %f, E-thetaprime(I) = %f\n",
-                       z1, z2, etheta[z1][z2], etheta_prime[z1][z2]);
-            }
-        }
-    }
-
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 3: \n");
-        printf(" Species          Species            g(x) "
-               " hfunc(x)   \n");
-    }
-
-    /*
-     *
-     *  calculate gfunc(x) and hfunc(x) for each cation-anion pair MX
-     *   In the original literature, hfunc, was called gprime. However,
-     *   it's not the derivative of gfunc(x), so I renamed it.
-     */
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * Only loop over oppositely charge species
-             */
-            if (charge(i)*charge(j) < 0) {
-                /*
-                 * x is a reduced function variable
-                 */
-                double x1 = sqrtIs * alpha1MX[counterIJ];
-                if (x1 > 1.0E-100) {
-                    gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 *x1);
-                    hfunc[counterIJ] = -2.0*
-                                       (1.0-(1.0 + x1 + 0.5*x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    gfunc[counterIJ] = 0.0;
-                    hfunc[counterIJ] = 0.0;
-                }
-
-                if (beta2MX_LL[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * alpha2MX[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        h2func[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        g2func[counterIJ] = 0.0;
-                        h2func[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                gfunc[counterIJ] = 0.0;
-                hfunc[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
-                       gfunc[counterIJ], hfunc[counterIJ]);
-            }
-        }
-    }
-    /*
-     * ------- SUBSECTION TO CALCULATE BMX_L, BprimeMX_LL, BphiMX_L ----------
-     * ------- These are now temperature derivatives of the
-     *         previously calculated quantities.
-     */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 4: \n");
-        printf(" Species          Species            BMX    "
-               "BprimeMX    BphiMX   \n");
-    }
-
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                BMX_LL[counterIJ]  = beta0MX_LL[counterIJ]
-                                     + beta1MX_LL[counterIJ] * gfunc[counterIJ]
-                                     + beta2MX_LL[counterIJ] * g2func[counterIJ];
-                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                    printf("%d %g: %g %g %g %g\n",
-                           (int) counterIJ,  BMX_LL[counterIJ], beta0MX_LL[counterIJ],
-                           beta1MX_LL[counterIJ], beta2MX_LL[counterIJ], gfunc[counterIJ]);
-                }
-                if (Is > 1.0E-150) {
-                    BprimeMX_LL[counterIJ] = (beta1MX_LL[counterIJ] * hfunc[counterIJ]/Is +
-                                              beta2MX_LL[counterIJ] * h2func[counterIJ]/Is);
-                } else {
-                    BprimeMX_LL[counterIJ] = 0.0;
-                }
-                BphiMX_LL[counterIJ] = BMX_LL[counterIJ] + Is*BprimeMX_LL[counterIJ];
-            } else {
-                BMX_LL[counterIJ]      = 0.0;
-                BprimeMX_LL[counterIJ] = 0.0;
-                BphiMX_LL[counterIJ]     = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
-                       sni.c_str(), snj.c_str(),
-                       BMX_LL[counterIJ], BprimeMX_LL[counterIJ], BphiMX_LL[counterIJ]);
-            }
-        }
-    }
-
-    /*
-     * --------- SUBSECTION TO CALCULATE CMX_LL ----------
-     * ---------
-     */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 5: \n");
-        printf(" Species          Species            CMX \n");
-    }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                CMX_LL[counterIJ] = CphiMX_LL[counterIJ]/
-                                    (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                CMX_LL[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
-                       CMX_LL[counterIJ]);
-            }
-        }
-    }
-
-    /*
-     * ------- SUBSECTION TO CALCULATE Phi, PhiPrime, and PhiPhi ----------
-     * --------
-     */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 6: \n");
-        printf(" Species          Species            Phi_ij "
-               " Phiprime_ij  Phi^phi_ij \n");
-    }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) > 0) {
-                Phi_LL[counterIJ] = thetaij_LL[counterIJ];
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_LL[counterIJ] = Phi_LL[counterIJ];
-            } else {
-                Phi_LL[counterIJ]      = 0.0;
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_LL[counterIJ]   = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
-                       sni.c_str(), snj.c_str(),
-                       Phi_LL[counterIJ], Phiprime[counterIJ], Phiphi_LL[counterIJ]);
-            }
-        }
-    }
-
-    /*
-     * ----------- SUBSECTION FOR CALCULATION OF d2FdT2 ---------------------
-     */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 7: \n");
-    }
-    double d2AphidT2 = d2A_DebyedT2_TP() / 3.0;
-    double d2FdT2 = -d2AphidT2 * (sqrt(Is) / (1.0 + 1.2*sqrt(Is))
-                           + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" initial value of d2FdT2 = %10.6f \n", d2FdT2);
-    }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0) {
-                d2FdT2 = d2FdT2 + molality[i]*molality[j] * BprimeMX_LL[counterIJ];
-            }
-            /*
-             * Both species have a non-zero charge, and they
-             * have the same sign, e.g., both positive or both negative.
-             */
-            if (charge(i)*charge(j) > 0) {
-                d2FdT2 = d2FdT2 + molality[i]*molality[j] * Phiprime[counterIJ];
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf(" d2FdT2 = %10.6f \n", d2FdT2);
-            }
-        }
-    }
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 8: \n");
-    }
-
-    for (size_t i = 1; i < m_kk; i++) {
-
-        /*
-         * -------- SUBSECTION FOR CALCULATING THE dACTCOEFFdT FOR CATIONS -----
-         * --
-         */
-        if (charge(i) > 0) {
-            // species i is the cation (positive) to calc the actcoeff
-            double zsqd2FdT2 = charge(i)*charge(i)*d2FdT2;
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                /*
-                 * Find the counterIJ for the symmetric binary interaction
-                 */
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
-
-                if (charge(j) < 0.0) {
-                    // sum over all anions
-                    sum1 = sum1 + molality[j]*
-                           (2.0*BMX_LL[counterIJ] + molarcharge*CMX_LL[counterIJ]);
-                    if (j < m_kk-1) {
-                        /*
-                         * This term is the ternary interaction involving the
-                         * non-duplicate sum over double anions, j, k, with
-                         * respect to the cation, i.
-                         */
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk_LL[n];
-                            }
-                        }
-                    }
-                }
-
-
-                if (charge(j) > 0.0) {
-                    // sum over all cations
-                    if (j != i) {
-                        sum2 = sum2 + molality[j]*(2.0*Phi_LL[counterIJ]);
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            // two inner sums over anions
-
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk_LL[n];
-                            /*
-                             * Find the counterIJ for the j,k interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 + (fabs(charge(i))*
-                                           molality[j]*molality[k]*CMX_LL[counterIJ2]);
-                        }
-                    }
-                }
-
-                /*
-                 * Handle neutral j species
-                 */
-                if (charge(j) == 0) {
-                    sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_LL(j,i);
-                    /*
-                     * Zeta interaction term
-                     */
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                            double zeta_LL = psi_ijk_LL[n];
-                            if (zeta_LL != 0.0) {
-                                sum5 = sum5 + molality[j]*molality[k]*zeta_LL;
-                            }
-                        }
-                    }
-                }
-            }
-            /*
-             * Add all of the contributions up to yield the log of the
-             * solute activity coefficients (molality scale)
-             */
-            m_d2lnActCoeffMolaldT2_Unscaled[i] =
-                zsqd2FdT2 + sum1 + sum2 + sum3 + sum4 + sum5;
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                printf(" %-16s d2lngammadT2[i]=%10.6f \n",
-                       sni.c_str(), m_d2lnActCoeffMolaldT2_Unscaled[i]);
-                printf("                   %12g %12g %12g %12g %12g %12g\n",
-                       zsqd2FdT2, sum1, sum2, sum3, sum4, sum5);
-            }
-        }
-
-
-        /*
-         * ------ SUBSECTION FOR CALCULATING THE d2ACTCOEFFdT2 FOR ANIONS ------
-         *
-         */
-        if (charge(i) < 0) {
-            //          species i is an anion (negative)
-            double zsqd2FdT2 = charge(i)*charge(i)*d2FdT2;
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                /*
-                 * Find the counterIJ for the symmetric binary interaction
-                 */
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
-
-                /*
-                 * For Anions, do the cation interactions.
-                 */
-                if (charge(j) > 0) {
-                    sum1 = sum1 + molality[j]*
-                           (2.0*BMX_LL[counterIJ] + molarcharge*CMX_LL[counterIJ]);
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk_LL[n];
-                            }
-                        }
-                    }
-                }
-
-                /*
-                 * For Anions, do the other anion interactions.
-                 */
-                if (charge(j) < 0.0) {
-                    //  sum over all anions
-                    if (j != i) {
-                        sum2 = sum2 + molality[j]*(2.0*Phi_LL[counterIJ]);
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk_LL[n];
-                            /*
-                             * Find the counterIJ for the symmetric binary interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 +
-                                   (fabs(charge(i))*
-                                    molality[j]*molality[k]*CMX_LL[counterIJ2]);
-                        }
-                    }
-                }
-
-                /*
-                 * for Anions, do the neutral species interaction
-                 */
-                if (charge(j) == 0.0) {
-                    sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_LL(j,i);
-                    /*
-                     * Zeta interaction term
-                     */
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta_LL = psi_ijk_LL[n];
-                            if (zeta_LL != 0.0) {
-                                sum5 = sum5 + molality[j]*molality[k]*zeta_LL;
-                            }
-                        }
-                    }
-                }
-            }
-            m_d2lnActCoeffMolaldT2_Unscaled[i] =
-                zsqd2FdT2 + sum1 + sum2 + sum3 + sum4 + sum5;
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                printf(" %-16s d2lngammadT2[i]=%10.6f\n",
-                       sni.c_str(), m_d2lnActCoeffMolaldT2_Unscaled[i]);
-                printf("                   %12g %12g %12g %12g %12g %12g\n",
-                       zsqd2FdT2, sum1, sum2, sum3, sum4, sum5);
-            }
-        }
-        /*
-         * ------ SUBSECTION FOR CALCULATING NEUTRAL SOLUTE ACT COEFF -------
-         * ------ -> equations agree with my notes,
-         *        -> Equations agree with Pitzer,
-         */
-        if (charge(i) == 0.0) {
-            double sum1 = 0.0;
-            double sum3 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                sum1 = sum1 + molality[j]*2.0*m_Lambda_nj_LL(i,j);
-                /*
-                 * Zeta term -> we piggyback on the psi term
-                 */
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 = sum3 + molality[j]*molality[k]*psi_ijk_LL[n];
-                        }
-                    }
-                }
-            }
-            double sum2 = 3.0 * molality[i] * molality[i] * m_Mu_nnn_LL[i];
-            m_d2lnActCoeffMolaldT2_Unscaled[i] = sum1 + sum2 + sum3;
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                printf(" %-16s d2lngammadT2[i]=%10.6f \n",
-                       sni.c_str(), m_d2lnActCoeffMolaldT2_Unscaled[i]);
-            }
-        }
-
-    }
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 9: \n");
-    }
-
-    /*
-     * ------ SUBSECTION FOR CALCULATING THE d2 OSMOTIC COEFF dT2 ---------
-     */
-    double sum1 = 0.0;
-    double sum2 = 0.0;
-    double sum3 = 0.0;
-    double sum4 = 0.0;
-    double sum5 = 0.0;
-    double sum6 = 0.0;
-    double sum7 = 0.0;
-    /*
-     * term1 is the temperature derivative of the
-     * DH term in the osmotic coefficient expression
-     * b = 1.2 sqrt(kg/gmol) <- arbitrarily set in all Pitzer
-     *                          implementations.
-     * Is = Ionic strength on the molality scale (units of (gmol/kg))
-     * Aphi = A_Debye / 3   (units of sqrt(kg/gmol))
-     */
-    double term1 = -d2AphidT2 * Is * sqrt(Is) / (1.0 + 1.2 * sqrt(Is));
-
-    for (size_t j = 1; j < m_kk; j++) {
-        /*
-         * Loop Over Cations
-         */
-        if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum1 = sum1 + molality[j]*molality[k]*
-                           (BphiMX_LL[counterIJ] + molarcharge*CMX_LL[counterIJ]);
-                }
-            }
-
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == (m_kk-1)) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2",
-                                       "logic error 1 in Step 9 of hmw_act");
-                }
-                if (charge(k) > 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between 2 cations.
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum2 = sum2 + molality[j]*molality[k]*Phiphi_LL[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 = sum2 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk_LL[n];
-                        }
-                    }
-                }
-            }
-        }
-
-        /*
-         * Loop Over Anions
-         */
-        if (charge(j) < 0) {
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == m_kk-1) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2",
-                                       "logic error 2 in Step 9 of hmw_act");
-                }
-                if (charge(k) < 0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between two anions
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum3 = sum3 + molality[j]*molality[k]*Phiphi_LL[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 = sum3 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk_LL[n];
-                        }
-                    }
-                }
-            }
-        }
-
-        /*
-         * Loop Over Neutral Species
-         */
-        if (charge(j) == 0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    sum4 = sum4 + molality[j]*molality[k]*m_Lambda_nj_LL(j,k);
-                }
-                if (charge(k) > 0.0) {
-                    sum5 = sum5 + molality[j]*molality[k]*m_Lambda_nj_LL(j,k);
-                }
-                if (charge(k) == 0.0) {
-                    if (k > j) {
-                        sum6 = sum6 + molality[j]*molality[k]*m_Lambda_nj_LL(j,k);
-                    } else if (k == j) {
-                        sum6 = sum6 + 0.5 * molality[j]*molality[k]*m_Lambda_nj_LL(j,k);
-                    }
-                }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta_LL = psi_ijk_LL[n];
-                            if (zeta_LL != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta_LL;
-                            }
-                        }
-                    }
-                }
-            }
-
-            sum7 += molality[j] * molality[j] * molality[j] * m_Mu_nnn_LL[j];
-        }
-    }
-    double sum_m_phi_minus_1 = 2.0 *
-                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7);
-    /*
-     * Calculate the osmotic coefficient from
-     *       osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
-     */
-    double d2_osmotic_coef_dT2;
-    if (molalitysum > 1.0E-150) {
-        d2_osmotic_coef_dT2 = 0.0 + (sum_m_phi_minus_1 / molalitysum);
-    } else {
-        d2_osmotic_coef_dT2 = 0.0;
-    }
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" term1=%10.6f sum1=%10.6f sum2=%10.6f "
-               "sum3=%10.6f sum4=%10.6f sum5=%10.6f\n",
-               term1, sum1, sum2, sum3, sum4, sum5);
-        printf("     sum_m_phi_minus_1=%10.6f        d2_osmotic_coef_dT2=%10.6f\n",
-               sum_m_phi_minus_1, d2_osmotic_coef_dT2);
-        printf(" Step 10: \n");
-    }
-    double d2_lnwateract_dT2 = -(m_weightSolvent/1000.0) * molalitysum * d2_osmotic_coef_dT2;
-
-    /*
-     * In Cantera, we define the activity coefficient of the solvent as
-     *
-     *     act_0 = actcoeff_0 * Xmol_0
-     *
-     * We have just computed act_0. However, this routine returns
-     *  ln(actcoeff[]). Therefore, we must calculate ln(actcoeff_0).
-     */
-    m_d2lnActCoeffMolaldT2_Unscaled[0] = d2_lnwateract_dT2;
-
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        double d2_wateract_dT2 = exp(d2_lnwateract_dT2);
-        printf(" d2_ln_a_water_dT2 = %10.6f d2_a_water_dT2=%10.6f\n\n",
-               d2_lnwateract_dT2, d2_wateract_dT2);
-    }
-}
-
-void HMWSoln::s_update_dlnMolalityActCoeff_dP() const
-{
-    static const int cacheId = m_cache.getId();
-    CachedScalar cached = m_cache.getScalar(cacheId);
-    if( cached.validate(temperature(), pressure(), stateMFNumber()) ) {
-        return;
-    }
-
-    m_dlnActCoeffMolaldP_Unscaled.assign(m_kk, 0.0);
-    s_updatePitzer_dlnMolalityActCoeff_dP();
-
-    for (size_t k = 1; k < m_kk; k++) {
-        if (CROP_speciesCropped_[k] == 2) {
-            m_dlnActCoeffMolaldP_Unscaled[k] = 0.0;
-        }
-    }
-
-    if (CROP_speciesCropped_[0]) {
-        m_dlnActCoeffMolaldP_Unscaled[0] = 0.0;
-    }
-
-    s_updateScaling_pHScaling_dP();
-}
-
-void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
-{
-    /*
-     * HKM -> Assumption is made that the solvent is species 0.
-     */
-#ifdef DEBUG_MODE
-    m_debugCalc = 0;
-#endif
-    if (m_indexSolvent != 0) {
-        throw CanteraError("HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP",
-                           "Wrong index solvent value!");
-    }
-
-    const double* molality  =  DATA_PTR(m_molalitiesCropped);
-    const double* beta0MX_P =  DATA_PTR(m_Beta0MX_ij_P);
-    const double* beta1MX_P =  DATA_PTR(m_Beta1MX_ij_P);
-    const double* beta2MX_P =  DATA_PTR(m_Beta2MX_ij_P);
-    const double* CphiMX_P  =  DATA_PTR(m_CphiMX_ij_P);
-    const double* thetaij_P =  DATA_PTR(m_Theta_ij_P);
-    const double* alpha1MX  =  DATA_PTR(m_Alpha1MX_ij);
-    const double* alpha2MX  =  DATA_PTR(m_Alpha2MX_ij);
-    const double* psi_ijk_P =  DATA_PTR(m_Psi_ijk_P);
-
-    /*
-     * Local variables defined by Coltrin
-     */
-    double etheta[5][5], etheta_prime[5][5], sqrtIs;
-    /*
-     * Molality based ionic strength of the solution
-     */
-    double Is = 0.0;
-    /*
-     * Molarcharge of the solution: In Pitzer's notation,
-     * this is his variable called "Z".
-     */
-    double molarcharge = 0.0;
-    /*
-     * molalitysum is the sum of the molalities over all solutes,
-     * even those with zero charge.
-     */
-    double molalitysum = 0.0;
-
-    double* gfunc    =  DATA_PTR(m_gfunc_IJ);
-    double* g2func   =  DATA_PTR(m_g2func_IJ);
-    double* hfunc    =  DATA_PTR(m_hfunc_IJ);
-    double* h2func   =  DATA_PTR(m_h2func_IJ);
-    double* BMX_P    =  DATA_PTR(m_BMX_IJ_P);
-    double* BprimeMX_P= DATA_PTR(m_BprimeMX_IJ_P);
-    double* BphiMX_P =  DATA_PTR(m_BphiMX_IJ_P);
-    double* Phi_P    =  DATA_PTR(m_Phi_IJ_P);
-    double* Phiprime =  DATA_PTR(m_Phiprime_IJ);
-    double* Phiphi_P =  DATA_PTR(m_PhiPhi_IJ_P);
-    double* CMX_P    =  DATA_PTR(m_CMX_IJ_P);
-
-    double currTemp = temperature();
-    double currPres = pressure();
-
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf("\n Debugging information from "
-               "s_Pitzer_dlnMolalityActCoeff_dP()\n");
-    }
-    /*
-     * Make sure the counter variables are setup
-     */
-    counterIJ_setup();
-
-    /*
-     * ---------- Calculate common sums over solutes ---------------------
-     */
-    for (size_t n = 1; n < m_kk; n++) {
-        //      ionic strength
-        Is += charge(n) * charge(n) * molality[n];
-        //      total molar charge
-        molarcharge +=  fabs(charge(n)) * molality[n];
-        molalitysum += molality[n];
-    }
-    Is *= 0.5;
-
-    /*
-     * Store the ionic molality in the object for reference.
-     */
-    m_IionicMolality = Is;
-    sqrtIs = sqrt(Is);
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 1: \n");
-        printf(" ionic strenth      = %14.7le \n total molar "
-               "charge = %14.7le \n", Is, molarcharge);
-    }
-
-    /*
-     * The following call to calc_lambdas() calculates all 16 elements
-     * of the elambda and elambda1 arrays, given the value of the
-     * ionic strength (Is)
-     */
-    calc_lambdas(Is);
-
-
-    /*
-     * ----- Step 2:  Find the coefficients E-theta and -------------------
-     *                E-thetaprime for all combinations of positive
-     *                unlike charges up to 4
-     */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 2: \n");
-    }
-    for (int z1 = 1; z1 <=4; z1++) {
-        for (int z2 =1; z2 <=4; z2++) {
-            calc_thetas(z1, z2, &etheta[z1][z2], &etheta_prime[z1][z2]);
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf(" z1=%3d z2=%3d E-theta(I) = %f, E-thetaprime(I) = %f\n",
-                       z1, z2, etheta[z1][z2], etheta_prime[z1][z2]);
-            }
-        }
-    }
-
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 3: \n");
-        printf(" Species          Species            g(x) "
-               " hfunc(x)   \n");
-    }
-
-    /*
-     *
-     *  calculate g(x) and hfunc(x) for each cation-anion pair MX
-     *   In the original literature, hfunc, was called gprime. However,
-     *   it's not the derivative of g(x), so I renamed it.
-     */
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * Only loop over oppositely charge species
-             */
-            if (charge(i)*charge(j) < 0) {
-                /*
-                 * x is a reduced function variable
-                 */
-                double x1 = sqrtIs * alpha1MX[counterIJ];
-                if (x1 > 1.0E-100) {
-                    gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    hfunc[counterIJ] = -2.0*
-                                       (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    gfunc[counterIJ] = 0.0;
-                    hfunc[counterIJ] = 0.0;
-                }
-
-                if (beta2MX_P[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * alpha2MX[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        h2func[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        g2func[counterIJ] = 0.0;
-                        h2func[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                gfunc[counterIJ] = 0.0;
-                hfunc[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
-                       gfunc[counterIJ], hfunc[counterIJ]);
-            }
-        }
-    }
-
-    /*
-     * ------- SUBSECTION TO CALCULATE BMX_P, BprimeMX_P, BphiMX_P ----------
-     * ------- These are now temperature derivatives of the
-     *         previously calculated quantities.
-     */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 4: \n");
-        printf(" Species          Species            BMX    "
-               "BprimeMX    BphiMX   \n");
-    }
-
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                BMX_P[counterIJ]  = beta0MX_P[counterIJ]
-                                    + beta1MX_P[counterIJ] * gfunc[counterIJ]
-                                    + beta2MX_P[counterIJ] * g2func[counterIJ];
-                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                    printf("%d %g: %g %g %g %g\n",
-                           (int) counterIJ,  BMX_P[counterIJ], beta0MX_P[counterIJ],
-                           beta1MX_P[counterIJ], beta2MX_P[counterIJ], gfunc[counterIJ]);
-                }
-                if (Is > 1.0E-150) {
-                    BprimeMX_P[counterIJ] = (beta1MX_P[counterIJ] * hfunc[counterIJ]/Is +
-                                             beta2MX_P[counterIJ] * h2func[counterIJ]/Is);
-                } else {
-                    BprimeMX_P[counterIJ] = 0.0;
-                }
-                BphiMX_P[counterIJ] = BMX_P[counterIJ] + Is*BprimeMX_P[counterIJ];
-            } else {
-                BMX_P[counterIJ]      = 0.0;
-                BprimeMX_P[counterIJ] = 0.0;
-                BphiMX_P[counterIJ]     = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
-                       sni.c_str(), snj.c_str(),
-                       BMX_P[counterIJ], BprimeMX_P[counterIJ], BphiMX_P[counterIJ]);
-            }
-        }
-    }
-
-    /*
-     * --------- SUBSECTION TO CALCULATE CMX_P ----------
-     */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 5: \n");
-        printf(" Species          Species            CMX \n");
-    }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                CMX_P[counterIJ] = CphiMX_P[counterIJ]/
-                                   (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                CMX_P[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
-                       CMX_P[counterIJ]);
-            }
-        }
-    }
-
-    /*
-     * ------- SUBSECTION TO CALCULATE Phi, PhiPrime, and PhiPhi ----------
-     * --------
-     */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 6: \n");
-        printf(" Species          Species            Phi_ij "
-               " Phiprime_ij  Phi^phi_ij \n");
-    }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) > 0) {
-                Phi_P[counterIJ] = thetaij_P[counterIJ];
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_P[counterIJ] = Phi_P[counterIJ] + Is * Phiprime[counterIJ];
-            } else {
-                Phi_P[counterIJ]      = 0.0;
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_P[counterIJ]   = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
-                       sni.c_str(), snj.c_str(),
-                       Phi_P[counterIJ], Phiprime[counterIJ], Phiphi_P[counterIJ]);
-            }
+    if (DEBUG_MODE_ENABLED && m_debugCalc) {
+        printf(" Steps 4, 5: \n");
+        printf(" Species          Species            BMX    "
+               "BprimeMX    BphiMX    CMX \n");
+    }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        const PitzerPair& pair = m_CationAnionPairs[p];
+        size_t counterIJ = pair.counterIJ;
+        BMX_LL[counterIJ]  = beta0MX_LL[counterIJ]
+                           + beta1MX_LL[counterIJ] * gfunc[counterIJ]
+                           + beta2MX_LL[counterIJ] * g2func[counterIJ];
+        if (Is > 1.0E-150) {
+            BprimeMX_LL[counterIJ] = (beta1MX_LL[counterIJ] * hfunc[counterIJ]/Is +
+                                      beta2MX_LL[counterIJ] * h2func[counterIJ]/Is);
+        } else {
+            BprimeMX_LL[counterIJ] = 0.0;
+        }
+        BphiMX_LL[counterIJ] = BMX_LL[counterIJ] + Is*BprimeMX_LL[counterIJ];
+        CMX_LL[counterIJ] = CphiMX_LL[counterIJ]/
+                            (2.0* sqrt(fabs(charge(pair.i)*charge(pair.j))));
+        d2FdT2 += molality[pair.i]*molality[pair.j] * BprimeMX_LL[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(pair.i);
+            std::string snj = speciesName(pair.j);
+            printf(" %-16s %-16s %11.7f %11.7f %11.7f %11.7f \n",
+                   sni.c_str(), snj.c_str(),
+                   BMX_LL[counterIJ], BprimeMX_LL[counterIJ], BphiMX_LL[counterIJ],
+                   CMX_LL[counterIJ]);
         }
     }
 
     /*
-     * ----------- SUBSECTION FOR CALCULATION OF dFdT ---------------------
+     * ------- SUBSECTION TO CALCULATE Phi_LL and PhiPhi_LL ----------
      */
-    if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 7: \n");
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t counterIJ = m_LikeChargePairs[p].counterIJ;
+        Phi_LL[counterIJ] = thetaij_LL[counterIJ];
+        Phiphi_LL[counterIJ] = Phi_LL[counterIJ];
     }
-    double dA_DebyedP = dA_DebyedP_TP(currTemp, currPres);
-    double dAphidP = dA_DebyedP /3.0;
-    double dFdP = -dAphidP * (sqrt(Is) / (1.0 + 1.2*sqrt(Is))
-                       + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" initial value of dFdP = %10.6f \n", dFdP);
+        printf(" Step 7: d2FdT2 = %10.6f \n", d2FdT2);
+        printf(" Step 8: \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0) {
-                dFdP = dFdP + molality[i]*molality[j] * BprimeMX_P[counterIJ];
-            }
-            /*
-             * Both species have a non-zero charge, and they
-             * have the same sign, e.g., both positive or both negative.
-             */
-            if (charge(i)*charge(j) > 0) {
-                dFdP = dFdP + molality[i]*molality[j] * Phiprime[counterIJ];
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf(" dFdP = %10.6f \n", dFdP);
-            }
+
+    /*
+     * -------- SUBSECTION FOR CALCULATING THE d2ACTCOEFFdT2 FOR THE SOLUTES -----
+     */
+    double sumInteractions =
+        s_updatePitzer_interactionSums(d2FdT2, BMX_LL, CMX_LL, BphiMX_LL, Phi_LL,
+                                       Phiphi_LL, psi_ijk_LL, m_Lambda_nj_LL,
+                                       m_Mu_nnn_LL,
+                                       DATA_PTR(m_d2lnActCoeffMolaldT2_Unscaled));
+    if (DEBUG_MODE_ENABLED && m_debugCalc) {
+        for (size_t i = 1; i < m_kk; i++) {
+            std::string sni = speciesName(i);
+            printf(" %-16s d2lngammadT2[i]=%10.6f \n",
+                   sni.c_str(), m_d2lnActCoeffMolaldT2_Unscaled[i]);
         }
+        printf(" Step 9: \n");
+    }
+
+    /*
+     * ------ SUBSECTION FOR CALCULATING THE d2 OSMOTIC COEFF dT2 ---------
+     *
+     * term1 is the second temperature derivative of the
+     * DH term in the osmotic coefficient expression
+     * b = 1.2 sqrt(kg/gmol) <- arbitrarily set in all Pitzer
+     *                          implementations.
+     * Is = Ionic strength on the molality scale (units of (gmol/kg))
+     * Aphi = A_Debye / 3   (units of sqrt(kg/gmol))
+     */
+    double term1 = -d2AphidT2 * Is * sqrt(Is) / (1.0 + 1.2 * sqrt(Is));
+    double sum_m_phi_minus_1 = 2.0 * (term1 + sumInteractions);
+    /*
+     * Calculate the osmotic coefficient from
+     *       osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
+     */
+    double d2_osmotic_coef_dT2;
+    if (molalitysum > 1.0E-150) {
+        d2_osmotic_coef_dT2 = 0.0 + (sum_m_phi_minus_1 / molalitysum);
+    } else {
+        d2_osmotic_coef_dT2 = 0.0;
     }
+
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 8: \n");
+        printf(" term1=%10.6f sum=%10.6f\n", term1, sumInteractions);
+        printf("     sum_m_phi_minus_1=%10.6f        d2_osmotic_coef_dT2 =%10.6f\n",
+               sum_m_phi_minus_1, d2_osmotic_coef_dT2);
+        printf(" Step 10: \n");
     }
+    double d2_lnwateract_dT2 = -(m_weightSolvent/1000.0) * molalitysum * d2_osmotic_coef_dT2;
 
-    for (size_t i = 1; i < m_kk; i++) {
+    /*
+     * In Cantera, we define the activity coefficient of the solvent as
+     *
+     *     act_0 = actcoeff_0 * Xmol_0
+     *
+     * We have just computed act_0. However, this routine returns
+     *  ln(actcoeff[]). Therefore, we must calculate ln(actcoeff_0).
+     */
+    m_d2lnActCoeffMolaldT2_Unscaled[0] = d2_lnwateract_dT2;
+    if (DEBUG_MODE_ENABLED && m_debugCalc) {
+        printf(" d2_lnwateract_dT2 = %10.6f\n\n", d2_lnwateract_dT2);
+    }
+}
 
-        /*
-         * -------- SUBSECTION FOR CALCULATING THE dACTCOEFFdP FOR CATIONS -----
-         */
-        if (charge(i) > 0) {
-            // species i is the cation (positive) to calc the actcoeff
-            double zsqdFdP = charge(i)*charge(i)*dFdP;
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                /*
-                 * Find the counterIJ for the symmetric binary interaction
-                 */
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
-
-                if (charge(j) < 0.0) {
-                    // sum over all anions
-                    sum1 = sum1 + molality[j]*
-                           (2.0*BMX_P[counterIJ] + molarcharge*CMX_P[counterIJ]);
-                    if (j < m_kk-1) {
-                        /*
-                         * This term is the ternary interaction involving the
-                         * non-duplicate sum over double anions, j, k, with
-                         * respect to the cation, i.
-                         */
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk_P[n];
-                            }
-                        }
-                    }
-                }
+void HMWSoln::s_update_dlnMolalityActCoeff_dP() const
+{
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if( cached.validate(temperature(), pressure(), stateMFNumber()) ) {
+        return;
+    }
 
+    m_dlnActCoeffMolaldP_Unscaled.assign(m_kk, 0.0);
+    s_updatePitzer_dlnMolalityActCoeff_dP();
 
-                if (charge(j) > 0.0) {
-                    // sum over all cations
-                    if (j != i) {
-                        sum2 = sum2 + molality[j]*(2.0*Phi_P[counterIJ]);
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            // two inner sums over anions
-
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk_P[n];
-                            /*
-                             * Find the counterIJ for the j,k interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 + (fabs(charge(i))*
-                                           molality[j]*molality[k]*CMX_P[counterIJ2]);
-                        }
-                    }
-                }
+    for (size_t k = 1; k < m_kk; k++) {
+        if (CROP_speciesCropped_[k] == 2) {
+            m_dlnActCoeffMolaldP_Unscaled[k] = 0.0;
+        }
+    }
 
-                /*
-                 * for Anions, do the neutral species interaction
-                 */
-                if (charge(j) == 0) {
-                    sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_P(j,i);
-                    /*
-                     * Zeta interaction term
-                     */
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                            double zeta_P = psi_ijk_P[n];
-                            if (zeta_P != 0.0) {
-                                sum5 = sum5 + molality[j]*molality[k]*zeta_P;
-                            }
-                        }
-                    }
-                }
-            }
+    if (CROP_speciesCropped_[0]) {
+        m_dlnActCoeffMolaldP_Unscaled[0] = 0.0;
+    }
 
-            /*
-             * Add all of the contributions up to yield the log of the
-             * solute activity coefficients (molality scale)
-             */
-            m_dlnActCoeffMolaldP_Unscaled[i] =
-                zsqdFdP + sum1 + sum2 + sum3 + sum4 + sum5;
+    s_updateScaling_pHScaling_dP();
+}
 
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                printf(" %-16s lngamma[i]=%10.6f \n",
-                       sni.c_str(), m_dlnActCoeffMolaldP_Unscaled[i]);
-                printf("                   %12g %12g %12g %12g %12g %12g\n",
-                       zsqdFdP, sum1, sum2, sum3, sum4, sum5);
-            }
-        }
+void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
+{
+    /*
+     * It may be assumed that the Pitzer activity coefficient routine is
+     * called immediately preceding the calling of this routine. Therefore,
+     * the ionic strength, the molar charge, and the g(x) and h(x) functions
+     * of the cation-anion pairs do not need to be recalculated here.
+     */
 
+    /*
+     * HKM -> Assumption is made that the solvent is
+     *        species 0.
+     */
+#ifdef DEBUG_MODE
+    m_debugCalc = 0;
+#endif
+    if (m_indexSolvent != 0) {
+        throw CanteraError("HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP",
+                           "Wrong index solvent value!");
+    }
 
-        /*
-         * ------ SUBSECTION FOR CALCULATING THE dACTCOEFFdP FOR ANIONS ------
-         */
-        if (charge(i) < 0) {
-            //          species i is an anion (negative)
-            double zsqdFdP = charge(i)*charge(i)*dFdP;
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
-            double sum5 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                /*
-                 * Find the counterIJ for the symmetric binary interaction
-                 */
-                size_t n = m_kk*i + j;
-                size_t counterIJ = m_CounterIJ[n];
+    const double* molality  =  DATA_PTR(m_molalitiesCropped);
+    const double* beta0MX_P =  DATA_PTR(m_Beta0MX_ij_P);
+    const double* beta1MX_P =  DATA_PTR(m_Beta1MX_ij_P);
+    const double* beta2MX_P =  DATA_PTR(m_Beta2MX_ij_P);
+    const double* CphiMX_P  =  DATA_PTR(m_CphiMX_ij_P);
+    const double* thetaij_P =  DATA_PTR(m_Theta_ij_P);
+    const double* psi_ijk_P =  DATA_PTR(m_Psi_ijk_P);
 
-                /*
-                 * For Anions, do the cation interactions.
-                 */
-                if (charge(j) > 0) {
-                    sum1 = sum1 + molality[j]*
-                           (2.0*BMX_P[counterIJ] + molarcharge*CMX_P[counterIJ]);
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk_P[n];
-                            }
-                        }
-                    }
-                }
+    const double* gfunc    =  DATA_PTR(m_gfunc_IJ);
+    const double* g2func   =  DATA_PTR(m_g2func_IJ);
+    const double* hfunc    =  DATA_PTR(m_hfunc_IJ);
+    const double* h2func   =  DATA_PTR(m_h2func_IJ);
+    double* BMX_P    =  DATA_PTR(m_BMX_IJ_P);
+    double* BprimeMX_P= DATA_PTR(m_BprimeMX_IJ_P);
+    double* BphiMX_P =  DATA_PTR(m_BphiMX_IJ_P);
+    double* Phi_P    =  DATA_PTR(m_Phi_IJ_P);
+    double* Phiphi_P =  DATA_PTR(m_PhiPhi_IJ_P);
+    double* CMX_P    =  DATA_PTR(m_CMX_IJ_P);
 
-                /*
-                 * For Anions, do the other anion interactions.
-                 */
-                if (charge(j) < 0.0) {
-                    //  sum over all anions
-                    if (j != i) {
-                        sum2 = sum2 + molality[j]*(2.0*Phi_P[counterIJ]);
-                    }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk_P[n];
-                            /*
-                             * Find the counterIJ for the symmetric binary interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 +
-                                   (fabs(charge(i))*
-                                    molality[j]*molality[k]*CMX_P[counterIJ2]);
-                        }
-                    }
-                }
+    /*
+     * Molality based ionic strength of the solution
+     */
+    double Is = m_IionicMolality;
+    double sqrtIs = sqrt(Is);
+    /*
+     * molalitysum is the sum of the molalities over all solutes,
+     * even those with zero charge.
+     */
+    double molalitysum = m_molalitySumCropped;
 
-                /*
-                 * for Anions, do the neutral species interaction
-                 */
-                if (charge(j) == 0.0) {
-                    sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_P(j,i);
-                    /*
-                     * Zeta interaction term
-                     */
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta_P = psi_ijk_P[n];
-                            if (zeta_P != 0.0) {
-                                sum5 = sum5 + molality[j]*molality[k]*zeta_P;
-                            }
-                        }
-                    }
-                }
-            }
-            m_dlnActCoeffMolaldP_Unscaled[i] =
-                zsqdFdP + sum1 + sum2 + sum3 + sum4 + sum5;
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                printf(" %-16s lndactcoeffmolaldP[i]=%10.6f \n",
-                       sni.c_str(), m_dlnActCoeffMolaldP_Unscaled[i]);
-                printf("                   %12g %12g %12g %12g %12g %12g\n",
-                       zsqdFdP, sum1, sum2, sum3, sum4, sum5);
-            }
-        }
+    if (DEBUG_MODE_ENABLED && m_debugCalc) {
+        printf("\n Debugging information from "
+               "s_Pitzer_dlnMolalityActCoeff_dP()\n");
+        printf(" ionic strenth      = %14.7le \n total molar "
+               "charge = %14.7le \n", Is, m_molarCharge);
+    }
 
-        /*
-         * ------ SUBSECTION FOR CALCULATING d NEUTRAL SOLUTE ACT COEFF dP -------
-         */
-        if (charge(i) == 0.0) {
-            double sum1 = 0.0;
-            double sum3 = 0.0;
-            for (size_t j = 1; j < m_kk; j++) {
-                sum1 +=  molality[j]*2.0*m_Lambda_nj_P(i,j);
-                /*
-                 * Zeta term -> we piggyback on the psi term
-                 */
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 = sum3 + molality[j]*molality[k]*psi_ijk_P[n];
-                        }
-                    }
-                }
-            }
-            double sum2 = 3.0 * molality[i] * molality[i] * m_Mu_nnn_P[i];
-            m_dlnActCoeffMolaldP_Unscaled[i] = sum1 + sum2 + sum3;
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                printf(" %-16s dlnActCoeffMolaldP[i]=%10.6f \n",
-                       sni.c_str(), m_dlnActCoeffMolaldP_Unscaled[i]);
-            }
+    /*
+     * ----------- SUBSECTION FOR CALCULATION OF dFdP ---------------------
+     *
+     * The binary terms are added in below. The E-theta terms are treated
+     * as independent of pressure, so there is no Phiprime contribution.
+     */
+    double dAphidP = dA_DebyedP_TP() / 3.0;
+    double dFdP = -dAphidP * (sqrt(Is) / (1.0 + 1.2*sqrt(Is))
+                       + (2.0/1.2) * log(1.0+1.2*(sqrtIs)));
+
+    /*
+     * ------- SUBSECTION TO CALCULATE BMX_P, BprimeMX_P, BphiMX_P, CMX_P ----
+     * ------- These are now pressure derivatives of the
+     *         previously calculated quantities.
+     */
+    if (DEBUG_MODE_ENABLED && m_debugCalc) {
+        printf(" Steps 4, 5: \n");
+        printf(" Species          Species            BMX    "
+               "BprimeMX    BphiMX    CMX \n");
+    }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        const PitzerPair& pair = m_CationAnionPairs[p];
+        size_t counterIJ = pair.counterIJ;
+        BMX_P[counterIJ]  = beta0MX_P[counterIJ]
+                          + beta1MX_P[counterIJ] * gfunc[counterIJ]
+                          + beta2MX_P[counterIJ] * g2func[counterIJ];
+        if (Is > 1.0E-150) {
+            BprimeMX_P[counterIJ] = (beta1MX_P[counterIJ] * hfunc[counterIJ]/Is +
+                                     beta2MX_P[counterIJ] * h2func[counterIJ]/Is);
+        } else {
+            BprimeMX_P[counterIJ] = 0.0;
+        }
+        BphiMX_P[counterIJ] = BMX_P[counterIJ] + Is*BprimeMX_P[counterIJ];
+        CMX_P[counterIJ] = CphiMX_P[counterIJ]/
+                           (2.0* sqrt(fabs(charge(pair.i)*charge(pair.j))));
+        dFdP += molality[pair.i]*molality[pair.j] * BprimeMX_P[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(pair.i);
+            std::string snj = speciesName(pair.j);
+            printf(" %-16s %-16s %11.7f %11.7f %11.7f %11.7f \n",
+                   sni.c_str(), snj.c_str(),
+                   BMX_P[counterIJ], BprimeMX_P[counterIJ], BphiMX_P[counterIJ],
+                   CMX_P[counterIJ]);
         }
+    }
 
+    /*
+     * ------- SUBSECTION TO CALCULATE Phi_P and PhiPhi_P ----------
+     */
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t counterIJ = m_LikeChargePairs[p].counterIJ;
+        Phi_P[counterIJ] = thetaij_P[counterIJ];
+        Phiphi_P[counterIJ] = Phi_P[counterIJ];
     }
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" Step 9: \n");
+        printf(" Step 7: dFdP = %10.6f \n", dFdP);
+        printf(" Step 8: \n");
     }
 
     /*
-     * ------ SUBSECTION FOR CALCULATING THE d OSMOTIC COEFF dP ---------
+     * -------- SUBSECTION FOR CALCULATING THE dACTCOEFFdP FOR THE SOLUTES -----
      */
-    double sum1 = 0.0;
-    double sum2 = 0.0;
-    double sum3 = 0.0;
-    double sum4 = 0.0;
-    double sum5 = 0.0;
-    double sum6 = 0.0;
-    double sum7 = 0.0;
+    double sumInteractions =
+        s_updatePitzer_interactionSums(dFdP, BMX_P, CMX_P, BphiMX_P, Phi_P,
+                                       Phiphi_P, psi_ijk_P, m_Lambda_nj_P,
+                                       m_Mu_nnn_P,
+                                       DATA_PTR(m_dlnActCoeffMolaldP_Unscaled));
+    if (DEBUG_MODE_ENABLED && m_debugCalc) {
+        for (size_t i = 1; i < m_kk; i++) {
+            std::string sni = speciesName(i);
+            printf(" %-16s dlngammadP[i]=%10.6f \n",
+                   sni.c_str(), m_dlnActCoeffMolaldP_Unscaled[i]);
+        }
+        printf(" Step 9: \n");
+    }
+
     /*
-     * term1 is the temperature derivative of the
+     * ------ SUBSECTION FOR CALCULATING THE d OSMOTIC COEFF dP ---------
+     *
+     * term1 is the pressure derivative of the
      * DH term in the osmotic coefficient expression
      * b = 1.2 sqrt(kg/gmol) <- arbitrarily set in all Pitzer
      *                          implementations.
@@ -4719,121 +2767,7 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
      * Aphi = A_Debye / 3   (units of sqrt(kg/gmol))
      */
     double term1 = -dAphidP * Is * sqrt(Is) / (1.0 + 1.2 * sqrt(Is));
-
-    for (size_t j = 1; j < m_kk; j++) {
-        /*
-         * Loop Over Cations
-         */
-        if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum1 = sum1 + molality[j]*molality[k]*
-                           (BphiMX_P[counterIJ] + molarcharge*CMX_P[counterIJ]);
-                }
-            }
-
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == (m_kk-1)) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP",
-                                       "logic error 1 in Step 9 of hmw_act");
-                }
-                if (charge(k) > 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between 2 cations.
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum2 = sum2 + molality[j]*molality[k]*Phiphi_P[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 = sum2 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk_P[n];
-                        }
-                    }
-                }
-            }
-        }
-
-
-        /*
-         * Loop Over Anions
-         */
-        if (charge(j) < 0) {
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == m_kk-1) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP",
-                                       "logic error 2 in Step 9 of hmw_act");
-                }
-                if (charge(k) < 0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between two anions
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum3 = sum3 + molality[j]*molality[k]*Phiphi_P[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 = sum3 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk_P[n];
-                        }
-                    }
-                }
-            }
-        }
-
-        /*
-         * Loop Over Neutral Species
-         */
-        if (charge(j) == 0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    sum4 = sum4 + molality[j]*molality[k]*m_Lambda_nj_P(j,k);
-                }
-                if (charge(k) > 0.0) {
-                    sum5 = sum5 + molality[j]*molality[k]*m_Lambda_nj_P(j,k);
-                }
-                if (charge(k) == 0.0) {
-                    if (k > j) {
-                        sum6 = sum6 + molality[j]*molality[k]*m_Lambda_nj_P(j,k);
-                    } else if (k == j) {
-                        sum6 = sum6 + 0.5 * molality[j]*molality[k]*m_Lambda_nj_P(j,k);
-                    }
-                }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta_P = psi_ijk_P[n];
-                            if (zeta_P != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta_P;
-                            }
-                        }
-                    }
-                }
-            }
-
-            sum7 += molality[j] * molality[j] * molality[j] * m_Mu_nnn_P[j];
-        }
-    }
-    double sum_m_phi_minus_1 = 2.0 *
-                        (term1 + sum1 + sum2 + sum3 + sum4 + sum5 + sum6 + sum7);
-
+    double sum_m_phi_minus_1 = 2.0 * (term1 + sumInteractions);
     /*
      * Calculate the osmotic coefficient from
      *       osmotic_coeff = 1 + dGex/d(M0noRT) / sum(molality_i)
@@ -4844,17 +2778,15 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
     } else {
         d_osmotic_coef_dP = 0.0;
     }
+
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        printf(" term1=%10.6f sum1=%10.6f sum2=%10.6f "
-               "sum3=%10.6f sum4=%10.6f sum5=%10.6f\n",
-               term1, sum1, sum2, sum3, sum4, sum5);
+        printf(" term1=%10.6f sum=%10.6f\n", term1, sumInteractions);
         printf("     sum_m_phi_minus_1=%10.6f        d_osmotic_coef_dP =%10.6f\n",
                sum_m_phi_minus_1, d_osmotic_coef_dP);
         printf(" Step 10: \n");
     }
     double d_lnwateract_dP = -(m_weightSolvent/1000.0) * molalitysum * d_osmotic_coef_dP;
 
-
     /*
      * In Cantera, we define the activity coefficient of the solvent as
      *
@@ -4865,9 +2797,7 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
      */
     m_dlnActCoeffMolaldP_Unscaled[0] = d_lnwateract_dP;
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
-        double d_wateract_dP = exp(d_lnwateract_dP);
-        printf(" d_ln_a_water_dP = %10.6f d_a_water_dP=%10.6f\n\n",
-               d_lnwateract_dP, d_wateract_dP);
+        printf(" d_lnwateract_dP = %10.6f\n\n", d_lnwateract_dP);
     }
 }
 
@@ -1574,6 +1574,12 @@ void HMWSoln::initThermoXML(XML_Node& phaseNode, const std::string& id_)
     calcMCCutoffParams_();
     setMoleFSolventMin(1.0E-5);
 
+    // Only the interactions with nonzero parameters are evaluated
+    interactionLists_setup();
+
+    // Values cached while the parameters were being read are out of date
+    m_cache.clear();
+
     MolalityVPSSTP::initThermoXML(phaseNode, id_);
     /*
      * Lastly calculate the charge balance and then add stuff until the charges compensate
@@ -7,6 +7,9 @@
 
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/base/vec_functions.h"
+#include "cantera/base/stringUtils.h"
+
+#include <limits>
 
 using namespace std;
 
@@ -82,6 +85,63 @@ doublereal IdealGasPhase::cv_mole() const
     return cp_mole() - GasConstant;
 }
 
+void IdealGasPhase::getPropertiesBatch(size_t nStates, const doublereal* T,
+                                       const doublereal* P, const doublereal* Y,
+                                       doublereal* rho, doublereal* mmw,
+                                       doublereal* cp, doublereal* h,
+                                       doublereal* s, doublereal* h_RT)
+{
+    const vector_fp& mw = molecularWeights();
+    doublereal pref = m_spthermo->refPressure();
+    vector_fp cp_R(m_kk), hrt(m_kk), s_R(m_kk), ym(m_kk);
+    doublereal Tlast = -1.0;
+    for (size_t j = 0; j < nStates; j++) {
+        // Normalize the mass fractions in the same way as
+        // Phase::setMassFractions, and compute Y_k / W_k
+        doublereal norm = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            norm += std::max(Y[k*nStates + j], 0.0);
+        }
+        doublereal sum = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            ym[k] = std::max(Y[k*nStates + j], 0.0) / norm / mw[k];
+            sum += ym[k];
+        }
+        doublereal W = 1.0 / sum;
+        if (rho) {
+            rho[j] = P[j] * W / (GasConstant * T[j]);
+        }
+        if (mmw) {
+            mmw[j] = W;
+        }
+        if (!cp && !h && !s && !h_RT) {
+            continue;
+        }
+
+        if (T[j] != Tlast) {
+            m_spthermo->update(T[j], &cp_R[0], &hrt[0], &s_R[0]);
+            Tlast = T[j];
+        }
+        if (cp) {
+            cp[j] = GasConstant * dot(ym.begin(), ym.end(), cp_R.begin());
+        }
+        if (h) {
+            h[j] = GasConstant * T[j] * dot(ym.begin(), ym.end(), hrt.begin());
+        }
+        if (s) {
+            doublereal xlogx = W * Cantera::sum_xlogx(ym.begin(), ym.end())
+                               + log(W);
+            s[j] = GasConstant / W * (W * dot(ym.begin(), ym.end(), s_R.begin())
+                                      - xlogx - log(P[j] / pref));
+        }
+        if (h_RT) {
+            for (size_t k = 0; k < m_kk; k++) {
+                h_RT[k*nStates + j] = hrt[k];
+            }
+        }
+    }
+}
+
 doublereal IdealGasPhase::cv_tr(doublereal atomicity) const
 {
     warn_deprecated("IdealGasPhase::cv_tr", "To be removed after Cantera 2.2.");
@@ -367,6 +427,149 @@ void IdealGasPhase::setToEquilState(const doublereal* mu_RT)
     setState_PX(pres, &m_pp[0]);
 }
 
+void IdealGasPhase::setState_HP(doublereal h, doublereal p, doublereal tol)
+{
+    if (p < 1.0E-300) {
+        throw CanteraError("IdealGasPhase::setState_HP",
+                           "Input pressure is too small or negative. p = " + fp2str(p));
+    }
+    doublereal T = solveTemperature(h, moleFractdivMMW(), temperature(), false,
+                                    tol, &m_cp0_R[0], &m_h0_RT[0], &m_s0_R[0]);
+    // The reference state arrays were overwritten during the iteration
+    m_cache.clear();
+    setTemperature(T);
+    setPressure(p);
+}
+
+void IdealGasPhase::setState_UV(doublereal u, doublereal v, doublereal tol)
+{
+    if (v < 1.0E-300) {
+        throw CanteraError("IdealGasPhase::setState_UV",
+                           "Input specific volume is too small or negative. v = " + fp2str(v));
+    }
+    doublereal T = solveTemperature(u, moleFractdivMMW(), temperature(), true,
+                                    tol, &m_cp0_R[0], &m_h0_RT[0], &m_s0_R[0]);
+    m_cache.clear();
+    setDensity(1.0/v);
+    setTemperature(T);
+}
+
+void IdealGasPhase::getTemperatureBatch_HP(size_t nStates, const doublereal* h,
+        const doublereal* Y, doublereal* T, doublereal tol) const
+{
+    getTemperatureBatch(nStates, h, Y, T, false, tol);
+}
+
+void IdealGasPhase::getTemperatureBatch_UV(size_t nStates, const doublereal* u,
+        const doublereal* Y, doublereal* T, doublereal tol) const
+{
+    getTemperatureBatch(nStates, u, Y, T, true, tol);
+}
+
+void IdealGasPhase::getTemperatureBatch(size_t nStates, const doublereal* e,
+                                        const doublereal* Y, doublereal* T,
+                                        bool doUV, doublereal tol) const
+{
+    const vector_fp& mw = molecularWeights();
+    vector_fp cp_R(m_kk), hrt(m_kk), s_R(m_kk), ym(m_kk);
+    for (size_t j = 0; j < nStates; j++) {
+        // Normalize the mass fractions in the same way as
+        // Phase::setMassFractions
+        doublereal norm = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            norm += std::max(Y[k*nStates + j], 0.0);
+        }
+        for (size_t k = 0; k < m_kk; k++) {
+            ym[k] = std::max(Y[k*nStates + j], 0.0) / norm / mw[k];
+        }
+        T[j] = solveTemperature(e[j], &ym[0], T[j], doUV, tol,
+                                &cp_R[0], &hrt[0], &s_R[0]);
+    }
+}
+
+doublereal IdealGasPhase::solveTemperature(doublereal e, const doublereal* ym,
+        doublereal T, bool doUV, doublereal tol, doublereal* cp_R,
+        doublereal* h_RT, doublereal* s_R) const
+{
+    // 1/W, the number of moles per unit mass
+    doublereal rmmw = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        rmmw += ym[k];
+    }
+    doublereal Tmin = m_spthermo->minTemp();
+    doublereal Tmax = m_spthermo->maxTemp();
+    if (!(T >= Tmin)) {
+        T = Tmin;
+    } else if (T > Tmax) {
+        T = Tmax;
+    }
+
+    // Since cp > 0, e(T) is monotonically increasing, and the solution lies
+    // between the highest temperature found with e(T) < e_target and the
+    // lowest temperature found with e(T) > e_target.
+    doublereal Tlow = 0.0;
+    doublereal Thigh = std::numeric_limits<double>::max();
+    doublereal Tinit = T;
+    doublereal eT = 0.0;
+    doublereal Tlast = 0.0, cpLast = 0.0;
+    for (int n = 0; n < 100; n++) {
+        m_spthermo->update(T, cp_R, h_RT, s_R);
+        doublereal hsum = 0.0, cpsum = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            hsum += ym[k] * h_RT[k];
+            cpsum += ym[k] * cp_R[k];
+        }
+        if (doUV) {
+            hsum -= rmmw;
+            cpsum -= rmmw;
+        }
+        eT = GasConstant * T * hsum;
+        doublereal f = eT - e;
+        if (f == 0.0) {
+            return T;
+        } else if (f > 0.0) {
+            Thigh = std::min(Thigh, T);
+        } else {
+            Tlow = std::max(Tlow, T);
+        }
+        doublereal Tnew = T - f / (GasConstant * cpsum);
+        bool newton = (Tnew > Tlow && Tnew < Thigh);
+        if (!newton) {
+            if (Thigh < std::numeric_limits<double>::max()) {
+                Tnew = 0.5 * (Tlow + Thigh);
+            } else {
+                Tnew = 2.0 * T;
+            }
+        }
+        doublereal dT = Tnew - T;
+
+        // Once the iteration is converging quadratically, the error after a
+        // Newton step is approximately (dcp/dT) / (2 cp) * dT^2, where dcp/dT
+        // is estimated from the previous iteration. With a safety factor of
+        // 10 for the crude estimate of dcp/dT, this usually saves one
+        // evaluation compared to requiring the step itself to be smaller
+        // than the tolerance.
+        doublereal err = fabs(dT);
+        if (n > 0 && newton && fabs(dT) < 0.1 * fabs(T - Tlast)) {
+            doublereal dcpdT = (cpsum - cpLast) / (T - Tlast);
+            err = std::min(err, fabs(5.0 * dcpdT / cpsum) * dT * dT);
+        }
+        Tlast = T;
+        cpLast = cpsum;
+        T = Tnew;
+        if (err < tol) {
+            return T;
+        }
+    }
+    throw CanteraError("IdealGasPhase::solveTemperature",
+                       string("No convergence in 100 iterations\n")
+                       + "\tTarget " + (doUV ? "internal energy" : "enthalpy")
+                       + " = " + fp2str(e) + "\n"
+                       + "\tStarting temperature = " + fp2str(Tinit) + "\n"
+                       + "\tCurrent temperature = " + fp2str(T) + "\n"
+                       + "\tCurrent value = " + fp2str(eT) + "\n");
+}
+
 void IdealGasPhase::_updateThermo() const
 {
     static const int cacheId = m_cache.getId();
@@ -973,6 +973,309 @@ doublereal MixtureFugacityTP::dpdVCalc(doublereal TKelvin, doublereal molarVol,
     throw CanteraError("MixtureFugacityTP::dpdVCalc", "unimplemented");
 }
 
+int MixtureFugacityTP::solveCubic(doublereal TKelvin, doublereal pres,
+                                  doublereal an, doublereal bn, doublereal cn,
+                                  doublereal dn, doublereal tc, doublereal vc,
+                                  doublereal Vroot[3], doublereal Vguess) const
+{
+    Vroot[0] = 0.0;
+    Vroot[1] = 0.0;
+    Vroot[2] = 0.0;
+
+    // Derive the center of the cubic, x_N
+    doublereal xN = - bn /(3 * an);
+
+    // Derive the value of delta**2. This is a key quantity that determines the number of turning points
+    doublereal delta2 = (bn * bn - 3 * an * cn) / (9 * an * an);
+    doublereal delta = 0.0;
+
+    int nSolnValues;
+
+    double h2 = 4. * an * an * delta2 * delta2 * delta2;
+    if (delta2 > 0.0) {
+        delta = sqrt(delta2);
+    }
+
+    doublereal h = 2.0 * an * delta * delta2;
+
+    doublereal yN = 2.0 * bn * bn * bn / (27.0 * an * an) - bn * cn / (3.0 * an) + dn;
+
+    doublereal desc = yN * yN - h2;
+
+    if (fabs(fabs(h) - fabs(yN)) < 1.0E-10) {
+        if (desc != 0.0) {
+            // this is for getting to other cases
+            throw CanteraError("MixtureFugacityTP::solveCubic()", "numerical issues");
+        }
+        desc = 0.0;
+    }
+
+    if (desc < 0.0) {
+        nSolnValues = 3;
+    } else if (desc == 0.0) {
+        nSolnValues = 2;
+        // We are here as p goes to zero.
+    } else {
+        nSolnValues = 1;
+    }
+
+    /*
+     *  One real root -> If we have a guess, try to find it with Newton's
+     *  method. The root is unique, so any converged result is the root.
+     */
+    bool warmStarted = false;
+    if (desc > 0.0 && Vguess > 0.0) {
+        doublereal v = Vguess;
+        for (int n = 0; n < 20; n++) {
+            doublereal dresdV = (3.0 * an * v + 2.0 * bn) * v + cn;
+            if (dresdV == 0.0) {
+                break;
+            }
+            doublereal res = ((an * v + bn) * v + cn) * v + dn;
+            doublereal del = - res / dresdV;
+            v += del;
+            if (fabs(del) < 1.0E-10 * fabs(v)) {
+                warmStarted = true;
+                break;
+            }
+        }
+        if (warmStarted) {
+            Vroot[0] = v;
+        }
+    }
+
+    /*
+     *  One real root -> have to determine whether gas or liquid is the root
+     */
+    if (warmStarted) {
+        // Root has already been found
+    } else if (desc > 0.0) {
+        doublereal tmpD = sqrt(desc);
+        doublereal tmp1 = (- yN + tmpD) / (2.0 * an);
+        doublereal sgn1 = 1.0;
+        if (tmp1 < 0.0) {
+            sgn1 = -1.0;
+            tmp1 = -tmp1;
+        }
+        doublereal tmp2 = (- yN - tmpD) / (2.0 * an);
+        doublereal sgn2 = 1.0;
+        if (tmp2 < 0.0) {
+            sgn2 = -1.0;
+            tmp2 = -tmp2;
+        }
+        doublereal p1 = pow(tmp1, 1./3.);
+        doublereal p2 = pow(tmp2, 1./3.);
+
+        doublereal alpha = xN + sgn1 * p1 + sgn2 * p2;
+        Vroot[0] = alpha;
+        Vroot[1] = 0.0;
+        Vroot[2] = 0.0;
+    } else if (desc < 0.0) {
+        doublereal tmp = - yN/h;
+
+        doublereal val = acos(tmp);
+        doublereal theta = val / 3.0;
+
+        doublereal oo = 2. * Cantera::Pi / 3.;
+        doublereal alpha = xN + 2. * delta * cos(theta);
+
+        doublereal beta = xN + 2. * delta * cos(theta + oo);
+
+        doublereal gamma = xN + 2. * delta * cos(theta + 2.0 * oo);
+
+        Vroot[0] = beta;
+        Vroot[1] = gamma;
+        Vroot[2] = alpha;
+
+        for (int i = 0; i < 3; i++) {
+            tmp = an *  Vroot[i] * Vroot[i] * Vroot[i] + bn * Vroot[i] * Vroot[i] + cn  * Vroot[i] + dn;
+            if (fabs(tmp) > 1.0E-4) {
+                for (int j = 0; j < 3; j++) {
+                    if (j != i) {
+                        if (fabs(Vroot[i] - Vroot[j]) < 1.0E-4 * (fabs(Vroot[i]) + fabs(Vroot[j]))) {
+                            writelog("MixtureFugacityTP::solveCubic(T = " + fp2str(TKelvin) + ", p = " +
+                                     fp2str(pres) + "): WARNING roots have merged: " +
+                                     fp2str(Vroot[i]) + ", " + fp2str(Vroot[j]));
+                            writelogendl();
+                        }
+                    }
+                }
+            }
+        }
+    } else if (desc == 0.0) {
+        if (yN == 0.0 && h == 0.0) {
+            Vroot[0] = xN;
+            Vroot[1] = xN;
+            Vroot[2] = xN;
+        } else {
+            // need to figure out whether delta is pos or neg
+            if (yN > 0.0) {
+                doublereal tmp = pow(yN/(2*an), 1./3.);
+                if (fabs(tmp - delta) > 1.0E-9) {
+                    throw CanteraError("MixtureFugacityTP::solveCubic()", "unexpected");
+                }
+                Vroot[1] = xN + delta;
+                Vroot[0] = xN - 2.0*delta;  // liquid phase root
+            } else {
+                doublereal tmp = pow(yN/(2*an), 1./3.);
+                if (fabs(tmp - delta) > 1.0E-9) {
+                    throw CanteraError("MixtureFugacityTP::solveCubic()", "unexpected");
+                }
+                delta = -delta;
+                Vroot[0] = xN + delta;
+                Vroot[1] = xN - 2.0*delta;  // gas phase root
+            }
+        }
+    }
+
+    /*
+     * Unfortunately, there is a heavy amount of roundoff error due to bad conditioning in this
+     */
+    double res, dresdV = 0.0;
+    for (int i = 0; i < nSolnValues; i++) {
+        for (int n = 0; n < 20; n++) {
+            res = an *  Vroot[i] * Vroot[i] * Vroot[i] + bn * Vroot[i] * Vroot[i] + cn  * Vroot[i] + dn;
+            if (fabs(res) < 1.0E-14) {
+                break;
+            }
+            dresdV = 3.0 * an *  Vroot[i] * Vroot[i] + 2.0 * bn * Vroot[i] + cn;
+            double del = - res / dresdV;
+
+            Vroot[i] += del;
+            if (fabs(del) / (fabs(Vroot[i]) + fabs(del)) < 1.0E-14) {
+                break;
+            }
+            double res2 = an *  Vroot[i] * Vroot[i] * Vroot[i] + bn * Vroot[i] * Vroot[i] + cn  * Vroot[i] + dn;
+            if (fabs(res2) < fabs(res)) {
+                continue;
+            } else {
+                Vroot[i] -= del;
+                Vroot[i] += 0.1 * del;
+            }
+        }
+        if ((fabs(res) > 1.0E-14) && (fabs(res) > 1.0E-14 * fabs(dresdV) * fabs(Vroot[i]))) {
+            writelog("MixtureFugacityTP::solveCubic(T = " + fp2str(TKelvin) + ", p = " +
+                     fp2str(pres) + "): WARNING root didn't converge V = " + fp2str(Vroot[i]));
+            writelogendl();
+        }
+    }
+
+    if (nSolnValues == 1) {
+        if (TKelvin > tc) {
+            if (Vroot[0] < vc) {
+                nSolnValues = -1;
+            }
+        } else {
+            if (Vroot[0] < xN) {
+                nSolnValues = -1;
+            }
+        }
+
+    } else {
+        if (nSolnValues == 2) {
+            if (delta > 0.0) {
+                nSolnValues = -2;
+            }
+        }
+    }
+    return nSolnValues;
+}
+
+void MixtureFugacityTP::cubicFugacityCoeffs(doublereal delta1, doublereal delta2,
+        doublereal b, doublereal A, doublereal dAdT, const doublereal* bk,
+        const doublereal* Ak, const doublereal* dAkdT, const doublereal* Akm,
+        doublereal* lnPhi, doublereal* vbar, doublereal* dlnPhidT, size_t ld,
+        doublereal* dlnPhidlnN) const
+{
+    doublereal T = temperature();
+    doublereal RT = GasConstant * T;
+    doublereal V = molarVolume();
+    doublereal P = pressure();
+    doublereal vmb = V - b;
+    doublereal p1 = V + delta1 * b;
+    doublereal p2 = V + delta2 * b;
+
+    /*
+     * The reduced residual Helmholtz energy for one kmol is
+     *     F = - g(V, b) - A/T f(V, b)
+     * with g = ln(1 - b/V) and f = ln(p1/p2) / (R b (delta1 - delta2)).
+     * Compute the derivatives of g and f with respect to V and b.
+     */
+    doublereal g_V = b / (V * vmb);
+    doublereal g_B = -1.0 / vmb;
+    doublereal g_VV = -1.0 / (vmb * vmb) + 1.0 / (V * V);
+    doublereal g_BV = 1.0 / (vmb * vmb);
+    doublereal g_BB = -1.0 / (vmb * vmb);
+
+    doublereal f = log(p1 / p2) / (GasConstant * b * (delta1 - delta2));
+    doublereal f_V = -1.0 / (GasConstant * p1 * p2);
+    doublereal f_B = -(f + V * f_V) / b;
+    doublereal f_VV = (p1 + p2) / (GasConstant * p1 * p1 * p2 * p2);
+    doublereal f_BV = -(2.0 * f_V + V * f_VV) / b;
+    doublereal f_BB = -(2.0 * f_B + V * f_BV) / b;
+
+    // Derivatives of F, where D = A (for one kmol) and D_k = 2 Ak
+    doublereal AT = A / T;
+    doublereal F_B = -g_B - AT * f_B;
+    doublereal F_D = -f / T;
+
+    if (lnPhi) {
+        doublereal lnZ = log(P * V / RT);
+        for (size_t k = 0; k < m_kk; k++) {
+            lnPhi[k] = -log(1.0 - b/V) + F_B * bk[k] + F_D * 2.0 * Ak[k] - lnZ;
+        }
+    }
+
+    if (!vbar && !dlnPhidT && !dlnPhidlnN) {
+        return;
+    }
+
+    // Pressure derivatives with respect to V and the mole numbers
+    doublereal F_BV = -g_BV - AT * f_BV;
+    doublereal F_DV = -f_V / T;
+    doublereal dPdV = RT * (g_VV + AT * f_VV) - RT / (V * V);
+    vector_fp dPdn(m_kk);
+    for (size_t k = 0; k < m_kk; k++) {
+        dPdn[k] = RT * (g_V - F_BV * bk[k] - F_DV * 2.0 * Ak[k]) + RT / V;
+    }
+
+    if (vbar) {
+        for (size_t k = 0; k < m_kk; k++) {
+            vbar[k] = - dPdn[k] / dPdV;
+        }
+    }
+
+    if (dlnPhidT) {
+        doublereal dATdT = dAdT / T - A / (T * T);
+        doublereal F_BT = - dATdT * f_B;
+        doublereal F_DT = f / (T * T);
+        doublereal F_VT = - dATdT * f_V;
+        doublereal dPdT = P / T - RT * F_VT;
+        for (size_t k = 0; k < m_kk; k++) {
+            doublereal F_kT = F_BT * bk[k] + F_DT * 2.0 * Ak[k]
+                              + F_D * 2.0 * dAkdT[k];
+            dlnPhidT[k] = F_kT + 1.0 / T + dPdn[k] / dPdV * dPdT / RT;
+        }
+    }
+
+    if (dlnPhidlnN) {
+        doublereal F_nB = -g_B;
+        doublereal F_BD = -f_B / T;
+        doublereal F_BB = -g_BB - AT * f_BB;
+        for (size_t m = 0; m < m_kk; m++) {
+            doublereal xm = moleFraction(m);
+            for (size_t k = 0; k < m_kk; k++) {
+                doublereal F_km = F_nB * (bk[k] + bk[m])
+                                  + F_BD * 2.0 * (bk[k] * Ak[m] + bk[m] * Ak[k])
+                                  + F_BB * bk[k] * bk[m]
+                                  + F_D * 2.0 * Akm[k*m_kk + m];
+                dlnPhidlnN[ld*m + k] = xm * (F_km + 1.0
+                                             + dPdn[k] * dPdn[m] / (RT * dPdV));
+            }
+        }
+    }
+}
+
 void MixtureFugacityTP::_updateReferenceStateThermo() const
 {
     double Tnow = temperature();
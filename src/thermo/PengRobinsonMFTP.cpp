@@ -0,0 +1,919 @@
+/**
+ *  @file PengRobinsonMFTP.cpp
+ * Definition file for a derived class of ThermoPhase that implements the
+ * Peng-Robinson cubic equation of state for a mixture (see \ref thermoprops
+ * and class \link Cantera::PengRobinsonMFTP PengRobinsonMFTP\endlink).
+ */
+
+#include "cantera/thermo/PengRobinsonMFTP.h"
+
+#include "cantera/thermo/mix_defs.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/numerics/RootFind.h"
+#include "cantera/base/stringUtils.h"
+#include "cantera/base/ctml.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+const doublereal PengRobinsonMFTP::omega_a = 4.5723552892138E-01;
+const doublereal PengRobinsonMFTP::omega_b = 7.7796073903888E-02;
+const doublereal PengRobinsonMFTP::omega_vc = 3.0740130869870E-01;
+
+namespace
+{
+//! The two constants of the generic cubic equation of state
+//! (1 + sqrt(2) and 1 - sqrt(2) for the Peng-Robinson equation of state)
+const doublereal Delta1 = 2.41421356237309505;
+const doublereal Delta2 = -0.41421356237309505;
+}
+
+PengRobinsonMFTP::PengRobinsonMFTP() :
+    m_b_current(0.0),
+    m_a_current(0.0),
+    m_dadt_current(0.0),
+    m_d2adt2_current(0.0),
+    m_aMix0(0.0),
+    NSolns_(0),
+    dpdV_(0.0),
+    dpdT_(0.0)
+{
+    Vroot_[0] = 0.0;
+    Vroot_[1] = 0.0;
+    Vroot_[2] = 0.0;
+}
+
+PengRobinsonMFTP::PengRobinsonMFTP(const std::string& infile, std::string id_) :
+    m_b_current(0.0),
+    m_a_current(0.0),
+    m_dadt_current(0.0),
+    m_d2adt2_current(0.0),
+    m_aMix0(0.0),
+    NSolns_(0),
+    dpdV_(0.0),
+    dpdT_(0.0)
+{
+    Vroot_[0] = 0.0;
+    Vroot_[1] = 0.0;
+    Vroot_[2] = 0.0;
+    XML_Node* root = get_XML_File(infile);
+    if (id_ == "-") {
+        id_ = "";
+    }
+    XML_Node* xphase = get_XML_NameID("phase", std::string("#")+id_, root);
+    if (!xphase) {
+        throw CanteraError("PengRobinsonMFTP::PengRobinsonMFTP()",
+                           "Couldn't find phase named \"" + id_ + "\" in file, " + infile);
+    }
+    importPhase(*xphase, this);
+}
+
+PengRobinsonMFTP::PengRobinsonMFTP(XML_Node& phaseRefRoot, const std::string& id_) :
+    m_b_current(0.0),
+    m_a_current(0.0),
+    m_dadt_current(0.0),
+    m_d2adt2_current(0.0),
+    m_aMix0(0.0),
+    NSolns_(0),
+    dpdV_(0.0),
+    dpdT_(0.0)
+{
+    Vroot_[0] = 0.0;
+    Vroot_[1] = 0.0;
+    Vroot_[2] = 0.0;
+    XML_Node* xphase = get_XML_NameID("phase", std::string("#")+id_, &phaseRefRoot);
+    if (!xphase) {
+        throw CanteraError("PengRobinsonMFTP::PengRobinsonMFTP()",
+                           "Couldn't find phase named \"" + id_ + "\" in XML node");
+    }
+    importPhase(*xphase, this);
+}
+
+PengRobinsonMFTP::PengRobinsonMFTP(const PengRobinsonMFTP& b) :
+    m_b_current(0.0),
+    m_a_current(0.0),
+    m_dadt_current(0.0),
+    m_d2adt2_current(0.0),
+    m_aMix0(0.0),
+    NSolns_(0),
+    dpdV_(0.0),
+    dpdT_(0.0)
+{
+    *this = b;
+}
+
+PengRobinsonMFTP& PengRobinsonMFTP::operator=(const PengRobinsonMFTP& b)
+{
+    if (&b != this) {
+        MixtureFugacityTP::operator=(b);
+        m_aij = b.m_aij;
+        b_vec_Curr_ = b.b_vec_Curr_;
+        m_acentric = b.m_acentric;
+        m_kappa = b.m_kappa;
+        m_tc_Species = b.m_tc_Species;
+        m_alphaC = b.m_alphaC;
+        m_alphaD = b.m_alphaD;
+        m_b_current = b.m_b_current;
+        m_a_current = b.m_a_current;
+        m_dadt_current = b.m_dadt_current;
+        m_d2adt2_current = b.m_d2adt2_current;
+        m_aMix0 = b.m_aMix0;
+        m_u0 = b.m_u0;
+        m_u1 = b.m_u1;
+        m_aSum = b.m_aSum;
+        m_dadtSum = b.m_dadtSum;
+        NSolns_ = b.NSolns_;
+        Vroot_[0] = b.Vroot_[0];
+        Vroot_[1] = b.Vroot_[1];
+        Vroot_[2] = b.Vroot_[2];
+        m_pp = b.m_pp;
+        m_tmpV = b.m_tmpV;
+        dpdV_ = b.dpdV_;
+        dpdT_ = b.dpdT_;
+    }
+    return *this;
+}
+
+ThermoPhase* PengRobinsonMFTP::duplMyselfAsThermoPhase() const
+{
+    return new PengRobinsonMFTP(*this);
+}
+
+int PengRobinsonMFTP::eosType() const
+{
+    return cPengRobinsonMFTP;
+}
+
+/*
+ * ------------Molar Thermodynamic Properties -------------------------
+ */
+
+doublereal PengRobinsonMFTP::enthalpy_mole() const
+{
+    _updateReferenceStateThermo();
+    doublereal h_ideal = _RT() * mean_X(m_h0_RT);
+    doublereal h_nonideal = hresid();
+    return h_ideal + h_nonideal;
+}
+
+doublereal PengRobinsonMFTP::entropy_mole() const
+{
+    _updateReferenceStateThermo();
+    doublereal sr_ideal =  GasConstant * (mean_X(m_s0_R)
+                                          - sum_xlogx() - std::log(pressure()/m_spthermo->refPressure()));
+    doublereal sr_nonideal = sresid();
+    return sr_ideal + sr_nonideal;
+}
+
+doublereal PengRobinsonMFTP::cp_mole() const
+{
+    doublereal cv = cv_mole();
+    pressureDerivatives();
+    return cv - temperature() * dpdT_ * dpdT_ / dpdV_;
+}
+
+doublereal PengRobinsonMFTP::cv_mole() const
+{
+    _updateReferenceStateThermo();
+    doublereal mv = molarVolume();
+    doublereal logRatio = log((mv + Delta1 * m_b_current) / (mv + Delta2 * m_b_current));
+    doublereal cvref = GasConstant * (mean_X(m_cp0_R) - 1.0);
+    return cvref + temperature() * m_d2adt2_current * logRatio
+           / (m_b_current * (Delta1 - Delta2));
+}
+
+doublereal PengRobinsonMFTP::pressure() const
+{
+    return m_Pcurrent;
+}
+
+void PengRobinsonMFTP::calcDensity()
+{
+    const doublereal* const dtmp = moleFractdivMMW();
+    getPartialMolarVolumes(DATA_PTR(m_tmpV));
+    double invDens = dot(m_tmpV.begin(), m_tmpV.end(), dtmp);
+    Phase::setDensity(1.0/invDens);
+}
+
+void PengRobinsonMFTP::setTemperature(const doublereal temp)
+{
+    Phase::setTemperature(temp);
+    _updateReferenceStateThermo();
+    updateAB();
+}
+
+void PengRobinsonMFTP::setMassFractions(const doublereal* const x)
+{
+    MixtureFugacityTP::setMassFractions(x);
+    updateAB();
+}
+
+void PengRobinsonMFTP::setMassFractions_NoNorm(const doublereal* const x)
+{
+    MixtureFugacityTP::setMassFractions_NoNorm(x);
+    updateAB();
+}
+
+void PengRobinsonMFTP::setMoleFractions(const doublereal* const x)
+{
+    MixtureFugacityTP::setMoleFractions(x);
+    updateAB();
+}
+
+void PengRobinsonMFTP::setMoleFractions_NoNorm(const doublereal* const x)
+{
+    MixtureFugacityTP::setMoleFractions_NoNorm(x);
+    updateAB();
+}
+
+void PengRobinsonMFTP::setConcentrations(const doublereal* const c)
+{
+    MixtureFugacityTP::setConcentrations(c);
+    updateAB();
+}
+
+void PengRobinsonMFTP::getActivityConcentrations(doublereal* c) const
+{
+    getPartialMolarVolumes(DATA_PTR(m_tmpV));
+    for (size_t k = 0; k < m_kk; k++) {
+        c[k] = moleFraction(k) / m_tmpV[k];
+    }
+}
+
+doublereal PengRobinsonMFTP::standardConcentration(size_t k) const
+{
+    getStandardVolumes(DATA_PTR(m_tmpV));
+    return 1.0 / m_tmpV[k];
+}
+
+void PengRobinsonMFTP::getUnitsStandardConc(double* uA, int, int sizeUA) const
+{
+    for (int i = 0; i < sizeUA; i++) {
+        uA[i] = 0.0;
+    }
+    if (sizeUA > 0) {
+        uA[0] = 1.0;
+    }
+    if (sizeUA > 1) {
+        uA[1] = -static_cast<int>(nDim());
+    }
+}
+
+void PengRobinsonMFTP::fugacityCoeffs(doublereal* lnPhi, doublereal* vbar,
+                                      doublereal* dlnPhidT, size_t ld,
+                                      doublereal* dlnPhidlnN) const
+{
+    vector_fp Akm;
+    if (dlnPhidlnN) {
+        doublereal sqt = sqrt(temperature());
+        Akm.resize(m_kk * m_kk);
+        for (size_t k = 0; k < m_kk; k++) {
+            doublereal mk = m_alphaC[k] - m_alphaD[k] * sqt;
+            for (size_t m = 0; m < m_kk; m++) {
+                doublereal mm = m_alphaC[m] - m_alphaD[m] * sqt;
+                Akm[k*m_kk + m] = m_aij[k*m_kk + m] * mk * mm;
+            }
+        }
+    }
+    cubicFugacityCoeffs(Delta1, Delta2, m_b_current, m_a_current, m_dadt_current,
+                        &b_vec_Curr_[0], &m_aSum[0], &m_dadtSum[0],
+                        Akm.empty() ? 0 : &Akm[0], lnPhi, vbar, dlnPhidT,
+                        ld, dlnPhidlnN);
+}
+
+void PengRobinsonMFTP::getActivityCoefficients(doublereal* ac) const
+{
+    fugacityCoeffs(ac, 0, 0, 0, 0);
+    for (size_t k = 0; k < m_kk; k++) {
+        ac[k] = exp(ac[k]);
+    }
+}
+
+void PengRobinsonMFTP::getdlnActCoeffdT(doublereal* dlnActCoeffdT) const
+{
+    fugacityCoeffs(0, 0, dlnActCoeffdT, 0, 0);
+}
+
+void PengRobinsonMFTP::getdlnActCoeffdlnN(const size_t ld, doublereal* const dlnActCoeffdlnN)
+{
+    fugacityCoeffs(0, 0, 0, ld, dlnActCoeffdlnN);
+}
+
+/*
+ * ---- Partial Molar Properties of the Solution -----------------
+ */
+
+void PengRobinsonMFTP::getChemPotentials_RT(doublereal* muRT) const
+{
+    getChemPotentials(muRT);
+    doublereal invRT = 1.0 / _RT();
+    for (size_t k = 0; k < m_kk; k++) {
+        muRT[k] *= invRT;
+    }
+}
+
+void PengRobinsonMFTP::getChemPotentials(doublereal* mu) const
+{
+    getGibbs_ref(mu);
+    fugacityCoeffs(DATA_PTR(m_pp), 0, 0, 0, 0);
+    doublereal rt = _RT();
+    doublereal logP = log(pressure() / refPressure());
+    for (size_t k = 0; k < m_kk; k++) {
+        double xx = std::max(SmallNumber, moleFraction(k));
+        mu[k] += rt * (log(xx) + logP + m_pp[k]);
+    }
+}
+
+void PengRobinsonMFTP::getPartialMolarEnthalpies(doublereal* hbar) const
+{
+    getEnthalpy_RT_ref(hbar);
+    fugacityCoeffs(0, 0, DATA_PTR(m_pp), 0, 0);
+    doublereal T = temperature();
+    doublereal rt = GasConstant * T;
+    for (size_t k = 0; k < m_kk; k++) {
+        hbar[k] = rt * (hbar[k] - T * m_pp[k]);
+    }
+}
+
+void PengRobinsonMFTP::getPartialMolarEntropies(doublereal* sbar) const
+{
+    getEntropy_R_ref(sbar);
+    fugacityCoeffs(DATA_PTR(m_pp), 0, DATA_PTR(m_tmpV), 0, 0);
+    doublereal T = temperature();
+    doublereal logP = log(pressure() / refPressure());
+    for (size_t k = 0; k < m_kk; k++) {
+        doublereal xx = std::max(SmallNumber, moleFraction(k));
+        sbar[k] = GasConstant * (sbar[k] - log(xx) - logP - m_pp[k]
+                                 - T * m_tmpV[k]);
+    }
+}
+
+void PengRobinsonMFTP::getPartialMolarIntEnergies(doublereal* ubar) const
+{
+    getPartialMolarEnthalpies(ubar);
+    getPartialMolarVolumes(DATA_PTR(m_tmpV));
+    doublereal p = pressure();
+    for (size_t k = 0; k < m_kk; k++) {
+        ubar[k] -= p * m_tmpV[k];
+    }
+}
+
+void PengRobinsonMFTP::getPartialMolarCp(doublereal* cpbar) const
+{
+    getCp_R(cpbar);
+    scale(cpbar, cpbar+m_kk, cpbar, GasConstant);
+}
+
+void PengRobinsonMFTP::getPartialMolarVolumes(doublereal* vbar) const
+{
+    fugacityCoeffs(0, vbar, 0, 0, 0);
+}
+
+doublereal PengRobinsonMFTP::critTemperature() const
+{
+    double pc, tc, vc;
+    pseudoCritical(pc, tc, vc);
+    return tc;
+}
+
+doublereal PengRobinsonMFTP::critPressure() const
+{
+    double pc, tc, vc;
+    pseudoCritical(pc, tc, vc);
+    return pc;
+}
+
+doublereal PengRobinsonMFTP::critVolume() const
+{
+    double pc, tc, vc;
+    pseudoCritical(pc, tc, vc);
+    return vc;
+}
+
+doublereal PengRobinsonMFTP::critCompressibility() const
+{
+    return omega_vc;
+}
+
+doublereal PengRobinsonMFTP::critDensity() const
+{
+    return meanMolecularWeight() / critVolume();
+}
+
+void PengRobinsonMFTP::pseudoCritical(doublereal& pc, doublereal& tc, doublereal& vc) const
+{
+    if (m_b_current <= 0.0) {
+        tc = 1000000.;
+        pc = 1.0E13;
+    } else if (m_aMix0 <= 0.0) {
+        tc = 0.0;
+        pc = 0.0;
+        vc = 2.0 * m_b_current;
+        return;
+    } else {
+        tc = m_aMix0 * omega_b / (m_b_current * omega_a * GasConstant);
+        pc = omega_b * GasConstant * tc / m_b_current;
+    }
+    vc = omega_vc * GasConstant * tc / pc;
+}
+
+void PengRobinsonMFTP::setParametersFromXML(const XML_Node& thermoNode)
+{
+    MixtureFugacityTP::setParametersFromXML(thermoNode);
+}
+
+void PengRobinsonMFTP::initThermo()
+{
+    initLengths();
+    MixtureFugacityTP::initThermo();
+}
+
+void PengRobinsonMFTP::setToEquilState(const doublereal* mu_RT)
+{
+    double tmp, tmp2;
+    _updateReferenceStateThermo();
+    getGibbs_RT_ref(DATA_PTR(m_tmpV));
+
+    /*
+     * Within the method, we protect against inf results if the
+     * exponent is too high.
+     *
+     * If it is too low, we set the partial pressure to zero. This capability
+     * is needed by the elemental potential method.
+     */
+    doublereal pres = 0.0;
+    double m_p0 = refPressure();
+    for (size_t k = 0; k < m_kk; k++) {
+        tmp = -m_tmpV[k] + mu_RT[k];
+        if (tmp < -600.) {
+            m_pp[k] = 0.0;
+        } else if (tmp > 500.0) {
+            tmp2 = tmp / 500.;
+            tmp2 *= tmp2;
+            m_pp[k] = m_p0 * exp(500.) * tmp2;
+        } else {
+            m_pp[k] = m_p0 * exp(tmp);
+        }
+        pres += m_pp[k];
+    }
+    setState_PX(pres, &m_pp[0]);
+}
+
+void PengRobinsonMFTP::initLengths()
+{
+    m_aij.resize(m_kk * m_kk, 0.0);
+    b_vec_Curr_.resize(m_kk, 0.0);
+    m_acentric.resize(m_kk, 0.0);
+    m_kappa.resize(m_kk, 0.0);
+    m_tc_Species.resize(m_kk, 0.0);
+    m_alphaC.resize(m_kk, 0.0);
+    m_alphaD.resize(m_kk, 0.0);
+    m_u0.resize(m_kk, 0.0);
+    m_u1.resize(m_kk, 0.0);
+    m_aSum.resize(m_kk, 0.0);
+    m_dadtSum.resize(m_kk, 0.0);
+    m_pp.resize(m_kk, 0.0);
+    m_tmpV.resize(m_kk, 0.0);
+}
+
+void PengRobinsonMFTP::initThermoXML(XML_Node& phaseNode, const std::string& id)
+{
+    PengRobinsonMFTP::initLengths();
+
+    if (phaseNode.hasChild("thermo")) {
+        XML_Node& thermoNode = phaseNode.child("thermo");
+        std::string model = thermoNode["model"];
+        if (model != "PengRobinson" && model != "PengRobinsonMFTP") {
+            throw CanteraError("PengRobinsonMFTP::initThermoXML",
+                               "Unknown thermo model : " + model);
+        }
+
+        if (thermoNode.hasChild("activityCoefficients")) {
+            XML_Node& acNode = thermoNode.child("activityCoefficients");
+            size_t nC = acNode.nChildren();
+            for (size_t i = 0; i < nC; i++) {
+                XML_Node& xmlACChild = acNode.child(i);
+                if (lowercase(xmlACChild.name()) == "purefluidparameters") {
+                    readXMLPureFluid(xmlACChild);
+                }
+            }
+
+            // Standard mixing rule for the cross terms, which may be
+            // overridden by crossFluidParameters entries
+            for (size_t i = 0; i < m_kk; i++) {
+                for (size_t j = 0; j < m_kk; j++) {
+                    if (i != j) {
+                        m_aij[i*m_kk + j] = sqrt(m_aij[i*m_kk + i] * m_aij[j*m_kk + j]);
+                    }
+                }
+            }
+
+            for (size_t i = 0; i < nC; i++) {
+                XML_Node& xmlACChild = acNode.child(i);
+                if (lowercase(xmlACChild.name()) == "crossfluidparameters") {
+                    readXMLCrossFluid(xmlACChild);
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < m_kk; i++) {
+        doublereal ai = m_aij[i*m_kk + i];
+        doublereal bi = b_vec_Curr_[i];
+        if (ai <= 0.0 || bi <= 0.0) {
+            throw CanteraError("PengRobinsonMFTP::initThermoXML",
+                               "Missing pureFluidParameters for species " + speciesName(i));
+        }
+        doublereal w = m_acentric[i];
+        if (w <= 0.491) {
+            m_kappa[i] = 0.37464 + 1.54226 * w - 0.26992 * w * w;
+        } else {
+            m_kappa[i] = 0.379642 + 1.48503 * w - 0.164423 * w * w + 0.016666 * w * w * w;
+        }
+        m_tc_Species[i] = ai * omega_b / (bi * omega_a * GasConstant);
+        m_alphaC[i] = 1.0 + m_kappa[i];
+        m_alphaD[i] = m_kappa[i] / sqrt(m_tc_Species[i]);
+    }
+
+    // Values cached while the parameters were being read are out of date
+    m_cache.clear();
+
+    MixtureFugacityTP::initThermoXML(phaseNode, id);
+}
+
+void PengRobinsonMFTP::readXMLPureFluid(XML_Node& pureFluidParam)
+{
+    vector_fp vParams;
+    string iName = pureFluidParam.attrib("species");
+    if (iName == "") {
+        throw CanteraError("PengRobinsonMFTP::readXMLPureFluid", "no species attribute");
+    }
+    size_t iSpecies = speciesIndex(iName);
+    if (iSpecies == npos) {
+        return;
+    }
+    size_t num = pureFluidParam.nChildren();
+    for (size_t iChild = 0; iChild < num; iChild++) {
+        XML_Node& xmlChild = pureFluidParam.child(iChild);
+        string nodeName = lowercase(xmlChild.name());
+
+        if (nodeName == "a_coeff") {
+            string iModel = lowercase(xmlChild.attrib("model"));
+            if (iModel != "" && iModel != "constant") {
+                throw CanteraError("PengRobinsonMFTP::readXMLPureFluid",
+                                   "unknown model for a_coeff: " + iModel);
+            }
+            ctml::getFloatArray(xmlChild, vParams, true, "Pascal-m6/kmol2", "a_coeff");
+            if (vParams.size() != 1) {
+                throw CanteraError("PengRobinsonMFTP::readXMLPureFluid(for a_coeff" + iName + ")",
+                                   "wrong number of params found");
+            }
+            m_aij[iSpecies*m_kk + iSpecies] = vParams[0];
+        } else if (nodeName == "b_coeff") {
+            ctml::getFloatArray(xmlChild, vParams, true, "m3/kmol", "b_coeff");
+            if (vParams.size() != 1) {
+                throw CanteraError("PengRobinsonMFTP::readXMLPureFluid(for b_coeff" + iName + ")",
+                                   "wrong number of params found");
+            }
+            b_vec_Curr_[iSpecies] = vParams[0];
+        } else if (nodeName == "acentric_factor") {
+            m_acentric[iSpecies] = fpValueCheck(xmlChild.value());
+        }
+    }
+}
+
+void PengRobinsonMFTP::readXMLCrossFluid(XML_Node& CrossFluidParam)
+{
+    vector_fp vParams;
+    string iName = CrossFluidParam.attrib("species1");
+    if (iName == "") {
+        throw CanteraError("PengRobinsonMFTP::readXMLCrossFluid", "no species1 attribute");
+    }
+    size_t iSpecies = speciesIndex(iName);
+    if (iSpecies == npos) {
+        return;
+    }
+    string jName = CrossFluidParam.attrib("species2");
+    if (jName == "") {
+        throw CanteraError("PengRobinsonMFTP::readXMLCrossFluid", "no species2 attribute");
+    }
+    size_t jSpecies = speciesIndex(jName);
+    if (jSpecies == npos) {
+        return;
+    }
+
+    size_t num = CrossFluidParam.nChildren();
+    for (size_t iChild = 0; iChild < num; iChild++) {
+        XML_Node& xmlChild = CrossFluidParam.child(iChild);
+        if (lowercase(xmlChild.name()) == "a_coeff") {
+            string iModel = lowercase(xmlChild.attrib("model"));
+            if (iModel != "" && iModel != "constant") {
+                throw CanteraError("PengRobinsonMFTP::readXMLCrossFluid",
+                                   "unknown model for a_coeff: " + iModel);
+            }
+            ctml::getFloatArray(xmlChild, vParams, true, "Pascal-m6/kmol2", "a_coeff");
+            if (vParams.size() != 1) {
+                throw CanteraError("PengRobinsonMFTP::readXMLCrossFluid(for a_coeff" + iName + ")",
+                                   "wrong number of params found");
+            }
+            m_aij[iSpecies*m_kk + jSpecies] = vParams[0];
+            m_aij[jSpecies*m_kk + iSpecies] = vParams[0];
+        }
+    }
+}
+
+doublereal PengRobinsonMFTP::sresid() const
+{
+    doublereal mv = molarVolume();
+    doublereal T = temperature();
+    doublereal logRatio = log((mv + Delta1 * m_b_current) / (mv + Delta2 * m_b_current));
+    return GasConstant * log(pressure() * (mv - m_b_current) / (GasConstant * T))
+           + m_dadt_current * logRatio / (m_b_current * (Delta1 - Delta2));
+}
+
+doublereal PengRobinsonMFTP::hresid() const
+{
+    doublereal mv = molarVolume();
+    doublereal T = temperature();
+    doublereal logRatio = log((mv + Delta1 * m_b_current) / (mv + Delta2 * m_b_current));
+    return pressure() * mv - GasConstant * T
+           + (T * m_dadt_current - m_a_current) * logRatio / (m_b_current * (Delta1 - Delta2));
+}
+
+doublereal PengRobinsonMFTP::liquidVolEst(doublereal TKelvin, doublereal& presGuess) const
+{
+    double v = m_b_current * 1.1;
+    double atmp;
+    double btmp;
+    calculateAB(TKelvin, atmp, btmp);
+
+    doublereal pres = std::max(psatEst(TKelvin), presGuess);
+    double Vroot[3];
+
+    bool foundLiq = false;
+    int m = 0;
+    do {
+        int nsol = solveEOS(TKelvin, pres, atmp, btmp, Vroot);
+        if (nsol == 1 || nsol == 2) {
+            double pc = critPressure();
+            if (pres > pc) {
+                foundLiq = true;
+            }
+            pres *= 1.04;
+        } else {
+            foundLiq = true;
+        }
+        m++;
+    } while ((m < 100) && (!foundLiq));
+
+    if (foundLiq) {
+        v = Vroot[0];
+        presGuess = pres;
+    } else {
+        v = -1.0;
+    }
+    return v;
+}
+
+doublereal PengRobinsonMFTP::densityCalc(doublereal TKelvin, doublereal presPa, int phaseRequested, doublereal rhoguess)
+{
+    /*
+     *  It's necessary to set the temperature so that m_a_current is set correctly.
+     */
+    setTemperature(TKelvin);
+    double tcrit = critTemperature();
+    doublereal mmw = meanMolecularWeight();
+    if (rhoguess == -1.0) {
+        if (phaseRequested >= FLUID_LIQUID_0 && TKelvin <= tcrit) {
+            double lqvol = liquidVolEst(TKelvin, presPa);
+            rhoguess = mmw / lqvol;
+        } else {
+            rhoguess = presPa * mmw / (GasConstant * TKelvin);
+        }
+    }
+
+    doublereal volguess = mmw / rhoguess;
+    NSolns_ = solveEOS(TKelvin, presPa, m_a_current, m_b_current, Vroot_, volguess);
+
+    doublereal molarVolLast = Vroot_[0];
+    if (NSolns_ >= 2) {
+        if (phaseRequested >= FLUID_LIQUID_0) {
+            molarVolLast = Vroot_[0];
+        } else if (phaseRequested == FLUID_GAS || phaseRequested == FLUID_SUPERCRIT) {
+            molarVolLast = Vroot_[2];
+        } else {
+            if (volguess > Vroot_[1]) {
+                molarVolLast = Vroot_[2];
+            } else {
+                molarVolLast = Vroot_[0];
+            }
+        }
+    } else if (NSolns_ == 1) {
+        if (phaseRequested == FLUID_GAS || phaseRequested == FLUID_SUPERCRIT || phaseRequested == FLUID_UNDEFINED) {
+            molarVolLast = Vroot_[0];
+        } else {
+            return -2.0;
+        }
+    } else if (NSolns_ == -1) {
+        if (phaseRequested >= FLUID_LIQUID_0 || phaseRequested == FLUID_UNDEFINED ||  phaseRequested == FLUID_SUPERCRIT) {
+            molarVolLast = Vroot_[0];
+        } else if (TKelvin > tcrit) {
+            molarVolLast = Vroot_[0];
+        } else {
+            return -2.0;
+        }
+    } else {
+        return -1.0;
+    }
+    return mmw / molarVolLast;
+}
+
+doublereal PengRobinsonMFTP::densSpinodalLiquid() const
+{
+    if (NSolns_ != 3) {
+        return critDensity();
+    }
+    double vmax = Vroot_[1];
+    double vmin = Vroot_[0];
+    RootFind rf(fdpdv_);
+    rf.setPrintLvl(10);
+    rf.setTol(1.0E-5, 1.0E-10);
+    rf.setFuncIsGenerallyDecreasing(true);
+
+    double vbest = 0.5 * (Vroot_[0]+Vroot_[1]);
+    double funcNeeded = 0.0;
+
+    int status = rf.solve(vmin, vmax, 100, funcNeeded, &vbest);
+    if (status != ROOTFIND_SUCCESS) {
+        throw CanteraError("PengRobinsonMFTP::densSpinodalLiquid()", "didn't converge");
+    }
+    return meanMolecularWeight() / vbest;
+}
+
+doublereal PengRobinsonMFTP::densSpinodalGas() const
+{
+    if (NSolns_ != 3) {
+        return critDensity();
+    }
+    double vmax = Vroot_[2];
+    double vmin = Vroot_[1];
+    RootFind rf(fdpdv_);
+    rf.setPrintLvl(10);
+    rf.setTol(1.0E-5, 1.0E-10);
+    rf.setFuncIsGenerallyIncreasing(true);
+
+    double vbest = 0.5 * (Vroot_[1]+Vroot_[2]);
+    double funcNeeded = 0.0;
+
+    int status = rf.solve(vmin, vmax, 100, funcNeeded, &vbest);
+    if (status != ROOTFIND_SUCCESS) {
+        throw CanteraError("PengRobinsonMFTP::densSpinodalGas()", "didn't converge");
+    }
+    return meanMolecularWeight() / vbest;
+}
+
+doublereal PengRobinsonMFTP::pressureCalc(doublereal TKelvin, doublereal molarVol) const
+{
+    doublereal den = molarVol * molarVol + 2.0 * m_b_current * molarVol
+                     - m_b_current * m_b_current;
+    return GasConstant * TKelvin / (molarVol - m_b_current) - m_a_current / den;
+}
+
+doublereal PengRobinsonMFTP::dpdVCalc(doublereal TKelvin, doublereal molarVol, doublereal& presCalc) const
+{
+    doublereal den = molarVol * molarVol + 2.0 * m_b_current * molarVol
+                     - m_b_current * m_b_current;
+    doublereal vmb = molarVol - m_b_current;
+    presCalc = GasConstant * TKelvin / vmb - m_a_current / den;
+    return - GasConstant * TKelvin / (vmb * vmb)
+           + m_a_current * 2.0 * (molarVol + m_b_current) / (den * den);
+}
+
+void PengRobinsonMFTP::pressureDerivatives() const
+{
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), density(), stateMFNumber())) {
+        return;
+    }
+
+    doublereal TKelvin = temperature();
+    doublereal mv = molarVolume();
+    doublereal pres;
+    dpdV_ = dpdVCalc(TKelvin, mv, pres);
+    doublereal den = mv * mv + 2.0 * m_b_current * mv - m_b_current * m_b_current;
+    dpdT_ = GasConstant / (mv - m_b_current) - m_dadt_current / den;
+}
+
+void PengRobinsonMFTP::updateMixingExpressions()
+{
+    updateAB();
+}
+
+void PengRobinsonMFTP::updateAB()
+{
+    /*
+     * With alpha_k^(1/2) = c_k - d_k T^(1/2), the sums over the composition
+     * can be split into two parts which do not depend on the temperature.
+     * These are only recomputed when the composition changes, so that a
+     * change in the temperature alone costs O(m_kk) operations.
+     */
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (!cached.validate(stateMFNumber())) {
+        m_b_current = 0.0;
+        m_aMix0 = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            m_b_current += moleFractions_[k] * b_vec_Curr_[k];
+            doublereal u0 = 0.0;
+            doublereal u1 = 0.0;
+            doublereal a0 = 0.0;
+            for (size_t j = 0; j < m_kk; j++) {
+                doublereal xa = moleFractions_[j] * m_aij[k*m_kk + j];
+                u0 += xa * m_alphaC[j];
+                u1 += xa * m_alphaD[j];
+                a0 += xa;
+            }
+            m_u0[k] = u0;
+            m_u1[k] = u1;
+            m_aMix0 += moleFractions_[k] * a0;
+        }
+    }
+
+    doublereal T = temperature();
+    doublereal sqt = sqrt(T);
+    m_a_current = 0.0;
+    m_dadt_current = 0.0;
+    m_d2adt2_current = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        doublereal mk = m_alphaC[k] - m_alphaD[k] * sqt;
+        doublereal dmk = -0.5 * m_alphaD[k] / sqt;
+        doublereal d2mk = 0.25 * m_alphaD[k] / (T * sqt);
+        doublereal u = m_u0[k] - sqt * m_u1[k];
+        doublereal w = -0.5 * m_u1[k] / sqt;
+        m_aSum[k] = mk * u;
+        m_dadtSum[k] = dmk * u + mk * w;
+        m_a_current += moleFractions_[k] * m_aSum[k];
+        m_dadt_current += moleFractions_[k] * m_dadtSum[k];
+        m_d2adt2_current += 2.0 * moleFractions_[k] * (d2mk * u + dmk * w);
+    }
+}
+
+void PengRobinsonMFTP::calculateAB(doublereal temp, doublereal& aCalc, doublereal& bCalc) const
+{
+    doublereal sqt = sqrt(temp);
+    bCalc = m_b_current;
+    aCalc = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        aCalc += moleFractions_[k] * (m_alphaC[k] - m_alphaD[k] * sqt)
+                 * (m_u0[k] - sqt * m_u1[k]);
+    }
+}
+
+int PengRobinsonMFTP::solveEOS(doublereal TKelvin, doublereal pres, doublereal a,
+                               doublereal b, doublereal Vroot[3], doublereal Vguess) const
+{
+    Vroot[0] = 0.0;
+    Vroot[1] = 0.0;
+    Vroot[2] = 0.0;
+    if (TKelvin <= 0.0) {
+        throw CanteraError("PengRobinsonMFTP::solveEOS()", "neg temperature");
+    }
+    doublereal RT = GasConstant * TKelvin;
+
+    /*
+     * At low pressures the cubic is badly conditioned. Solve for the
+     * compressibility factor directly instead.
+     */
+    doublereal B = pres * b / RT;
+    doublereal Aq = a * pres / (RT * RT);
+    if (fabs(B) < 1.0E-5 && fabs(Aq) < 1.0E-5) {
+        doublereal zz = 1.0;
+        for (int i = 0; i < 10; i++) {
+            doublereal znew = zz / (zz - B) - Aq * zz / (zz * zz + 2.0 * B * zz - B * B);
+            doublereal deltaz = znew - zz;
+            zz = znew;
+            if (fabs(deltaz) < 1.0E-14) {
+                break;
+            }
+        }
+        Vroot[0] = zz * RT / pres;
+        return 1;
+    }
+
+    /*
+     *  Derive the coefficients of the cubic polynomial to solve.
+     */
+    doublereal an = 1.0;
+    doublereal bn = b - RT / pres;
+    doublereal cn = -3.0 * b * b - 2.0 * RT * b / pres + a / pres;
+    doublereal dn = b * b * b + RT * b * b / pres - a * b / pres;
+
+    double pc, tc, vc;
+    pseudoCritical(pc, tc, vc);
+    return solveCubic(TKelvin, pres, an, bn, cn, dn, tc, vc, Vroot, Vguess);
+}
+
+}
@@ -21,6 +21,7 @@ Phase::Phase() :
     m_ndim(3),
     m_undefinedElementBehavior(UndefElement::error),
     m_xml(new XML_Node("phase")),
+    m_xmlRoot(m_xml),
     m_id("<phase>"),
     m_temp(0.001),
     m_dens(0.001),
@@ -69,6 +70,7 @@ Phase& Phase::operator=(const Phase& right)
     m_molwts = right.m_molwts;
     m_rmolwts = right.m_rmolwts;
     m_stateNum = -1;
+    m_cache.clear();
 
     m_speciesNames = right.m_speciesNames;
     m_speciesComp = right.m_speciesComp;
@@ -81,29 +83,10 @@ Phase& Phase::operator=(const Phase& right)
     m_elementNames   = right.m_elementNames;
     m_entropy298     = right.m_entropy298;
     m_elem_type      = right.m_elem_type;
-    /*
-     * This is a little complicated. -> Because we delete m_xml
-     * in the destructor, we own m_xml completely, and we need
-     * to have our own individual copies of the XML data tree
-     * in each object
-     */
-    if (m_xml) {
-        XML_Node* rroot = &(m_xml->root());
-        delete rroot;
-        m_xml = 0;
-    }
-    if (right.m_xml) {
-        XML_Node *rroot = &(right.m_xml->root());
-        XML_Node *root_xml = new XML_Node();
-        (rroot)->copy(root_xml);
-        m_xml = findXMLPhase(root_xml, right.m_xml->id());
-        if (!m_xml) {
-          throw CanteraError("Phase::operator=()", "Confused: Couldn't find original phase " + right.m_xml->id());
-        }
-        if (&(m_xml->root()) != root_xml) {
-          throw CanteraError("Phase::operator=()", "confused: root changed");
-        }
-    }
+    // The XML data tree is not modified after it has been set, so the copy
+    // shares it instead of duplicating it.
+    m_xml = right.m_xml;
+    m_xmlRoot = right.m_xmlRoot;
     m_id    = right.m_id;
     m_name  = right.m_name;
     realNumberRangeBehavior_ = right.realNumberRangeBehavior_;
@@ -113,11 +96,6 @@ Phase& Phase::operator=(const Phase& right)
 
 Phase::~Phase()
 {
-    if (m_xml) {
-        XML_Node* xroot = &(m_xml->root());
-        delete xroot;
-    }
-    m_xml = 0;
 }
 
 XML_Node& Phase::xml() const
@@ -130,11 +108,7 @@ void Phase::setXMLdata(XML_Node& xmlPhase)
     XML_Node* xroot = &(xmlPhase.root());
     XML_Node *root_xml = new XML_Node();
     (xroot)->copy(root_xml);
-    if (m_xml) {
-       XML_Node *rOld = &(m_xml->root());
-       delete rOld;
-       m_xml = 0;
-    }
+    m_xmlRoot.reset(root_xml);
     m_xml = findXMLPhase(root_xml, xmlPhase.id());
     if (!m_xml) {
         throw CanteraError("Phase::setXMLdata()", "XML 'phase' node not found");
@@ -34,6 +34,8 @@ RedlichKwongMFTP::RedlichKwongMFTP() :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_a0_current(0.0),
+    m_dadt_current(0.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -48,6 +50,8 @@ RedlichKwongMFTP::RedlichKwongMFTP(const std::string& infile, std::string id_) :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_a0_current(0.0),
+    m_dadt_current(0.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -72,6 +76,8 @@ RedlichKwongMFTP::RedlichKwongMFTP(XML_Node& phaseRefRoot, const std::string& id
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_a0_current(0.0),
+    m_dadt_current(0.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -91,6 +97,8 @@ RedlichKwongMFTP::RedlichKwongMFTP(int testProb) :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_a0_current(0.0),
+    m_dadt_current(0.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -119,6 +127,8 @@ RedlichKwongMFTP::RedlichKwongMFTP(const RedlichKwongMFTP& b) :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_a0_current(0.0),
+    m_dadt_current(0.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -141,7 +151,11 @@ RedlichKwongMFTP& RedlichKwongMFTP::operator=(const RedlichKwongMFTP& b)
         m_formTempParam = b.m_formTempParam;
         m_b_current = b.m_b_current;
         m_a_current = b.m_a_current;
-        a_vec_Curr_ = b.a_vec_Curr_;
+        m_a0_current = b.m_a0_current;
+        m_dadt_current = b.m_dadt_current;
+        m_aSum = b.m_aSum;
+        m_a0Sum = b.m_a0Sum;
+        m_dadtSum = b.m_dadtSum;
         b_vec_Curr_ = b.b_vec_Curr_;
         a_coeff_vec = b.a_coeff_vec;
 
@@ -211,8 +225,9 @@ doublereal RedlichKwongMFTP::cp_mole() const
 
 doublereal RedlichKwongMFTP::cv_mole() const
 {
-    throw CanteraError("", "unimplemented");
-    return cp_mole() - GasConstant;
+    doublereal cp = cp_mole();
+    pressureDerivatives();
+    return cp + temperature() * dpdT_ * dpdT_ / dpdV_;
 }
 
 doublereal RedlichKwongMFTP::pressure() const
@@ -336,20 +351,13 @@ void RedlichKwongMFTP::getActivityCoefficients(doublereal* ac) const
     doublereal vpb = mv + m_b_current;
     doublereal vmb = mv - m_b_current;
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
     doublereal pres = pressure();
 
     for (size_t k = 0; k < m_kk; k++) {
         ac[k] = (- rt * log(pres * mv / rt)
                  + rt * log(mv / vmb)
                  + rt * b_vec_Curr_[k] / vmb
-                 - 2.0 * m_pp[k] / (m_b_current * sqt) * log(vpb/mv)
+                 - 2.0 * m_aSum[k] / (m_b_current * sqt) * log(vpb/mv)
                  + m_a_current *  b_vec_Curr_[k] / (m_b_current * m_b_current * sqt) * log(vpb/mv)
                  - m_a_current / (m_b_current * sqt) * (b_vec_Curr_[k]/vpb)
                 );
@@ -387,13 +395,6 @@ void RedlichKwongMFTP::getChemPotentials(doublereal* mu) const
     doublereal vpb = mv + m_b_current;
     doublereal vmb = mv - m_b_current;
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
     doublereal pres = pressure();
     doublereal refP = refPressure();
 
@@ -401,7 +402,7 @@ void RedlichKwongMFTP::getChemPotentials(doublereal* mu) const
         mu[k] += (rt * log(pres/refP) - rt * log(pres * mv / rt)
                   + rt * log(mv / vmb)
                   + rt * b_vec_Curr_[k] / vmb
-                  - 2.0 * m_pp[k] / (m_b_current * sqt) * log(vpb/mv)
+                  - 2.0 * m_aSum[k] / (m_b_current * sqt) * log(vpb/mv)
                   + m_a_current *  b_vec_Curr_[k] / (m_b_current * m_b_current * sqt) * log(vpb/mv)
                   - m_a_current / (m_b_current * sqt) * (b_vec_Curr_[k]/vpb)
                  );
@@ -427,29 +428,16 @@ void RedlichKwongMFTP::getPartialMolarEnthalpies(doublereal* hbar) const
     doublereal vpb = mv + m_b_current;
     doublereal vmb = mv - m_b_current;
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
-
-
 
     for (size_t k = 0; k < m_kk; k++) {
-        dpdni_[k] = rt/vmb + rt * b_vec_Curr_[k] / (vmb * vmb) - 2.0 * m_pp[k] / (sqt * mv * vpb)
+        dpdni_[k] = rt/vmb + rt * b_vec_Curr_[k] / (vmb * vmb) - 2.0 * m_aSum[k] / (sqt * mv * vpb)
                     + m_a_current * b_vec_Curr_[k]/(sqt * mv * vpb * vpb);
     }
     doublereal dadt = da_dt();
     doublereal fac = TKelvin * dadt - 3.0 * m_a_current / 2.0;
 
     for (size_t k = 0; k < m_kk; k++) {
-        m_tmpV[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_tmpV[k] += 2.0 * moleFractions_[i] * TKelvin * a_coeff_vec(1,counter) - 3.0 *  moleFractions_[i] * a_vec_Curr_[counter];
-        }
+        m_tmpV[k] = 2.0 * TKelvin * m_dadtSum[k] - 3.0 * m_aSum[k];
     }
 
     pressureDerivatives();
@@ -482,23 +470,6 @@ void RedlichKwongMFTP::getPartialMolarEntropies(doublereal* sbar) const
         sbar[k] += r * (- log(xx));
     }
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
-
-    for (size_t k = 0; k < m_kk; k++) {
-        m_tmpV[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_tmpV[k] += moleFractions_[i] * a_coeff_vec(1,counter);
-        }
-    }
-
-
     doublereal dadt = da_dt();
     doublereal fac = dadt -  m_a_current / (2.0 * TKelvin);
     doublereal vmb = mv - m_b_current;
@@ -510,8 +481,8 @@ void RedlichKwongMFTP::getPartialMolarEntropies(doublereal* sbar) const
                    + GasConstant
                    + GasConstant * log(mv/vmb)
                    + GasConstant * b_vec_Curr_[k]/vmb
-                   + m_pp[k]/(m_b_current * TKelvin * sqt) * log(vpb/mv)
-                   - 2.0 * m_tmpV[k]/(m_b_current * sqt) * log(vpb/mv)
+                   + m_aSum[k]/(m_b_current * TKelvin * sqt) * log(vpb/mv)
+                   - 2.0 * m_dadtSum[k]/(m_b_current * sqt) * log(vpb/mv)
                    + b_vec_Curr_[k] / (m_b_current * m_b_current * sqt) * log(vpb/mv) * fac
                    - 1.0 / (m_b_current * sqt) *  b_vec_Curr_[k] / vpb * fac
                   ) ;
@@ -540,22 +511,6 @@ void RedlichKwongMFTP::getPartialMolarCp(doublereal* cpbar) const
 
 void RedlichKwongMFTP::getPartialMolarVolumes(doublereal* vbar) const
 {
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
-
-    for (size_t k = 0; k < m_kk; k++) {
-        m_tmpV[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_tmpV[k] += moleFractions_[i] * a_coeff_vec(1,counter);
-        }
-    }
-
     doublereal TKelvin = temperature();
     doublereal sqt = sqrt(TKelvin);
     doublereal mv = molarVolume();
@@ -569,7 +524,7 @@ void RedlichKwongMFTP::getPartialMolarVolumes(doublereal* vbar) const
 
         doublereal num = (rt + rt * m_b_current/ vmb + rt * b_vec_Curr_[k] / vmb
                           + rt *  m_b_current * b_vec_Curr_[k] /(vmb * vmb)
-                          - 2.0 * m_pp[k] / (sqt * vpb)
+                          - 2.0 * m_aSum[k] / (sqt * vpb)
                           + m_a_current *  b_vec_Curr_[k] / (sqt * vpb * vpb)
                          );
 
@@ -581,87 +536,80 @@ void RedlichKwongMFTP::getPartialMolarVolumes(doublereal* vbar) const
 
 }
 
-doublereal RedlichKwongMFTP::critTemperature() const
+void RedlichKwongMFTP::getdlnActCoeffdT(doublereal* dlnActCoeffdT) const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
+    doublereal TKelvin = temperature();
+    doublereal sqt = sqrt(TKelvin);
+    for (size_t k = 0; k < m_kk; k++) {
+        m_pp[k] = m_aSum[k] / sqt;
+        m_tmpV[k] = (m_dadtSum[k] - 0.5 * m_aSum[k] / TKelvin) / sqt;
     }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-    return tc;
+    doublereal dAdT = (m_dadt_current - 0.5 * m_a_current / TKelvin) / sqt;
+    cubicFugacityCoeffs(1.0, 0.0, m_b_current, m_a_current / sqt, dAdT,
+                        &b_vec_Curr_[0], &m_pp[0], &m_tmpV[0], 0,
+                        0, 0, dlnActCoeffdT, 0, 0);
 }
 
-doublereal RedlichKwongMFTP::critPressure() const
+void RedlichKwongMFTP::getdlnActCoeffdlnN(const size_t ld, doublereal* const dlnActCoeffdlnN)
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
+    doublereal TKelvin = temperature();
+    doublereal sqt = sqrt(TKelvin);
+    vector_fp Akm(m_kk * m_kk);
+    for (size_t k = 0; k < m_kk; k++) {
+        m_pp[k] = m_aSum[k] / sqt;
+        for (size_t m = 0; m < m_kk; m++) {
+            size_t counter = k + m_kk * m;
+            Akm[k*m_kk + m] = (a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * TKelvin) / sqt;
         }
     }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
+    cubicFugacityCoeffs(1.0, 0.0, m_b_current, m_a_current / sqt, 0.0,
+                        &b_vec_Curr_[0], &m_pp[0], 0, &Akm[0],
+                        0, 0, 0, ld, dlnActCoeffdlnN);
+}
+
+doublereal RedlichKwongMFTP::critTemperature() const
+{
+    return criticalConditions()[1];
+}
 
-    return pc;
+doublereal RedlichKwongMFTP::critPressure() const
+{
+    return criticalConditions()[0];
 }
 
 doublereal RedlichKwongMFTP::critVolume() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-    return vc;
+    return criticalConditions()[2];
 }
 
 doublereal RedlichKwongMFTP::critCompressibility() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-    return pc*vc/tc/GasConstant;
+    const vector_fp& crit = criticalConditions();
+    return crit[0]*crit[2]/crit[1]/GasConstant;
 }
 
 doublereal RedlichKwongMFTP::critDensity() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] *a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] *a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-
     double mmw = meanMolecularWeight();
-    return mmw / vc;
+    return mmw / criticalConditions()[2];
+}
+
+const vector_fp& RedlichKwongMFTP::criticalConditions() const
+{
+    // Depends only on the composition
+    static const int cacheId = m_cache.getId();
+    CachedArray cached = m_cache.getArray(cacheId);
+    if (cached.stateNum != stateMFNumber()) {
+        double pc, tc, vc;
+        calcCriticalConditions(m_a_current, m_b_current, m_a0_current,
+                               m_dadt_current, pc, tc, vc);
+        cached.value.resize(3);
+        cached.value[0] = pc;
+        cached.value[1] = tc;
+        cached.value[2] = vc;
+        cached.stateNum = stateMFNumber();
+    }
+    return cached.value;
 }
 
 void RedlichKwongMFTP::initThermo()
@@ -707,8 +655,10 @@ void RedlichKwongMFTP::setToEquilState(const doublereal* mu_RT)
 
 void RedlichKwongMFTP::initLengths()
 {
-    a_vec_Curr_.resize(m_kk * m_kk, 0.0);
     b_vec_Curr_.resize(m_kk, 0.0);
+    m_aSum.resize(m_kk, 0.0);
+    m_a0Sum.resize(m_kk, 0.0);
+    m_dadtSum.resize(m_kk, 0.0);
 
     a_coeff_vec.resize(2, m_kk * m_kk, 0.0);
 
@@ -803,6 +753,9 @@ void RedlichKwongMFTP::initThermoXML(XML_Node& phaseNode, const std::string& id)
         calcCriticalConditions(ai, bi, a0coeff, aTcoeff, m_pc_Species[i], m_tc_Species[i], m_vc_Species[i]);
     }
 
+    // Values cached while the parameters were being read are out of date
+    m_cache.clear();
+
     MixtureFugacityTP::initThermoXML(phaseNode, id);
 }
 
@@ -1060,7 +1013,7 @@ doublereal RedlichKwongMFTP::densityCalc(doublereal TKelvin, doublereal presPa,
     }
 
     doublereal volguess = mmw / rhoguess;
-    NSolns_ = NicholsSolve(TKelvin, presPa, m_a_current, m_b_current, Vroot_);
+    NSolns_ = NicholsSolve(TKelvin, presPa, m_a_current, m_b_current, Vroot_, volguess);
 
     doublereal molarVolLast = Vroot_[0];
     if (NSolns_ >= 2) {
@@ -1165,6 +1118,12 @@ doublereal  RedlichKwongMFTP::dpdVCalc(doublereal TKelvin, doublereal molarVol,
 
 void  RedlichKwongMFTP::pressureDerivatives() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), density(), stateMFNumber())) {
+        return;
+    }
+
     doublereal TKelvin = temperature();
     doublereal mv = molarVolume();
     doublereal pres;
@@ -1187,63 +1146,50 @@ void RedlichKwongMFTP::updateMixingExpressions()
 
 void RedlichKwongMFTP::updateAB()
 {
-    double temp = temperature();
-    if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                a_vec_Curr_[counter] = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
+    /*
+     * The sums over the a coefficients weighted by the mole fractions only
+     * change when the composition changes. The temperature dependence of the
+     * linear_a model is then applied to the sums, so that a change in the
+     * temperature alone costs O(m_kk) operations rather than O(m_kk**2).
+     */
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (!cached.validate(stateMFNumber())) {
+        m_b_current = 0.0;
+        m_a0_current = 0.0;
+        m_dadt_current = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            m_b_current += moleFractions_[k] * b_vec_Curr_[k];
+            doublereal a0 = 0.0;
+            doublereal aT = 0.0;
+            for (size_t i = 0; i < m_kk; i++) {
+                size_t counter = k + m_kk * i;
+                a0 += moleFractions_[i] * a_coeff_vec(0,counter);
+                aT += moleFractions_[i] * a_coeff_vec(1,counter);
             }
+            m_a0Sum[k] = a0;
+            m_dadtSum[k] = aT;
+            m_a0_current += moleFractions_[k] * a0;
+            m_dadt_current += moleFractions_[k] * aT;
         }
     }
 
-    m_b_current = 0.0;
-    m_a_current = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        m_b_current += moleFractions_[i] * b_vec_Curr_[i];
-        for (size_t j = 0; j < m_kk; j++) {
-            m_a_current +=  a_vec_Curr_[i * m_kk + j] * moleFractions_[i] * moleFractions_[j];
-        }
+    double temp = temperature();
+    for (size_t k = 0; k < m_kk; k++) {
+        m_aSum[k] = m_a0Sum[k] + m_dadtSum[k] * temp;
     }
+    m_a_current = m_a0_current + m_dadt_current * temp;
 }
 
 void RedlichKwongMFTP::calculateAB(doublereal temp, doublereal& aCalc, doublereal& bCalc) const
 {
-    bCalc = 0.0;
-    aCalc = 0.0;
-    if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            bCalc += moleFractions_[i] * b_vec_Curr_[i];
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                doublereal a_vec_Curr = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
-                aCalc +=  a_vec_Curr * moleFractions_[i] * moleFractions_[j];
-            }
-        }
-    } else {
-        for (size_t i = 0; i < m_kk; i++) {
-            bCalc += moleFractions_[i] * b_vec_Curr_[i];
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                doublereal a_vec_Curr = a_coeff_vec(0,counter);
-                aCalc +=  a_vec_Curr * moleFractions_[i] * moleFractions_[j];
-            }
-        }
-    }
+    bCalc = m_b_current;
+    aCalc = m_a0_current + m_dadt_current * temp;
 }
 
 doublereal RedlichKwongMFTP::da_dt() const
 {
-    doublereal dadT = 0.0;
-    if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                dadT+=  a_coeff_vec(1,counter) * moleFractions_[i] * moleFractions_[j];
-            }
-        }
-    }
-    return dadT;
+    return m_dadt_current;
 }
 
 void RedlichKwongMFTP::calcCriticalConditions(doublereal a, doublereal b, doublereal a0_coeff, doublereal aT_coeff,
@@ -1290,7 +1236,7 @@ void RedlichKwongMFTP::calcCriticalConditions(doublereal a, doublereal b, double
 }
 
 int RedlichKwongMFTP::NicholsSolve(double TKelvin, double pres, doublereal a, doublereal b,
-                                   doublereal Vroot[3]) const
+                                   doublereal Vroot[3], doublereal Vguess) const
 {
     Vroot[0] = 0.0;
     Vroot[1] = 0.0;
@@ -1312,13 +1258,6 @@ int RedlichKwongMFTP::NicholsSolve(double TKelvin, double pres, doublereal a, do
     double tc =  pow(tmp, pp);
     double pc = omega_b * GasConstant * tc / b;
     double   vc = omega_vc * GasConstant * tc / pc;
-    // Derive the center of the cubic, x_N
-    doublereal xN = - bn /(3 * an);
-
-
-    // Derive the value of delta**2. This is a key quantity that determines the number of turning points
-    doublereal delta2 = (bn * bn - 3 * an * cn) / (9 * an * an);
-    doublereal delta = 0.0;
 
     // Calculate a couple of ratios
     doublereal ratio1 = 3.0 * an * cn / (bn * bn);
@@ -1342,177 +1281,7 @@ int RedlichKwongMFTP::NicholsSolve(double TKelvin, double pres, doublereal a, do
         }
     }
 
-    int nSolnValues;
-
-    double h2 = 4. * an * an * delta2 * delta2 * delta2;
-    if (delta2 > 0.0) {
-        delta = sqrt(delta2);
-    }
-
-    doublereal h = 2.0 * an * delta * delta2;
-
-    doublereal yN = 2.0 * bn * bn * bn / (27.0 * an * an) - bn * cn / (3.0 * an) + dn;
-
-    doublereal desc = yN * yN - h2;
-
-    if (fabs(fabs(h) - fabs(yN)) < 1.0E-10) {
-        if (desc != 0.0) {
-            // this is for getting to other cases
-            printf("NicholsSolve(): numerical issues\n");
-            throw CanteraError("NicholsSolve()", "numerical issues");
-        }
-        desc = 0.0;
-    }
-
-    if (desc < 0.0) {
-        nSolnValues = 3;
-    } else if (desc == 0.0) {
-        nSolnValues = 2;
-        // We are here as p goes to zero.
-    } else if (desc > 0.0) {
-        nSolnValues = 1;
-    }
-
-    /*
-     *  One real root -> have to determine whether gas or liquid is the root
-     */
-    if (desc > 0.0) {
-        doublereal tmpD = sqrt(desc);
-        doublereal tmp1 = (- yN + tmpD) / (2.0 * an);
-        doublereal sgn1 = 1.0;
-        if (tmp1 < 0.0) {
-            sgn1 = -1.0;
-            tmp1 = -tmp1;
-        }
-        doublereal tmp2 = (- yN - tmpD) / (2.0 * an);
-        doublereal sgn2 = 1.0;
-        if (tmp2 < 0.0) {
-            sgn2 = -1.0;
-            tmp2 = -tmp2;
-        }
-        doublereal p1 = pow(tmp1, 1./3.);
-        doublereal p2 = pow(tmp2, 1./3.);
-
-        doublereal alpha = xN + sgn1 * p1 + sgn2 * p2;
-        Vroot[0] = alpha;
-        Vroot[1] = 0.0;
-        Vroot[2] = 0.0;
-
-        tmp = an *  Vroot[0] * Vroot[0] * Vroot[0] + bn * Vroot[0] * Vroot[0] + cn  * Vroot[0] + dn;
-
-    } else if (desc < 0.0) {
-        doublereal tmp = - yN/h;
-
-        doublereal val = acos(tmp);
-        doublereal theta = val / 3.0;
-
-        doublereal oo = 2. * Cantera::Pi / 3.;
-        doublereal alpha = xN + 2. * delta * cos(theta);
-
-        doublereal beta = xN + 2. * delta * cos(theta + oo);
-
-        doublereal gamma = xN + 2. * delta * cos(theta + 2.0 * oo);
-
-
-        Vroot[0] = beta;
-        Vroot[1] = gamma;
-        Vroot[2] = alpha;
-
-        for (int i = 0; i < 3; i++) {
-            tmp = an *  Vroot[i] * Vroot[i] * Vroot[i] + bn * Vroot[i] * Vroot[i] + cn  * Vroot[i] + dn;
-            if (fabs(tmp) > 1.0E-4) {
-                for (int j = 0; j < 3; j++) {
-                    if (j != i) {
-                        if (fabs(Vroot[i] - Vroot[j]) < 1.0E-4 * (fabs(Vroot[i]) + fabs(Vroot[j]))) {
-                            writelog("RedlichKwongMFTP::NicholsSolve(T = " + fp2str(TKelvin) + ", p = " +
-                                     fp2str(pres) + "): WARNING roots have merged: " +
-                                     fp2str(Vroot[i]) + ", " + fp2str(Vroot[j]));
-                            writelogendl();
-                        }
-                    }
-                }
-            }
-        }
-    } else if (desc == 0.0) {
-        if (yN == 0.0 && h == 0.0) {
-            Vroot[0] = xN;
-            Vroot[1] = xN;
-            Vroot[2] = xN;
-        } else {
-            // need to figure out whether delta is pos or neg
-            if (yN > 0.0) {
-                tmp = pow(yN/(2*an), 1./3.);
-                if (fabs(tmp - delta) > 1.0E-9) {
-                    throw CanteraError("RedlichKwongMFTP::NicholsSolve()", "unexpected");
-                }
-                Vroot[1] = xN + delta;
-                Vroot[0] = xN - 2.0*delta;  // liquid phase root
-            } else {
-                tmp = pow(yN/(2*an), 1./3.);
-                if (fabs(tmp - delta) > 1.0E-9) {
-                    throw CanteraError("RedlichKwongMFTP::NicholsSolve()", "unexpected");
-                }
-                delta = -delta;
-                Vroot[0] = xN + delta;
-                Vroot[1] = xN - 2.0*delta;  // gas phase root
-            }
-        }
-        for (int i = 0; i < 2; i++) {
-            tmp = an *  Vroot[i] * Vroot[i] * Vroot[i] + bn * Vroot[i] * Vroot[i] + cn  * Vroot[i] + dn;
-        }
-    }
-
-    /*
-     * Unfortunately, there is a heavy amount of roundoff error due to bad conditioning in this
-     */
-    double res, dresdV = 0.0;
-    for (int i = 0; i < nSolnValues; i++) {
-        for (int n = 0; n < 20; n++) {
-            res = an *  Vroot[i] * Vroot[i] * Vroot[i] + bn * Vroot[i] * Vroot[i] + cn  * Vroot[i] + dn;
-            if (fabs(res) < 1.0E-14) {
-                break;
-            }
-            dresdV = 3.0 * an *  Vroot[i] * Vroot[i] + 2.0 * bn * Vroot[i] + cn;
-            double del = - res / dresdV;
-
-            Vroot[i] += del;
-            if (fabs(del) / (fabs(Vroot[i]) + fabs(del)) < 1.0E-14) {
-                break;
-            }
-            double res2 = an *  Vroot[i] * Vroot[i] * Vroot[i] + bn * Vroot[i] * Vroot[i] + cn  * Vroot[i] + dn;
-            if (fabs(res2) < fabs(res)) {
-                continue;
-            } else {
-                Vroot[i] -= del;
-                Vroot[i] += 0.1 * del;
-            }
-        }
-        if ((fabs(res) > 1.0E-14) && (fabs(res) > 1.0E-14 * fabs(dresdV) * fabs(Vroot[i]))) {
-            writelog("RedlichKwongMFTP::NicholsSolve(T = " + fp2str(TKelvin) + ", p = " +
-                     fp2str(pres) + "): WARNING root didn't converge V = " + fp2str(Vroot[i]));
-            writelogendl();
-        }
-    }
-
-    if (nSolnValues == 1) {
-        if (TKelvin > tc) {
-            if (Vroot[0] < vc) {
-                nSolnValues = -1;
-            }
-        } else {
-            if (Vroot[0] < xN) {
-                nSolnValues = -1;
-            }
-        }
-
-    } else {
-        if (nSolnValues == 2) {
-            if (delta > 0.0) {
-                nSolnValues = -2;
-            }
-        }
-    }
-    return nSolnValues;
+    return solveCubic(TKelvin, pres, an, bn, cn, dn, tc, vc, Vroot, Vguess);
 }
 
 }
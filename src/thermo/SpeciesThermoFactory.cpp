@@ -13,6 +13,7 @@
 #include "ShomateThermo.h"
 #include "cantera/thermo/SimpleThermo.h"
 #include "cantera/thermo/GeneralSpeciesThermo.h"
+#include "cantera/thermo/TabulatedSpeciesThermo.h"
 #include "cantera/thermo/Mu0Poly.h"
 #include "cantera/thermo/Nasa9PolyMultiTempRegion.h"
 #include "cantera/thermo/Nasa9Poly1.h"
@@ -176,6 +177,8 @@ SpeciesThermo* SpeciesThermoFactory::newSpeciesThermoManager(const std::string&
         return new SpeciesThermoDuo<ShomateThermo, SimpleThermo>;
     } else if (ltype ==   "general") {
         return new GeneralSpeciesThermo();
+    } else if (ltype == "tabulated") {
+        return new TabulatedSpeciesThermo();
     } else if (ltype ==  "") {
         return (SpeciesThermo*) 0;
     } else {
@@ -0,0 +1,347 @@
+/**
+ *  @file TabulatedSpeciesThermo.cpp
+ *  Definitions for a species thermodynamic property manager which
+ *  interpolates the reference state properties of all species from tables
+ *  (see \ref mgrsrefcalc and \link Cantera::TabulatedSpeciesThermo
+ *  TabulatedSpeciesThermo\endlink).
+ */
+
+#include "cantera/thermo/TabulatedSpeciesThermo.h"
+#include "cantera/thermo/NasaPoly2.h"
+#include "cantera/thermo/ShomatePoly.h"
+#include "cantera/thermo/Nasa9PolyMultiTempRegion.h"
+#include "cantera/base/stringUtils.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace Cantera
+{
+
+TabulatedSpeciesThermo::TabulatedSpeciesThermo(doublereal tol) :
+    m_tol(tol),
+    m_Tmin_user(0.0),
+    m_Tmax_user(0.0),
+    m_maxBins(16384),
+    m_table_ok(false),
+    m_nsp(0),
+    m_Tlow(0.0),
+    m_Thigh(0.0),
+    m_T0(0.0),
+    m_dT(0.0),
+    m_nbins(0),
+    m_maxError(0.0)
+{
+}
+
+TabulatedSpeciesThermo::TabulatedSpeciesThermo(const GeneralSpeciesThermo& b,
+                                               doublereal tol) :
+    GeneralSpeciesThermo(b),
+    m_tol(tol),
+    m_Tmin_user(0.0),
+    m_Tmax_user(0.0),
+    m_maxBins(16384),
+    m_table_ok(false),
+    m_nsp(0),
+    m_Tlow(0.0),
+    m_Thigh(0.0),
+    m_T0(0.0),
+    m_dT(0.0),
+    m_nbins(0),
+    m_maxError(0.0)
+{
+}
+
+TabulatedSpeciesThermo::TabulatedSpeciesThermo(const TabulatedSpeciesThermo& b) :
+    GeneralSpeciesThermo(b),
+    m_tol(b.m_tol),
+    m_Tmin_user(b.m_Tmin_user),
+    m_Tmax_user(b.m_Tmax_user),
+    m_maxBins(b.m_maxBins),
+    m_table_ok(b.m_table_ok),
+    m_nsp(b.m_nsp),
+    m_Tlow(b.m_Tlow),
+    m_Thigh(b.m_Thigh),
+    m_T0(b.m_T0),
+    m_dT(b.m_dT),
+    m_nbins(b.m_nbins),
+    m_coeffs(b.m_coeffs),
+    m_exactStart(b.m_exactStart),
+    m_exact(b.m_exact),
+    m_maxError(b.m_maxError),
+    m_cp(b.m_cp),
+    m_h(b.m_h),
+    m_s(b.m_s)
+{
+}
+
+TabulatedSpeciesThermo&
+TabulatedSpeciesThermo::operator=(const TabulatedSpeciesThermo& b)
+{
+    if (&b == this) {
+        return *this;
+    }
+    GeneralSpeciesThermo::operator=(b);
+    m_tol = b.m_tol;
+    m_Tmin_user = b.m_Tmin_user;
+    m_Tmax_user = b.m_Tmax_user;
+    m_maxBins = b.m_maxBins;
+    m_table_ok = b.m_table_ok;
+    m_nsp = b.m_nsp;
+    m_Tlow = b.m_Tlow;
+    m_Thigh = b.m_Thigh;
+    m_T0 = b.m_T0;
+    m_dT = b.m_dT;
+    m_nbins = b.m_nbins;
+    m_coeffs = b.m_coeffs;
+    m_exactStart = b.m_exactStart;
+    m_exact = b.m_exact;
+    m_maxError = b.m_maxError;
+    m_cp = b.m_cp;
+    m_h = b.m_h;
+    m_s = b.m_s;
+    return *this;
+}
+
+SpeciesThermo* TabulatedSpeciesThermo::duplMyselfAsSpeciesThermo() const
+{
+    return new TabulatedSpeciesThermo(*this);
+}
+
+void TabulatedSpeciesThermo::install_STIT(SpeciesThermoInterpType* stit_ptr)
+{
+    GeneralSpeciesThermo::install_STIT(stit_ptr);
+    invalidate();
+}
+
+void TabulatedSpeciesThermo::modifyOneHf298(const size_t k,
+                                            const doublereal Hf298New)
+{
+    GeneralSpeciesThermo::modifyOneHf298(k, Hf298New);
+    invalidate();
+}
+
+void TabulatedSpeciesThermo::setTolerance(doublereal tol)
+{
+    if (tol <= 0.0) {
+        throw CanteraError("TabulatedSpeciesThermo::setTolerance",
+                           "Tolerance must be positive");
+    }
+    m_tol = tol;
+    invalidate();
+}
+
+void TabulatedSpeciesThermo::setTemperatureRange(doublereal Tmin,
+                                                 doublereal Tmax)
+{
+    if (Tmin < 0.0 || Tmax < 0.0 || (Tmin > 0.0 && Tmax > 0.0 && Tmax <= Tmin)) {
+        throw CanteraError("TabulatedSpeciesThermo::setTemperatureRange",
+                           "Invalid temperature range: " + fp2str(Tmin) +
+                           " to " + fp2str(Tmax));
+    }
+    m_Tmin_user = Tmin;
+    m_Tmax_user = Tmax;
+    invalidate();
+}
+
+void TabulatedSpeciesThermo::setMaxIntervals(size_t n)
+{
+    m_maxBins = std::max<size_t>(n, 1);
+    invalidate();
+}
+
+void TabulatedSpeciesThermo::update(doublereal T, doublereal* cp_R,
+                                    doublereal* h_RT, doublereal* s_R) const
+{
+    if (!m_table_ok) {
+        buildTable();
+    }
+    if (m_nbins == 0 || !(T >= m_Tlow && T <= m_Thigh)) {
+        GeneralSpeciesThermo::update(T, cp_R, h_RT, s_R);
+        return;
+    }
+    doublereal x = (T - m_T0) / m_dT;
+    size_t i = std::min(static_cast<size_t>(x), m_nbins - 1);
+    interpolate(i, x - i, cp_R, h_RT, s_R);
+    for (size_t p = m_exactStart[i]; p < m_exactStart[i+1]; p++) {
+        GeneralSpeciesThermo::update_one(m_exact[p], T, cp_R, h_RT, s_R);
+    }
+}
+
+void TabulatedSpeciesThermo::interpolate(size_t i, doublereal t,
+        doublereal* cp_R, doublereal* h_RT, doublereal* s_R) const
+{
+    size_t K = m_nsp;
+    const doublereal* c = &m_coeffs[12*i*K];
+    for (size_t k = 0; k < K; k++) {
+        cp_R[k] = c[k] + t*(c[K+k] + t*(c[2*K+k] + t*c[3*K+k]));
+    }
+    c += 4*K;
+    for (size_t k = 0; k < K; k++) {
+        h_RT[k] = c[k] + t*(c[K+k] + t*(c[2*K+k] + t*c[3*K+k]));
+    }
+    c += 4*K;
+    for (size_t k = 0; k < K; k++) {
+        s_R[k] = c[k] + t*(c[K+k] + t*(c[2*K+k] + t*c[3*K+k]));
+    }
+}
+
+void TabulatedSpeciesThermo::buildTable() const
+{
+    m_table_ok = true;
+    doublereal dT = 100.0;
+    while (true) {
+        if (!fillTable(dT)) {
+            m_nbins = 0;
+            return;
+        }
+        m_maxError = tableError();
+        if (m_maxError <= m_tol) {
+            return;
+        }
+        if (2 * m_nbins > m_maxBins) {
+            m_nbins = 0;
+            throw CanteraError("TabulatedSpeciesThermo::buildTable",
+                "Interpolation tolerance of " + fp2str(m_tol) + " not met "
+                "with " + int2str(m_maxBins) + " or fewer intervals. "
+                "Largest error: " + fp2str(m_maxError));
+        }
+        dT *= 0.5;
+    }
+}
+
+bool TabulatedSpeciesThermo::fillTable(doublereal dT) const
+{
+    // The table only covers phases whose species are numbered contiguously
+    size_t K = m_speciesLoc.size();
+    if (K == 0 || m_speciesLoc.rbegin()->first != K - 1) {
+        return false;
+    }
+    m_nsp = K;
+    m_Tlow = (m_Tmin_user > 0.0) ? m_Tmin_user : m_tlow_max;
+    m_Thigh = (m_Tmax_user > 0.0) ? m_Tmax_user : m_thigh_min;
+    if (!(m_Thigh > m_Tlow)) {
+        return false;
+    }
+    m_T0 = floor(m_Tlow / dT) * dT;
+    if (m_T0 <= 0.0) {
+        m_T0 = m_Tlow;
+    }
+    m_dT = dT;
+    m_nbins = std::max<size_t>(static_cast<size_t>(ceil((m_Thigh - m_T0) / dT)), 1);
+
+    m_cp.resize(K);
+    m_h.resize(K);
+    m_s.resize(K);
+    m_coeffs.resize(12 * m_nbins * K);
+    vector_fp f0(3*K), d0(3*K), f1(3*K), d1(3*K), cp1(K), cp2(K), cp3(K);
+    doublereal delta = 1e-3 * dT;
+    for (size_t i = 0; i < m_nbins; i++) {
+        doublereal Ta = m_T0 + i * dT;
+        doublereal Tb = Ta + dT;
+        for (size_t side = 0; side < 2; side++) {
+            // The end points are moved slightly into the interval, so that if
+            // a region boundary is at a grid point, the polynomial for the
+            // region containing the interval is used on both sides.
+            doublereal T = (side == 0) ? Ta * (1.0 + 1e-13) : Tb * (1.0 - 1e-13);
+            doublereal* f = (side == 0) ? &f0[0] : &f1[0];
+            doublereal* d = (side == 0) ? &d0[0] : &d1[0];
+            GeneralSpeciesThermo::update(T, f, f + K, f + 2*K);
+
+            // The derivative of cp/R is approximated by differentiating the
+            // quadratic through three points inside the interval.
+            doublereal h = (side == 0) ? delta : -delta;
+            GeneralSpeciesThermo::update(T + h, &cp1[0], &m_h[0], &m_s[0]);
+            GeneralSpeciesThermo::update(T + 2*h, &cp2[0], &m_h[0], &m_s[0]);
+            GeneralSpeciesThermo::update(T + 3*h, &cp3[0], &m_h[0], &m_s[0]);
+            for (size_t k = 0; k < K; k++) {
+                // Derivatives with respect to t = (T - Ta) / dT
+                d[k] = dT * (-2.5*cp1[k] + 4.0*cp2[k] - 1.5*cp3[k]) / h;
+                d[K+k] = dT * (f[k] - f[K+k]) / T;
+                d[2*K+k] = dT * f[k] / T;
+            }
+        }
+
+        // Cubic Hermite polynomial coefficients
+        for (size_t p = 0; p < 3; p++) {
+            doublereal* c = &m_coeffs[(12*i + 4*p) * K];
+            for (size_t k = 0; k < K; k++) {
+                size_t j = p*K + k;
+                doublereal df = f1[j] - f0[j];
+                c[k] = f0[j];
+                c[K+k] = d0[j];
+                c[2*K+k] = 3.0*df - 2.0*d0[j] - d1[j];
+                c[3*K+k] = -2.0*df + d0[j] + d1[j];
+            }
+        }
+    }
+
+    // Find the species with region boundaries inside each interval
+    std::vector<std::vector<size_t> > exact(m_nbins);
+    for (STIT_map::const_iterator iter = m_sp.begin(); iter != m_sp.end(); iter++) {
+        for (size_t n = 0; n < iter->second.size(); n++) {
+            const SpeciesThermoInterpType* sp = iter->second[n];
+            vector_fp bounds;
+            if (const NasaPoly2* nasa = dynamic_cast<const NasaPoly2*>(sp)) {
+                bounds.push_back(nasa->midTemp());
+            } else if (const ShomatePoly2* shomate = dynamic_cast<const ShomatePoly2*>(sp)) {
+                bounds.push_back(shomate->midTemp());
+            } else if (const Nasa9PolyMultiTempRegion* nasa9 =
+                           dynamic_cast<const Nasa9PolyMultiTempRegion*>(sp)) {
+                const vector_fp& lower = nasa9->lowerTempBounds();
+                bounds.assign(lower.begin() + std::min<size_t>(lower.size(), 1),
+                              lower.end());
+            }
+            for (size_t m = 0; m < bounds.size(); m++) {
+                doublereal x = (bounds[m] - m_T0) / dT;
+                if (x <= 0.0 || x >= m_nbins || x == floor(x)) {
+                    continue;
+                }
+                std::vector<size_t>& e = exact[static_cast<size_t>(x)];
+                if (find(e.begin(), e.end(), sp->speciesIndex()) == e.end()) {
+                    e.push_back(sp->speciesIndex());
+                }
+            }
+        }
+    }
+    m_exactStart.assign(1, 0);
+    m_exact.clear();
+    for (size_t i = 0; i < m_nbins; i++) {
+        m_exact.insert(m_exact.end(), exact[i].begin(), exact[i].end());
+        m_exactStart.push_back(m_exact.size());
+    }
+    return true;
+}
+
+doublereal TabulatedSpeciesThermo::tableError() const
+{
+    size_t K = m_nsp;
+    vector_fp cp(K), h(K), s(K);
+    std::vector<char> skip(K, 0);
+    doublereal err = 0.0;
+    for (size_t i = 0; i < m_nbins; i++) {
+        for (size_t p = m_exactStart[i]; p < m_exactStart[i+1]; p++) {
+            skip[m_exact[p]] = 1;
+        }
+        for (size_t n = 1; n < 4; n++) {
+            doublereal t = 0.25 * n;
+            GeneralSpeciesThermo::update(m_T0 + (i + t) * m_dT,
+                                         &m_cp[0], &m_h[0], &m_s[0]);
+            interpolate(i, t, &cp[0], &h[0], &s[0]);
+            for (size_t k = 0; k < K; k++) {
+                if (!skip[k]) {
+                    err = std::max(err, fabs(cp[k] - m_cp[k]));
+                    err = std::max(err, fabs(h[k] - m_h[k]));
+                    err = std::max(err, fabs(s[k] - m_s[k]));
+                }
+            }
+        }
+        for (size_t p = m_exactStart[i]; p < m_exactStart[i+1]; p++) {
+            skip[m_exact[p]] = 0;
+        }
+    }
+    return err;
+}
+
+}
@@ -175,6 +175,45 @@ void ThermoPhase::setState_TPY(doublereal t, doublereal p, const std::string& y)
     setState_TP(t,p);
 }
 
+void ThermoPhase::getPropertiesBatch(size_t nStates, const doublereal* T,
+                                     const doublereal* P, const doublereal* Y,
+                                     doublereal* rho, doublereal* mmw,
+                                     doublereal* cp, doublereal* h,
+                                     doublereal* s, doublereal* h_RT)
+{
+    vector_fp state;
+    saveState(state);
+    vector_fp y(m_kk), hrt(m_kk);
+    for (size_t j = 0; j < nStates; j++) {
+        for (size_t k = 0; k < m_kk; k++) {
+            y[k] = Y[k*nStates + j];
+        }
+        setState_TPY(T[j], P[j], &y[0]);
+        if (rho) {
+            rho[j] = density();
+        }
+        if (mmw) {
+            mmw[j] = meanMolecularWeight();
+        }
+        if (cp) {
+            cp[j] = cp_mass();
+        }
+        if (h) {
+            h[j] = enthalpy_mass();
+        }
+        if (s) {
+            s[j] = entropy_mass();
+        }
+        if (h_RT) {
+            getEnthalpy_RT(&hrt[0]);
+            for (size_t k = 0; k < m_kk; k++) {
+                h_RT[k*nStates + j] = hrt[k];
+            }
+        }
+    }
+    restoreState(state);
+}
+
 void ThermoPhase::setState_TP(doublereal t, doublereal p)
 {
     setTemperature(t);
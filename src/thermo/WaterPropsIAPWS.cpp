@@ -41,7 +41,13 @@ WaterPropsIAPWS::WaterPropsIAPWS() :
     m_phi(0),
     tau(-1.0),
     delta(-1.0),
-    iState(-30000)
+    iState(-30000),
+    m_tabTmin(0.0),
+    m_tabDT(0.0),
+    m_tabLnPmin(0.0),
+    m_tabDlnP(0.0),
+    m_tabNT(0),
+    m_tabNP(0)
 {
     m_phi = new WaterPropsIAPWSphi();
 }
@@ -50,10 +56,20 @@ WaterPropsIAPWS::WaterPropsIAPWS(const WaterPropsIAPWS& b) :
     m_phi(0),
     tau(b.tau),
     delta(b.delta),
-    iState(b.iState)
+    iState(b.iState),
+    m_tabTmin(b.m_tabTmin),
+    m_tabDT(b.m_tabDT),
+    m_tabLnPmin(b.m_tabLnPmin),
+    m_tabDlnP(b.m_tabDlnP),
+    m_tabNT(b.m_tabNT),
+    m_tabNP(b.m_tabNP)
 {
     m_phi = new WaterPropsIAPWSphi();
     m_phi->tdpolycalc(tau, delta);
+    for (int i = 0; i < 2; i++) {
+        m_tabRho[i] = b.m_tabRho[i];
+        m_tabValid[i] = b.m_tabValid[i];
+    }
 }
 
 WaterPropsIAPWS& WaterPropsIAPWS::operator=(const WaterPropsIAPWS& b)
@@ -65,6 +81,16 @@ WaterPropsIAPWS& WaterPropsIAPWS::operator=(const WaterPropsIAPWS& b)
     delta = b.delta;
     iState = b.iState;
     m_phi->tdpolycalc(tau, delta);
+    m_tabTmin = b.m_tabTmin;
+    m_tabDT = b.m_tabDT;
+    m_tabLnPmin = b.m_tabLnPmin;
+    m_tabDlnP = b.m_tabDlnP;
+    m_tabNT = b.m_tabNT;
+    m_tabNP = b.m_tabNP;
+    for (int i = 0; i < 2; i++) {
+        m_tabRho[i] = b.m_tabRho[i];
+        m_tabValid[i] = b.m_tabValid[i];
+    }
     return *this;
 }
 
@@ -111,39 +137,71 @@ doublereal  WaterPropsIAPWS::pressure() const
 doublereal WaterPropsIAPWS::density(doublereal temperature, doublereal pressure,
                                     int phase, doublereal rhoguess)
 {
-    doublereal deltaGuess = 0.0;
+    bool stablePhase = (phase == -1 || phase == WATER_LIQUID ||
+                        phase == WATER_GAS || phase == WATER_SUPERCRIT);
+    if (stablePhase && hasDensityTable()) {
+        int branch = 1;
+        if (phase == WATER_LIQUID || (phase == -1 && rhoguess > Rho_c)) {
+            branch = 0;
+        }
+        doublereal rho = tableDensity(temperature, pressure, branch);
+        if (rho > 0.0) {
+            rho = newtonDensity(temperature, pressure, rho);
+            if (rho > 0.0) {
+                return rho;
+            }
+        }
+    }
     if (rhoguess == -1.0) {
-        if (phase != -1) {
-            if (temperature > T_c) {
-                rhoguess = pressure * M_water / (Rgas * temperature);
-            } else {
-                if (phase == WATER_GAS || phase == WATER_SUPERCRIT) {
-                    rhoguess = pressure * M_water / (Rgas * temperature);
-                } else if (phase == WATER_LIQUID) {
-                    /*
-                     * Provide a guess about the liquid density that is
-                     * relatively high -> convergence from above seems robust.
-                     */
-                    rhoguess = 1000.;
-                } else if (phase == WATER_UNSTABLELIQUID || phase == WATER_UNSTABLEGAS) {
-                    throw Cantera::CanteraError("WaterPropsIAPWS::density",
-                                                "Unstable Branch finder is untested");
-                } else {
-                    throw Cantera::CanteraError("WaterPropsIAPWS::density",
-                                                "unknown state: " + Cantera::int2str(phase));
-                }
+        /*
+         * For small changes from the current state, start from the density
+         * extrapolated from it
+         */
+        doublereal rho = -1.0;
+        if (stablePhase) {
+            rho = warmStartDensity(temperature, pressure, phase);
+        }
+        if (rho > 0.0) {
+            rho = newtonDensity(temperature, pressure, rho);
+            if (rho > 0.0) {
+                return rho;
             }
-        } else {
+        }
+        rhoguess = densityGuess(temperature, pressure, phase);
+    }
+    return solveDensity(temperature, pressure, rhoguess);
+}
+
+doublereal WaterPropsIAPWS::densityGuess(doublereal temperature,
+        doublereal pressure, int phase) const
+{
+    if (phase != -1 && temperature <= T_c) {
+        if (phase == WATER_LIQUID) {
             /*
-             * Assume the Gas phase initial guess, if nothing is
-             * specified to the routine
+             * Provide a guess about the liquid density that is
+             * relatively high -> convergence from above seems robust.
              */
-            rhoguess = pressure * M_water / (Rgas * temperature);
+            return 1000.;
+        } else if (phase == WATER_UNSTABLELIQUID || phase == WATER_UNSTABLEGAS) {
+            throw Cantera::CanteraError("WaterPropsIAPWS::density",
+                                        "Unstable Branch finder is untested");
+        } else if (phase != WATER_GAS && phase != WATER_SUPERCRIT) {
+            throw Cantera::CanteraError("WaterPropsIAPWS::density",
+                                        "unknown state: " + Cantera::int2str(phase));
         }
-
     }
+    /*
+     * Assume the Gas phase initial guess, if nothing is
+     * specified to the routine
+     */
+    return pressure * M_water / (Rgas * temperature);
+}
+
+doublereal WaterPropsIAPWS::solveDensity(doublereal temperature,
+        doublereal pressure, doublereal rhoguess)
+{
     doublereal p_red = pressure * M_water / (Rgas * temperature * Rho_c);
-    deltaGuess = rhoguess / Rho_c;
+    doublereal deltaGuess = rhoguess / Rho_c;
     setState_TR(temperature, rhoguess);
     doublereal delta_retn = m_phi->dfind(p_red, tau, deltaGuess);
     doublereal density_retn;
@@ -167,6 +225,261 @@ doublereal WaterPropsIAPWS::density(doublereal temperature, doublereal pressure,
     return density_retn;
 }
 
+doublereal WaterPropsIAPWS::newtonDensity(doublereal temperature,
+        doublereal pressure, doublereal rhoguess)
+{
+    doublereal tau_n = T_c / temperature;
+    doublereal p_red = pressure * M_water / (Rgas * temperature * Rho_c);
+    doublereal pcheck = 1.0E-30 + 1.0E-8 * p_red;
+    doublereal dd = rhoguess / Rho_c;
+    for (int n = 0; n < 6; n++) {
+        doublereal pred = dd * m_phi->pressureM_rhoRT(tau_n, dd);
+        if (fabs(pred - p_red) < pcheck) {
+            if (temperature < T_c && (dd > 1.0) != (rhoguess > Rho_c)) {
+                break;
+            }
+            setState_TR(temperature, dd * Rho_c);
+            return dd * Rho_c;
+        }
+        doublereal dpdd = m_phi->dimdpdrho(tau_n, dd);
+        if (dpdd <= 0.0) {
+            break;
+        }
+        dd -= (pred - p_red) / dpdd;
+        if (dd <= 0.0) {
+            break;
+        }
+    }
+    // Restore the polynomials of the current state
+    m_phi->tdpolycalc(tau, delta);
+    return -1.0;
+}
+
+doublereal WaterPropsIAPWS::warmStartDensity(doublereal temperature,
+        doublereal pressure, int phase) const
+{
+    if (tau <= 0.0 || delta <= 0.0) {
+        return -1.0;
+    }
+    doublereal T0 = T_c / tau;
+    if (fabs(temperature - T0) > 0.05 * T0) {
+        return -1.0;
+    }
+    // The current state has to be on the requested branch
+    bool liquid = (phase == WATER_LIQUID);
+    if ((temperature < T_c || T0 < T_c) && liquid != (delta > 1.0)) {
+        return -1.0;
+    }
+    doublereal dpdrho_val = dpdrho();
+    if (dpdrho_val <= 0.0) {
+        return -1.0;
+    }
+    doublereal rho0 = delta * Rho_c;
+    doublereal dpdT = coeffPresExp() * rho0 * Rgas / M_water;
+    doublereal rho = rho0 + (pressure - this->pressure()
+                             - dpdT * (temperature - T0)) / dpdrho_val;
+    if (rho <= 0.0 || (temperature < T_c && liquid != (rho > Rho_c))) {
+        return -1.0;
+    }
+    return rho;
+}
+
+void WaterPropsIAPWS::buildDensityTable(doublereal Tmin, doublereal Tmax,
+                                        doublereal Pmin, doublereal Pmax,
+                                        size_t nT, size_t nP, doublereal rtol)
+{
+    if (Tmin <= 0.0 || Tmax <= Tmin || Pmin <= 0.0 || Pmax <= Pmin) {
+        throw CanteraError("WaterPropsIAPWS::buildDensityTable",
+                           "Invalid temperature or pressure range");
+    }
+    if (nT == 0 || nP == 0) {
+        throw CanteraError("WaterPropsIAPWS::buildDensityTable",
+                           "The table needs at least one interval in each direction");
+    }
+    clearDensityTable();
+    doublereal tauSave = tau;
+    doublereal deltaSave = delta;
+    int iStateSave = iState;
+
+    doublereal Tlow = Tmin;
+    doublereal dT = (Tmax - Tmin) / nT;
+    doublereal lnPlow = log(Pmin);
+    doublereal dlnP = (log(Pmax) - lnPlow) / nP;
+    vector_fp table[2];
+    std::vector<int> valid[2];
+    for (int b = 0; b < 2; b++) {
+        vector_fp& f = table[b];
+        f.resize(4 * (nT + 1) * (nP + 1));
+        std::vector<int> nodeOK((nT + 1) * (nP + 1), 0);
+        for (size_t i = 0; i <= nT; i++) {
+            for (size_t j = 0; j <= nP; j++) {
+                size_t n = i * (nP + 1) + j;
+                nodeOK[n] = tableNode(Tlow + i * dT, exp(lnPlow + j * dlnP),
+                                      b, &f[4*n]);
+                // Scale the derivatives to the cell size
+                f[4*n+1] *= dT;
+                f[4*n+2] *= dlnP;
+                f[4*n+3] *= dT * dlnP;
+            }
+        }
+        valid[b].assign(nT * nP, 0);
+        for (size_t i = 0; i < nT; i++) {
+            for (size_t j = 0; j < nP; j++) {
+                size_t n = i * (nP + 1) + j;
+                if (!nodeOK[n] || !nodeOK[n+1] || !nodeOK[n+nP+1] ||
+                        !nodeOK[n+nP+2]) {
+                    continue;
+                }
+                // Compare the interpolant to the full calculation at the
+                // center of the cell
+                doublereal fc[4];
+                doublereal Tc = Tlow + (i + 0.5) * dT;
+                doublereal Pc = exp(lnPlow + (j + 0.5) * dlnP);
+                if (!tableNode(Tc, Pc, b, fc)) {
+                    continue;
+                }
+                // Hermite basis functions at the midpoint are 1/2 for the
+                // values and +/- 1/8 for the derivatives
+                const doublereal* f00 = &f[4*n];
+                const doublereal* f01 = &f[4*(n+1)];
+                const doublereal* f10 = &f[4*(n+nP+1)];
+                const doublereal* f11 = &f[4*(n+nP+2)];
+                doublereal interp = 0.0;
+                const doublereal w[2] = {0.5, 0.125};
+                const doublereal* corner[4] = {f00, f01, f10, f11};
+                for (int c = 0; c < 4; c++) {
+                    doublereal sT = (c < 2) ? 1.0 : -1.0;
+                    doublereal sP = (c % 2 == 0) ? 1.0 : -1.0;
+                    const doublereal* fk = corner[c];
+                    interp += w[0] * w[0] * fk[0] + sT * w[1] * w[0] * fk[1]
+                              + sP * w[0] * w[1] * fk[2]
+                              + sT * sP * w[1] * w[1] * fk[3];
+                }
+                if (fabs(interp - fc[0]) <= rtol) {
+                    valid[b][i * nP + j] = 1;
+                }
+            }
+        }
+    }
+
+    tau = tauSave;
+    delta = deltaSave;
+    iState = iStateSave;
+    m_phi->tdpolycalc(tau, delta);
+
+    m_tabTmin = Tlow;
+    m_tabDT = dT;
+    m_tabLnPmin = lnPlow;
+    m_tabDlnP = dlnP;
+    m_tabNT = nT;
+    m_tabNP = nP;
+    for (int b = 0; b < 2; b++) {
+        m_tabRho[b].swap(table[b]);
+        m_tabValid[b].swap(valid[b]);
+    }
+}
+
+void WaterPropsIAPWS::clearDensityTable()
+{
+    for (int b = 0; b < 2; b++) {
+        m_tabRho[b].clear();
+        m_tabValid[b].clear();
+    }
+    m_tabNT = 0;
+    m_tabNP = 0;
+}
+
+doublereal WaterPropsIAPWS::densityTableCoverage(int phase) const
+{
+    if (!hasDensityTable()) {
+        return 0.0;
+    }
+    const std::vector<int>& valid = m_tabValid[phase == WATER_LIQUID ? 0 : 1];
+    size_t nValid = 0;
+    for (size_t n = 0; n < valid.size(); n++) {
+        nValid += valid[n];
+    }
+    return static_cast<doublereal>(nValid) / valid.size();
+}
+
+bool WaterPropsIAPWS::tableNode(doublereal temperature, doublereal pressure,
+                                int branch, doublereal* f)
+{
+    f[0] = f[1] = f[2] = f[3] = 0.0;
+    int phase = (branch == 0) ? WATER_LIQUID : WATER_GAS;
+    doublereal rho = solveDensity(temperature, pressure,
+                                  densityGuess(temperature, pressure, phase));
+    if (rho <= 0.0 || (temperature < T_c && (branch == 0) != (rho > Rho_c))) {
+        return false;
+    }
+    doublereal dpdrho_val = dpdrho();
+    if (dpdrho_val <= 0.0) {
+        return false;
+    }
+    // d(ln rho)/dT at constant P, and d(ln rho)/d(ln P) at constant T
+    doublereal dpdT = coeffPresExp() * rho * Rgas / M_water;
+    f[0] = log(rho);
+    f[1] = - dpdT / (rho * dpdrho_val);
+    f[2] = pressure / (rho * dpdrho_val);
+
+    // Cross derivative from central differences of d(ln rho)/d(ln P)
+    doublereal h = 1.0E-4 * temperature;
+    doublereal fp[2];
+    for (int k = 0; k < 2; k++) {
+        doublereal Tk = temperature + (k == 0 ? h : -h);
+        doublereal rhok = newtonDensity(Tk, pressure,
+                                        rho * (1.0 + f[1] * (Tk - temperature)));
+        if (rhok <= 0.0) {
+            rhok = solveDensity(Tk, pressure, rho);
+        }
+        if (rhok <= 0.0 || (Tk < T_c && (branch == 0) != (rhok > Rho_c))) {
+            return false;
+        }
+        doublereal dpdrho_k = dpdrho();
+        if (dpdrho_k <= 0.0) {
+            return false;
+        }
+        fp[k] = pressure / (rhok * dpdrho_k);
+    }
+    f[3] = (fp[0] - fp[1]) / (2.0 * h);
+    return true;
+}
+
+doublereal WaterPropsIAPWS::tableDensity(doublereal temperature,
+        doublereal pressure, int branch) const
+{
+    doublereal x = (temperature - m_tabTmin) / m_tabDT;
+    doublereal y = (log(pressure) - m_tabLnPmin) / m_tabDlnP;
+    if (!(x >= 0.0 && x <= m_tabNT && y >= 0.0 && y <= m_tabNP)) {
+        return -1.0;
+    }
+    size_t i = std::min(static_cast<size_t>(x), m_tabNT - 1);
+    size_t j = std::min(static_cast<size_t>(y), m_tabNP - 1);
+    if (!m_tabValid[branch][i * m_tabNP + j]) {
+        return -1.0;
+    }
+    doublereal u = x - i;
+    doublereal v = y - j;
+    // Cubic Hermite basis functions for the values (h0, h1) and for the
+    // scaled derivatives (g0, g1) at each end of the interval
+    doublereal hu[2] = {(1.0 + 2.0 * u) * (1.0 - u) * (1.0 - u),
+                        u * u * (3.0 - 2.0 * u)};
+    doublereal gu[2] = {u * (1.0 - u) * (1.0 - u), - u * u * (1.0 - u)};
+    doublereal hv[2] = {(1.0 + 2.0 * v) * (1.0 - v) * (1.0 - v),
+                        v * v * (3.0 - 2.0 * v)};
+    doublereal gv[2] = {v * (1.0 - v) * (1.0 - v), - v * v * (1.0 - v)};
+    const vector_fp& f = m_tabRho[branch];
+    doublereal lnrho = 0.0;
+    for (int a = 0; a < 2; a++) {
+        for (int b = 0; b < 2; b++) {
+            const doublereal* fk = &f[4 * ((i + a) * (m_tabNP + 1) + j + b)];
+            lnrho += hu[a] * hv[b] * fk[0] + gu[a] * hv[b] * fk[1]
+                     + hu[a] * gv[b] * fk[2] + gu[a] * gv[b] * fk[3];
+        }
+    }
+    return exp(lnrho);
+}
+
 doublereal WaterPropsIAPWS::density_const(doublereal pressure,
         int phase, doublereal rhoguess) const
 {
@@ -174,34 +487,7 @@ doublereal WaterPropsIAPWS::density_const(doublereal pressure,
     doublereal deltaGuess = 0.0;
     doublereal deltaSave = delta;
     if (rhoguess == -1.0) {
-        if (phase != -1) {
-            if (temperature > T_c) {
-                rhoguess = pressure * M_water / (Rgas * temperature);
-            } else {
-                if (phase == WATER_GAS || phase == WATER_SUPERCRIT) {
-                    rhoguess = pressure * M_water / (Rgas * temperature);
-                } else if (phase == WATER_LIQUID) {
-                    /*
-                     * Provide a guess about the liquid density that is
-                     * relatively high -> convergence from above seems robust.
-                     */
-                    rhoguess = 1000.;
-                } else if (phase == WATER_UNSTABLELIQUID || phase == WATER_UNSTABLEGAS) {
-                    throw Cantera::CanteraError("WaterPropsIAPWS::density",
-                                                "Unstable Branch finder is untested");
-                } else {
-                    throw Cantera::CanteraError("WaterPropsIAPWS::density",
-                                                "unknown state: " + Cantera::int2str(phase));
-                }
-            }
-        } else {
-            /*
-             * Assume the Gas phase initial guess, if nothing is
-             * specified to the routine
-             */
-            rhoguess = pressure * M_water / (Rgas * temperature);
-        }
-
+        rhoguess = densityGuess(temperature, pressure, phase);
     }
     doublereal p_red = pressure * M_water / (Rgas * temperature * Rho_c);
     deltaGuess = rhoguess / Rho_c;
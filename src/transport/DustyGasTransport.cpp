@@ -18,9 +18,12 @@ namespace Cantera
 DustyGasTransport::DustyGasTransport(thermo_t* thermo) :
     Transport(thermo),
     m_temp(-1.0),
+    m_press(-1.0),
     m_gradP(0.0),
     m_knudsen_ok(false),
     m_bulk_ok(false),
+    m_hmatrix_ok(false),
+    m_multidiff_ok(false),
     m_porosity(0.0),
     m_tortuosity(1.0),
     m_pore_radius(0.0),
@@ -32,9 +35,12 @@ DustyGasTransport::DustyGasTransport(thermo_t* thermo) :
 
 DustyGasTransport::DustyGasTransport(const DustyGasTransport& right) :
     m_temp(-1.0),
+    m_press(-1.0),
     m_gradP(0.0),
     m_knudsen_ok(false),
     m_bulk_ok(false),
+    m_hmatrix_ok(false),
+    m_multidiff_ok(false),
     m_porosity(0.0),
     m_tortuosity(1.0),
     m_pore_radius(0.0),
@@ -57,12 +63,17 @@ DustyGasTransport& DustyGasTransport::operator=(const  DustyGasTransport& right)
     m_x = right.m_x;
     m_dk = right.m_dk;
     m_temp = right.m_temp;
+    m_press = right.m_press;
+    m_hmatrix = right.m_hmatrix;
     m_multidiff = right.m_multidiff;
     m_spwork = right.m_spwork;
     m_spwork2 = right.m_spwork2;
+    m_spwork3 = right.m_spwork3;
     m_gradP = right.m_gradP;
     m_knudsen_ok = right.m_knudsen_ok;
     m_bulk_ok= right.m_bulk_ok;
+    m_hmatrix_ok = right.m_hmatrix_ok;
+    m_multidiff_ok = right.m_multidiff_ok;
     m_porosity = right.m_porosity;
     m_tortuosity = right.m_tortuosity;
     m_pore_radius = right.m_pore_radius;
@@ -135,6 +146,7 @@ void DustyGasTransport::initialize(ThermoPhase* phase, Transport* gastr)
     m_mw.resize(m_nsp);
     copy(m_thermo->molecularWeights().begin(),  m_thermo->molecularWeights().end(), m_mw.begin());
 
+    m_hmatrix.resize(m_nsp, m_nsp);
     m_multidiff.resize(m_nsp, m_nsp);
     m_d.resize(m_nsp, m_nsp);
     m_dk.resize(m_nsp, 0.0);
@@ -145,9 +157,14 @@ void DustyGasTransport::initialize(ThermoPhase* phase, Transport* gastr)
     // set flags all false
     m_knudsen_ok = false;
     m_bulk_ok = false;
+    m_hmatrix_ok = false;
+    m_multidiff_ok = false;
+    m_temp = -1.0;
+    m_press = -1.0;
 
     m_spwork.resize(m_nsp);
     m_spwork2.resize(m_nsp);
+    m_spwork3.resize(m_nsp);
 }
 
 void DustyGasTransport::updateBinaryDiffCoeffs()
@@ -190,7 +207,7 @@ void DustyGasTransport::eval_H_matrix()
 
         // evaluate off-diagonal terms
         for (size_t l = 0; l < m_nsp; l++) {
-            m_multidiff(k,l) = -m_x[k]/m_d(k,l);
+            m_hmatrix(k,l) = -m_x[k]/m_d(k,l);
         }
 
         // evaluate diagonal term
@@ -200,7 +217,7 @@ void DustyGasTransport::eval_H_matrix()
                 sum += m_x[j]/m_d(k,j);
             }
         }
-        m_multidiff(k,k) = 1.0/m_dk[k] + sum;
+        m_hmatrix(k,k) = 1.0/m_dk[k] + sum;
     }
 }
 
@@ -240,12 +257,7 @@ void DustyGasTransport::getMolarFluxes(const doublereal* const state1,
 
     m_thermo->setState_TPX(tbar, pbar, cbar);
 
-    updateMultiDiffCoeffs();
-
-    // Multiply m_multidiff and gradc together and store the result in fluxes[]
-    multiply(m_multidiff, gradc, fluxes);
-
-    divide_each(cbar, cbar + m_nsp, m_dk.begin());
+    updateHMatrix();
 
     // if no permeability has been specified, use result for
     // close-packed spheres
@@ -259,30 +271,65 @@ void DustyGasTransport::getMolarFluxes(const doublereal* const state1,
         b = m_perm;
     }
     b *= gradp / m_gastran->viscosity();
-    scale(cbar, cbar + m_nsp, cbar, b);
 
-    // Multiply m_multidiff with cbar and add it to fluxes
-    increment(m_multidiff, cbar, fluxes);
-    scale(fluxes, fluxes + m_nsp, fluxes, -1.0);
+    // Solve H * fluxes = -(gradc + b * cbar / Dknud) with the factored H
+    for (size_t k = 0; k < m_nsp; k++) {
+        fluxes[k] = -(gradc[k] + b * cbar[k] / m_dk[k]);
+    }
+    m_hmatrix.solve(fluxes);
 }
 
-void DustyGasTransport::updateMultiDiffCoeffs()
+void DustyGasTransport::getMolarFluxes(size_t npoints,
+                                       const doublereal* const states1,
+                                       const doublereal* const states2,
+                                       const doublereal* const delta,
+                                       doublereal* const fluxes)
+{
+    size_t nstate = m_nsp + 2;
+    vector_fp state0;
+    m_thermo->saveState(state0);
+    for (size_t n = 0; n < npoints; n++) {
+        getMolarFluxes(states1 + n*nstate, states2 + n*nstate, delta[n],
+                       fluxes + n*m_nsp);
+    }
+    m_thermo->restoreState(state0);
+}
+
+void DustyGasTransport::updateHMatrix()
 {
     // see if temperature has changed
     updateTransport_T();
 
-    // update the mole fractions
+    // update the mole fractions and pressure
     updateTransport_C();
 
+    if (m_hmatrix_ok && m_knudsen_ok && m_bulk_ok) {
+        return;
+    }
     eval_H_matrix();
+    m_hmatrix.factor();
+    m_hmatrix_ok = true;
+    m_multidiff_ok = false;
+}
 
-    // invert H
-    int ierr = invert(m_multidiff);
+void DustyGasTransport::updateMultiDiffCoeffs()
+{
+    updateHMatrix();
+    if (m_multidiff_ok) {
+        return;
+    }
 
+    // invert H using its LU factorization
+    m_multidiff.zero();
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_multidiff(k,k) = 1.0;
+    }
+    int ierr = m_hmatrix.solve(m_multidiff.ptrColumn(0), m_nsp, m_nsp);
     if (ierr != 0) {
         throw CanteraError("DustyGasTransport::updateMultiDiffCoeffs",
-                           "invert returned ierr = "+int2str(ierr));
+                           "solve returned ierr = "+int2str(ierr));
     }
+    m_multidiff_ok = true;
 }
 
 void DustyGasTransport::getMultiDiffCoeffs(const size_t ld, doublereal* const d)
@@ -307,15 +354,24 @@ void DustyGasTransport::updateTransport_T()
 
 void DustyGasTransport::updateTransport_C()
 {
-    m_thermo->getMoleFractions(DATA_PTR(m_x));
+    m_thermo->getMoleFractions(DATA_PTR(m_spwork3));
 
     // add an offset to avoid a pure species condition
     // (check - this may be unnecessary)
     for (size_t k = 0; k < m_nsp; k++) {
-        m_x[k] = std::max(Tiny, m_x[k]);
+        doublereal x = std::max(Tiny, m_spwork3[k]);
+        if (x != m_x[k]) {
+            m_x[k] = x;
+            m_hmatrix_ok = false;
+        }
     }
+
     // diffusion coeffs depend on Pressure
-    m_bulk_ok = false;
+    doublereal p = m_thermo->pressure();
+    if (p != m_press) {
+        m_press = p;
+        m_bulk_ok = false;
+    }
 }
 
 void DustyGasTransport::setPorosity(doublereal porosity)
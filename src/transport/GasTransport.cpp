@@ -4,6 +4,23 @@
 #include "cantera/base/stringUtils.h"
 #include "cantera/numerics/polyfit.h"
 #include "cantera/transport/TransportData.h"
+#include "cantera/base/ct_thread.h"
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#ifdef THREAD_SAFE_CANTERA
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+#endif
 
 namespace Cantera
 {
@@ -12,6 +29,33 @@ namespace Cantera
 //! except in CK mode, where the degree is 6.
 #define COLL_INT_POLY_DEGREE 8
 
+//! number of temperatures used to generate the data for the property fits
+const size_t FitPoints = 50;
+
+//! minimum number of binary diffusion coefficient fits done by each thread
+const size_t MinFitsPerThread = 256;
+
+//! identifies files written by GasTransport::writeFitCache
+const char FitCacheMagic[8] = {'C', 'T', 'F', 'I', 'T', 'S', '\0', '\0'};
+
+//! version of the fits and the format of the cache files. Included in the
+//! inputs compared by GasTransport::readFitCache.
+const double FitCacheVersion = 1.0;
+
+static mutex_t fit_cache_mutex;
+static std::string fit_cache_dir;
+
+//! number of cache files written by this process, used to give each
+//! temporary file a unique name
+static int fit_cache_count = 0;
+
+typedef std::map<vector_fp, weak_ptr<const GasTransportFits> > fit_registry;
+
+//! Fits used by the transport managers in this process, indexed by the
+//! inputs to the fits. An entry expires when the last transport manager
+//! using the fits is deleted. Protected by #fit_cache_mutex.
+static fit_registry shared_fits;
+
 GasTransport::GasTransport(ThermoPhase* thermo) :
     Transport(thermo),
     m_viscmix(0.0),
@@ -28,11 +72,14 @@ GasTransport::GasTransport(ThermoPhase* thermo) :
     m_logt(0.0),
     m_t14(0.0),
     m_t32(0.0),
+    m_bdiff_gen(0),
+    m_trace_threshold(0.0),
     m_log_level(0)
 {
 }
 
 GasTransport::GasTransport(const GasTransport& right) :
+    Transport(right),
     m_viscmix(0.0),
     m_visc_ok(false),
     m_viscwt_ok(false),
@@ -47,6 +94,8 @@ GasTransport::GasTransport(const GasTransport& right) :
     m_logt(0.0),
     m_t14(0.0),
     m_t32(0.0),
+    m_bdiff_gen(0),
+    m_trace_threshold(0.0),
     m_log_level(0)
 {
 }
@@ -75,9 +124,16 @@ GasTransport& GasTransport::operator=(const GasTransport& right)
     m_logt = right.m_logt;
     m_t14 = right.m_t14;
     m_t32 = right.m_t32;
-    m_diffcoeffs = right.m_diffcoeffs;
-    m_bdiff = right.m_bdiff;
-    m_condcoeffs = right.m_condcoeffs;
+    m_fits = right.m_fits;
+    m_bdiff_packed = right.m_bdiff_packed;
+    m_bdiff_inv_packed = right.m_bdiff_inv_packed;
+    m_bdiff_gen = right.m_bdiff_gen;
+    m_bdiff_row_gen = right.m_bdiff_row_gen;
+    m_trace_threshold = right.m_trace_threshold;
+    m_fitCacheFile = right.m_fitCacheFile;
+    m_major = right.m_major;
+    m_phi_wrat = right.m_phi_wrat;
+    m_phi_scale = right.m_phi_scale;
     m_poly = right.m_poly;
     m_omega22_poly = right.m_omega22_poly;
     m_astar_poly = right.m_astar_poly;
@@ -126,6 +182,7 @@ void GasTransport::update_T(void)
     m_spvisc_ok = false;
     m_viscwt_ok = false;
     m_bindiff_ok = false;
+    m_bdiff_gen++;
 }
 
 doublereal GasTransport::viscosity()
@@ -136,7 +193,11 @@ doublereal GasTransport::viscosity()
     if (m_visc_ok) {
         return m_viscmix;
     }
+    return evalMixViscosity();
+}
 
+doublereal GasTransport::evalMixViscosity()
+{
     doublereal vismix = 0.0;
     // update m_visc and m_phi if necessary
     if (!m_viscwt_ok) {
@@ -154,22 +215,20 @@ doublereal GasTransport::viscosity()
 
 void GasTransport::updateViscosity_T()
 {
-    doublereal vratiokj, wratiojk, factor1;
-
     if (!m_spvisc_ok) {
         updateSpeciesViscosities();
     }
 
-    // see Eq. (9-5.15) of Reid, Prausnitz, and Poling
+    // see Eq. (9-5.15) of Reid, Prausnitz, and Poling. Each column of m_phi
+    // is filled in a single loop over k.
     for (size_t j = 0; j < m_nsp; j++) {
-        for (size_t k = j; k < m_nsp; k++) {
-            vratiokj = m_visc[k]/m_visc[j];
-            wratiojk = m_mw[j]/m_mw[k];
-
-            // Note that m_wratjk(k,j) holds the square root of m_wratjk(j,k)!
-            factor1 = 1.0 + (m_sqvisc[k]/m_sqvisc[j]) * m_wratjk(k,j);
-            m_phi(k,j) = factor1*factor1 / (sqrt(8.0) * m_wratkj1(j,k));
-            m_phi(j,k) = m_phi(k,j)/(vratiokj * wratiojk);
+        doublereal rsqvisc = 1.0 / m_sqvisc[j];
+        doublereal* phi = &m_phi(0,j);
+        const doublereal* wrat = &m_phi_wrat(0,j);
+        const doublereal* scale = &m_phi_scale(0,j);
+        for (size_t k = 0; k < m_nsp; k++) {
+            doublereal factor1 = 1.0 + m_sqvisc[k] * rsqvisc * wrat[k];
+            phi[k] = factor1 * factor1 * scale[k];
         }
     }
     m_viscwt_ok = true;
@@ -179,14 +238,16 @@ void GasTransport::updateSpeciesViscosities()
 {
     update_T();
     if (m_mode == CK_Mode) {
+        evalFits(m_fits->visccoeffs_cm, m_nsp, &m_visc[0]);
         for (size_t k = 0; k < m_nsp; k++) {
-            m_visc[k] = exp(dot4(m_polytempvec, m_visccoeffs[k]));
+            m_visc[k] = exp(m_visc[k]);
             m_sqvisc[k] = sqrt(m_visc[k]);
         }
     } else {
+        // the polynomial fit is done for sqrt(visc/sqrt(T))
+        evalFits(m_fits->visccoeffs_cm, m_nsp, &m_sqvisc[0]);
         for (size_t k = 0; k < m_nsp; k++) {
-            // the polynomial fit is done for sqrt(visc/sqrt(T))
-            m_sqvisc[k] = m_t14 * dot5(m_polytempvec, m_visccoeffs[k]);
+            m_sqvisc[k] *= m_t14;
             m_visc[k] = (m_sqvisc[k] * m_sqvisc[k]);
         }
     }
@@ -197,26 +258,127 @@ void GasTransport::updateDiff_T()
 {
     update_T();
     // evaluate binary diffusion coefficients at unit pressure
-    size_t ic = 0;
-    if (m_mode == CK_Mode) {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = exp(dot4(m_polytempvec, m_diffcoeffs[ic]));
-                m_bdiff(j,i) = m_bdiff(i,j);
-                ic++;
+    evalBinDiff(0, m_bdiff_packed.size());
+    m_bdiff_row_gen.assign(m_nsp, m_bdiff_gen);
+    m_bindiff_ok = true;
+}
+
+void GasTransport::updateDiffMix()
+{
+    update_T();
+    if (m_bindiff_ok) {
+        return;
+    } else if (m_trace_threshold <= 0.0) {
+        updateDiff_T();
+        return;
+    }
+    for (size_t k = 0; k < m_nsp; k++) {
+        if (m_molefracs[k] < m_trace_threshold ||
+            m_bdiff_row_gen[k] == m_bdiff_gen) {
+            continue;
+        }
+        // pairs (j,k) with j < k, unless already evaluated for species j
+        for (size_t j = 0; j < k; j++) {
+            if (m_bdiff_row_gen[j] != m_bdiff_gen) {
+                size_t ic = pairIndex(j, k);
+                evalBinDiff(ic, ic + 1);
             }
         }
+        // pairs (k,j) with j >= k are contiguous
+        evalBinDiff(pairIndex(k, k), pairIndex(k, m_nsp - 1) + 1);
+        m_bdiff_row_gen[k] = m_bdiff_gen;
+    }
+}
+
+void GasTransport::evalBinDiff(size_t begin, size_t end)
+{
+    size_t npairs = m_bdiff_packed.size();
+    evalFits(m_fits->diffcoeffs_cm, npairs, &m_bdiff_packed[0], begin, end);
+    if (m_mode == CK_Mode) {
+        for (size_t ic = begin; ic < end; ic++) {
+            m_bdiff_packed[ic] = exp(m_bdiff_packed[ic]);
+            m_bdiff_inv_packed[ic] = 1.0 / m_bdiff_packed[ic];
+        }
     } else {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = m_temp * m_sqrt_t*dot5(m_polytempvec,
-                                                      m_diffcoeffs[ic]);
-                m_bdiff(j,i) = m_bdiff(i,j);
-                ic++;
-            }
+        doublereal pre = m_temp * m_sqrt_t;
+        for (size_t ic = begin; ic < end; ic++) {
+            m_bdiff_packed[ic] *= pre;
+            m_bdiff_inv_packed[ic] = 1.0 / m_bdiff_packed[ic];
         }
     }
-    m_bindiff_ok = true;
+}
+
+void GasTransport::setTraceThreshold(doublereal xtrace)
+{
+    if (xtrace < 0.0 || xtrace >= 1.0) {
+        throw CanteraError("GasTransport::setTraceThreshold",
+                           "threshold must be in [0, 1)");
+    }
+    m_trace_threshold = xtrace;
+}
+
+void GasTransport::evalFits(const vector_fp& coeffs, size_t m,
+                            doublereal* out, size_t begin, size_t end) const
+{
+    end = std::min(end, m);
+    size_t ncoeffs = coeffs.size() / std::max<size_t>(m, 1);
+    const doublereal* c = &coeffs[0];
+    for (size_t k = begin; k < end; k++) {
+        out[k] = c[k];
+    }
+    for (size_t n = 1; n < ncoeffs; n++) {
+        doublereal tn = m_polytempvec[n];
+        const doublereal* cn = c + n*m;
+        for (size_t k = begin; k < end; k++) {
+            out[k] += cn[k] * tn;
+        }
+    }
+}
+
+void GasTransport::packFitCoeffs(GasTransportFits& fits) const
+{
+    size_t npairs = fits.diffcoeffs.size();
+    size_t ncoeffs = (m_mode == CK_Mode ? 4 : 5);
+    fits.visccoeffs_cm.resize(ncoeffs * m_nsp);
+    fits.condcoeffs_cm.resize(ncoeffs * m_nsp);
+    fits.diffcoeffs_cm.resize(ncoeffs * npairs);
+    for (size_t n = 0; n < ncoeffs; n++) {
+        for (size_t k = 0; k < m_nsp; k++) {
+            fits.visccoeffs_cm[n*m_nsp + k] = fits.visccoeffs[k][n];
+            fits.condcoeffs_cm[n*m_nsp + k] = fits.condcoeffs[k][n];
+        }
+        for (size_t ic = 0; ic < npairs; ic++) {
+            fits.diffcoeffs_cm[n*npairs + ic] = fits.diffcoeffs[ic][n];
+        }
+    }
+}
+
+void GasTransport::getViscosityPolynomial(size_t i, doublereal* coeffs) const
+{
+    checkSpeciesIndex(i);
+    const vector_fp& c = m_fits->visccoeffs[i];
+    std::copy(c.begin(), c.end(), coeffs);
+}
+
+void GasTransport::getConductivityPolynomial(size_t i, doublereal* coeffs) const
+{
+    checkSpeciesIndex(i);
+    const vector_fp& c = m_fits->condcoeffs[i];
+    std::copy(c.begin(), c.end(), coeffs);
+}
+
+void GasTransport::getBinDiffusivityPolynomial(size_t i, size_t j,
+                                               doublereal* coeffs) const
+{
+    checkSpeciesIndex(i);
+    checkSpeciesIndex(j);
+    if (i > j) {
+        std::swap(i, j);
+    }
+    // index of the pair (i,j) in the order used by fitProperties()
+    size_t ic = i*m_nsp - (i*(i-1))/2 + (j-i);
+    const vector_fp& c = m_fits->diffcoeffs[ic];
+    std::copy(c.begin(), c.end(), coeffs);
 }
 
 void GasTransport::getBinaryDiffCoeffs(const size_t ld, doublereal* const d)
@@ -230,42 +392,83 @@ void GasTransport::getBinaryDiffCoeffs(const size_t ld, doublereal* const d)
         throw CanteraError(" MixTransport::getBinaryDiffCoeffs()", "ld is too small");
     }
     doublereal rp = 1.0/m_thermo->pressure();
-    for (size_t i = 0; i < m_nsp; i++)
-        for (size_t j = 0; j < m_nsp; j++) {
-            d[ld*j + i] = rp * m_bdiff(i,j);
+    size_t ic = 0;
+    for (size_t i = 0; i < m_nsp; i++) {
+        for (size_t j = i; j < m_nsp; j++) {
+            d[ld*j + i] = rp * m_bdiff_packed[ic];
+            d[ld*i + j] = rp * m_bdiff_packed[ic];
+            ic++;
         }
+    }
 }
 
 void GasTransport::getMixDiffCoeffs(doublereal* const d)
 {
     update_T();
     update_C();
+    evalMixDiffCoeffs(m_thermo->pressure(), m_thermo->meanMolecularWeight(), d);
+}
 
-    // update the binary diffusion coefficients if necessary
-    if (!m_bindiff_ok) {
-        updateDiff_T();
+void GasTransport::evalMixDiffSums(const doublereal* w, doublereal* sums)
+{
+    updateDiffMix();
+    std::fill(sums, sums + m_nsp, 0.0);
+    m_major.clear();
+    for (size_t k = 0; k < m_nsp; k++) {
+        if (m_molefracs[k] >= m_trace_threshold) {
+            m_major.push_back(k);
+        }
     }
 
-    doublereal mmw = m_thermo->meanMolecularWeight();
+    const doublereal* rinv = &m_bdiff_inv_packed[0];
+    if (m_major.size() == m_nsp) {
+        // Visit the pairs (i,j) with j > i in the order they are stored
+        for (size_t i = 0; i < m_nsp; i++) {
+            const doublereal* r = rinv + pairIndex(i, i);
+            doublereal wi = w[i];
+            doublereal sum = sums[i];
+            for (size_t j = i + 1; j < m_nsp; j++) {
+                sum += w[j] * r[j-i];
+                sums[j] += wi * r[j-i];
+            }
+            sums[i] = sum;
+        }
+    } else {
+        // Visit each pair (i,j) where j is not a trace species, and skip
+        // pairs of two non-trace species where i > j, since they are
+        // visited as (j,i).
+        for (size_t i = 0; i < m_nsp; i++) {
+            bool traceI = (m_molefracs[i] < m_trace_threshold);
+            for (size_t n = 0; n < m_major.size(); n++) {
+                size_t j = m_major[n];
+                if (j == i || (!traceI && j < i)) {
+                    continue;
+                }
+                doublereal r = rinv[pairIndex(i, j)];
+                sums[i] += w[j] * r;
+                sums[j] += w[i] * r;
+            }
+        }
+    }
+}
+
+void GasTransport::evalMixDiffCoeffs(doublereal p, doublereal mmw,
+                                     doublereal* const d)
+{
     doublereal sumxw = 0.0;
-    doublereal p = m_thermo->pressure();
     if (m_nsp == 1) {
-        d[0] = m_bdiff(0,0) / p;
+        updateDiffMix();
+        d[0] = m_bdiff_packed[0] / p;
     } else {
+        evalMixDiffSums(&m_molefracs[0], &m_spwork[0]);
         for (size_t k = 0; k < m_nsp; k++) {
             sumxw += m_molefracs[k] * m_mw[k];
         }
         for (size_t k = 0; k < m_nsp; k++) {
-            double sum2 = 0.0;
-            for (size_t j = 0; j < m_nsp; j++) {
-                if (j != k) {
-                    sum2 += m_molefracs[j] / m_bdiff(j,k);
-                }
-            }
-            if (sum2 <= 0.0) {
-                d[k] = m_bdiff(k,k) / p;
+            if (m_spwork[k] <= 0.0) {
+                d[k] = m_bdiff_packed[pairIndex(k, k)] / p;
             } else {
-                d[k] = (sumxw - m_molefracs[k] * m_mw[k])/(p * mmw * sum2);
+                d[k] = (sumxw - m_molefracs[k] * m_mw[k])/(p * mmw * m_spwork[k]);
             }
         }
     }
@@ -276,26 +479,17 @@ void GasTransport::getMixDiffCoeffsMole(doublereal* const d)
     update_T();
     update_C();
 
-    // update the binary diffusion coefficients if necessary
-    if (!m_bindiff_ok) {
-        updateDiff_T();
-    }
-
     doublereal p = m_thermo->pressure();
     if (m_nsp == 1) {
-        d[0] = m_bdiff(0,0) / p;
+        updateDiffMix();
+        d[0] = m_bdiff_packed[0] / p;
     } else {
+        evalMixDiffSums(&m_molefracs[0], &m_spwork[0]);
         for (size_t k = 0; k < m_nsp; k++) {
-            double sum2 = 0.0;
-            for (size_t j = 0; j < m_nsp; j++) {
-                if (j != k) {
-                    sum2 += m_molefracs[j] / m_bdiff(j,k);
-                }
-            }
-            if (sum2 <= 0.0) {
-                d[k] = m_bdiff(k,k) / p;
+            if (m_spwork[k] <= 0.0) {
+                d[k] = m_bdiff_packed[pairIndex(k, k)] / p;
             } else {
-                d[k] = (1 - m_molefracs[k]) / (p * sum2);
+                d[k] = (1 - m_molefracs[k]) / (p * m_spwork[k]);
             }
         }
     }
@@ -306,30 +500,26 @@ void GasTransport::getMixDiffCoeffsMass(doublereal* const d)
     update_T();
     update_C();
 
-    // update the binary diffusion coefficients if necessary
-    if (!m_bindiff_ok) {
-        updateDiff_T();
-    }
-
     doublereal mmw = m_thermo->meanMolecularWeight();
     doublereal p = m_thermo->pressure();
 
     if (m_nsp == 1) {
-        d[0] = m_bdiff(0,0) / p;
+        updateDiffMix();
+        d[0] = m_bdiff_packed[0] / p;
     } else {
+        // sums weighted by the mole fractions and by the mole fractions
+        // times the molecular weights
+        vector_fp xw(m_nsp), sum2(m_nsp);
+        for (size_t k = 0; k < m_nsp; k++) {
+            xw[k] = m_molefracs[k] * m_mw[k];
+        }
+        evalMixDiffSums(&m_molefracs[0], &m_spwork[0]);
+        evalMixDiffSums(&xw[0], &sum2[0]);
         for (size_t k=0; k<m_nsp; k++) {
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            for (size_t i=0; i<m_nsp; i++) {
-                if (i==k) {
-                    continue;
-                }
-                sum1 += m_molefracs[i] / m_bdiff(k,i);
-                sum2 += m_molefracs[i] * m_mw[i] / m_bdiff(k,i);
-            }
-            sum1 *= p;
-            sum2 *= p * m_molefracs[k] / (mmw - m_mw[k]*m_molefracs[k]);
-            d[k] = 1.0 / (sum1 +  sum2);
+            doublereal sum1 = p * m_spwork[k];
+            doublereal s2 = p * sum2[k] * m_molefracs[k] /
+                            (mmw - m_mw[k]*m_molefracs[k]);
+            d[k] = 1.0 / (sum1 + s2);
         }
     }
 }
@@ -348,7 +538,8 @@ void GasTransport::init(thermo_t* thermo, int mode, int log_level)
     m_visc.resize(m_nsp);
     m_sqvisc.resize(m_nsp);
     m_phi.resize(m_nsp, m_nsp, 0.0);
-    m_bdiff.resize(m_nsp, m_nsp);
+    m_bdiff_row_gen.assign(m_nsp, npos);
+    m_major.reserve(m_nsp);
 
     // make a local copy of the molecular weights
     m_mw.assign(m_thermo->molecularWeights().begin(),
@@ -364,6 +555,17 @@ void GasTransport::init(thermo_t* thermo, int mode, int log_level)
         }
     }
 
+    // weight factors for the viscosity mixture rule, stored in full so that
+    // each column of m_phi is evaluated in a single pass
+    m_phi_wrat.resize(m_nsp, m_nsp, 0.0);
+    m_phi_scale.resize(m_nsp, m_nsp, 0.0);
+    for (size_t j = 0; j < m_nsp; j++) {
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_phi_wrat(k,j) = sqrt(sqrt(m_mw[j]/m_mw[k]));
+            m_phi_scale(k,j) = 1.0 / sqrt(8.0 * (1.0 + m_mw[k]/m_mw[j]));
+        }
+    }
+
     // set flags all false
     m_visc_ok = false;
     m_viscwt_ok = false;
@@ -459,6 +661,8 @@ void GasTransport::setupMM()
     if (DEBUG_MODE_ENABLED && m_log_level) {
         writelog("*** end of property fits ***\n");
     }
+    m_bdiff_packed.resize(m_fits->diffcoeffs.size());
+    m_bdiff_inv_packed.resize(m_fits->diffcoeffs.size());
 }
 
 void GasTransport::getTransportData()
@@ -566,22 +770,97 @@ void GasTransport::fitCollisionIntegrals(MMCollisionInt& integrals)
     }
 }
 
+void GasTransport::setFitCacheDirectory(const std::string& dir)
+{
+    ScopedLock lock(fit_cache_mutex);
+    fit_cache_dir = dir;
+}
+
+std::string GasTransport::fitCacheDirectory()
+{
+    ScopedLock lock(fit_cache_mutex);
+    return fit_cache_dir;
+}
+
 void GasTransport::fitProperties(MMCollisionInt& integrals)
 {
     int ndeg = 0;
-    // number of points to use in generating fit data
-    const size_t np = 50;
-
+    const size_t np = FitPoints;
     int degree = (m_mode == CK_Mode ? 3 : 4);
 
     double dt = (m_thermo->maxTemp() - m_thermo->minTemp())/(np-1);
     vector_fp tlog(np), spvisc(np), spcond(np);
     vector_fp w(np), w2(np);
 
-    // generate array of log(t) values
+    // generate array of log(t) values, and the reference state heat
+    // capacities of all species at each temperature
+    vector_fp cp_R_all(np * m_nsp);
     for (size_t n = 0; n < np; n++) {
         double t = m_thermo->minTemp() + dt*n;
         tlog[n] = log(t);
+        m_thermo->setTemperature(t);
+        m_thermo->getCp_R_ref(&cp_R_all[n*m_nsp]);
+    }
+
+    // The inputs to the fits, which identify fits that can be reused
+    vector_fp key;
+    key.push_back(FitCacheVersion);
+    key.push_back(m_mode);
+    key.push_back(m_thermo->minTemp());
+    key.push_back(m_thermo->maxTemp());
+    key.push_back(static_cast<double>(m_nsp));
+    for (size_t k = 0; k < m_nsp; k++) {
+        key.push_back(m_thermo->molecularWeight(k));
+        key.push_back(m_sigma[k]);
+        key.push_back(m_eps[k]);
+        key.push_back(m_dipole(k,k));
+        key.push_back(m_alpha[k]);
+        key.push_back(m_zrot[k]);
+        key.push_back(m_crot[k]);
+    }
+    key.insert(key.end(), cp_R_all.begin(), cp_R_all.end());
+
+    // Share the fits of another transport manager made from the same inputs
+    m_fits.reset();
+    {
+        ScopedLock lock(fit_cache_mutex);
+        fit_registry::const_iterator iter = shared_fits.find(key);
+        if (iter != shared_fits.end()) {
+            m_fits = iter->second.lock();
+        }
+    }
+
+    // Use the cached fits if they were made from the same inputs
+    std::string cacheFile = fitCacheDirectory();
+    m_fitCacheFile.clear();
+    shared_ptr<GasTransportFits> newFits(new GasTransportFits);
+    if (!cacheFile.empty()) {
+        // FNV-1a hash of the inputs, used to name the file
+        unsigned long hash = 2166136261UL;
+        const unsigned char* bytes =
+            reinterpret_cast<const unsigned char*>(&key[0]);
+        for (size_t i = 0; i < key.size() * sizeof(double); i++) {
+            hash = ((hash ^ bytes[i]) * 16777619UL) & 0xffffffffUL;
+        }
+        cacheFile += "/transport-fits-" + int2str(static_cast<int>(hash), "%08x") + ".bin";
+        m_fitCacheFile = cacheFile;
+        if (m_fits) {
+            // Save the shared fits if the cache was enabled after they were
+            // made
+            if (!std::ifstream(cacheFile.c_str())) {
+                writeFitCache(cacheFile, key, *m_fits);
+            }
+            return;
+        }
+        if (readFitCache(cacheFile, key, *newFits)) {
+            if (DEBUG_MODE_ENABLED && m_log_level) {
+                writelog("Polynomial fits read from " + cacheFile + "\n");
+            }
+            shareFits(key, newFits);
+            return;
+        }
+    } else if (m_fits) {
+        return;
     }
 
     // vector of polynomial coefficients
@@ -611,11 +890,7 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
     for (size_t k = 0; k < m_nsp; k++) {
         for (size_t n = 0; n < np; n++) {
             double t = m_thermo->minTemp() + dt*n;
-
-            m_thermo->setTemperature(t);
-            vector_fp cp_R_all(m_thermo->nSpecies());
-            m_thermo->getCp_R_ref(&cp_R_all[0]);
-            cp_R = cp_R_all[k];
+            cp_R = cp_R_all[n*m_nsp + k];
 
             double tstar = Boltzmann * t/ m_eps[k];
             sqrt_T = sqrt(t);
@@ -707,8 +982,8 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
             mxerr_cond = std::max(mxerr_cond, fabs(err));
             mxrelerr_cond = std::max(mxrelerr_cond, fabs(relerr));
         }
-        m_visccoeffs.push_back(c);
-        m_condcoeffs.push_back(c2);
+        newFits->visccoeffs.push_back(c);
+        newFits->condcoeffs.push_back(c2);
 
         if (DEBUG_MODE_ENABLED && m_log_level >= 2) {
             writelog(m_thermo->speciesName(k) + ": [" + vec2str(c) + "]\n");
@@ -728,7 +1003,7 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
         if (m_log_level >= 2)
             for (size_t k = 0; k < m_nsp; k++) {
                 writelog(m_thermo->speciesName(k) + ": [" +
-                         vec2str(m_condcoeffs[k]) + "]\n");
+                         vec2str(newFits->condcoeffs[k]) + "]\n");
             }
         writelogf("Maximum conductivity absolute error:  %12.6g\n", mxerr_cond);
         writelogf("Maximum conductivity relative error:  %12.6g\n", mxrelerr_cond);
@@ -742,55 +1017,71 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
         }
     }
 
-    mxerr = 0.0, mxrelerr = 0.0;
-    vector_fp diff(np + 1);
-    double eps, sigma;
-    for (size_t k = 0; k < m_nsp; k++)  {
+    // Species pairs (k, j) with j >= k, in the order of diffcoeffs. The
+    // binary diffusion coefficient is inversely proportional to the square
+    // root of the reduced mass and to the square of the collision diameter,
+    // and otherwise depends only on the well depth and the reduced dipole
+    // moment. Only the first pair with each combination of these is fitted.
+    typedef std::map<std::pair<double, double>, size_t> group_map;
+    group_map groups;
+    std::vector<std::pair<size_t, size_t> > fitPairs;
+    std::vector<size_t> pairGroup;
+    for (size_t k = 0; k < m_nsp; k++) {
         for (size_t j = k; j < m_nsp; j++) {
-            for (size_t n = 0; n < np; n++) {
-                double t = m_thermo->minTemp() + dt*n;
-                eps = m_epsilon(j,k);
-                double tstar = Boltzmann * t/eps;
-                sigma = m_diam(j,k);
-                om11 = integrals.omega11(tstar, m_delta(j,k));
-
-                diffcoeff = 3.0/16.0 * sqrt(2.0 * Pi/m_reducedMass(k,j)) *
-                            pow(Boltzmann * t, 1.5) /
-                            (Pi * sigma * sigma * om11);
-
-                // 2nd order correction
-                // NOTE: THIS CORRECTION IS NOT APPLIED
-                double fkj, fjk;
-                getBinDiffCorrection(t, integrals, k, j, 1.0, 1.0, fkj, fjk);
-
-                if (m_mode == CK_Mode) {
-                    diff[n] = log(diffcoeff);
-                    w[n] = -1.0;
-                } else {
-                    diff[n] = diffcoeff/pow(t, 1.5);
-                    w[n] = 1.0/(diff[n]*diff[n]);
-                }
+            std::pair<group_map::iterator, bool> g = groups.insert(
+                std::make_pair(std::make_pair(m_epsilon(j,k), m_delta(j,k)),
+                               fitPairs.size()));
+            if (g.second) {
+                fitPairs.push_back(std::make_pair(k, j));
             }
-            polyfit(np, DATA_PTR(tlog), DATA_PTR(diff),
-                    DATA_PTR(w), degree, ndeg, 0.0, DATA_PTR(c));
+            pairGroup.push_back(g.first->second);
+        }
+    }
+
+    size_t nfits = fitPairs.size();
+    vector_fp fits(nfits * (degree + 1)), errors(2 * nfits);
+    size_t nThreads = 1;
+#ifdef THREAD_SAFE_CANTERA
+    nThreads = std::max<size_t>(boost::thread::hardware_concurrency(), 1);
+    nThreads = std::min(nThreads, (nfits + MinFitsPerThread - 1) / MinFitsPerThread);
+#endif
+    if (nThreads > 1) {
+#ifdef THREAD_SAFE_CANTERA
+        boost::thread_group workers;
+        for (size_t i = 0; i < nThreads; i++) {
+            workers.create_thread(boost::bind(&GasTransport::fitDiffCoeffsThread,
+                this, &integrals, &fitPairs, i * nfits / nThreads,
+                (i + 1) * nfits / nThreads, &fits[0], &errors[0]));
+        }
+        workers.join_all();
+#endif
+    } else if (nfits) {
+        fitDiffCoeffs(&integrals, &fitPairs, 0, nfits, &fits[0], &errors[0]);
+    }
 
-            for (size_t n = 0; n < np; n++) {
-                double val, fit;
+    mxerr = 0.0, mxrelerr = 0.0;
+    size_t ic = 0;
+    for (size_t k = 0; k < m_nsp; k++)  {
+        for (size_t j = k; j < m_nsp; j++) {
+            size_t g = pairGroup[ic++];
+            size_t k0 = fitPairs[g].first;
+            size_t j0 = fitPairs[g].second;
+            c.assign(fits.begin() + g * (degree + 1),
+                     fits.begin() + (g + 1) * (degree + 1));
+            double factor = 1.0;
+            if (k0 != k || j0 != j) {
+                double ratio = m_diam(j0,k0) / m_diam(j,k);
+                factor = sqrt(m_reducedMass(k0,j0) / m_reducedMass(k,j)) *
+                         ratio * ratio;
                 if (m_mode == CK_Mode) {
-                    val = exp(diff[n]);
-                    fit = exp(poly3(tlog[n], DATA_PTR(c)));
+                    c[0] += log(factor);
                 } else {
-                    double t = exp(tlog[n]);
-                    double pre = pow(t, 1.5);
-                    val = pre * diff[n];
-                    fit = pre * poly4(tlog[n], DATA_PTR(c));
+                    scale(c.begin(), c.end(), c.begin(), factor);
                 }
-                err = fit - val;
-                relerr = err/val;
-                mxerr = std::max(mxerr, fabs(err));
-                mxrelerr = std::max(mxrelerr, fabs(relerr));
             }
-            m_diffcoeffs.push_back(c);
+            newFits->diffcoeffs.push_back(c);
+            mxerr = std::max(mxerr, factor * errors[2*g]);
+            mxrelerr = std::max(mxrelerr, errors[2*g+1]);
             if (DEBUG_MODE_ENABLED && m_log_level >= 2) {
                 writelog(m_thermo->speciesName(k) + "__" +
                          m_thermo->speciesName(j) + ": [" + vec2str(c) + "]\n");
@@ -798,11 +1089,197 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
         }
     }
     if (DEBUG_MODE_ENABLED && m_log_level) {
+        writelogf("Binary diffusion coefficients fitted for %d of %d "
+                  "species pairs\n", static_cast<int>(nfits),
+                  static_cast<int>(ic));
         writelogf("Maximum binary diffusion coefficient absolute error:"
                  "  %12.6g\n", mxerr);
         writelogf("Maximum binary diffusion coefficient relative error:"
                  "%12.6g", mxrelerr);
     }
+    if (!cacheFile.empty()) {
+        writeFitCache(cacheFile, key, *newFits);
+    }
+    shareFits(key, newFits);
+}
+
+void GasTransport::shareFits(const vector_fp& key,
+                             shared_ptr<GasTransportFits> fits)
+{
+    packFitCoeffs(*fits);
+    ScopedLock lock(fit_cache_mutex);
+    // Use the fits of another transport manager which made the same fits at
+    // the same time, so that only one copy is kept
+    weak_ptr<const GasTransportFits>& entry = shared_fits[key];
+    m_fits = entry.lock();
+    if (!m_fits) {
+        m_fits = fits;
+        entry = m_fits;
+    }
+
+    // Remove the entries of fits which are no longer used
+    fit_registry::iterator iter = shared_fits.begin();
+    while (iter != shared_fits.end()) {
+        if (iter->second.expired()) {
+            shared_fits.erase(iter++);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+void GasTransport::fitDiffCoeffs(const MMCollisionInt* integrals,
+        const std::vector<std::pair<size_t, size_t> >* pairs,
+        size_t begin, size_t end, doublereal* coeffs, doublereal* errors) const
+{
+    int ndeg = 0;
+    const size_t np = FitPoints;
+    int degree = (m_mode == CK_Mode ? 3 : 4);
+    double dt = (m_thermo->maxTemp() - m_thermo->minTemp())/(np-1);
+    vector_fp tlog(np), diff(np + 1), w(np);
+    for (size_t n = 0; n < np; n++) {
+        tlog[n] = log(m_thermo->minTemp() + dt*n);
+    }
+
+    for (size_t i = begin; i < end; i++) {
+        size_t k = (*pairs)[i].first;
+        size_t j = (*pairs)[i].second;
+        double eps = m_epsilon(j,k);
+        double sigma = m_diam(j,k);
+        for (size_t n = 0; n < np; n++) {
+            double t = m_thermo->minTemp() + dt*n;
+            double tstar = Boltzmann * t/eps;
+            double om11 = integrals->omega11(tstar, m_delta(j,k));
+            double diffcoeff = 3.0/16.0 * sqrt(2.0 * Pi/m_reducedMass(k,j)) *
+                               pow(Boltzmann * t, 1.5) /
+                               (Pi * sigma * sigma * om11);
+            if (m_mode == CK_Mode) {
+                diff[n] = log(diffcoeff);
+                w[n] = -1.0;
+            } else {
+                diff[n] = diffcoeff/pow(t, 1.5);
+                w[n] = 1.0/(diff[n]*diff[n]);
+            }
+        }
+        doublereal* c = coeffs + i * (degree + 1);
+        polyfit(np, DATA_PTR(tlog), DATA_PTR(diff),
+                DATA_PTR(w), degree, ndeg, 0.0, c);
+
+        double mxerr = 0.0, mxrelerr = 0.0;
+        for (size_t n = 0; n < np; n++) {
+            double val, fit;
+            if (m_mode == CK_Mode) {
+                val = exp(diff[n]);
+                fit = exp(poly3(tlog[n], c));
+            } else {
+                double pre = pow(exp(tlog[n]), 1.5);
+                val = pre * diff[n];
+                fit = pre * poly4(tlog[n], c);
+            }
+            mxerr = std::max(mxerr, fabs(fit - val));
+            mxrelerr = std::max(mxrelerr, fabs((fit - val)/val));
+        }
+        errors[2*i] = mxerr;
+        errors[2*i+1] = mxrelerr;
+    }
+}
+
+void GasTransport::fitDiffCoeffsThread(const MMCollisionInt* integrals,
+        const std::vector<std::pair<size_t, size_t> >* pairs,
+        size_t begin, size_t end, doublereal* coeffs, doublereal* errors) const
+{
+    fitDiffCoeffs(integrals, pairs, begin, end, coeffs, errors);
+#ifdef THREAD_SAFE_CANTERA
+    thread_complete();
+#endif
+}
+
+bool GasTransport::readFitCache(const std::string& fname, const vector_fp& key,
+                                GasTransportFits& fits) const
+{
+    std::ifstream f(fname.c_str(), std::ios::binary);
+    char magic[sizeof(FitCacheMagic)];
+    f.read(magic, sizeof(magic));
+    if (!f || std::string(magic, sizeof(magic)) !=
+            std::string(FitCacheMagic, sizeof(FitCacheMagic))) {
+        return false;
+    }
+    double nkey = 0.0;
+    f.read(reinterpret_cast<char*>(&nkey), sizeof(double));
+    if (!f || nkey != key.size()) {
+        return false;
+    }
+    vector_fp fileKey(key.size());
+    f.read(reinterpret_cast<char*>(&fileKey[0]), key.size() * sizeof(double));
+    if (!f || fileKey != key) {
+        return false;
+    }
+
+    size_t ncoeffs = (m_mode == CK_Mode ? 4 : 5);
+    size_t npairs = m_nsp * (m_nsp + 1) / 2;
+    vector_fp data((2 * m_nsp + npairs) * ncoeffs);
+    f.read(reinterpret_cast<char*>(&data[0]), data.size() * sizeof(double));
+    if (!f || f.peek() != EOF) {
+        return false;
+    }
+    vector_fp::const_iterator d = data.begin();
+    fits.visccoeffs.resize(m_nsp);
+    fits.condcoeffs.resize(m_nsp);
+    fits.diffcoeffs.resize(npairs);
+    for (size_t k = 0; k < m_nsp; k++, d += ncoeffs) {
+        fits.visccoeffs[k].assign(d, d + ncoeffs);
+    }
+    for (size_t k = 0; k < m_nsp; k++, d += ncoeffs) {
+        fits.condcoeffs[k].assign(d, d + ncoeffs);
+    }
+    for (size_t ic = 0; ic < npairs; ic++, d += ncoeffs) {
+        fits.diffcoeffs[ic].assign(d, d + ncoeffs);
+    }
+    return true;
+}
+
+void GasTransport::writeFitCache(const std::string& fname,
+                                 const vector_fp& key,
+                                 const GasTransportFits& fits) const
+{
+    vector_fp data;
+    for (size_t k = 0; k < fits.visccoeffs.size(); k++) {
+        data.insert(data.end(), fits.visccoeffs[k].begin(),
+                    fits.visccoeffs[k].end());
+    }
+    for (size_t k = 0; k < fits.condcoeffs.size(); k++) {
+        data.insert(data.end(), fits.condcoeffs[k].begin(),
+                    fits.condcoeffs[k].end());
+    }
+    for (size_t ic = 0; ic < fits.diffcoeffs.size(); ic++) {
+        data.insert(data.end(), fits.diffcoeffs[ic].begin(),
+                    fits.diffcoeffs[ic].end());
+    }
+
+    // Write to a temporary file first, so that other processes never read
+    // a partially written file. The name is unique to this process and
+    // call, so that concurrent writers of the same cache file do not
+    // overwrite each other's temporary files.
+    int count;
+    {
+        ScopedLock lock(fit_cache_mutex);
+        count = fit_cache_count++;
+    }
+    std::string tmpName = fname + "." + int2str(static_cast<int>(getpid())) +
+                          "-" + int2str(count) + ".tmp";
+    std::ofstream f(tmpName.c_str(), std::ios::binary);
+    double nkey = static_cast<double>(key.size());
+    f.write(FitCacheMagic, sizeof(FitCacheMagic));
+    f.write(reinterpret_cast<const char*>(&nkey), sizeof(double));
+    f.write(reinterpret_cast<const char*>(&key[0]), key.size() * sizeof(double));
+    f.write(reinterpret_cast<const char*>(&data[0]), data.size() * sizeof(double));
+    f.close();
+    if (!f || std::rename(tmpName.c_str(), fname.c_str()) != 0) {
+        std::remove(tmpName.c_str());
+        if (DEBUG_MODE_ENABLED && m_log_level) {
+            writelog("Unable to write polynomial fits to " + fname + "\n");
+        }
+    }
 }
 
 void GasTransport::getBinDiffCorrection(double t, MMCollisionInt& integrals,
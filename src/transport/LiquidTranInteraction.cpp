@@ -41,9 +41,25 @@ public:
                        + msg + "\n") {}
 };
 
+//! True if any of the interaction matrices in `tables` has a nonzero entry
+//! for the species pair (i,j)
+static bool hasInteraction(const std::vector<DenseMatrix*>& tables,
+                           size_t i, size_t j)
+{
+    for (size_t k = 0; k < tables.size(); k++) {
+        if ((*tables[k])(i,j) != 0.0) {
+            return true;
+        }
+    }
+    return false;
+}
+
 LiquidTranInteraction::LiquidTranInteraction(TransportPropertyType tp_ind) :
     m_model(LTI_MODEL_NOTSET),
-    m_property(tp_ind)
+    m_property(tp_ind),
+    m_thermo(0),
+    m_nterms(0),
+    m_pair_tlast(-1.0)
 {
 }
 
@@ -165,6 +181,23 @@ void LiquidTranInteraction::init(const XML_Node& compModelNode,
             m_Dij(jSpecies,iSpecies) = m_Dij(iSpecies,jSpecies) ;
         }
     }
+
+    // Only the species pairs with interaction parameters contribute to the
+    // interaction terms of the mixing rules
+    m_nterms = std::max(std::max(m_Aij.size(), m_Bij.size()),
+                        std::max(m_Hij.size(), m_Sij.size()));
+    m_pairs.clear();
+    for (size_t i = 0; i < nsp; i++) {
+        for (size_t j = 0; j < nsp; j++) {
+            if (hasInteraction(m_Aij, i, j) || hasInteraction(m_Bij, i, j) ||
+                hasInteraction(m_Hij, i, j) || hasInteraction(m_Sij, i, j)) {
+                m_pairs.push_back(std::make_pair(i, j));
+            }
+        }
+    }
+    m_pairCoeffs.assign(m_pairs.size() * m_nterms, 0.0);
+    m_pair_tlast = -1.0;
+    m_fracs.resize(nsp);
 }
 
 LiquidTranInteraction::LiquidTranInteraction(const LiquidTranInteraction& right)
@@ -185,10 +218,57 @@ LiquidTranInteraction& LiquidTranInteraction::operator=(const LiquidTranInteract
         m_Hij       = right.m_Hij;
         m_Sij       = right.m_Sij;
         m_Dij       = right.m_Dij;
+        m_pairs     = right.m_pairs;
+        m_nterms    = right.m_nterms;
+        m_pairCoeffs = right.m_pairCoeffs;
+        m_pair_tlast = right.m_pair_tlast;
+        m_fracs     = right.m_fracs;
     }
     return *this;
 }
 
+doublereal LiquidTranInteraction::interactionSum(const doublereal* x)
+{
+    if (m_pairs.empty()) {
+        return 0.0;
+    }
+    doublereal temp = m_thermo->temperature();
+    if (temp != m_pair_tlast) {
+        updateInteractionCoeffs(temp);
+        m_pair_tlast = temp;
+    }
+
+    doublereal sum = 0.0;
+    for (size_t n = 0; n < m_pairs.size(); n++) {
+        doublereal xi = x[m_pairs[n].first];
+        const doublereal* c = &m_pairCoeffs[n*m_nterms];
+        doublereal poly = c[m_nterms-1];
+        for (size_t k = m_nterms-1; k > 0; k--) {
+            poly = poly * xi + c[k-1];
+        }
+        sum += xi * x[m_pairs[n].second] * poly;
+    }
+    return sum;
+}
+
+void LiquidTranInteraction::updateInteractionCoeffs(doublereal T)
+{
+    for (size_t n = 0; n < m_pairs.size(); n++) {
+        size_t i = m_pairs[n].first;
+        size_t j = m_pairs[n].second;
+        doublereal* c = &m_pairCoeffs[n*m_nterms];
+        for (size_t k = 0; k < m_nterms; k++) {
+            c[k] = 0.0;
+            if (k < m_Aij.size()) {
+                c[k] += (*m_Aij[k])(i,j);
+            }
+            if (k < m_Bij.size()) {
+                c[k] += (*m_Bij[k])(i,j) * T;
+            }
+        }
+    }
+}
+
 LTI_Solvent::LTI_Solvent(TransportPropertyType tp_ind) :
     LiquidTranInteraction(tp_ind)
 {
@@ -198,20 +278,15 @@ LTI_Solvent::LTI_Solvent(TransportPropertyType tp_ind) :
 doublereal LTI_Solvent::getMixTransProp(doublereal* speciesValues, doublereal* speciesWeight)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
+    m_thermo->getMoleFractions(&m_fracs[0]);
 
     doublereal value = 0.0;
 
     //if weightings are specified, use those
-    if (speciesWeight) {
-        for (size_t k = 0; k < nsp; k++) {
-            // should be: molefracs[k] = molefracs[k]*speciesWeight[k]; for consistency, but weight(solvent)=1?
-        }
-    } else {
+    if (!speciesWeight) {
         throw CanteraError("LTI_Solvent::getMixTransProp","You should be specifying the speciesWeight");
     }
+    // should be: molefracs[k] = molefracs[k]*speciesWeight[k]; for consistency, but weight(solvent)=1?
 
     for (size_t i = 0; i < nsp; i++) {
         //presume that the weighting is set to 1.0 for solvent and 0.0 for everything else.
@@ -221,46 +296,26 @@ doublereal LTI_Solvent::getMixTransProp(doublereal* speciesValues, doublereal* s
         } else {
             AssertTrace(speciesWeight[i] == 0.0);
         }
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Aij[k])(i,j)*pow(molefracs[i], (int) k);
-            }
-            for (size_t k = 0; k < m_Bij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Bij[k])(i,j)*temp*pow(molefracs[i], (int) k);
-            }
-        }
     }
 
-    return value;
+    return value + interactionSum(&m_fracs[0]);
 }
 
-doublereal LTI_Solvent::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_Solvent::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
+    m_thermo->getMoleFractions(&m_fracs[0]);
 
     doublereal value = 0.0;
 
-    for (size_t k = 0; k < nsp; k++) {
-        // should be:      molefracs[k] = molefracs[k]*LTPptrs[k]->getMixWeight(); for consistency, but weight(solvent)=1?
-    }
+    // should be:      molefracs[k] = molefracs[k]*LTPptrs[k]->getMixWeight(); for consistency, but weight(solvent)=1?
 
     for (size_t i = 0; i < nsp; i++) {
         //presume that the weighting is set to 1.0 for solvent and 0.0 for everything else.
         value += LTPptrs[i]->getSpeciesTransProp() * LTPptrs[i]->getMixWeight();
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Aij[k])(i,j)*pow(molefracs[i], (int) k);
-            }
-            for (size_t k = 0; k < m_Bij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Bij[k])(i,j)*temp*pow(molefracs[i], (int) k);
-            }
-        }
     }
 
-    return value;
+    return value + interactionSum(&m_fracs[0]);
 }
 
 void LTI_Solvent::getMatrixTransProp(DenseMatrix& mat, doublereal* speciesValues)
@@ -271,189 +326,118 @@ void LTI_Solvent::getMatrixTransProp(DenseMatrix& mat, doublereal* speciesValues
 doublereal LTI_MoleFracs::getMixTransProp(doublereal* speciesValues, doublereal* speciesWeight)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
-
-    doublereal value = 0;
+    m_thermo->getMoleFractions(&m_fracs[0]);
 
     //if weightings are specified, use those
-    if (speciesWeight) {
-        for (size_t k = 0; k < nsp; k++) {
-            molefracs[k] = molefracs[k]*speciesWeight[k];
-        }
-    } else {
+    if (!speciesWeight) {
         throw CanteraError("LTI_MoleFracs::getMixTransProp","You should be specifying the speciesWeight");
     }
 
+    doublereal value = 0;
     for (size_t i = 0; i < nsp; i++) {
-        value += speciesValues[i] * molefracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Aij[k])(i,j)*pow(molefracs[i], (int) k);
-            }
-            for (size_t k = 0; k < m_Bij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Bij[k])(i,j)*temp*pow(molefracs[i], (int) k);
-            }
-        }
+        m_fracs[i] *= speciesWeight[i];
+        value += speciesValues[i] * m_fracs[i];
     }
 
-    return value;
+    return value + interactionSum(&m_fracs[0]);
 }
 
-doublereal LTI_MoleFracs::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_MoleFracs::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
+    m_thermo->getMoleFractions(&m_fracs[0]);
 
     doublereal value = 0;
-
-    for (size_t k = 0; k < nsp; k++) {
-        molefracs[k] = molefracs[k]*LTPptrs[k]->getMixWeight();
-    }
-
     for (size_t i = 0; i < nsp; i++) {
-        value += LTPptrs[i]->getSpeciesTransProp() * molefracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Aij[k])(i,j)*pow(molefracs[i], (int) k);
-            }
-            for (size_t k = 0; k < m_Bij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Bij[k])(i,j)*temp*pow(molefracs[i], (int) k);
-            }
-        }
+        m_fracs[i] *= LTPptrs[i]->getMixWeight();
+        value += LTPptrs[i]->getSpeciesTransProp() * m_fracs[i];
     }
-    return value;
+
+    return value + interactionSum(&m_fracs[0]);
 }
 
 doublereal LTI_MassFracs::getMixTransProp(doublereal* speciesValues, doublereal* speciesWeight)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp massfracs(nsp);
-    m_thermo->getMassFractions(&massfracs[0]);
-
-    doublereal value = 0;
+    m_thermo->getMassFractions(&m_fracs[0]);
 
     //if weightings are specified, use those
-    if (speciesWeight) {
-        for (size_t k = 0; k < nsp; k++) {
-            massfracs[k] = massfracs[k]*speciesWeight[k];
-        }
-    } else {
+    if (!speciesWeight) {
         throw CanteraError("LTI_MassFracs::getMixTransProp","You should be specifying the speciesWeight");
     }
 
+    doublereal value = 0;
     for (size_t i = 0; i < nsp; i++) {
-        value += speciesValues[i] * massfracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += massfracs[i]*massfracs[j]*(*m_Aij[k])(i,j)*pow(massfracs[i], (int) k);
-            }
-            for (size_t k = 0; k < m_Bij.size(); k++) {
-                value += massfracs[i]*massfracs[j]*(*m_Bij[k])(i,j)*temp*pow(massfracs[i], (int) k);
-            }
-        }
+        m_fracs[i] *= speciesWeight[i];
+        value += speciesValues[i] * m_fracs[i];
     }
 
-    return value;
+    return value + interactionSum(&m_fracs[0]);
 }
 
-doublereal LTI_MassFracs::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_MassFracs::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp massfracs(nsp);
-    m_thermo->getMassFractions(&massfracs[0]);
+    m_thermo->getMassFractions(&m_fracs[0]);
 
     doublereal value = 0;
-
-    for (size_t k = 0; k < nsp; k++) {
-        massfracs[k] = massfracs[k]*LTPptrs[k]->getMixWeight();
-    }
-
     for (size_t i = 0; i < nsp; i++) {
-        value += LTPptrs[i]->getSpeciesTransProp() * massfracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += massfracs[i]*massfracs[j]*(*m_Aij[k])(i,j)*pow(massfracs[i], (int) k);
-            }
-            for (size_t k = 0; k < m_Bij.size(); k++) {
-                value += massfracs[i]*massfracs[j]*(*m_Bij[k])(i,j)*temp*pow(massfracs[i], (int) k);
-            }
-        }
+        m_fracs[i] *= LTPptrs[i]->getMixWeight();
+        value += LTPptrs[i]->getSpeciesTransProp() * m_fracs[i];
     }
 
-    return value;
+    return value + interactionSum(&m_fracs[0]);
 }
 
 doublereal LTI_Log_MoleFracs::getMixTransProp(doublereal* speciesValues, doublereal* speciesWeight)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
-
-
-
-    doublereal value = 0;
+    m_thermo->getMoleFractions(&m_fracs[0]);
 
     //if weightings are specified, use those
-    if (speciesWeight) {
-        for (size_t k = 0; k < nsp; k++) {
-            molefracs[k] = molefracs[k]*speciesWeight[k];
-        }
-    } else {
+    if (!speciesWeight) {
         throw CanteraError("LTI_Log_MoleFracs::getMixTransProp","You probably should have a speciesWeight when you call getMixTransProp to convert ion mole fractions to molecular mole fractions");
     }
 
+    doublereal value = 0;
     for (size_t i = 0; i < nsp; i++) {
-        value += log(speciesValues[i]) * molefracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Hij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Hij[k])(i,j)/temp*pow(molefracs[i], (int) k);
-            }
-            for (size_t k = 0; k < m_Sij.size(); k++) {
-                value -= molefracs[i]*molefracs[j]*(*m_Sij[k])(i,j)*pow(molefracs[i], (int) k);
-            }
-        }
+        m_fracs[i] *= speciesWeight[i];
+        value += log(speciesValues[i]) * m_fracs[i];
     }
 
-    return exp(value);
+    return exp(value + interactionSum(&m_fracs[0]));
 }
 
-doublereal LTI_Log_MoleFracs::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_Log_MoleFracs::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
-
+    m_thermo->getMoleFractions(&m_fracs[0]);
 
     doublereal value = 0;
-
-    //if weightings are specified, use those
-
-    for (size_t k = 0; k < nsp; k++) {
-        molefracs[k] = molefracs[k]*LTPptrs[k]->getMixWeight();
+    for (size_t i = 0; i < nsp; i++) {
+        m_fracs[i] *= LTPptrs[i]->getMixWeight();
+        value += log(LTPptrs[i]->getSpeciesTransProp()) * m_fracs[i];
     }
 
-    for (size_t i = 0; i < nsp; i++) {
-        value += log(LTPptrs[i]->getSpeciesTransProp()) * molefracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Hij.size(); k++) {
-                value +=  molefracs[i]*molefracs[j]*(*m_Hij[k])(i,j)/temp*pow(molefracs[i], (int) k);
+    return exp(value + interactionSum(&m_fracs[0]));
+}
+
+void LTI_Log_MoleFracs::updateInteractionCoeffs(doublereal T)
+{
+    for (size_t n = 0; n < m_pairs.size(); n++) {
+        size_t i = m_pairs[n].first;
+        size_t j = m_pairs[n].second;
+        doublereal* c = &m_pairCoeffs[n*m_nterms];
+        for (size_t k = 0; k < m_nterms; k++) {
+            c[k] = 0.0;
+            if (k < m_Hij.size()) {
+                c[k] += (*m_Hij[k])(i,j) / T;
             }
-            for (size_t k = 0; k < m_Sij.size(); k++) {
-                value -=  molefracs[i]*molefracs[j]*(*m_Sij[k])(i,j)*pow(molefracs[i], (int) k);
+            if (k < m_Sij.size()) {
+                c[k] -= (*m_Sij[k])(i,j);
             }
         }
     }
-
-    value = exp(value);
-    return value;
 }
 
 void LTI_Pairwise_Interaction::setParameters(LiquidTransportParams& trParam)
@@ -482,7 +466,7 @@ doublereal LTI_Pairwise_Interaction::getMixTransProp(doublereal* speciesValues,
     return value;
 }
 
-doublereal LTI_Pairwise_Interaction::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_Pairwise_Interaction::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
     vector_fp molefracs(nsp);
@@ -499,8 +483,6 @@ void LTI_Pairwise_Interaction::getMatrixTransProp(DenseMatrix& mat, doublereal*
 {
     size_t nsp = m_thermo->nSpecies();
     doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
 
     mat.resize(nsp, nsp, 0.0);
     for (size_t i = 0; i < nsp; i++)
@@ -563,7 +545,7 @@ doublereal LTI_StefanMaxwell_PPN::getMixTransProp(doublereal* speciesValues, dou
     return value;
 }
 
-doublereal LTI_StefanMaxwell_PPN::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_StefanMaxwell_PPN::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
     vector_fp molefracs(nsp);
@@ -667,7 +649,7 @@ doublereal LTI_StokesEinstein::getMixTransProp(doublereal* speciesValues, double
     return value;
 }
 
-doublereal LTI_StokesEinstein::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_StokesEinstein::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
     vector_fp molefracs(nsp);
@@ -715,55 +697,52 @@ void LTI_StokesEinstein::getMatrixTransProp(DenseMatrix& mat, doublereal* specie
 doublereal LTI_MoleFracs_ExpT::getMixTransProp(doublereal* speciesValues, doublereal* speciesWeight)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
-
-    doublereal value = 0;
+    m_thermo->getMoleFractions(&m_fracs[0]);
 
     //if weightings are specified, use those
-    if (speciesWeight) {
-        for (size_t k = 0; k < nsp; k++) {
-            molefracs[k] = molefracs[k]*speciesWeight[k];
-        }
-    } else {
+    if (!speciesWeight) {
         throw CanteraError("LTI_MoleFracs_ExpT::getMixTransProp","You should be specifying the speciesWeight");
     }
 
+    doublereal value = 0;
     for (size_t i = 0; i < nsp; i++) {
-        value += speciesValues[i] * molefracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Aij[k])(i,j)*pow(molefracs[i], (int) k)*exp((*m_Bij[k])(i,j)*temp);
-            }
-        }
+        m_fracs[i] *= speciesWeight[i];
+        value += speciesValues[i] * m_fracs[i];
     }
 
-    return value;
+    return value + interactionSum(&m_fracs[0]);
 }
 
-doublereal LTI_MoleFracs_ExpT::getMixTransProp(std::vector<LTPspecies*> LTPptrs)
+doublereal LTI_MoleFracs_ExpT::getMixTransProp(const std::vector<LTPspecies*>& LTPptrs)
 {
     size_t nsp = m_thermo->nSpecies();
-    doublereal temp = m_thermo->temperature();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
+    m_thermo->getMoleFractions(&m_fracs[0]);
 
     doublereal value = 0;
-
-    for (size_t k = 0; k < nsp; k++) {
-        molefracs[k] = molefracs[k]*LTPptrs[k]->getMixWeight();
+    for (size_t i = 0; i < nsp; i++) {
+        m_fracs[i] *= LTPptrs[i]->getMixWeight();
+        value += LTPptrs[i]->getSpeciesTransProp() * m_fracs[i];
     }
 
-    for (size_t i = 0; i < nsp; i++) {
-        value += LTPptrs[i]->getSpeciesTransProp() * molefracs[i];
-        for (size_t j = 0; j < nsp; j++) {
-            for (size_t k = 0; k < m_Aij.size(); k++) {
-                value += molefracs[i]*molefracs[j]*(*m_Aij[k])(i,j)*pow(molefracs[i], (int) k)*exp((*m_Bij[k])(i,j)*temp);
+    return value + interactionSum(&m_fracs[0]);
+}
+
+void LTI_MoleFracs_ExpT::updateInteractionCoeffs(doublereal T)
+{
+    for (size_t n = 0; n < m_pairs.size(); n++) {
+        size_t i = m_pairs[n].first;
+        size_t j = m_pairs[n].second;
+        doublereal* c = &m_pairCoeffs[n*m_nterms];
+        for (size_t k = 0; k < m_nterms; k++) {
+            c[k] = 0.0;
+            if (k < m_Aij.size()) {
+                c[k] = (*m_Aij[k])(i,j);
+                if (k < m_Bij.size()) {
+                    c[k] *= exp((*m_Bij[k])(i,j) * T);
+                }
             }
         }
     }
-    return value;
 }
 
 } //namespace Cantera
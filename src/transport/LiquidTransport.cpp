@@ -403,6 +403,7 @@ doublereal LiquidTransport::viscosity()
 
     ////// LiquidTranInteraction method
     m_viscmix = m_viscMixModel->getMixTransProp(m_viscTempDep_Ns);
+    m_visc_mix_ok = true;
 
     return m_viscmix;
 }
@@ -427,6 +428,7 @@ doublereal LiquidTransport::ionConductivity()
 
     ////// LiquidTranInteraction method
     m_ionCondmix = m_ionCondMixModel->getMixTransProp(m_ionCondTempDep_Ns);
+    m_ionCond_mix_ok = true;
 
     return m_ionCondmix;
 }
@@ -456,6 +458,7 @@ void LiquidTransport::mobilityRatio(doublereal* mobRat)
                 }
             }
         }
+        m_mobRat_mix_ok = true;
     }
     for (size_t k = 0; k < m_nsp2; k++) {
         mobRat[k] = m_mobRatMix[k];
@@ -483,6 +486,7 @@ void LiquidTransport::selfDiffusion(doublereal* const selfDiff)
         for (size_t k = 0; k < m_nsp; k++) {
             m_selfDiffMix[k] = m_selfDiffMixModel[k]->getMixTransProp(m_selfDiffTempDep_Ns[k]);
         }
+        m_selfDiff_mix_ok = true;
     }
     for (size_t k = 0; k < m_nsp; k++) {
         selfDiff[k] = m_selfDiffMix[k];
@@ -520,7 +524,7 @@ doublereal LiquidTransport::thermalConductivity()
 
     if (!m_lambda_mix_ok) {
         m_lambda = m_lambdaMixModel->getMixTransProp(m_lambdaTempDep_Ns);
-        m_cond_mix_ok = true;
+        m_lambda_mix_ok = true;
     }
 
     return m_lambda;
@@ -539,6 +543,7 @@ void LiquidTransport::getBinaryDiffCoeffs(size_t ld, doublereal* d)
         throw CanteraError("LiquidTransport::getBinaryDiffCoeffs",
                            "First argument does not correspond to number of species in model.\nDiff Coeff matrix may be misdimensioned");
     update_T();
+    update_C();
 
     // if necessary, evaluate the binary diffusion coefficients
     // from the polynomial fits
@@ -554,6 +559,37 @@ void LiquidTransport::getBinaryDiffCoeffs(size_t ld, doublereal* d)
     }
 }
 
+void LiquidTransport::getLiquidTransportProperties(size_t npoints,
+        const doublereal* T, doublereal P, const doublereal* X,
+        doublereal* visc, doublereal* ionCond, doublereal* cond,
+        doublereal* d)
+{
+    vector_fp state, x(m_nsp), dk(d ? m_nsp*m_nsp : 0);
+    m_thermo->saveState(state);
+    for (size_t n = 0; n < npoints; n++) {
+        for (size_t k = 0; k < m_nsp; k++) {
+            x[k] = X[k*npoints + n];
+        }
+        m_thermo->setState_TPX(T[n], P, &x[0]);
+        if (visc) {
+            visc[n] = viscosity();
+        }
+        if (ionCond) {
+            ionCond[n] = ionConductivity();
+        }
+        if (cond) {
+            cond[n] = thermalConductivity();
+        }
+        if (d) {
+            getBinaryDiffCoeffs(m_nsp, &dk[0]);
+            for (size_t i = 0; i < m_nsp*m_nsp; i++) {
+                d[i*npoints + n] = dk[i];
+            }
+        }
+    }
+    m_thermo->restoreState(state);
+}
+
 void LiquidTransport::getMobilities(doublereal* const mobil)
 {
     getMixDiffCoeffs(DATA_PTR(m_spwork));
@@ -798,6 +834,7 @@ bool LiquidTransport::update_C()
     int iStateNew = m_thermo->stateMFNumber();
     if (iStateNew != m_iStateMF) {
         qReturn = false;
+        m_iStateMF = iStateNew;
         m_thermo->getMassFractions(DATA_PTR(m_massfracs));
         m_thermo->getMoleFractions(DATA_PTR(m_molefracs));
         m_thermo->getConcentrations(DATA_PTR(m_concentrations));
@@ -834,6 +871,12 @@ bool LiquidTransport::update_C()
     m_diff_mix_ok = false;
     m_lambda_mix_ok = false;
 
+    // Some models for the Stefan-Maxwell interaction parameters depend on
+    // the composition as well as the temperature
+    if (m_diffMixModel->compositionDependent()) {
+        m_diff_temp_ok = false;
+    }
+
     return true;
 }
 
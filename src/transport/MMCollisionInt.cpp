@@ -8,6 +8,8 @@
 #include "cantera/numerics/polyfit.h"
 #include "cantera/base/stringUtils.h"
 
+#include <algorithm>
+
 using namespace std;
 
 namespace Cantera
@@ -18,7 +20,7 @@ double MMCollisionInt::delta[8] = {0.0, 0.25, 0.50, 0.75, 1.0,
                                    1.5, 2.0, 2.5
                                   };
 
-doublereal quadInterp(doublereal x0, doublereal* x, doublereal* y)
+doublereal quadInterp(doublereal x0, const doublereal* x, const doublereal* y)
 {
     doublereal dx21, dx32, dx31, dy32, dy21, a;
     dx21 = x[1] - x[0];
@@ -319,104 +321,60 @@ doublereal MMCollisionInt::fitDelta(int table, int ntstar, int degree, doublerea
     return polyfit(8, delta, begin, DATA_PTR(w), degree, ndeg, 0.0, c);
 }
 
-doublereal MMCollisionInt::omega22(double ts, double deltastar)
+size_t MMCollisionInt::interpIndex(double ts) const
 {
-    int i;
-    for (i = 0; i < 37; i++) if (ts < tstar22[i]) {
-            break;
-        }
-    int i1, i2;
-    i1 = std::max(i - 1, 0);
-    i2 = i1+3;
-    if (i2 > 36) {
-        i2 = 36;
-        i1 = i2 - 3;
-    }
-    vector_fp values(3);
-    for (i = i1; i < i2; i++) {
-        if (deltastar == 0.0) {
-            values[i-i1] = omega22_table[8*i];
-        } else {
-            values[i-i1] = poly5(deltastar, DATA_PTR(m_o22poly[i]));
-        }
-    }
-    return quadInterp(log(ts), DATA_PTR(m_logTemp)
-                      + i1, DATA_PTR(values));
+    // index of the first tabulated T* greater than ts
+    size_t i = upper_bound(tstar22, tstar22 + 37, ts) - tstar22;
+    size_t i1 = (i > 0) ? i - 1 : 0;
+    return std::min<size_t>(i1, 33);
 }
 
-doublereal MMCollisionInt::astar(double ts, double deltastar)
+doublereal MMCollisionInt::interp(double logts, size_t i1,
+                                  const doublereal* table,
+                                  const std::vector<vector_fp>& polys,
+                                  double deltastar) const
 {
-    int i;
-    for (i = 0; i < 37; i++) if (ts < tstar22[i]) {
-            break;
-        }
-    int i1, i2;
-    i1 = std::max(i - 1, 0);
-    i2 = i1+3;
-    if (i2 > 36) {
-        i2 = 36;
-        i1 = i2 - 3;
-    }
-    vector_fp values(3);
-    for (i = i1; i < i2; i++) {
+    doublereal values[3];
+    for (size_t i = i1; i < i1 + 3; i++) {
         if (deltastar == 0.0) {
-            values[i-i1] = astar_table[8*(i + 1)];
+            values[i-i1] = table[8*i];
         } else {
-            values[i-i1] = poly5(deltastar, DATA_PTR(m_apoly[i]));
+            values[i-i1] = poly5(deltastar, &polys[i][0]);
         }
     }
-    return quadInterp(log(ts), DATA_PTR(m_logTemp)
-                      + i1, DATA_PTR(values));
+    return quadInterp(logts, &m_logTemp[i1], values);
 }
 
-doublereal MMCollisionInt::bstar(double ts, double deltastar)
+doublereal MMCollisionInt::omega22(double ts, double deltastar) const
 {
-    int i;
-    for (i = 0; i < 37; i++) if (ts < tstar22[i]) {
-            break;
-        }
-    int i1, i2;
-    i1 = std::max(i - 1, 0);
-    i2 = i1+3;
-    if (i2 > 36) {
-        i2 = 36;
-        i1 = i2 - 3;
-    }
-    vector_fp values(3);
-    for (i = i1; i < i2; i++) {
-        if (deltastar == 0.0) {
-            values[i-i1] = bstar_table[8*(i + 1)];
-        } else {
-            values[i-i1] = poly5(deltastar, DATA_PTR(m_bpoly[i]));
-        }
-    }
-    return quadInterp(log(ts), DATA_PTR(m_logTemp) + i1,
-                      DATA_PTR(values));
+    return interp(log(ts), interpIndex(ts), omega22_table, m_o22poly,
+                  deltastar);
 }
 
-doublereal MMCollisionInt::cstar(double ts, double deltastar)
+doublereal MMCollisionInt::astar(double ts, double deltastar) const
 {
-    int i;
-    for (i = 0; i < 37; i++) if (ts < tstar22[i]) {
-            break;
-        }
-    int i1, i2;
-    i1 = std::max(i - 1,0);
-    i2 = i1+3;
-    if (i2 > 36) {
-        i2 = 36;
-        i1 = i2 - 3;
-    }
-    vector_fp values(3);
-    for (i = i1; i < i2; i++) {
-        if (deltastar == 0.0) {
-            values[i-i1] = cstar_table[8*(i + 1)];
-        } else {
-            values[i-i1] = poly5(deltastar, DATA_PTR(m_cpoly[i]));
-        }
-    }
-    return quadInterp(log(ts), DATA_PTR(m_logTemp) + i1,
-                      DATA_PTR(values));
+    return interp(log(ts), interpIndex(ts), astar_table + 8, m_apoly,
+                  deltastar);
+}
+
+doublereal MMCollisionInt::bstar(double ts, double deltastar) const
+{
+    return interp(log(ts), interpIndex(ts), bstar_table + 8, m_bpoly,
+                  deltastar);
+}
+
+doublereal MMCollisionInt::cstar(double ts, double deltastar) const
+{
+    return interp(log(ts), interpIndex(ts), cstar_table + 8, m_cpoly,
+                  deltastar);
+}
+
+doublereal MMCollisionInt::omega11(double ts, double deltastar) const
+{
+    double logts = log(ts);
+    size_t i1 = interpIndex(ts);
+    return interp(logts, i1, omega22_table, m_o22poly, deltastar) /
+           interp(logts, i1, astar_table + 8, m_apoly, deltastar);
 }
 
 void MMCollisionInt::fit_omega22(int degree, doublereal deltastar,
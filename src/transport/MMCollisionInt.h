@@ -35,20 +35,45 @@ public:
      */
     void init(doublereal tsmin,  doublereal tsmax, int loglevel = 0);
 
-    doublereal omega22(double ts, double deltastar);
-    doublereal astar(double ts, double deltastar);
-    doublereal bstar(double ts, double deltastar);
-    doublereal cstar(double ts, double deltastar);
+    //! @name Collision integrals
+    //! Evaluated by quadratic interpolation in log(T*) between the tabulated
+    //! values, using the polynomial fits in delta* for nonzero delta*. These
+    //! methods do not modify the object, and may be called concurrently from
+    //! multiple threads.
+    //! @{
+    doublereal omega22(double ts, double deltastar) const;
+    doublereal astar(double ts, double deltastar) const;
+    doublereal bstar(double ts, double deltastar) const;
+    doublereal cstar(double ts, double deltastar) const;
+
+    //! The omega11 collision integral, equal to omega22 / A*
+    doublereal omega11(double ts, double deltastar) const;
+    //! @}
+
     void fit(int degree, doublereal deltastar,
              doublereal* astar, doublereal* bstar, doublereal* cstar);
     void fit_omega22(int degree, doublereal deltastar, doublereal* om22);
-    doublereal omega11(double ts, double deltastar) {
-        return omega22(ts, deltastar)/astar(ts, deltastar);
-    }
 
 private:
     doublereal fitDelta(int table, int ntstar, int degree, doublereal* c);
 
+    //! Index of the first of the three tabulated T* values used to
+    //! interpolate at `ts`
+    size_t interpIndex(double ts) const;
+
+    //! Interpolate a collision integral in log(T*)
+    /*!
+     *  @param logts      log(T*)
+     *  @param i1         index returned by interpIndex()
+     *  @param table      tabulated values for delta* = 0, with a stride of 8
+     *                    between T* values
+     *  @param polys      fits vs. delta* at each T*, used if delta* != 0
+     *  @param deltastar  reduced dipole moment delta*
+     */
+    doublereal interp(double logts, size_t i1, const doublereal* table,
+                      const std::vector<vector_fp>& polys,
+                      double deltastar) const;
+
     std::vector<vector_fp>  m_o22poly;
 
     std::vector<vector_fp>  m_apoly;
@@ -79,15 +79,67 @@ doublereal MixTransport::thermalConductivity()
         updateCond_T();
     }
     if (!m_condmix_ok) {
-        doublereal sum1 = 0.0, sum2 = 0.0;
+        evalMixConductivity();
+    }
+    return m_lambda;
+}
+
+void MixTransport::evalMixConductivity()
+{
+    doublereal sum1 = 0.0, sum2 = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        sum1 += m_molefracs[k] * m_cond[k];
+        sum2 += m_molefracs[k] / m_cond[k];
+    }
+    m_lambda = 0.5*(sum1 + 1.0/sum2);
+    m_condmix_ok = true;
+}
+
+void MixTransport::getMixTransportProperties(size_t npoints,
+                                             const doublereal* T, doublereal P,
+                                             const doublereal* X,
+                                             doublereal* visc, doublereal* cond,
+                                             doublereal* d)
+{
+    // update_T() takes the temperature from the phase. Everything else is
+    // evaluated from the arguments, so the composition and pressure of the
+    // phase are not needed.
+    doublereal T0 = m_thermo->temperature();
+    vector_fp dk(m_nsp);
+    for (size_t n = 0; n < npoints; n++) {
+        m_thermo->setTemperature(T[n]);
+        update_T();
+
+        doublereal mmw = 0.0;
         for (size_t k = 0; k < m_nsp; k++) {
-            sum1 += m_molefracs[k] * m_cond[k];
-            sum2 += m_molefracs[k] / m_cond[k];
+            doublereal x = X[k*npoints + n];
+            mmw += x * m_mw[k];
+            // add an offset to avoid a pure species condition
+            m_molefracs[k] = std::max(Tiny, x);
+        }
+
+        if (visc) {
+            visc[n] = evalMixViscosity();
+        }
+        if (cond) {
+            if (!m_spcond_ok) {
+                updateCond_T();
+            }
+            evalMixConductivity();
+            cond[n] = m_lambda;
+        }
+        if (d) {
+            evalMixDiffCoeffs(P, mmw, &dk[0]);
+            for (size_t k = 0; k < m_nsp; k++) {
+                d[k*npoints + n] = dk[k];
+            }
         }
-        m_lambda = 0.5*(sum1 + 1.0/sum2);
-        m_condmix_ok = true;
     }
-    return m_lambda;
+    m_thermo->setTemperature(T0);
+
+    // m_molefracs no longer holds the composition of the phase
+    m_visc_ok = false;
+    m_condmix_ok = false;
 }
 
 void MixTransport::getThermalDiffCoeffs(doublereal* const dt)
@@ -161,13 +213,14 @@ void MixTransport::update_C()
 
 void MixTransport::updateCond_T()
 {
+    evalFits(m_fits->condcoeffs_cm, m_nsp, &m_cond[0]);
     if (m_mode == CK_Mode) {
         for (size_t k = 0; k < m_nsp; k++) {
-            m_cond[k] = exp(dot4(m_polytempvec, m_condcoeffs[k]));
+            m_cond[k] = exp(m_cond[k]);
         }
     } else {
         for (size_t k = 0; k < m_nsp; k++) {
-            m_cond[k] = m_sqrt_t * dot5(m_polytempvec, m_condcoeffs[k]);
+            m_cond[k] *= m_sqrt_t;
         }
     }
     m_spcond_ok = true;
@@ -35,7 +35,12 @@ inline doublereal Frot(doublereal tr, doublereal sqtr)
 //////////////////// class MultiTransport methods //////////////
 
 MultiTransport::MultiTransport(thermo_t* thermo)
-    : GasTransport(thermo)
+    : GasTransport(thermo),
+      m_iterative(false),
+      m_cg_maxiter(50),
+      m_cg_rtol(1.0e-8),
+      m_cg_iterations(0),
+      m_series_order(2)
 {
 }
 
@@ -48,6 +53,7 @@ void MultiTransport::init(ThermoPhase* thermo, int mode, int log_level)
     m_a.resize(3*m_nsp, 1.0);
     m_b.resize(3*m_nsp, 0.0);
     m_aa.resize(m_nsp, m_nsp, 0.0);
+    m_bdiff.resize(m_nsp, m_nsp);
     m_molefracs_last.resize(m_nsp, -1.0);
 
     m_frot_298.resize(m_nsp);
@@ -71,6 +77,7 @@ void MultiTransport::init(ThermoPhase* thermo, int mode, int log_level)
     m_spwork1.resize(m_nsp);
     m_spwork2.resize(m_nsp);
     m_spwork3.resize(m_nsp);
+    m_cgwork.resize(12*m_nsp);
 
     // precompute and store log(epsilon_ij/k_B)
     m_log_eps_k.resize(m_nsp, m_nsp);
@@ -93,8 +100,28 @@ void MultiTransport::init(ThermoPhase* thermo, int mode, int log_level)
     }
 }
 
+void MultiTransport::setIterativeSolver(bool iterative, size_t maxIter,
+                                        doublereal rtol, size_t seriesOrder)
+{
+    if (maxIter == 0 || rtol <= 0.0) {
+        throw CanteraError("MultiTransport::setIterativeSolver",
+                           "maxIter and rtol must be positive");
+    }
+    m_iterative = iterative;
+    m_cg_maxiter = maxIter;
+    m_cg_rtol = rtol;
+    m_series_order = seriesOrder;
+
+    // The L matrix holds different forms of the L00,00 block for the two
+    // methods
+    m_l0000_ok = false;
+    m_lmatrix_soln_ok = false;
+}
+
 doublereal MultiTransport::thermalConductivity()
 {
+    updateThermal_T();
+    update_C();
     solveLMatrixEquation();
     doublereal sum = 0.0;
     for (size_t k = 0; k  < 2*m_nsp; k++) {
@@ -105,6 +132,8 @@ doublereal MultiTransport::thermalConductivity()
 
 void MultiTransport::getThermalDiffCoeffs(doublereal* const dt)
 {
+    updateThermal_T();
+    update_C();
     solveLMatrixEquation();
     const doublereal c = 1.6/GasConstant;
     for (size_t k = 0; k < m_nsp; k++) {
@@ -114,9 +143,6 @@ void MultiTransport::getThermalDiffCoeffs(doublereal* const dt)
 
 void MultiTransport::solveLMatrixEquation()
 {
-    // if T has changed, update the temperature-dependent properties.
-    updateThermal_T();
-    update_C();
     if (m_lmatrix_soln_ok) {
         return;
     }
@@ -154,7 +180,11 @@ void MultiTransport::solveLMatrixEquation()
     m_Lmatrix.resize(3*m_nsp, 3*m_nsp, 0.0);
 
     //! Evaluate the upper-left block of the L matrix.
-    eval_L0000(DATA_PTR(m_molefracs));
+    if (m_iterative) {
+        eval_L0000_sym(DATA_PTR(m_molefracs));
+    } else {
+        eval_L0000(DATA_PTR(m_molefracs));
+    }
     eval_L0010(DATA_PTR(m_molefracs));
     eval_L0001();
     eval_L1000();
@@ -164,9 +194,17 @@ void MultiTransport::solveLMatrixEquation()
     eval_L0110();
     eval_L0101(DATA_PTR(m_molefracs));
 
-    // Solve it using GMRES or LU decomposition. The last solution
-    // in m_a should provide a good starting guess, so convergence
-    // should be fast.
+    // Solve it using conjugate gradients or LU decomposition. The last
+    // solution in m_a provides a good starting guess for the conjugate
+    // gradient iterations, so convergence should be fast.
+    if (m_iterative) {
+        solveLMatrixCG();
+        m_lmatrix_soln_ok = true;
+        m_molefracs_last = m_molefracs;
+        // L matrix holds the symmetric form of L00,00
+        m_l0000_ok = false;
+        return;
+    }
 
     copy(m_b.begin(), m_b.end(), m_a.begin());
     try {
@@ -404,6 +442,17 @@ void MultiTransport::getMultiDiffCoeffs(const size_t ld, doublereal* const d)
     update_T();
     updateThermal_T();
 
+    evalMultiDiffCoeffs(p, m_thermo->meanMolecularWeight(), ld, d);
+}
+
+void MultiTransport::evalMultiDiffCoeffs(doublereal p, doublereal mmw,
+                                         size_t ld, doublereal* const d)
+{
+    if (m_iterative) {
+        evalMultiDiffCoeffsSeries(p, mmw, ld, d);
+        return;
+    }
+
     // evaluate L0000 if the temperature or concentrations have
     // changed since it was last evaluated.
     if (!m_l0000_ok) {
@@ -419,8 +468,7 @@ void MultiTransport::getMultiDiffCoeffs(const size_t ld, doublereal* const d)
     m_l0000_ok = false;           // matrix is overwritten by inverse
     m_lmatrix_soln_ok = false;
 
-    doublereal prefactor = 16.0 * m_temp
-                           * m_thermo->meanMolecularWeight()/(25.0 * p);
+    doublereal prefactor = 16.0 * m_temp * mmw / (25.0 * p);
     doublereal c;
 
     for (size_t i = 0; i < m_nsp; i++) {
@@ -432,6 +480,167 @@ void MultiTransport::getMultiDiffCoeffs(const size_t ld, doublereal* const d)
     }
 }
 
+void MultiTransport::evalMultiDiffCoeffsSeries(doublereal p, doublereal mmw,
+                                               size_t ld, doublereal* const d)
+{
+    // The multicomponent diffusion coefficients are
+    //
+    //     D_ij = mmw / (p W_j) x_i (V_ii - V_ij)
+    //
+    // where V is the symmetric matrix satisfying S V = P^T and V y = 0, S is
+    // the Stefan-Maxwell matrix, P = I - 1 y^T is the projector onto the
+    // space orthogonal to the mass fractions y, and 1 is a vector of ones.
+    // With the splitting S = T - Z, where T_ii = S_ii/(1 - y_i), V is the sum
+    // of the convergent series
+    //
+    //     V_0 = P T^-1 P^T,   V_n+1 = V_n + P T^-1 (P^T - S V_n)
+    //
+    // [Ern and Giovangigli, J. Comput. Phys. 120:105-116, 1995].
+    const doublereal* x = DATA_PTR(m_molefracs);
+    doublereal* y = DATA_PTR(m_cgwork);
+    doublereal* tinv = y + m_nsp;
+    doublereal* g = y + 2*m_nsp;
+    doublereal* h = y + 3*m_nsp;
+
+    doublereal sum = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        y[k] = x[k] * m_mw[k];
+        sum += y[k];
+    }
+    for (size_t k = 0; k < m_nsp; k++) {
+        y[k] /= sum;
+    }
+
+    m_smatrix.resize(m_nsp, m_nsp);
+    for (size_t j = 0; j < m_nsp; j++) {
+        doublereal diag = 0.0;
+        for (size_t i = 0; i < m_nsp; i++) {
+            if (i != j) {
+                m_smatrix(i,j) = - x[i] * x[j] / m_bdiff(i,j);
+                diag -= m_smatrix(i,j);
+            }
+        }
+        m_smatrix(j,j) = diag;
+        tinv[j] = (1.0 - y[j]) / diag;
+        g[j] = tinv[j] * y[j];
+    }
+
+    // zeroth order term: V_0 = T^-1 - g 1^T - 1 g^T + s 1 1^T, with g = T^-1 y
+    // and s = y^T T^-1 y
+    doublereal s = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        s += y[k] * g[k];
+    }
+    m_vmatrix.resize(m_nsp, m_nsp);
+    for (size_t j = 0; j < m_nsp; j++) {
+        for (size_t i = 0; i < m_nsp; i++) {
+            m_vmatrix(i,j) = s - g[i] - g[j];
+        }
+        m_vmatrix(j,j) += tinv[j];
+    }
+
+    m_rmatrix.resize(m_nsp, m_nsp);
+    for (size_t n = 0; n < m_series_order; n++) {
+        // residual R = P^T - S V_n
+        if (n == 0) {
+            // S V_0 = S T^-1 - (S g) 1^T, since S 1 = 0
+            multiply(m_smatrix, g, h);
+            for (size_t j = 0; j < m_nsp; j++) {
+                for (size_t i = 0; i < m_nsp; i++) {
+                    m_rmatrix(i,j) = h[i] - y[i] - m_smatrix(i,j) * tinv[j];
+                }
+            }
+        } else {
+            for (size_t j = 0; j < m_nsp; j++) {
+                multiply(m_smatrix, m_vmatrix.ptrColumn(j),
+                         m_rmatrix.ptrColumn(j));
+                for (size_t i = 0; i < m_nsp; i++) {
+                    m_rmatrix(i,j) = - y[i] - m_rmatrix(i,j);
+                }
+            }
+        }
+        for (size_t j = 0; j < m_nsp; j++) {
+            m_rmatrix(j,j) += 1.0;
+        }
+
+        // V_n+1 = V_n + P T^-1 R
+        for (size_t j = 0; j < m_nsp; j++) {
+            doublereal* r = m_rmatrix.ptrColumn(j);
+            doublereal ysum = 0.0;
+            for (size_t i = 0; i < m_nsp; i++) {
+                r[i] *= tinv[i];
+                ysum += y[i] * r[i];
+            }
+            doublereal* v = m_vmatrix.ptrColumn(j);
+            for (size_t i = 0; i < m_nsp; i++) {
+                v[i] += r[i] - ysum;
+            }
+        }
+    }
+
+    doublereal prefactor = mmw / p;
+    for (size_t j = 0; j < m_nsp; j++) {
+        doublereal c = prefactor / m_mw[j];
+        for (size_t i = 0; i < m_nsp; i++) {
+            d[ld*j + i] = c * x[i] * (m_vmatrix(i,i) - m_vmatrix(i,j));
+        }
+    }
+}
+
+void MultiTransport::getMultiTransportProperties(size_t npoints,
+        const doublereal* T, doublereal P, const doublereal* X,
+        doublereal* visc, doublereal* cond, doublereal* d, doublereal* dt)
+{
+    // update_T() and updateThermal_T() take the temperature from the phase.
+    // Everything else is evaluated from the arguments.
+    doublereal T0 = m_thermo->temperature();
+    vector_fp dk(d ? m_nsp*m_nsp : 0);
+    for (size_t n = 0; n < npoints; n++) {
+        m_thermo->setTemperature(T[n]);
+        update_T();
+        updateThermal_T();
+
+        doublereal mmw = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            doublereal x = X[k*npoints + n];
+            mmw += x * m_mw[k];
+            // add an offset to avoid a pure species condition
+            m_molefracs[k] = std::max(Tiny, x);
+            if (m_molefracs[k] != m_molefracs_last[k]) {
+                m_l0000_ok = false;
+                m_lmatrix_soln_ok = false;
+            }
+        }
+
+        if (visc) {
+            visc[n] = evalMixViscosity();
+        }
+        if (cond || dt) {
+            solveLMatrixEquation();
+        }
+        if (cond) {
+            doublereal sum = 0.0;
+            for (size_t k = 0; k < 2*m_nsp; k++) {
+                sum += m_b[k + m_nsp] * m_a[k + m_nsp];
+            }
+            cond[n] = -4.0*sum;
+        }
+        if (dt) {
+            const doublereal c = 1.6/GasConstant;
+            for (size_t k = 0; k < m_nsp; k++) {
+                dt[k*npoints + n] = c * m_mw[k] * m_molefracs[k] * m_a[k];
+            }
+        }
+        if (d) {
+            evalMultiDiffCoeffs(P, mmw, m_nsp, &dk[0]);
+            for (size_t i = 0; i < m_nsp*m_nsp; i++) {
+                d[i*npoints + n] = dk[i];
+            }
+        }
+    }
+    m_thermo->setTemperature(T0);
+}
+
 void MultiTransport::update_T()
 {
     if (m_temp == m_thermo->temperature()) {
@@ -464,6 +673,22 @@ void MultiTransport::update_C()
     }
 }
 
+void MultiTransport::updateDiff_T()
+{
+    GasTransport::updateDiff_T();
+    // Column i of m_bdiff starts at [i*m_nsp], and the pairs (i,j) with
+    // j > i are contiguous in both the packed array and column i.
+    doublereal* bdiff = &m_bdiff(0,0);
+    size_t ic = 0;
+    for (size_t i = 0; i < m_nsp; i++) {
+        for (size_t j = i; j < m_nsp; j++) {
+            bdiff[i*m_nsp + j] = m_bdiff_packed[ic];
+            bdiff[j*m_nsp + i] = m_bdiff_packed[ic];
+            ic++;
+        }
+    }
+}
+
 void MultiTransport::updateThermal_T()
 {
     if (m_thermal_tlast == m_thermo->temperature()) {
@@ -564,6 +789,95 @@ void MultiTransport::eval_L0000(const doublereal* const x)
     }
 }
 
+void MultiTransport::eval_L0000_sym(const doublereal* const x)
+{
+    doublereal prefactor = 16.0*m_temp/25.0;
+    for (size_t j = 0; j < m_nsp; j++) {
+        doublereal sum = 0.0;
+        for (size_t i = 0; i < m_nsp; i++) {
+            if (i != j) {
+                m_Lmatrix(i,j) = prefactor * x[i] * x[j] / m_bdiff(i,j);
+                sum += m_Lmatrix(i,j);
+            }
+        }
+        m_Lmatrix(j,j) = -sum;
+    }
+}
+
+void MultiTransport::solveLMatrixCG()
+{
+    // The L matrix in symmetric form is negative semidefinite, so solve
+    // (-L) a = -b. Its null space is spanned by vectors which are constant
+    // in the first block and zero elsewhere.
+    size_t n = 3*m_nsp;
+    doublereal* r = DATA_PTR(m_cgwork);
+    doublereal* z = r + n;
+    doublereal* p = r + 2*n;
+    doublereal* q = r + 3*n;
+
+    // The equations for species with no internal modes are a[2*m_nsp+k] = 0,
+    // which are written with the sign of the other equations
+    for (size_t k = 0; k < m_nsp; k++) {
+        if (!hasInternalModes(k)) {
+            m_Lmatrix(2*m_nsp + k, 2*m_nsp + k) = -1.0;
+        }
+    }
+
+    // Initial residual for the starting guess from the last solution, and
+    // the preconditioned norm of the right-hand side
+    multiply(m_Lmatrix, DATA_PTR(m_a), q);
+    doublereal rz = 0.0, bnorm = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        doublereal diag = - m_Lmatrix(i,i);
+        r[i] = q[i] - m_b[i];
+        z[i] = r[i] / diag;
+        p[i] = z[i];
+        rz += r[i] * z[i];
+        bnorm += m_b[i] * m_b[i] / diag;
+    }
+    doublereal tol = m_cg_rtol * m_cg_rtol * bnorm;
+
+    m_cg_iterations = 0;
+    while (rz > tol && m_cg_iterations < m_cg_maxiter) {
+        multiply(m_Lmatrix, p, q);
+        doublereal pq = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            q[i] = -q[i];
+            pq += p[i] * q[i];
+        }
+        if (pq <= 0.0) {
+            // The search direction is in the null space to within round-off
+            // error, so no further progress is possible
+            break;
+        }
+        doublereal alpha = rz / pq;
+        doublereal rz_new = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            m_a[i] += alpha * p[i];
+            r[i] -= alpha * q[i];
+            z[i] = - r[i] / m_Lmatrix(i,i);
+            rz_new += r[i] * z[i];
+        }
+        doublereal beta = rz_new / rz;
+        rz = rz_new;
+        for (size_t i = 0; i < n; i++) {
+            p[i] = z[i] + beta * p[i];
+        }
+        m_cg_iterations++;
+    }
+
+    // Fix the constant in the first block so that the thermal diffusion
+    // coefficients sum to zero
+    doublereal sum = 0.0, wsum = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        sum += m_molefracs[k] * m_mw[k] * m_a[k];
+        wsum += m_molefracs[k] * m_mw[k];
+    }
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_a[k] -= sum / wsum;
+    }
+}
+
 void MultiTransport::eval_L0010(const doublereal* const x)
 {
     doublereal prefactor = 1.6*m_temp;
@@ -579,10 +893,14 @@ void MultiTransport::eval_L0010(const doublereal* const x)
                                      ((wj + m_mw[i]) * m_bdiff(j,i));
 
             //  the next term is independent of "j";
-            //  need to do it for the "j,j" term
-            sum -= m_Lmatrix(i,j+m_nsp);
+            //  need to do it for the "j,j" term. The i = j term cancels,
+            //  and is left out of the sum to avoid round-off error for
+            //  dominant species.
+            if (i != j) {
+                sum -= m_Lmatrix(i,j+m_nsp);
+            }
         }
-        m_Lmatrix(j,j+m_nsp) += sum;
+        m_Lmatrix(j,j+m_nsp) = sum;
     }
 }
 
@@ -110,6 +110,70 @@ void Transport::finalize()
                            "finalize has already been called.");
 }
 
+void Transport::getMixTransportProperties(size_t npoints, const doublereal* T,
+                                          doublereal P, const doublereal* X,
+                                          doublereal* visc, doublereal* cond,
+                                          doublereal* d)
+{
+    vector_fp state, x(m_nsp), dk(m_nsp);
+    m_thermo->saveState(state);
+    for (size_t n = 0; n < npoints; n++) {
+        for (size_t k = 0; k < m_nsp; k++) {
+            x[k] = X[k*npoints + n];
+        }
+        m_thermo->setMoleFractions_NoNorm(&x[0]);
+        m_thermo->setState_TP(T[n], P);
+        if (visc) {
+            visc[n] = viscosity();
+        }
+        if (cond) {
+            cond[n] = thermalConductivity();
+        }
+        if (d) {
+            getMixDiffCoeffs(&dk[0]);
+            for (size_t k = 0; k < m_nsp; k++) {
+                d[k*npoints + n] = dk[k];
+            }
+        }
+    }
+    m_thermo->restoreState(state);
+}
+
+void Transport::getMultiTransportProperties(size_t npoints, const doublereal* T,
+                                            doublereal P, const doublereal* X,
+                                            doublereal* visc, doublereal* cond,
+                                            doublereal* d, doublereal* dt)
+{
+    vector_fp state, x(m_nsp), dk(m_nsp*m_nsp);
+    m_thermo->saveState(state);
+    for (size_t n = 0; n < npoints; n++) {
+        for (size_t k = 0; k < m_nsp; k++) {
+            x[k] = X[k*npoints + n];
+        }
+        m_thermo->setMoleFractions_NoNorm(&x[0]);
+        m_thermo->setState_TP(T[n], P);
+        if (visc) {
+            visc[n] = viscosity();
+        }
+        if (cond) {
+            cond[n] = thermalConductivity();
+        }
+        if (d) {
+            getMultiDiffCoeffs(m_nsp, &dk[0]);
+            for (size_t i = 0; i < m_nsp*m_nsp; i++) {
+                d[i*npoints + n] = dk[i];
+            }
+        }
+        if (dt) {
+            getThermalDiffCoeffs(&dk[0]);
+            for (size_t k = 0; k < m_nsp; k++) {
+                dt[k*npoints + n] = dk[k];
+            }
+        }
+    }
+    m_thermo->restoreState(state);
+}
+
 void Transport::getSpeciesFluxes(size_t ndim, const doublereal* const grad_T,
                                  size_t ldx, const doublereal* const grad_X,
                                  size_t ldf, doublereal* const fluxes)
@@ -392,6 +392,41 @@ size_t Reactor::componentIndex(const string& nm) const
     }
 }
 
+void Reactor::getChemistryJacobian(std::vector<size_t>& rows,
+                                   std::vector<size_t>& cols,
+                                   vector_fp& values)
+{
+    if (!m_chem) {
+        return;
+    }
+    restoreState();
+    size_t kstart = componentIndex(m_thermo->speciesName(0));
+    size_t iT = componentIndex("T");
+    std::vector<size_t> colStart, rowIndex;
+    vector_fp jac;
+    m_kin->getNetProductionRatesJacobian(colStart, rowIndex, jac);
+
+    // Y_k' = W_k wdot_k / rho, and C_j = rho Y_j / W_j
+    const vector_fp& mw = m_thermo->molecularWeights();
+    double rho = m_thermo->density();
+    for (size_t j = 0; j < m_nsp; j++) {
+        for (size_t p = colStart[j]; p < colStart[j+1]; p++) {
+            size_t k = rowIndex[p];
+            rows.push_back(kstart + k);
+            cols.push_back(kstart + j);
+            values.push_back(jac[p] * mw[k] / mw[j]);
+        }
+    }
+    if (iT != npos && m_energy) {
+        for (size_t p = colStart[m_nsp]; p < colStart[m_nsp+1]; p++) {
+            size_t k = rowIndex[p];
+            rows.push_back(kstart + k);
+            cols.push_back(iT);
+            values.push_back(jac[p] * mw[k] / rho);
+        }
+    }
+}
+
 void Reactor::applySensitivity(double* params)
 {
     if (!params) {
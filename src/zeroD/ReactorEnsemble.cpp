@@ -0,0 +1,192 @@
+//! @file ReactorEnsemble.cpp
+#include "cantera/zeroD/ReactorEnsemble.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/IdealGasConstPressureReactor.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/kinetics/KineticsFactory.h"
+
+#ifdef THREAD_SAFE_CANTERA
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+#endif
+
+#include <limits>
+#include <memory>
+
+using namespace std;
+
+namespace Cantera
+{
+
+ReactorEnsemble::ReactorEnsemble(const std::string& infile,
+                                 const std::string& id) :
+    m_phase_xml(0),
+    m_thermo(0),
+    m_kin(0),
+    m_tEnd(1.0),
+    m_rtol(1.0e-9),
+    m_atol(1.0e-15),
+    m_nThreads(1),
+    m_saveTrajectories(false),
+    m_next(0)
+{
+    XML_Node* root = get_XML_File(infile);
+    m_phase_xml = get_XML_NameID("phase", "#"+id, root);
+    if (!m_phase_xml) {
+        throw CanteraError("ReactorEnsemble::ReactorEnsemble",
+                           "Couldn't find phase named \"" + id + "\" in file "
+                           + infile);
+    }
+    m_thermo = newPhase(*m_phase_xml);
+    std::vector<ThermoPhase*> phases(1, m_thermo);
+    m_kin = newKineticsMgr(*m_phase_xml, phases);
+#ifdef THREAD_SAFE_CANTERA
+    m_nThreads = std::max<size_t>(boost::thread::hardware_concurrency(), 1);
+#endif
+}
+
+ReactorEnsemble::~ReactorEnsemble()
+{
+    delete m_kin;
+    delete m_thermo;
+}
+
+void ReactorEnsemble::addInitialState(double T, double P, const std::string& X)
+{
+    m_thermo->setState_TPX(T, P, X);
+    m_T0.push_back(T);
+    m_P0.push_back(P);
+    m_X0.push_back(vector_fp(m_thermo->nSpecies()));
+    m_thermo->getMoleFractions(&m_X0.back()[0]);
+}
+
+void ReactorEnsemble::addInitialState(double T, double P, const doublereal* X)
+{
+    m_thermo->setState_TPX(T, P, X);
+    m_T0.push_back(T);
+    m_P0.push_back(P);
+    m_X0.push_back(vector_fp(m_thermo->nSpecies()));
+    m_thermo->getMoleFractions(&m_X0.back()[0]);
+}
+
+void ReactorEnsemble::run()
+{
+    size_t n = nStates();
+    m_tau.assign(n, std::numeric_limits<double>::quiet_NaN());
+    m_Tfinal.assign(n, std::numeric_limits<double>::quiet_NaN());
+    m_errors.assign(n, "");
+    m_times.assign(n, vector_fp());
+    m_states.assign(n, vector_fp());
+    m_next = 0;
+
+#ifdef THREAD_SAFE_CANTERA
+    boost::thread_group workers;
+    for (size_t i = 0; i < std::min(m_nThreads, n); i++) {
+        workers.create_thread(boost::bind(&ReactorEnsemble::runWorker, this));
+    }
+    workers.join_all();
+#else
+    runWorker();
+#endif
+}
+
+size_t ReactorEnsemble::nextCase()
+{
+    ScopedLock lock(m_mutex);
+    if (m_next < nStates()) {
+        return m_next++;
+    }
+    return npos;
+}
+
+void ReactorEnsemble::runWorker()
+{
+    // Each worker uses its own phase and kinetics objects, which are copied
+    // from the prototypes, sharing their parameter data, and reused for all
+    // of the worker's cases.
+    ThermoPhase* thermo = 0;
+    Kinetics* kin = 0;
+    std::string setupError;
+    try {
+        ScopedLock lock(m_mutex);
+        thermo = m_thermo->duplMyselfAsThermoPhase();
+        std::vector<ThermoPhase*> phases(1, thermo);
+        kin = m_kin->duplMyselfAsKinetics(phases);
+    } catch (CanteraError& err) {
+        setupError = err.getMessage();
+    }
+
+    for (size_t i = nextCase(); i != npos; i = nextCase()) {
+        if (!setupError.empty()) {
+            m_errors[i] = setupError;
+            continue;
+        }
+        try {
+            solve(i, *thermo, *kin);
+        } catch (CanteraError& err) {
+            m_errors[i] = err.getMessage();
+        } catch (std::exception& err) {
+            m_errors[i] = err.what();
+        }
+    }
+
+    delete kin;
+    delete thermo;
+#ifdef THREAD_SAFE_CANTERA
+    thread_complete();
+#endif
+}
+
+void ReactorEnsemble::solve(size_t i, ThermoPhase& thermo, Kinetics& kin)
+{
+    thermo.setState_TPX(m_T0[i], m_P0[i], &m_X0[i][0]);
+    std::auto_ptr<Reactor> r;
+    if (thermo.eosType() == cIdealGas) {
+        r.reset(new IdealGasConstPressureReactor());
+    } else {
+        r.reset(new ConstPressureReactor());
+    }
+    r->setThermoMgr(thermo);
+    r->setKineticsMgr(kin);
+
+    ReactorNet net;
+    net.addReactor(*r);
+    net.setTolerances(m_rtol, m_atol);
+    if (!m_solverType.empty()) {
+        net.setLinearSolverType(m_solverType);
+    }
+
+    size_t nsp = thermo.nSpecies();
+    vector_fp& times = m_times[i];
+    vector_fp& states = m_states[i];
+    double tprev = 0.0;
+    double Tprev = r->temperature();
+    if (m_saveTrajectories) {
+        times.push_back(tprev);
+        states.push_back(Tprev);
+        states.insert(states.end(), r->massFractions(),
+                      r->massFractions() + nsp);
+    }
+
+    double dTdt_max = 0.0;
+    while (net.time() < m_tEnd) {
+        double t = net.step(m_tEnd);
+        double T = r->temperature();
+        double dTdt = (T - Tprev) / (t - tprev);
+        if (dTdt > dTdt_max) {
+            dTdt_max = dTdt;
+            m_tau[i] = 0.5 * (t + tprev);
+        }
+        if (m_saveTrajectories) {
+            times.push_back(t);
+            states.push_back(T);
+            states.insert(states.end(), r->massFractions(),
+                          r->massFractions() + nsp);
+        }
+        tprev = t;
+        Tprev = T;
+    }
+    m_Tfinal[i] = r->temperature();
+}
+
+}
@@ -207,6 +207,71 @@ void ReactorNet::evalJacobian(doublereal t, doublereal* y,
     }
 }
 
+void ReactorNet::setLinearSolverType(const std::string& type)
+{
+    if (type == "DENSE") {
+        m_integ->setProblemType(DENSE + NOJAC);
+    } else if (type == "GMRES") {
+        m_integ->setProblemType(GMRES + PRECON);
+    } else if (type == "BICGSTAB") {
+        m_integ->setProblemType(BICGSTAB + PRECON);
+    } else {
+        throw CanteraError("ReactorNet::setLinearSolverType",
+                           "Unknown linear solver type '" + type + "'");
+    }
+    m_init = false;
+}
+
+bool ReactorNet::preconditionerSetup(double t, double* y, double gamma,
+                                     bool jok)
+{
+    if (!jok) {
+        updateState(y);
+        m_jac_rows.clear();
+        m_jac_cols.clear();
+        m_jac_values.clear();
+        for (size_t n = 0; n < m_reactors.size(); n++) {
+            size_t nz = m_jac_rows.size();
+            m_reactors[n]->getChemistryJacobian(m_jac_rows, m_jac_cols,
+                                                m_jac_values);
+            for (size_t i = nz; i < m_jac_rows.size(); i++) {
+                m_jac_rows[i] += m_start[n];
+                m_jac_cols[i] += m_start[n];
+            }
+        }
+    }
+
+    // Assemble P = I - gamma * J
+    size_t nz = m_jac_rows.size();
+    m_precon_rows.resize(nz + m_nv);
+    m_precon_cols.resize(nz + m_nv);
+    m_precon_values.resize(nz + m_nv);
+    for (size_t i = 0; i < nz; i++) {
+        m_precon_rows[i] = m_jac_rows[i];
+        m_precon_cols[i] = m_jac_cols[i];
+        m_precon_values[i] = -gamma * m_jac_values[i];
+    }
+    for (size_t i = 0; i < m_nv; i++) {
+        m_precon_rows[nz+i] = i;
+        m_precon_cols[nz+i] = i;
+        m_precon_values[nz+i] = 1.0;
+    }
+    int info = m_precon.factor(m_nv, m_precon_rows, m_precon_cols,
+                               m_precon_values);
+    if (info) {
+        throw CanteraError("ReactorNet::preconditionerSetup",
+                           "Zero pivot in row " + int2str(info - 1));
+    }
+    return !jok;
+}
+
+void ReactorNet::preconditionerSolve(double t, double* y, double* r,
+                                     double* z)
+{
+    copy(r, r + m_nv, z);
+    m_precon.solve(z);
+}
+
 void ReactorNet::updateState(doublereal* y)
 {
     for (size_t n = 0; n < m_reactors.size(); n++) {
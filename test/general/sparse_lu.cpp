@@ -0,0 +1,66 @@
+#include "gtest/gtest.h"
+#include "cantera/numerics/SparseLU.h"
+
+namespace Cantera
+{
+
+TEST(SparseLU, solve)
+{
+    // A 5x5 matrix whose factorization has fill-in:
+    //  [ 4 1 0 0 1 ]
+    //  [ 1 4 0 0 0 ]
+    //  [ 0 0 3 1 0 ]
+    //  [ 2 0 1 5 0 ]
+    //  [ 0 0 0 1 2 ]
+    size_t r[] = {0, 0, 0, 1, 1, 2, 2, 3, 3, 3, 4, 4};
+    size_t c[] = {0, 1, 4, 0, 1, 2, 3, 0, 2, 3, 3, 4};
+    double v[] = {4, 1, 1, 1, 4, 3, 1, 2, 1, 5, 1, 2};
+    std::vector<size_t> rows(r, r+12), cols(c, c+12);
+    vector_fp values(v, v+12);
+
+    SparseLU lu;
+    ASSERT_EQ(0, lu.factor(5, rows, cols, values));
+    EXPECT_GT(lu.nnz(), rows.size());
+
+    double x[] = {1.0, -2.0, 0.5, 3.0, -1.5};
+    vector_fp b(5, 0.0);
+    for (size_t i = 0; i < rows.size(); i++) {
+        b[rows[i]] += values[i] * x[cols[i]];
+    }
+    lu.solve(&b[0]);
+    for (size_t i = 0; i < 5; i++) {
+        EXPECT_NEAR(x[i], b[i], 1e-14);
+    }
+
+    // Refactor with new values and duplicate diagonal entries
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] *= 2;
+    }
+    for (size_t i = 0; i < 5; i++) {
+        rows.push_back(i);
+        cols.push_back(i);
+        values.push_back(1.0);
+    }
+    ASSERT_EQ(0, lu.factor(5, rows, cols, values));
+    b.assign(5, 0.0);
+    for (size_t i = 0; i < rows.size(); i++) {
+        b[rows[i]] += values[i] * x[cols[i]];
+    }
+    lu.solve(&b[0]);
+    for (size_t i = 0; i < 5; i++) {
+        EXPECT_NEAR(x[i], b[i], 1e-14);
+    }
+}
+
+TEST(SparseLU, zero_pivot)
+{
+    size_t r[] = {0, 0, 1, 1};
+    size_t c[] = {0, 1, 0, 1};
+    double v[] = {1, 2, 2, 4};
+    std::vector<size_t> rows(r, r+4), cols(c, c+4);
+    vector_fp values(v, v+4);
+    SparseLU lu;
+    EXPECT_EQ(2, lu.factor(2, rows, cols, values));
+}
+
+}
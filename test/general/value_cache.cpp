@@ -0,0 +1,66 @@
+#include "gtest/gtest.h"
+#include "cantera/base/ValueCache.h"
+
+namespace Cantera
+{
+
+TEST(ValueCache, uniqueIds)
+{
+    int id1 = ValueCache::getId();
+    int id2 = ValueCache::getId();
+    ValueCache cache;
+    int id3 = cache.getId();
+    EXPECT_GT(id1, 0);
+    EXPECT_NE(id1, id2);
+    EXPECT_NE(id2, id3);
+    EXPECT_NE(id1, id3);
+}
+
+TEST(ValueCache, validate)
+{
+    ValueCache cache;
+    int id = cache.getId();
+    CachedScalar cached = cache.getScalar(id);
+    EXPECT_FALSE(cached.validate(300.0, 101325.0, 4));
+    cached.value = 2.5;
+    EXPECT_TRUE(cached.validate(300.0, 101325.0, 4));
+    EXPECT_FALSE(cached.validate(300.0, 101325.0, 5));
+    EXPECT_TRUE(cache.getScalar(id).validate(300.0, 101325.0, 5));
+    EXPECT_EQ(2.5, cache.getScalar(id).value);
+}
+
+TEST(ValueCache, stableReferences)
+{
+    ValueCache cache;
+    int id1 = cache.getId();
+    CachedScalar s1 = cache.getScalar(id1);
+    CachedArray a1 = cache.getArray(id1);
+    s1.value = 3.0;
+    a1.value.assign(3, 1.0);
+
+    // Adding many more entries must not invalidate the held references
+    for (int i = 0; i < 100; i++) {
+        int id = cache.getId();
+        cache.getScalar(id).value = i;
+        cache.getArray(id).value.assign(2, i);
+    }
+    EXPECT_EQ(&s1, &cache.getScalar(id1));
+    EXPECT_EQ(&a1, &cache.getArray(id1));
+    EXPECT_EQ(3.0, s1.value);
+    EXPECT_EQ((size_t) 3, a1.value.size());
+}
+
+TEST(ValueCache, clear)
+{
+    ValueCache cache;
+    int id = cache.getId();
+    CachedScalar cached = cache.getScalar(id);
+    cached.validate(300.0);
+    cache.getArray(id).value.assign(4, 1.0);
+    EXPECT_TRUE(cached.validate(300.0));
+    cache.clear();
+    EXPECT_FALSE(cached.validate(300.0));
+    EXPECT_TRUE(cache.getArray(id).value.empty());
+}
+
+}
@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+#include "cantera/base/ctml.h"
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/kinetics/importKinetics.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace Cantera
+{
+
+class XML_BinaryTest : public testing::Test
+{
+public:
+    ~XML_BinaryTest() {
+        std::remove("gri30-test.ctb");
+    }
+};
+
+TEST_F(XML_BinaryTest, roundTrip)
+{
+    XML_Node* x = get_XML_File("gri30.xml");
+    ctml::ct2ctb("gri30.xml", "gri30-test.ctb");
+    XML_Node* y = get_XML_File("gri30-test.ctb");
+    std::stringstream sx, sy;
+    x->write(sx);
+    y->write(sy);
+    EXPECT_EQ(sx.str(), sy.str());
+    EXPECT_EQ(x->child("ctml").lineNumber(), y->child("ctml").lineNumber());
+}
+
+TEST_F(XML_BinaryTest, kinetics)
+{
+    ctml::ct2ctb("gri30.xml", "gri30-test.ctb");
+    IdealGasPhase thermo1, thermo2;
+    GasKinetics kin1, kin2;
+    buildSolutionFromXML(*get_XML_File("gri30.xml"), "gri30", "phase",
+                         &thermo1, &kin1);
+    buildSolutionFromXML(*get_XML_File("gri30-test.ctb"), "gri30", "phase",
+                         &thermo2, &kin2);
+    ASSERT_EQ(thermo1.nSpecies(), thermo2.nSpecies());
+    ASSERT_EQ(kin1.nReactions(), kin2.nReactions());
+
+    const char* X = "CH4:0.5, O2:1.0, N2:3.76, H:0.01, OH:0.02, CO:0.05";
+    thermo1.setState_TPX(1500, OneAtm, X);
+    thermo2.setState_TPX(1500, OneAtm, X);
+    EXPECT_EQ(thermo1.enthalpy_mass(), thermo2.enthalpy_mass());
+    EXPECT_EQ(thermo1.entropy_mass(), thermo2.entropy_mass());
+    vector_fp w1(thermo1.nSpecies()), w2(thermo2.nSpecies());
+    kin1.getNetProductionRates(&w1[0]);
+    kin2.getNetProductionRates(&w2[0]);
+    for (size_t k = 0; k < w1.size(); k++) {
+        EXPECT_EQ(w1[k], w2[k]) << k;
+    }
+}
+
+TEST_F(XML_BinaryTest, truncated)
+{
+    std::stringstream s;
+    get_XML_File("gri30.xml")->writeBinary(s);
+    std::string data = s.str();
+    std::stringstream s2(data.substr(0, data.size() / 2));
+    XML_Node x("doc");
+    EXPECT_THROW(x.buildBinary(s2), CanteraError);
+
+    std::stringstream s3("<ctml></ctml>");
+    XML_Node y("doc");
+    EXPECT_THROW(y.buildBinary(s3), CanteraError);
+}
+
+}
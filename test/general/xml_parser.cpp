@@ -0,0 +1,153 @@
+#include "gtest/gtest.h"
+#include "cantera/base/xml.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <fstream>
+#include <sstream>
+
+namespace Cantera
+{
+
+TEST(XML_Reader, build)
+{
+    std::stringstream s(
+        "<?xml version=\"1.0\"?>\n"
+        "<ctml>\n"
+        "  <!-- a comment -->\n"
+        "  <phase dim=\"3\" id=\"gas\">\n"
+        "    <elementArray datasrc=\"elements.xml\"> O  H\n"
+        "       N </elementArray>\n"
+        "    <kinetics model=\"GasKinetics\"/>\n"
+        "  </phase>\n"
+        "</ctml>\n");
+    XML_Node root("doc");
+    root.build(s);
+    XML_Node& ctml = root.child("ctml");
+    ASSERT_EQ((size_t) 2, ctml.nChildren());
+    EXPECT_TRUE(ctml.child(0).isComment());
+    EXPECT_EQ(" a comment ", ctml.child(0).value());
+    XML_Node& phase = ctml.child("phase");
+    EXPECT_EQ("gas", phase["id"]);
+    EXPECT_EQ("3", phase["dim"]);
+    EXPECT_EQ(3, phase.lineNumber());
+    EXPECT_EQ("O  H\n N", phase.child("elementArray").value());
+    EXPECT_EQ("GasKinetics", phase.child("kinetics")["model"]);
+    EXPECT_EQ("", phase.child("kinetics").value());
+}
+
+TEST(XML_Reader, tagMismatch)
+{
+    std::stringstream s("<ctml>\n<phase>\n</kinetics>\n</ctml>\n");
+    XML_Node root("doc");
+    EXPECT_THROW(root.build(s), CanteraError);
+}
+
+//! Counts the elements of each name and records the structure of the file
+class CountingHandler : public XML_Handler
+{
+public:
+    CountingHandler() : depth(0), maxDepth(0), ncomments(0) {}
+
+    virtual void startElement(const std::string& name, const std::string& value,
+                              std::map<std::string, std::string>& attribs,
+                              int line) {
+        counts[name]++;
+        depth++;
+        maxDepth = std::max(depth, maxDepth);
+        if (name == "reaction" && !attribs["id"].empty()) {
+            lastReaction = attribs["id"];
+            lastReactionLine = line;
+        } else if (name == "equation") {
+            lastEquation = value;
+        }
+    }
+
+    virtual void endElement(const std::string& name) {
+        depth--;
+    }
+
+    virtual void comment(const std::string& text) {
+        ncomments++;
+    }
+
+    std::map<std::string, int> counts;
+    int depth, maxDepth, ncomments;
+    std::string lastReaction, lastEquation;
+    int lastReactionLine;
+};
+
+TEST(XML_Reader, parse)
+{
+    std::stringstream s(
+        "<?xml version=\"1.0\"?>\n"
+        "<ctml>\n"
+        "  <!-- a comment -->\n"
+        "  <phase dim=\"3\" id=\"gas\">\n"
+        "    <elementArray datasrc=\"elements.xml\"> O  H </elementArray>\n"
+        "    <kinetics model=\"GasKinetics\"/>\n"
+        "  </phase>\n"
+        "</ctml>\n");
+    CountingHandler h;
+    XML_Node::parse(s, h);
+    EXPECT_EQ(1, h.counts["ctml"]);
+    EXPECT_EQ(1, h.counts["phase"]);
+    EXPECT_EQ(1, h.counts["kinetics"]);
+    EXPECT_EQ(0, h.depth);
+    EXPECT_EQ(3, h.maxDepth);
+    EXPECT_EQ(1, h.ncomments);
+
+    std::stringstream s2("<ctml>\n<phase>\n</kinetics>\n</ctml>\n");
+    EXPECT_THROW(XML_Node::parse(s2, h), CanteraError);
+}
+
+TEST(XML_Reader, parseLongInput)
+{
+    // Values, comments and tags which are split between the chunks in which
+    // the input is read
+    std::string longValue(100000, 'x');
+    std::stringstream s;
+    s << "<ctml>\n<!-- " << longValue << " -->\n";
+    for (int i = 0; i < 10000; i++) {
+        s << "<reaction id=\"" << i << "\">\n  <equation>A"
+          << i << "</equation>\n</reaction>\n";
+    }
+    s << "<value>" << longValue << "\n" << longValue << "</value>\n</ctml>\n";
+
+    CountingHandler h;
+    XML_Node::parse(s, h);
+    EXPECT_EQ(10000, h.counts["reaction"]);
+    EXPECT_EQ("9999", h.lastReaction);
+    EXPECT_EQ("A9999", h.lastEquation);
+    EXPECT_EQ(2 + 3*9999, h.lastReactionLine);
+    EXPECT_EQ(1, h.ncomments);
+    EXPECT_EQ(0, h.depth);
+
+    s.clear();
+    s.seekg(0);
+    XML_Node root("doc");
+    root.build(s);
+    XML_Node& ctml = root.child("ctml");
+    EXPECT_EQ(" " + longValue + " ", ctml.child(0).value());
+    EXPECT_EQ(longValue + "\n" + longValue, ctml.child("value").value());
+    EXPECT_EQ(2 + 3*10000, ctml.child("value").lineNumber());
+}
+
+TEST(XML_Reader, parseMatchesTree)
+{
+    std::string path = findInputFile("gri30.xml");
+    std::ifstream f(path.c_str());
+    CountingHandler h;
+    XML_Node::parse(f, h);
+
+    XML_Node* root = get_XML_File("gri30.xml");
+    std::vector<XML_Node*> reactions =
+        root->child("ctml").child("reactionData").getChildren("reaction");
+    ASSERT_EQ((int) reactions.size(), h.counts["reaction"]);
+    XML_Node& last = *reactions.back();
+    EXPECT_EQ(last["id"], h.lastReaction);
+    EXPECT_EQ(last.lineNumber(), h.lastReactionLine);
+    EXPECT_EQ(last.child("equation").value(), h.lastEquation);
+    EXPECT_EQ(0, h.depth);
+}
+
+}
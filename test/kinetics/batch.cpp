@@ -0,0 +1,91 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics.h"
+#include "cantera/thermo/IdealGasPhase.h"
+
+namespace Cantera
+{
+
+class KineticsBatchTest : public testing::Test
+{
+public:
+    void setup(const std::string& file, const std::string& id) {
+        XML_Node* phase_node = get_XML_File(file);
+        buildSolutionFromXML(*phase_node, id, "phase", &thermo, &kin);
+    }
+
+    //! Fill the batch input arrays with `n` states based on the current state
+    //! of the phase, with perturbed temperatures, pressures and compositions.
+    void makeStates(size_t n) {
+        size_t K = thermo.nSpecies();
+        T.resize(n);
+        P.resize(n);
+        Y.resize(K*n);
+        vector_fp y0(K);
+        thermo.getMassFractions(&y0[0]);
+        for (size_t j = 0; j < n; j++) {
+            T[j] = 800 + 97.3*j;
+            P[j] = OneAtm * (0.5 + 3.1*j);
+            for (size_t k = 0; k < K; k++) {
+                Y[k*n+j] = y0[k] * (1.0 + 0.1*((j+k) % 5)) + 1e-3;
+            }
+        }
+    }
+
+    void compareToReference() {
+        size_t n = T.size();
+        size_t K = thermo.nSpecies();
+        double T0 = thermo.temperature();
+        vector_fp wdot(K*n), wref(K*n);
+        kin.getNetProductionRatesBatch(n, &T[0], &P[0], &Y[0], &wdot[0]);
+        EXPECT_DOUBLE_EQ(T0, thermo.temperature());
+        kin.Kinetics::getNetProductionRatesBatch(n, &T[0], &P[0], &Y[0],
+                                                 &wref[0]);
+        for (size_t k = 0; k < K; k++) {
+            for (size_t j = 0; j < n; j++) {
+                double ref = wref[k*n+j];
+                EXPECT_NEAR(ref, wdot[k*n+j], 1e-9 * std::abs(ref) + 1e-14)
+                    << "k = " << k << ", j = " << j;
+            }
+        }
+    }
+
+    IdealGasPhase thermo;
+    GasKinetics kin;
+    vector_fp T, P, Y;
+};
+
+TEST_F(KineticsBatchTest, gri30)
+{
+    setup("gri30.xml", "gri30");
+    thermo.setState_TPX(1200, OneAtm, "CH4:0.5, O2:1.0, N2:3.76, H:0.01, "
+                        "OH:0.02, CO:0.05, HO2:0.001");
+    makeStates(13);
+    compareToReference();
+}
+
+TEST_F(KineticsBatchTest, pdep)
+{
+    setup("../data/pdep-test.xml", "gas");
+    thermo.setState_TPX(900.0, OneAtm, "H:1.0, R1A:1.0, R1B:1.0, R2:1.0, "
+                        "R3:1.0, R4:1.0, R5:1.0, R6:1.0");
+    makeStates(5);
+    compareToReference();
+}
+
+TEST_F(KineticsBatchTest, single_state)
+{
+    setup("gri30.xml", "gri30");
+    thermo.setState_TPX(1500, 2*OneAtm, "CH4:0.5, O2:1.0, N2:3.76, H:0.01");
+    size_t K = thermo.nSpecies();
+    vector_fp wref(K), wdot(K), y(K);
+    kin.getNetProductionRates(&wref[0]);
+    thermo.getMassFractions(&y[0]);
+    double T = thermo.temperature();
+    double P = thermo.pressure();
+    kin.getNetProductionRatesBatch(1, &T, &P, &y[0], &wdot[0]);
+    for (size_t k = 0; k < K; k++) {
+        EXPECT_NEAR(wref[k], wdot[k], 1e-11 * std::abs(wref[k]) + 1e-16);
+    }
+}
+
+}
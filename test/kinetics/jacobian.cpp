@@ -0,0 +1,119 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics.h"
+#include "cantera/thermo/IdealGasPhase.h"
+
+namespace Cantera
+{
+
+class KineticsJacobianTest : public testing::Test
+{
+public:
+    void setup(const std::string& file, const std::string& id) {
+        XML_Node* phase_node = get_XML_File(file);
+        buildSolutionFromXML(*phase_node, id, "phase", &thermo, &kin);
+    }
+
+    //! Set the state, with every species present so that the finite
+    //! difference approximation is well-conditioned in every column.
+    void setState(double T, double P, const std::string& X) {
+        thermo.setState_TPX(T, P, X);
+        vector_fp x(thermo.nSpecies());
+        thermo.getMoleFractions(&x[0]);
+        for (size_t k = 0; k < x.size(); k++) {
+            x[k] += 1e-3;
+        }
+        thermo.setState_TPX(T, P, &x[0]);
+    }
+
+    //! Compare the analytic Jacobian with central finite differences of the
+    //! net production rates, column by column.
+    void compareToFiniteDifferences() {
+        size_t K = thermo.nSpecies();
+        std::vector<size_t> colStart, rowIndex;
+        vector_fp values;
+        kin.getNetProductionRatesJacobian(colStart, rowIndex, values);
+        ASSERT_EQ(K + 2, colStart.size());
+        ASSERT_EQ(rowIndex.size(), values.size());
+
+        vector_fp C(K), Cp(K), wp(K), wm(K);
+        thermo.getConcentrations(&C[0]);
+        double T = thermo.temperature();
+        for (size_t m = 0; m <= K; m++) {
+            // Expand the sparse column
+            vector_fp col(K, 0.0);
+            for (size_t p = colStart[m]; p < colStart[m+1]; p++) {
+                col[rowIndex[p]] = values[p];
+            }
+
+            double delta;
+            if (m < K) {
+                double h = 1e-4 * C[m];
+                Cp = C;
+                Cp[m] = C[m] + h;
+                thermo.setConcentrations(&Cp[0]);
+                kin.getNetProductionRates(&wp[0]);
+                Cp[m] = C[m] - h;
+                delta = 2 * h;
+                thermo.setConcentrations(&Cp[0]);
+                kin.getNetProductionRates(&wm[0]);
+                thermo.setConcentrations(&C[0]);
+            } else {
+                double h = 1e-5 * T;
+                thermo.setTemperature(T + h);
+                kin.getNetProductionRates(&wp[0]);
+                thermo.setTemperature(T - h);
+                kin.getNetProductionRates(&wm[0]);
+                thermo.setTemperature(T);
+                delta = 2 * h;
+            }
+
+            double scale = 0.0;
+            vector_fp fd(K);
+            for (size_t k = 0; k < K; k++) {
+                fd[k] = (wp[k] - wm[k]) / delta;
+                scale = std::max(scale, std::abs(fd[k]));
+            }
+            for (size_t k = 0; k < K; k++) {
+                EXPECT_NEAR(fd[k], col[k], 1e-4 * std::abs(fd[k]) + 1e-7 * scale)
+                    << "k = " << k << ", m = " << m;
+            }
+        }
+    }
+
+    IdealGasPhase thermo;
+    GasKinetics kin;
+};
+
+TEST_F(KineticsJacobianTest, gri30)
+{
+    setup("gri30.xml", "gri30");
+    setState(1600, OneAtm, "CH4:0.5, O2:1.0, N2:3.76, H:0.01, "
+             "OH:0.02, CO:0.05, HO2:0.001, H2O:0.1, CH3:0.003, AR:0.01");
+    compareToFiniteDifferences();
+}
+
+TEST_F(KineticsJacobianTest, pdep)
+{
+    setup("../data/pdep-test.xml", "gas");
+    setState(900.0, 2*OneAtm, "H:1.0, R1A:1.0, R1B:1.0, R2:1.0, R3:1.0, "
+             "R4:1.0, R5:1.0, R6:1.0, P1:0.5, P2A:0.3, P2B:0.2");
+    compareToFiniteDifferences();
+}
+
+TEST_F(KineticsJacobianTest, sparsity)
+{
+    setup("gri30.xml", "gri30");
+    thermo.setState_TPX(1200, OneAtm, "CH4:0.5, O2:1.0, N2:3.76");
+    std::vector<size_t> colStart, rowIndex;
+    vector_fp values;
+    kin.getNetProductionRatesJacobian(colStart, rowIndex, values);
+    size_t K = thermo.nSpecies();
+    EXPECT_LT(rowIndex.size(), K * (K + 1));
+    for (size_t m = 0; m <= K; m++) {
+        for (size_t p = colStart[m] + 1; p < colStart[m+1]; p++) {
+            EXPECT_LT(rowIndex[p-1], rowIndex[p]);
+        }
+    }
+}
+
+}
@@ -203,6 +203,50 @@ TEST_F(KineticsFromScratch, add_chebyshev_reaction)
     check_rates(4);
 }
 
+TEST_F(KineticsFromScratch, chebyshev_single_coefficient)
+{
+    // A single temperature coefficient, so the rate constant only depends
+    // on pressure. At P = 1e5 Pa, the reduced pressure is zero.
+    Composition reac = parseCompString("HO2:1");
+    Composition prod = parseCompString("OH:1 O:1");
+    Array2D coeffs(1, 3);
+    coeffs(0,0) = 8.2883e+00;
+    coeffs(0,1) = -1.1397e+00;
+    coeffs(0,2) = -1.2059e-01;
+    ChebyshevRate rate(1000.0, 10000000.0, 290, 3000, coeffs);
+    shared_ptr<ChebyshevReaction> R(new ChebyshevReaction(reac, prod, rate));
+    kin.addReaction(R);
+    kin.finalize();
+
+    double kexact = pow(10, 8.2883e+00 + 1.2059e-01);
+    std::string X = "O:0.02 H2:0.2 O2:0.5 H:0.03 OH:0.05 H2O:0.1 HO2:0.01";
+    vector_fp k(1);
+    for (int i = 0; i < 3; i++) {
+        p.setState_TPX(600 + 500*i, 1e5, X);
+        kin.getFwdRateConstants(&k[0]);
+        EXPECT_NEAR(kexact, k[0], 1e-12 * kexact) << i;
+    }
+
+    // A single pressure coefficient, so the rate constant does not depend on
+    // pressure
+    Array2D coeffsT(3, 1);
+    coeffsT(0,0) = 8.2883e+00;
+    coeffsT(1,0) = 1.9764e+00;
+    coeffsT(2,0) = 3.1770e-01;
+    ChebyshevRate rateT(1000.0, 10000000.0, 290, 3000, coeffsT);
+    double logP = log10(1e5);
+    rateT.update_C(&logP);
+    rateT.updateTemp(log(1200.0), 1.0 / 1200);
+    double k1 = rateT.updateRC(log(1200.0), 1.0 / 1200);
+    logP = log10(5e6);
+    rateT.update_C(&logP);
+    EXPECT_DOUBLE_EQ(k1, rateT.updateRC(log(1200.0), 1.0 / 1200));
+    double Tr = (2.0 / 1200 - 1.0 / 290 - 1.0 / 3000) / (1.0 / 3000 - 1.0 / 290);
+    double kT = pow(10, 8.2883e+00 + 1.9764e+00 * Tr +
+                    3.1770e-01 * (2 * Tr * Tr - 1));
+    EXPECT_NEAR(kT, k1, 1e-12 * kT);
+}
+
 TEST_F(KineticsFromScratch, undeclared_species)
 {
     Composition reac = parseCompString("CO:1 OH:1");
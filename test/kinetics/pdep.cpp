@@ -224,6 +224,30 @@ TEST_F(PdepTest, ChebyshevEdgeCases)
     EXPECT_NEAR(3.354054351e+07, kf[4], 1e-1);
 }
 
+TEST_F(PdepTest, CachedRates)
+{
+    // Sequence of states with isothermal pressure changes, including changes
+    // between P-log interpolation intervals, and isobaric temperature changes
+    double T[] = {900.0, 900.0, 900.0, 1200.0, 1200.0, 700.0};
+    double P[] = {1.0e4, 2.0e5, 5.0e6, 5.0e6, 3.0e3, 3.0e3};
+    vector_fp kf(6), kref(6);
+    XML_Node* phase_node = get_XML_File("../data/pdep-test.xml");
+    for (size_t i = 0; i < 6; i++) {
+        set_TP(T[i], P[i]);
+        kin_->getFwdRateConstants(&kf[0]);
+
+        IdealGasPhase thermo;
+        GasKinetics kin;
+        buildSolutionFromXML(*phase_node, "gas", "phase", &thermo, &kin);
+        thermo.setState_TPX(T[i], P[i], "H:1.0, R1A:1.0, R1B:1.0, R2:1.0, "
+                            "R3:1.0, R4:1.0, R5:1.0, R6:1.0");
+        kin.getFwdRateConstants(&kref[0]);
+        for (size_t j = 0; j < 6; j++) {
+            EXPECT_DOUBLE_EQ(kref[j], kf[j]) << "state " << i << ", reaction " << j;
+        }
+    }
+}
+
 } // namespace Cantera
 
 int main(int argc, char** argv)
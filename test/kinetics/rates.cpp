@@ -144,4 +144,154 @@ TEST_F(FracCoeffTest, EquilibriumConstants)
     EXPECT_NEAR(exp(-deltaG0_1/RT) * pow(pRef/RT, -0.5), Kc[1], 1e-13 * Kc[1]);
 }
 
+TEST_F(FracCoeffTest, SparseStoichiometry)
+{
+    // Sparse matrices built by finalize() during import
+    GasKinetics kin2;
+    kin2.setSparseStoichiometry(true);
+    std::vector<ThermoPhase*> phases(1, &therm);
+    importKinetics(therm.xml(), phases, &kin2);
+    EXPECT_TRUE(kin2.sparseStoichiometry());
+
+    size_t nr = kin.nReactions();
+    size_t nsp = therm.nSpecies();
+    vector_fp ropf(nr), ropf2(nr), wdot(nsp), wdot2(nsp);
+    kin.getFwdRatesOfProgress(&ropf[0]);
+    kin2.getFwdRatesOfProgress(&ropf2[0]);
+    kin.getNetProductionRates(&wdot[0]);
+    kin2.getNetProductionRates(&wdot2[0]);
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(ropf[i], ropf2[i]);
+    }
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(wdot[k], wdot2[k], 1e-14 * std::abs(wdot[k]));
+    }
+}
+
+TEST(SparseStoichiometry, gri30)
+{
+    IdealGasPhase thermo("gri30.xml", "gri30");
+    std::vector<ThermoPhase*> phases(1, &thermo);
+    GasKinetics kin, kin2;
+    importKinetics(thermo.xml(), phases, &kin);
+    importKinetics(thermo.xml(), phases, &kin2);
+    // Sparse matrices built immediately after import
+    kin2.setSparseStoichiometry(true);
+    EXPECT_FALSE(kin.sparseStoichiometry());
+    thermo.setState_TPX(1500, OneAtm, "CH4:0.5, O2:1.0, N2:3.76, H:0.01, "
+                        "OH:0.02, CO:0.05, HO2:0.001, H2O:0.1");
+
+    size_t nr = kin.nReactions();
+    size_t nsp = thermo.nSpecies();
+    vector_fp r1(nr), r2(nr), w1(nsp), w2(nsp), c1(nsp), c2(nsp);
+    kin.getFwdRatesOfProgress(&r1[0]);
+    kin2.getFwdRatesOfProgress(&r2[0]);
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(r1[i], r2[i]);
+    }
+    kin.getRevRatesOfProgress(&r1[0]);
+    kin2.getRevRatesOfProgress(&r2[0]);
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_NEAR(r1[i], r2[i], 1e-12 * std::abs(r1[i]));
+    }
+    kin.getCreationRates(&c1[0]);
+    kin2.getCreationRates(&c2[0]);
+    kin.getNetProductionRates(&w1[0]);
+    kin2.getNetProductionRates(&w2[0]);
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(c1[k], c2[k], 1e-12 * std::abs(c1[k]));
+        EXPECT_NEAR(w1[k], w2[k],
+                    1e-12 * (std::abs(c1[k]) + std::abs(w1[k])));
+    }
+}
+
+TEST(Rate1Arrhenius, MatchesArrhenius)
+{
+    std::vector<Arrhenius> rates;
+    rates.push_back(Arrhenius(3.87e4, 2.7, 6260.0 / 1.987));
+    rates.push_back(Arrhenius(1.2e11, -1.0, 0.0));
+    rates.push_back(Arrhenius(2.0e10, 0.0, 0.0));
+    rates.push_back(Arrhenius(-5.0e6, 0.5, 1500.0));
+    rates.push_back(Arrhenius(6.6e10, 0.0, 37500.0));
+
+    // Install in an order that differs from the reaction numbering
+    Rate1<Arrhenius> mgr;
+    size_t nr = rates.size();
+    for (size_t i = 0; i < nr; i++) {
+        mgr.install(nr - 1 - i, rates[i]);
+    }
+    EXPECT_EQ(nr, mgr.nReactions());
+
+    double T[] = {300.0, 1000.0, 2500.0};
+    vector_fp k(nr), kb(nr * 3);
+    double logT[3], recipT[3];
+    for (size_t j = 0; j < 3; j++) {
+        logT[j] = log(T[j]);
+        recipT[j] = 1.0 / T[j];
+    }
+    mgr.update(3, logT, recipT, &kb[0], 3);
+    for (size_t j = 0; j < 3; j++) {
+        mgr.update(T[j], logT[j], &k[0]);
+        for (size_t i = 0; i < nr; i++) {
+            double kref = rates[i].updateRC(logT[j], recipT[j]);
+            EXPECT_DOUBLE_EQ(kref, k[nr - 1 - i]);
+            EXPECT_DOUBLE_EQ(kref, kb[(nr - 1 - i)*3 + j]);
+        }
+    }
+}
+
+TEST(StoichManagerN, CopyOnWrite)
+{
+    std::vector<size_t> k(2);
+    k[0] = 0;
+    k[1] = 1;
+    StoichManagerN s1;
+    s1.add(0, k);
+    StoichManagerN s2 = s1;
+    k[1] = 2;
+    s2.add(1, k);
+
+    double S[] = {2.0, 3.0, 5.0};
+    double R1[] = {1.0, 1.0};
+    double R2[] = {1.0, 1.0};
+    s1.multiply(S, R1);
+    s2.multiply(S, R2);
+    EXPECT_DOUBLE_EQ(6.0, R1[0]);
+    EXPECT_DOUBLE_EQ(1.0, R1[1]);
+    EXPECT_DOUBLE_EQ(6.0, R2[0]);
+    EXPECT_DOUBLE_EQ(10.0, R2[1]);
+}
+
+TEST(KineticsCopy, gri30)
+{
+    IdealGasPhase thermo("gri30.xml", "gri30");
+    std::vector<ThermoPhase*> phases(1, &thermo);
+    GasKinetics kin;
+    importKinetics(thermo.xml(), phases, &kin);
+
+    ThermoPhase* thermo2 = thermo.duplMyselfAsThermoPhase();
+    EXPECT_EQ(&thermo.xml(), &thermo2->xml());
+    std::vector<ThermoPhase*> phases2(1, thermo2);
+    Kinetics* kin2 = kin.duplMyselfAsKinetics(phases2);
+
+    thermo.setState_TPX(1500, OneAtm, "CH4:0.5, O2:1.0, N2:3.76, H:0.01, "
+                        "OH:0.02, CO:0.05, HO2:0.001, H2O:0.1");
+    thermo2->setState_TPX(1500, OneAtm, "CH4:0.5, O2:1.0, N2:3.76, H:0.01, "
+                          "OH:0.02, CO:0.05, HO2:0.001, H2O:0.1");
+    size_t nsp = thermo.nSpecies();
+    vector_fp w1(nsp), w2(nsp);
+    kin.getNetProductionRates(&w1[0]);
+    kin2->getNetProductionRates(&w2[0]);
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_DOUBLE_EQ(w1[k], w2[k]);
+    }
+
+    // The original objects must remain usable after the copies are deleted
+    delete kin2;
+    delete thermo2;
+    thermo.setState_TPX(1600, OneAtm, "CH4:0.5, O2:1.0, N2:3.76, H:0.01");
+    kin.getNetProductionRates(&w1[0]);
+    EXPECT_EQ(&thermo, &kin.thermo());
+}
+
 }
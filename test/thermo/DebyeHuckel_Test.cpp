@@ -0,0 +1,41 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/DebyeHuckel.h"
+
+namespace Cantera
+{
+
+class DebyeHuckel_Test : public testing::Test
+{
+public:
+    DebyeHuckel_Test() : phase("../data/DH-NaCl-water.xml", "NaCl_electrolyte") {
+        nsp = phase.nSpecies();
+    }
+
+    DebyeHuckel phase;
+    size_t nsp;
+};
+
+TEST_F(DebyeHuckel_Test, activityCoeffsAfterPressureDerivative)
+{
+    vector_fp ac1(nsp), ac2(nsp), pmv(nsp);
+    phase.setState_TP(310.0, 2 * OneAtm);
+    phase.getMolalityActivityCoefficients(&ac1[0]);
+
+    // The pressure derivatives of the activity coefficients do not change
+    // the cached activity coefficients
+    phase.getPartialMolarVolumes(&pmv[0]);
+    phase.getMolalityActivityCoefficients(&ac2[0]);
+    size_t iSiO2 = phase.speciesIndex("SiO2(aq)");
+    EXPECT_NE(1.0, ac1[iSiO2]);
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_DOUBLE_EQ(ac1[k], ac2[k]) << phase.speciesName(k);
+    }
+
+    phase.setState_TP(310.0, 2 * OneAtm);
+    phase.getMolalityActivityCoefficients(&ac2[0]);
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_DOUBLE_EQ(ac1[k], ac2[k]) << phase.speciesName(k);
+    }
+}
+
+}
@@ -0,0 +1,89 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/HMWSoln.h"
+
+namespace Cantera
+{
+
+class HMWSoln_Test : public testing::TestWithParam<double>
+{
+public:
+    HMWSoln_Test() : phase("../data/HMW-NaCl-CaCl2.xml", "NaCl_CaCl2_electrolyte") {
+        nsp = phase.nSpecies();
+        vector_fp m(nsp);
+        phase.getMolalities(&m[0]);
+        for (size_t k = 1; k < nsp; k++) {
+            m[k] *= GetParam();
+        }
+        phase.setMolalities(&m[0]);
+        phase.setState_TP(330.0, 2.0e6);
+    }
+
+    //! Chemical potentials divided by T at the temperature T
+    void getMuOverT(double T, double P, vector_fp& mu) {
+        phase.setState_TP(T, P);
+        phase.getChemPotentials(&mu[0]);
+        for (size_t k = 0; k < nsp; k++) {
+            mu[k] /= T;
+        }
+    }
+
+    HMWSoln phase;
+    size_t nsp;
+};
+
+TEST_P(HMWSoln_Test, partialMolarEnthalpies)
+{
+    // h_k = -T^2 d(mu_k/T)/dT, which checks the temperature derivatives of
+    // all of the Pitzer interaction terms
+    double T = phase.temperature();
+    double P = phase.pressure();
+    double dT = 1e-3;
+    vector_fp h(nsp), mu1(nsp), mu2(nsp);
+    phase.getPartialMolarEnthalpies(&h[0]);
+    getMuOverT(T + dT, P, mu2);
+    getMuOverT(T - dT, P, mu1);
+    for (size_t k = 0; k < nsp; k++) {
+        double numerical = - T * T * (mu2[k] - mu1[k]) / (2 * dT);
+        EXPECT_NEAR(numerical, h[k], 1e-7 * std::abs(h[k]) + 1.0)
+                << "k = " << k;
+    }
+}
+
+TEST_P(HMWSoln_Test, partialMolarVolumes)
+{
+    double T = phase.temperature();
+    double P = phase.pressure();
+    double dP = 1e5;
+    vector_fp v(nsp), mu1(nsp), mu2(nsp);
+    phase.getPartialMolarVolumes(&v[0]);
+    phase.setState_TP(T, P + dP);
+    phase.getChemPotentials(&mu2[0]);
+    phase.setState_TP(T, P - dP);
+    phase.getChemPotentials(&mu1[0]);
+    for (size_t k = 0; k < nsp; k++) {
+        double numerical = (mu2[k] - mu1[k]) / (2 * dP);
+        EXPECT_NEAR(numerical, v[k], 1e-6 * std::abs(v[k]) + 1e-9)
+                << "k = " << k;
+    }
+}
+
+TEST_P(HMWSoln_Test, osmoticCoefficient)
+{
+    // The osmotic coefficient and the solvent activity are two views of the
+    // same quantity
+    vector_fp m(nsp), a(nsp);
+    phase.getMolalities(&m[0]);
+    phase.getActivities(&a[0]);
+    double msum = 0.0;
+    for (size_t k = 1; k < nsp; k++) {
+        msum += m[k];
+    }
+    double lnaw = - phase.osmoticCoefficient() * msum *
+                  phase.molecularWeight(0) / 1000.0;
+    EXPECT_NEAR(lnaw, log(a[0]), 1e-12);
+}
+
+INSTANTIATE_TEST_CASE_P(HMWSoln, HMWSoln_Test,
+                        testing::Values(0.1, 1.0, 1.5));
+
+}
@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/thermo/ThermoFactory.h"
+#include "cantera/thermo/IdealGasPhase.h"
 #include <vector>
 
 namespace Cantera
@@ -91,4 +92,123 @@ TEST_F(TestThermoMethods, getMassFractionsByName)
     EXPECT_EQ(Y.size(), (size_t) 3);
 }
 
+TEST_F(TestThermoMethods, getPropertiesBatch)
+{
+    const size_t n = 5;
+    size_t K = thermo->nSpecies();
+    double T[n] = {300.0, 1000.0, 1000.0, 1500.0, 2500.0};
+    double P[n] = {OneAtm, 2*OneAtm, 5e4, OneAtm, 1e6};
+    vector_fp Y(K*n, 0.0);
+    for (size_t j = 0; j < n; j++) {
+        for (size_t k = 0; k < K; k++) {
+            Y[k*n + j] = 0.01 * (k + 1) * (j + 1) + (k == j ? 0.5 : 0.0);
+        }
+    }
+    Y[2*n + 3] = -1e-8; // negative values should be ignored
+
+    thermo->setState_TPX(800.0, 3e5, "O2:0.2, H2:0.3, AR:0.5");
+    vector_fp state0;
+    thermo->saveState(state0);
+
+    vector_fp rho(n), mmw(n), cp(n), h(n), s(n), hrt(K*n);
+    vector_fp rho2(n), mmw2(n), cp2(n), h2(n), s2(n), hrt2(K*n);
+    thermo->getPropertiesBatch(n, T, P, &Y[0], &rho[0], &mmw[0], &cp[0],
+                               &h[0], &s[0], &hrt[0]);
+    thermo->ThermoPhase::getPropertiesBatch(n, T, P, &Y[0], &rho2[0], &mmw2[0],
+                                            &cp2[0], &h2[0], &s2[0], &hrt2[0]);
+
+    vector_fp state1;
+    thermo->saveState(state1);
+    for (size_t i = 0; i < state0.size(); i++) {
+        EXPECT_DOUBLE_EQ(state0[i], state1[i]);
+    }
+
+    for (size_t j = 0; j < n; j++) {
+        EXPECT_NEAR(rho2[j], rho[j], 1e-12 * rho2[j]);
+        EXPECT_NEAR(mmw2[j], mmw[j], 1e-12 * mmw2[j]);
+        EXPECT_NEAR(cp2[j], cp[j], 1e-12 * cp2[j]);
+        EXPECT_NEAR(h2[j], h[j], 1e-10 * std::abs(h2[j]) + 1e-6);
+        EXPECT_NEAR(s2[j], s[j], 1e-12 * s2[j]);
+        for (size_t k = 0; k < K; k++) {
+            EXPECT_DOUBLE_EQ(hrt2[k*n + j], hrt[k*n + j]);
+        }
+    }
+
+    // Null output arrays are skipped
+    vector_fp s3(n);
+    thermo->getPropertiesBatch(n, T, P, &Y[0], 0, 0, 0, 0, &s3[0], 0);
+    for (size_t j = 0; j < n; j++) {
+        EXPECT_DOUBLE_EQ(s[j], s3[j]);
+    }
+}
+
+TEST_F(TestThermoMethods, setState_HP_UV)
+{
+    IdealGasPhase* gas = dynamic_cast<IdealGasPhase*>(thermo);
+    ASSERT_TRUE(gas != 0);
+    double T[] = {300.0, 999.0, 1001.0, 1800.0, 3000.0};
+    double T0[] = {2500.0, 1000.0, 300.0, 1790.0, 500.0};
+    for (size_t i = 0; i < 5; i++) {
+        gas->setState_TPX(T[i], 2e5, "H2:0.3, O2:0.2, OH:0.01, H2O:0.1, AR:0.4");
+        double h = gas->enthalpy_mass();
+        double u = gas->intEnergy_mass();
+        double v = 1.0 / gas->density();
+
+        gas->setState_TP(T0[i], OneAtm);
+        gas->setState_HP(h, 2e5, 1e-8);
+        EXPECT_NEAR(T[i], gas->temperature(), 1e-8);
+        EXPECT_NEAR(2e5, gas->pressure(), 1e-8);
+        EXPECT_NEAR(h, gas->enthalpy_mass(), 1e-12 * std::abs(h) + 1e-6);
+
+        gas->setState_TP(T0[i], OneAtm);
+        gas->setState_UV(u, v, 1e-8);
+        EXPECT_NEAR(T[i], gas->temperature(), 1e-8);
+        EXPECT_NEAR(1.0 / v, gas->density(), 1e-12 / v);
+        EXPECT_NEAR(u, gas->intEnergy_mass(), 1e-12 * std::abs(u) + 1e-6);
+
+        // Same result as the general method
+        gas->setState_TP(T0[i], OneAtm);
+        gas->ThermoPhase::setState_HP(h, 2e5, 1e-8);
+        EXPECT_NEAR(T[i], gas->temperature(), 1e-6);
+    }
+}
+
+TEST_F(TestThermoMethods, getTemperatureBatch)
+{
+    IdealGasPhase* gas = dynamic_cast<IdealGasPhase*>(thermo);
+    ASSERT_TRUE(gas != 0);
+    const size_t n = 4;
+    size_t K = gas->nSpecies();
+    double T[n] = {350.0, 1001.0, 1500.0, 2800.0};
+    double P[n] = {OneAtm, OneAtm, 1e5, 1e6};
+    vector_fp Y(K*n);
+    for (size_t j = 0; j < n; j++) {
+        for (size_t k = 0; k < K; k++) {
+            Y[k*n + j] = 0.01 * (k + j + 1);
+        }
+    }
+    vector_fp h(n), u(n), y(K);
+    for (size_t j = 0; j < n; j++) {
+        for (size_t k = 0; k < K; k++) {
+            y[k] = Y[k*n + j];
+        }
+        gas->setState_TPY(T[j], P[j], &y[0]);
+        h[j] = gas->enthalpy_mass();
+        u[j] = gas->intEnergy_mass();
+    }
+    gas->setState_TPX(800.0, 3e5, "O2:0.2, H2:0.3, AR:0.5");
+    vector_fp Tout(n, 1200.0);
+    gas->getTemperatureBatch_HP(n, &h[0], &Y[0], &Tout[0], 1e-8);
+    for (size_t j = 0; j < n; j++) {
+        EXPECT_NEAR(T[j], Tout[j], 1e-8);
+    }
+    Tout.assign(n, 600.0);
+    gas->getTemperatureBatch_UV(n, &u[0], &Y[0], &Tout[0], 1e-8);
+    for (size_t j = 0; j < n; j++) {
+        EXPECT_NEAR(T[j], Tout[j], 1e-8);
+    }
+    EXPECT_DOUBLE_EQ(800.0, gas->temperature());
+    EXPECT_DOUBLE_EQ(3e5, gas->pressure());
+}
+
 }
@@ -0,0 +1,147 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/thermo/RedlichKwongMFTP.h"
+#include "cantera/thermo/PengRobinsonMFTP.h"
+#include "cantera/base/stringUtils.h"
+
+namespace Cantera
+{
+
+class CubicEOSTest : public testing::TestWithParam<std::string>
+{
+public:
+    CubicEOSTest() {
+        phase.reset(newPhase("../data/co2-cubic-eos.xml", GetParam()));
+        nsp = phase->nSpecies();
+    }
+
+    //! Set a state with a strongly non-ideal gas
+    void setGasState() {
+        phase->setState_TPX(400.0, 1.0e7, "CO2:0.6, H2O:0.1, N2:0.3");
+    }
+
+    std::auto_ptr<ThermoPhase> phase;
+    size_t nsp;
+};
+
+TEST_P(CubicEOSTest, dlnActCoeffdlnN)
+{
+    setGasState();
+    vector_fp exact(nsp*nsp), numerical(nsp*nsp), x(nsp);
+    phase->getMoleFractions(&x[0]);
+    phase->getdlnActCoeffdlnN(nsp, &exact[0]);
+    phase->getdlnActCoeffdlnN_numderiv(nsp, &numerical[0]);
+    for (size_t m = 0; m < nsp; m++) {
+        double gibbsDuhem = 0.0;
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(numerical[nsp*m+k], exact[nsp*m+k], 1e-6)
+                    << "k = " << k << ", m = " << m;
+            gibbsDuhem += x[k] * exact[nsp*m+k];
+        }
+        EXPECT_NEAR(0.0, gibbsDuhem, 1e-10);
+    }
+}
+
+TEST_P(CubicEOSTest, dlnActCoeffdT)
+{
+    setGasState();
+    double T = phase->temperature();
+    double P = phase->pressure();
+    double dT = 1e-4 * T;
+    vector_fp exact(nsp), ac1(nsp), ac2(nsp);
+    if (GetParam() == "co2_rk") {
+        dynamic_cast<RedlichKwongMFTP&>(*phase).getdlnActCoeffdT(&exact[0]);
+    } else {
+        dynamic_cast<PengRobinsonMFTP&>(*phase).getdlnActCoeffdT(&exact[0]);
+    }
+    phase->setState_TP(T + dT, P);
+    phase->getActivityCoefficients(&ac2[0]);
+    phase->setState_TP(T - dT, P);
+    phase->getActivityCoefficients(&ac1[0]);
+    for (size_t k = 0; k < nsp; k++) {
+        double numerical = (log(ac2[k]) - log(ac1[k])) / (2 * dT);
+        EXPECT_NEAR(numerical, exact[k], 1e-6 * std::abs(exact[k]) + 1e-10)
+                << "k = " << k;
+    }
+}
+
+TEST_P(CubicEOSTest, partialMolarProperties)
+{
+    setGasState();
+    vector_fp v(nsp), h(nsp), s(nsp), mu(nsp);
+    phase->getPartialMolarVolumes(&v[0]);
+    phase->getPartialMolarEnthalpies(&h[0]);
+    phase->getPartialMolarEntropies(&s[0]);
+    phase->getChemPotentials(&mu[0]);
+    EXPECT_NEAR(phase->molarVolume(), phase->mean_X(&v[0]),
+                1e-10 * phase->molarVolume());
+    EXPECT_NEAR(phase->enthalpy_mole(), phase->mean_X(&h[0]), 1e-1);
+    EXPECT_NEAR(phase->entropy_mole(), phase->mean_X(&s[0]), 1e-4);
+    EXPECT_NEAR(phase->gibbs_mole(), phase->mean_X(&mu[0]), 1e-1);
+}
+
+TEST_P(CubicEOSTest, heatCapacities)
+{
+    setGasState();
+    double T = phase->temperature();
+    double P = phase->pressure();
+    double rho = phase->density();
+    double cp = phase->cp_mole();
+    double cv = phase->cv_mole();
+    double dT = 1e-4 * T;
+
+    phase->setState_TP(T + dT, P);
+    double h2 = phase->enthalpy_mole();
+    phase->setState_TP(T - dT, P);
+    double h1 = phase->enthalpy_mole();
+    EXPECT_NEAR(cp, (h2 - h1) / (2 * dT), 1e-6 * cp);
+
+    phase->setState_TR(T + dT, rho);
+    double u2 = phase->intEnergy_mole();
+    phase->setState_TR(T - dT, rho);
+    double u1 = phase->intEnergy_mole();
+    EXPECT_NEAR(cv, (u2 - u1) / (2 * dT), 1e-6 * cv);
+    EXPECT_GT(cp - cv, GasConstant);
+}
+
+TEST_P(CubicEOSTest, warmStartDensity)
+{
+    double T[] = {300.0, 350.0, 500.0, 800.0};
+    double P[] = {1.0e5, 3.0e6, 1.0e7, 3.0e7};
+    std::string X = "CO2:0.6, H2O:0.1, N2:0.3";
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t j = 0; j < 4; j++) {
+            // Reach the state from the previous state, so that the previous
+            // density is used as the initial guess
+            phase->setState_TPX(T[i], P[j], X);
+            double rho = phase->density();
+
+            std::auto_ptr<ThermoPhase> fresh(newPhase("../data/co2-cubic-eos.xml", GetParam()));
+            fresh->setState_TPX(T[i], P[j], X);
+            EXPECT_NEAR(fresh->density(), rho, 1e-10 * rho)
+                    << "T = " << T[i] << ", P = " << P[j];
+            EXPECT_NEAR(phase->pressure(), P[j], 1e-8 * P[j]);
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(CubicEOS, CubicEOSTest,
+                        testing::Values(std::string("co2_rk"),
+                                        std::string("co2_pr")));
+
+TEST(PengRobinsonMFTP, critTemperature)
+{
+    std::auto_ptr<ThermoPhase> pr(newPhase("../data/co2-cubic-eos.xml", "co2_pr"));
+    pr->setState_TPX(300.0, OneAtm, "CO2:1.0");
+    EXPECT_NEAR(304.13, pr->critTemperature(), 1e-3);
+    EXPECT_NEAR(7.3773e6, pr->critPressure(), 10.0);
+}
+
+TEST(PengRobinsonMFTP, factory)
+{
+    ThermoPhase* p = newThermoPhase("PengRobinson");
+    EXPECT_TRUE(dynamic_cast<PengRobinsonMFTP*>(p) != 0);
+    delete p;
+}
+
+}
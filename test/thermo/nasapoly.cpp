@@ -139,6 +139,33 @@ TEST(Nasa9Test, Nasa9Thermo) {
     }
 }
 
+TEST(NasaPoly2Test, packedUpdate)
+{
+    // Properties of all species computed together from the packed
+    // coefficients should be identical to those computed one species at a
+    // time by the NasaPoly2 objects.
+    IdealGasMix g("gri30.xml", "gri30");
+    SpeciesThermo& sp = g.speciesThermo();
+    size_t nsp = g.nSpecies();
+    vector_fp cp1(nsp), h1(nsp), s1(nsp), cp2(nsp), h2(nsp), s2(nsp);
+    double T[] = {300.0, 999.999, 1000.0, 1000.001, 2500.0};
+    for (int pass = 0; pass < 2; pass++) {
+        if (pass == 1) {
+            // Check that the packed coefficients are updated
+            sp.modifyOneHf298(g.speciesIndex("OH"), 4.0e7);
+        }
+        for (size_t i = 0; i < 5; i++) {
+            sp.update(T[i], &cp1[0], &h1[0], &s1[0]);
+            for (size_t k = 0; k < nsp; k++) {
+                sp.update_one(k, T[i], &cp2[0], &h2[0], &s2[0]);
+                EXPECT_EQ(cp2[k], cp1[k]);
+                EXPECT_EQ(h2[k], h1[k]);
+                EXPECT_EQ(s2[k], s1[k]);
+            }
+        }
+    }
+    EXPECT_NEAR(4.0e7, sp.reportOneHf298(g.speciesIndex("OH")), 1e-3);
+}
 
 } // namespace Cantera
 
@@ -0,0 +1,108 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/TabulatedSpeciesThermo.h"
+#include "cantera/thermo/SpeciesThermoFactory.h"
+#include "cantera/IdealGasMix.h"
+
+namespace Cantera
+{
+
+class TabulatedThermoTest : public testing::Test
+{
+public:
+    TabulatedThermoTest()
+        : gas("gri30.xml", "gri30")
+        , exact(dynamic_cast<GeneralSpeciesThermo&>(gas.speciesThermo()))
+        , nsp(gas.nSpecies())
+        , cp1(nsp), h1(nsp), s1(nsp), cp2(nsp), h2(nsp), s2(nsp) {
+    }
+
+    //! Check the tabulated properties against the exact values at `n`
+    //! temperatures between `Tmin` and `Tmax`.
+    void compare(const SpeciesThermo& tab, double Tmin, double Tmax,
+                 size_t n, double tol) {
+        for (size_t i = 0; i <= n; i++) {
+            double T = Tmin + (Tmax - Tmin) * i / n;
+            exact.update(T, &cp1[0], &h1[0], &s1[0]);
+            tab.update(T, &cp2[0], &h2[0], &s2[0]);
+            for (size_t k = 0; k < nsp; k++) {
+                EXPECT_NEAR(cp1[k], cp2[k], tol) << "T = " << T << ", k = " << k;
+                EXPECT_NEAR(h1[k], h2[k], tol) << "T = " << T << ", k = " << k;
+                EXPECT_NEAR(s1[k], s2[k], tol) << "T = " << T << ", k = " << k;
+            }
+        }
+    }
+
+    IdealGasMix gas;
+    GeneralSpeciesThermo& exact;
+    size_t nsp;
+    vector_fp cp1, h1, s1, cp2, h2, s2;
+};
+
+TEST_F(TabulatedThermoTest, tolerance)
+{
+    TabulatedSpeciesThermo tab(exact, 1e-6);
+    tab.buildTable();
+    EXPECT_GT(tab.nIntervals(), (size_t) 0);
+    EXPECT_LE(tab.maxError(), 1e-6);
+    // Includes points near the region boundaries at 1000, 1368, 1382 and
+    // 1478 K for some of the species in GRI 3.0
+    compare(tab, 300.0, 3000.0, 2719, 2e-6);
+
+    TabulatedSpeciesThermo coarse(exact, 1e-3);
+    coarse.buildTable();
+    EXPECT_LT(coarse.nIntervals(), tab.nIntervals());
+    compare(coarse, 300.0, 3000.0, 997, 2e-3);
+}
+
+TEST_F(TabulatedThermoTest, outsideRange)
+{
+    TabulatedSpeciesThermo tab(exact);
+    tab.setTemperatureRange(500.0, 2000.0);
+    double Tout[] = {300.0, 499.9, 2000.1, 3000.0};
+    for (size_t i = 0; i < 4; i++) {
+        double T = Tout[i];
+        exact.update(T, &cp1[0], &h1[0], &s1[0]);
+        tab.update(T, &cp2[0], &h2[0], &s2[0]);
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_EQ(cp1[k], cp2[k]);
+            EXPECT_EQ(h1[k], h2[k]);
+            EXPECT_EQ(s1[k], s2[k]);
+        }
+    }
+    compare(tab, 500.0, 2000.0, 101, 2e-6);
+}
+
+TEST_F(TabulatedThermoTest, modifyHf298)
+{
+    TabulatedSpeciesThermo tab(exact);
+    compare(tab, 300.0, 3000.0, 10, 2e-6);
+    size_t k = gas.speciesIndex("OH");
+    exact.modifyOneHf298(k, 4.0e7);
+    tab.modifyOneHf298(k, 4.0e7);
+    compare(tab, 300.0, 3000.0, 10, 2e-6);
+}
+
+TEST_F(TabulatedThermoTest, phase)
+{
+    gas.setState_TPX(1234.5, OneAtm, "CH4:1, O2:2, N2:7.52, OH:0.01");
+    double h = gas.enthalpy_mass();
+    double cp = gas.cp_mass();
+    double s = gas.entropy_mass();
+
+    gas.setSpeciesThermo(new TabulatedSpeciesThermo(exact, 1e-7));
+    gas.setState_TPX(500.0, OneAtm, "CH4:1, O2:2, N2:7.52, OH:0.01");
+    gas.setState_TPX(1234.5, OneAtm, "CH4:1, O2:2, N2:7.52, OH:0.01");
+    EXPECT_NEAR(h, gas.enthalpy_mass(), 1e-6 * std::abs(h));
+    EXPECT_NEAR(cp, gas.cp_mass(), 1e-6 * cp);
+    EXPECT_NEAR(s, gas.entropy_mass(), 1e-6 * s);
+}
+
+TEST(TabulatedThermoFactory, create)
+{
+    suppress_deprecation_warnings();
+    SpeciesThermo* sp = newSpeciesThermoMgr("tabulated");
+    EXPECT_TRUE(dynamic_cast<TabulatedSpeciesThermo*>(sp) != 0);
+    delete sp;
+}
+
+}
@@ -0,0 +1,106 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/WaterPropsIAPWS.h"
+#include "cantera/base/ctexceptions.h"
+
+namespace Cantera
+{
+
+class WaterPropsIAPWSTest : public testing::Test
+{
+public:
+    //! Density calculated by a fresh object, without any warm start
+    double coldDensity(double T, double P, int phase) {
+        WaterPropsIAPWS fresh;
+        return fresh.density(T, P, phase);
+    }
+
+    WaterPropsIAPWS water;
+};
+
+TEST_F(WaterPropsIAPWSTest, warmStartDensity)
+{
+    double T[] = {300.0, 301.0, 305.0, 320.0, 400.0, 401.0};
+    double P[] = {1.0e5, 2.0e5, 5.0e6, 3.0e7};
+    for (size_t i = 0; i < 6; i++) {
+        for (size_t j = 0; j < 4; j++) {
+            double rho = water.density(T[i], P[j], WATER_LIQUID);
+            // Both solves stop at a relative pressure residual of 1e-8
+            EXPECT_NEAR(coldDensity(T[i], P[j], WATER_LIQUID), rho, 1e-9 * rho)
+                    << "T = " << T[i] << ", P = " << P[j];
+            EXPECT_NEAR(P[j], water.pressure(), 1e-7 * P[j]);
+        }
+    }
+    for (size_t i = 0; i < 6; i++) {
+        double rho = water.density(T[i] + 100.0, 1.0e4, WATER_GAS);
+        EXPECT_NEAR(coldDensity(T[i] + 100.0, 1.0e4, WATER_GAS), rho, 1e-7 * rho);
+        EXPECT_NEAR(1.0e4, water.pressure(), 1e-7 * 1.0e4);
+    }
+}
+
+TEST_F(WaterPropsIAPWSTest, densityTable)
+{
+    water.setState_TR(350.0, 980.0);
+    water.buildDensityTable(280.0, 900.0, 1.0e3, 5.0e7, 40, 40);
+    ASSERT_TRUE(water.hasDensityTable());
+    EXPECT_GT(water.densityTableCoverage(WATER_LIQUID), 0.5);
+    EXPECT_GT(water.densityTableCoverage(WATER_GAS), 0.5);
+
+    // The state is not changed by building the table
+    EXPECT_DOUBLE_EQ(350.0, water.temperature());
+    EXPECT_DOUBLE_EQ(980.0, water.density());
+
+    // Points in the liquid, vapor and supercritical regions, including some
+    // close to the saturation curve and the critical point
+    double T[] = {285.3, 373.0, 373.2, 500.0, 646.9, 647.2, 700.0, 899.0};
+    double P[] = {1.1e3, 1.0e5, 1.0143e5, 2.0e6, 2.2e7, 2.21e7, 4.9e7};
+    int phases[] = {WATER_LIQUID, WATER_GAS, WATER_SUPERCRIT};
+    for (size_t i = 0; i < 8; i++) {
+        for (size_t j = 0; j < 7; j++) {
+            for (size_t k = 0; k < 3; k++) {
+                WaterPropsIAPWS fresh;
+                double exact = fresh.density(T[i], P[j], phases[k]);
+                if (exact < 0.0) {
+                    // No root on this branch, e.g. vapor above the
+                    // saturation pressure
+                    continue;
+                }
+                // Both solves stop at a relative pressure residual of 1e-8,
+                // which allows large density differences near the critical
+                // point
+                double kappa = fresh.isothermalCompressibility();
+                double rho = water.density(T[i], P[j], phases[k]);
+                EXPECT_NEAR(exact, rho, 2e-8 * P[j] * kappa * exact)
+                        << "T = " << T[i]
+                        << ", P = " << P[j] << ", phase = " << phases[k];
+                EXPECT_NEAR(T[i], water.temperature(), 1e-12 * T[i]);
+            }
+        }
+    }
+
+    water.clearDensityTable();
+    EXPECT_FALSE(water.hasDensityTable());
+}
+
+TEST_F(WaterPropsIAPWSTest, densityTableCopy)
+{
+    water.buildDensityTable(300.0, 400.0, 1.0e5, 1.0e6, 10, 10);
+    WaterPropsIAPWS copy(water);
+    EXPECT_TRUE(copy.hasDensityTable());
+    EXPECT_DOUBLE_EQ(water.densityTableCoverage(WATER_LIQUID),
+                     copy.densityTableCoverage(WATER_LIQUID));
+    double rho = copy.density(350.0, 5.0e5, WATER_LIQUID);
+    EXPECT_NEAR(coldDensity(350.0, 5.0e5, WATER_LIQUID), rho, 1e-9 * rho);
+}
+
+TEST_F(WaterPropsIAPWSTest, densityTableErrors)
+{
+    EXPECT_THROW(water.buildDensityTable(400.0, 300.0, 1.0e5, 1.0e6),
+                 CanteraError);
+    EXPECT_THROW(water.buildDensityTable(300.0, 400.0, 0.0, 1.0e6),
+                 CanteraError);
+    EXPECT_THROW(water.buildDensityTable(300.0, 400.0, 1.0e5, 1.0e6, 0, 10),
+                 CanteraError);
+    EXPECT_FALSE(water.hasDensityTable());
+}
+
+}
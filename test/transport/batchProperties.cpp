@@ -0,0 +1,127 @@
+#include "gtest/gtest.h"
+
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+using namespace Cantera;
+
+class TransportBatchTest : public testing::TestWithParam<std::string>
+{
+public:
+    TransportBatchTest() : npts(5), P(2 * OneAtm) {
+        gas.reset(newPhase("gri30.xml", "gri30"));
+        tran.reset(newTransportMgr(GetParam(), gas.get()));
+        nsp = gas->nSpecies();
+
+        // A set of states between an unburned and a burned mixture
+        T.resize(npts);
+        X.resize(npts * nsp);
+        vector_fp X0(nsp), X1(nsp);
+        gas->setState_TPX(300.0, P, "CH4:1, O2:2, N2:7.52");
+        gas->getMoleFractions(&X0[0]);
+        gas->setState_TPX(2200.0, P, "CO2:1, H2O:2, N2:7.52, OH:0.01, H:0.001");
+        gas->getMoleFractions(&X1[0]);
+        for (size_t n = 0; n < npts; n++) {
+            double f = n / (npts - 1.0);
+            T[n] = 300.0 + 1900.0 * f;
+            for (size_t k = 0; k < nsp; k++) {
+                X[k*npts + n] = (1 - f) * X0[k] + f * X1[k];
+            }
+        }
+        gas->setState_TPX(500.0, OneAtm, "H2:1, O2:1");
+    }
+
+    //! Set the phase to state n
+    void setState(size_t n) {
+        vector_fp x(nsp);
+        for (size_t k = 0; k < nsp; k++) {
+            x[k] = X[k*npts + n];
+        }
+        gas->setState_TPX(T[n], P, &x[0]);
+    }
+
+    std::auto_ptr<ThermoPhase> gas;
+    std::auto_ptr<Transport> tran;
+    size_t nsp, npts;
+    double P;
+    vector_fp T, X;
+};
+
+TEST_P(TransportBatchTest, mixProperties)
+{
+    vector_fp visc(npts), cond(npts), d(npts*nsp), dk(nsp);
+    tran->getMixTransportProperties(npts, &T[0], P, &X[0],
+                                    &visc[0], &cond[0], &d[0]);
+
+    // The state of the phase is not changed
+    EXPECT_DOUBLE_EQ(500.0, gas->temperature());
+    EXPECT_DOUBLE_EQ(OneAtm, gas->pressure());
+    EXPECT_DOUBLE_EQ(0.5, gas->moleFraction("H2"));
+
+    for (size_t n = 0; n < npts; n++) {
+        setState(n);
+        EXPECT_NEAR(tran->viscosity(), visc[n], 1e-12 * visc[n]);
+        double lambda = tran->thermalConductivity();
+        EXPECT_NEAR(lambda, cond[n], 1e-10 * lambda);
+        tran->getMixDiffCoeffs(&dk[0]);
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(dk[k], d[k*npts + n], 1e-12 * dk[k])
+                    << "n = " << n << ", k = " << k;
+        }
+    }
+}
+
+TEST_P(TransportBatchTest, optionalOutputs)
+{
+    vector_fp visc(npts), d(npts*nsp), d2(npts*nsp);
+    tran->getMixTransportProperties(npts, &T[0], P, &X[0], 0, 0, &d[0]);
+    tran->getMixTransportProperties(npts, &T[0], P, &X[0],
+                                    &visc[0], 0, &d2[0]);
+    for (size_t i = 0; i < npts*nsp; i++) {
+        EXPECT_DOUBLE_EQ(d[i], d2[i]);
+    }
+    setState(2);
+    EXPECT_NEAR(tran->viscosity(), visc[2], 1e-12 * visc[2]);
+}
+
+INSTANTIATE_TEST_CASE_P(TransportBatch, TransportBatchTest,
+                        testing::Values(std::string("Mix"),
+                                        std::string("CK_Mix"),
+                                        std::string("Multi")));
+
+class MultiTransportBatchTest : public TransportBatchTest {};
+
+TEST_P(MultiTransportBatchTest, multiProperties)
+{
+    vector_fp visc(npts), cond(npts), d(npts*nsp*nsp), dt(npts*nsp);
+    vector_fp dk(nsp*nsp), dtk(nsp);
+    tran->getMultiTransportProperties(npts, &T[0], P, &X[0],
+                                      &visc[0], &cond[0], &d[0], &dt[0]);
+    EXPECT_DOUBLE_EQ(500.0, gas->temperature());
+    EXPECT_DOUBLE_EQ(OneAtm, gas->pressure());
+
+    for (size_t n = 0; n < npts; n++) {
+        setState(n);
+        EXPECT_NEAR(tran->viscosity(), visc[n], 1e-12 * visc[n]);
+        double lambda = tran->thermalConductivity();
+        EXPECT_NEAR(lambda, cond[n], 1e-10 * lambda);
+        tran->getThermalDiffCoeffs(&dtk[0]);
+        double dtmax = 0.0;
+        for (size_t k = 0; k < nsp; k++) {
+            dtmax = std::max(dtmax, std::abs(dtk[k]));
+        }
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(dtk[k], dt[k*npts + n], 1e-9 * dtmax)
+                    << "n = " << n << ", k = " << k;
+        }
+        tran->getMultiDiffCoeffs(nsp, &dk[0]);
+        for (size_t i = 0; i < nsp*nsp; i++) {
+            EXPECT_NEAR(dk[i], d[i*npts + n], 1e-9 * std::abs(dk[i]))
+                    << "n = " << n << ", i = " << i;
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(MultiTransportBatch, MultiTransportBatchTest,
+                        testing::Values(std::string("Multi"),
+                                        std::string("CK_Multi")));
@@ -0,0 +1,161 @@
+#include "gtest/gtest.h"
+
+#include "cantera/transport/DustyGasTransport.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+using namespace Cantera;
+
+class DustyGasTransportTest : public testing::Test
+{
+public:
+    DustyGasTransportTest() {
+        gas.reset(newPhase("h2o2.xml"));
+        tran.reset(newTransportMgr("DustyGas", gas.get()));
+        dusty = dynamic_cast<DustyGasTransport*>(tran.get());
+        nsp = gas->nSpecies();
+        dusty->setPorosity(0.3);
+        dusty->setTortuosity(3.0);
+        dusty->setMeanPoreRadius(5.0e-7);
+        dusty->setMeanParticleDiameter(2.0e-6);
+    }
+
+    void getState(double T, double P, const std::string& X, vector_fp& state) {
+        gas->setState_TPX(T, P, X);
+        gas->saveState(state);
+    }
+
+    //! Check that the fluxes satisfy the dusty gas model equations at the
+    //! mean of the two states
+    void checkFluxes(const vector_fp& state1, const vector_fp& state2,
+                     double delta, const double* fluxes) {
+        vector_fp c1(nsp), c2(nsp), cbar(nsp), x(nsp), d(nsp*nsp), dk(nsp);
+        gas->restoreState(state1);
+        gas->getConcentrations(&c1[0]);
+        double p1 = gas->pressure();
+        gas->restoreState(state2);
+        gas->getConcentrations(&c2[0]);
+        double p2 = gas->pressure();
+        for (size_t k = 0; k < nsp; k++) {
+            cbar[k] = 0.5 * (c1[k] + c2[k]);
+        }
+        double T = 0.5 * (state1[0] + state2[0]);
+        gas->setState_TPX(T, 0.5 * (p1 + p2), &cbar[0]);
+        gas->getMoleFractions(&x[0]);
+        dusty->gasTransport().getBinaryDiffCoeffs(nsp, &d[0]);
+        double b = 1.0e-13 * (p2 - p1) / delta /
+                   dusty->gasTransport().viscosity();
+        for (size_t k = 0; k < nsp; k++) {
+            x[k] = std::max(x[k], Tiny);
+            dk[k] = 2.0 / 3.0 * 5.0e-7 * 0.1 *
+                    sqrt(8.0 * GasConstant * T / (Pi * gas->molecularWeight(k)));
+        }
+        for (size_t k = 0; k < nsp; k++) {
+            double lhs = fluxes[k] / dk[k];
+            double scale = std::abs(lhs);
+            for (size_t j = 0; j < nsp; j++) {
+                if (j != k) {
+                    double term = (x[j] * fluxes[k] - x[k] * fluxes[j]) /
+                                  (0.1 * d[nsp*j + k]);
+                    lhs += term;
+                    scale += std::abs(term);
+                }
+            }
+            double rhs = -(c2[k] - c1[k]) / delta - cbar[k] / dk[k] * b;
+            EXPECT_NEAR(rhs, lhs, 1e-10 * scale) << k;
+        }
+    }
+
+    std::auto_ptr<ThermoPhase> gas;
+    std::auto_ptr<Transport> tran;
+    DustyGasTransport* dusty;
+    size_t nsp;
+};
+
+TEST_F(DustyGasTransportTest, molarFluxes)
+{
+    dusty->setPermeability(1.0e-13);
+    vector_fp state1, state2, fluxes(nsp);
+    getState(600.0, OneAtm, "H2:0.4, O2:0.2, H2O:0.3, AR:0.1", state1);
+    getState(620.0, 1.1 * OneAtm, "H2:0.3, O2:0.25, H2O:0.35, AR:0.1", state2);
+    dusty->getMolarFluxes(&state1[0], &state2[0], 1.0e-3, &fluxes[0]);
+    checkFluxes(state1, state2, 1.0e-3, &fluxes[0]);
+
+    // Only the distance changes, so the factored matrix is reused
+    vector_fp fluxes2(nsp);
+    dusty->getMolarFluxes(&state1[0], &state2[0], 2.0e-3, &fluxes2[0]);
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(0.5 * fluxes[k], fluxes2[k], 1e-14 * std::abs(fluxes[k]));
+    }
+
+    // New mean composition at the same temperature and pressure
+    getState(620.0, 1.1 * OneAtm, "H2:0.1, O2:0.2, H2O:0.6, AR:0.1", state2);
+    dusty->getMolarFluxes(&state1[0], &state2[0], 1.0e-3, &fluxes[0]);
+    checkFluxes(state1, state2, 1.0e-3, &fluxes[0]);
+}
+
+TEST_F(DustyGasTransportTest, multiDiffCoeffs)
+{
+    vector_fp d(nsp*nsp), d2(nsp*nsp), state1, state2, fluxes(nsp);
+    getState(800.0, OneAtm, "H2:0.4, O2:0.2, H2O:0.3, AR:0.1", state1);
+    dusty->getMultiDiffCoeffs(nsp, &d[0]);
+
+    // Flux evaluations at other states do not change the result
+    getState(900.0, 2 * OneAtm, "H2:0.1, O2:0.2, H2O:0.6, AR:0.1", state2);
+    dusty->getMolarFluxes(&state2[0], &state2[0], 1.0e-3, &fluxes[0]);
+    gas->restoreState(state1);
+    dusty->getMultiDiffCoeffs(nsp, &d2[0]);
+    double dmax = *std::max_element(d.begin(), d.end());
+    for (size_t i = 0; i < nsp*nsp; i++) {
+        EXPECT_NEAR(d[i], d2[i], 1e-14 * dmax) << i;
+    }
+
+    // A change in pressure alone changes the binary diffusion coefficients
+    gas->setPressure(2 * OneAtm);
+    dusty->getMultiDiffCoeffs(nsp, &d2[0]);
+    size_t iH2 = gas->speciesIndex("H2");
+    size_t iO2 = gas->speciesIndex("O2");
+    EXPECT_NE(d[nsp*iO2 + iH2], d2[nsp*iO2 + iH2]);
+
+    // Changing the porosity also invalidates the saved factorization
+    gas->restoreState(state1);
+    dusty->setPorosity(0.4);
+    dusty->getMultiDiffCoeffs(nsp, &d2[0]);
+    EXPECT_NE(d[nsp*iO2 + iH2], d2[nsp*iO2 + iH2]);
+}
+
+TEST_F(DustyGasTransportTest, batchFluxes)
+{
+    const size_t npts = 4;
+    const char* comp[npts+1] = {"H2:0.4, O2:0.2, H2O:0.3, AR:0.1",
+                                "H2:0.35, O2:0.2, H2O:0.35, AR:0.1",
+                                "H2:0.3, O2:0.22, H2O:0.38, AR:0.1",
+                                "H2:0.2, O2:0.25, H2O:0.45, AR:0.1",
+                                "H2:0.1, O2:0.3, H2O:0.5, AR:0.1"};
+    size_t nstate = nsp + 2;
+    vector_fp states1(npts*nstate), states2(npts*nstate), state;
+    vector_fp delta(npts, 1.0e-4);
+    for (size_t n = 0; n < npts; n++) {
+        getState(700.0 + 10.0 * n, OneAtm * (1.0 + 0.01 * n), comp[n], state);
+        std::copy(state.begin(), state.end(), states1.begin() + n*nstate);
+        getState(710.0 + 10.0 * n, OneAtm * (1.01 + 0.01 * n), comp[n+1], state);
+        std::copy(state.begin(), state.end(), states2.begin() + n*nstate);
+    }
+
+    gas->setState_TPX(500.0, OneAtm, "H2:0.5, O2:0.5");
+    vector_fp fluxes(npts*nsp);
+    dusty->getMolarFluxes(npts, &states1[0], &states2[0], &delta[0], &fluxes[0]);
+
+    // The state of the phase is not changed
+    EXPECT_DOUBLE_EQ(500.0, gas->temperature());
+    EXPECT_DOUBLE_EQ(0.5, gas->moleFraction("H2"));
+
+    vector_fp fluxes1(nsp);
+    for (size_t n = 0; n < npts; n++) {
+        dusty->getMolarFluxes(&states1[n*nstate], &states2[n*nstate],
+                              delta[n], &fluxes1[0]);
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_DOUBLE_EQ(fluxes1[k], fluxes[n*nsp + k]) << n << " " << k;
+        }
+    }
+}
@@ -0,0 +1,286 @@
+#include "gtest/gtest.h"
+
+#include "cantera/transport/MixTransport.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/base/logger.h"
+#include "../../src/transport/MMCollisionInt.h"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace Cantera;
+
+//! Provides access to the polynomial fits and the cache file functions
+class TestMixTransport : public MixTransport
+{
+public:
+    using GasTransport::readFitCache;
+    using GasTransport::writeFitCache;
+    using GasTransport::m_fits;
+    using GasTransport::m_eps;
+    using GasTransport::fitDiffCoeffs;
+};
+
+class TransportFitCacheTest : public testing::Test
+{
+public:
+    TransportFitCacheTest() : fname("transport-fits-test.bin") {
+        gas.reset(newPhase("gri30.xml", "gri30"));
+        nsp = gas->nSpecies();
+        key.push_back(1.0);
+        key.push_back(2.5);
+        key.push_back(-3.0);
+    }
+
+    ~TransportFitCacheTest() {
+        GasTransport::setFitCacheDirectory("");
+        std::remove(fname.c_str());
+        for (size_t i = 0; i < generated.size(); i++) {
+            std::remove(generated[i].c_str());
+        }
+    }
+
+    //! Check that the polynomial fits of two transport managers are identical
+    void compareFits(GasTransport& t1, GasTransport& t2, size_t ncoeffs) {
+        vector_fp c1(ncoeffs), c2(ncoeffs);
+        for (size_t i = 0; i < nsp; i++) {
+            t1.getViscosityPolynomial(i, &c1[0]);
+            t2.getViscosityPolynomial(i, &c2[0]);
+            for (size_t n = 0; n < ncoeffs; n++) {
+                EXPECT_EQ(c1[n], c2[n]);
+            }
+            t1.getConductivityPolynomial(i, &c1[0]);
+            t2.getConductivityPolynomial(i, &c2[0]);
+            for (size_t n = 0; n < ncoeffs; n++) {
+                EXPECT_EQ(c1[n], c2[n]);
+            }
+            for (size_t j = 0; j < nsp; j++) {
+                t1.getBinDiffusivityPolynomial(i, j, &c1[0]);
+                t2.getBinDiffusivityPolynomial(i, j, &c2[0]);
+                for (size_t n = 0; n < ncoeffs; n++) {
+                    EXPECT_EQ(c1[n], c2[n]) << i << ", " << j;
+                }
+            }
+        }
+    }
+
+    std::auto_ptr<ThermoPhase> gas;
+    size_t nsp;
+    std::string fname;
+    vector_fp key;
+
+    //! Cache files written by the transport managers, removed by the
+    //! destructor
+    std::vector<std::string> generated;
+};
+
+TEST_F(TransportFitCacheTest, writeAndRead)
+{
+    TestMixTransport t1;
+    t1.init(gas.get());
+    t1.writeFitCache(fname, key, *t1.m_fits);
+
+    GasTransportFits fits;
+    ASSERT_TRUE(t1.readFitCache(fname, key, fits));
+    const GasTransportFits& f1 = *t1.m_fits;
+    ASSERT_EQ(f1.diffcoeffs.size(), fits.diffcoeffs.size());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_TRUE(f1.visccoeffs[k] == fits.visccoeffs[k]);
+        EXPECT_TRUE(f1.condcoeffs[k] == fits.condcoeffs[k]);
+    }
+    for (size_t ic = 0; ic < f1.diffcoeffs.size(); ic++) {
+        EXPECT_TRUE(f1.diffcoeffs[ic] == fits.diffcoeffs[ic]);
+    }
+}
+
+TEST_F(TransportFitCacheTest, mismatchedKey)
+{
+    TestMixTransport t1;
+    t1.init(gas.get());
+    t1.writeFitCache(fname, key, *t1.m_fits);
+
+    GasTransportFits fits;
+    vector_fp key2 = key;
+    key2[1] = 2.5000000001;
+    EXPECT_FALSE(t1.readFitCache(fname, key2, fits));
+    key2 = key;
+    key2.push_back(1.0);
+    EXPECT_FALSE(t1.readFitCache(fname, key2, fits));
+    EXPECT_FALSE(t1.readFitCache("nonexistent-file.bin", key, fits));
+
+    // A file written for a transport manager of a different type of fits has
+    // the wrong number of coefficients
+    TestMixTransport t2;
+    t2.init(gas.get(), CK_Mode);
+    EXPECT_FALSE(t2.readFitCache(fname, key, fits));
+}
+
+TEST_F(TransportFitCacheTest, truncatedFile)
+{
+    TestMixTransport t1;
+    t1.init(gas.get());
+    t1.writeFitCache(fname, key, *t1.m_fits);
+    GasTransportFits fits;
+    EXPECT_TRUE(t1.readFitCache(fname, key, fits));
+
+    std::string contents;
+    {
+        std::ifstream in(fname.c_str(), std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(in),
+                        std::istreambuf_iterator<char>());
+    }
+    std::ofstream out(fname.c_str(), std::ios::binary);
+    out.write(contents.data(), contents.size() - 8);
+    out.close();
+    EXPECT_FALSE(t1.readFitCache(fname, key, fits));
+}
+
+TEST_F(TransportFitCacheTest, cachedTransport)
+{
+    std::auto_ptr<Transport> tran(newTransportMgr("Mix", gas.get()));
+    GasTransport::setFitCacheDirectory(".");
+    EXPECT_EQ(".", GasTransport::fitCacheDirectory());
+
+    // The first transport manager writes the cache and the second reads it
+    std::auto_ptr<Transport> tran1(newTransportMgr("Mix", gas.get()));
+    std::auto_ptr<Transport> tran2(newTransportMgr("Mix", gas.get()));
+    const std::string& cacheFile =
+        dynamic_cast<GasTransport&>(*tran1).fitCacheFile();
+    generated.push_back(cacheFile);
+    EXPECT_EQ((size_t) 0, cacheFile.find("./transport-fits-"));
+    EXPECT_EQ(cacheFile, dynamic_cast<GasTransport&>(*tran2).fitCacheFile());
+    EXPECT_EQ("", dynamic_cast<GasTransport&>(*tran).fitCacheFile());
+    compareFits(dynamic_cast<GasTransport&>(*tran),
+                dynamic_cast<GasTransport&>(*tran1), 5);
+    compareFits(dynamic_cast<GasTransport&>(*tran),
+                dynamic_cast<GasTransport&>(*tran2), 5);
+
+    // Fits of a different type are not read from the same cache file
+    std::auto_ptr<Transport> ck1(newTransportMgr("CK_Mix", gas.get()));
+    std::auto_ptr<Transport> ck2(newTransportMgr("CK_Mix", gas.get()));
+    generated.push_back(dynamic_cast<GasTransport&>(*ck1).fitCacheFile());
+    EXPECT_NE(cacheFile, generated.back());
+    compareFits(dynamic_cast<GasTransport&>(*ck1),
+                dynamic_cast<GasTransport&>(*ck2), 4);
+
+    gas->setState_TPX(1200.0, OneAtm, "H2:1, O2:1, AR:3");
+    EXPECT_DOUBLE_EQ(tran->viscosity(), tran2->viscosity());
+    EXPECT_DOUBLE_EQ(tran->thermalConductivity(),
+                     tran2->thermalConductivity());
+    EXPECT_NE(tran->viscosity(), ck2->viscosity());
+}
+
+TEST_F(TransportFitCacheTest, scaledDiffusionFits)
+{
+    // Pairs with the same well depth and reduced dipole moment share one fit,
+    // scaled for each pair. Compare these with fits made for every pair.
+    int modes[2] = {0, CK_Mode};
+    for (size_t m = 0; m < 2; m++) {
+        TestMixTransport t;
+        t.init(gas.get(), modes[m]);
+
+        // Collision integrals over the same range of reduced temperature as
+        // in GasTransport::init()
+        double tsmin = 1.0e8, tsmax = 0.0;
+        std::vector<std::pair<size_t, size_t> > pairs;
+        for (size_t k = 0; k < nsp; k++) {
+            for (size_t j = k; j < nsp; j++) {
+                double eps = sqrt(t.m_eps[k] * t.m_eps[j]);
+                tsmin = std::min(tsmin, Boltzmann * gas->minTemp() / eps);
+                tsmax = std::max(tsmax, Boltzmann * gas->maxTemp() / eps);
+                pairs.push_back(std::make_pair(k, j));
+            }
+        }
+        if (modes[m] == CK_Mode) {
+            tsmin = 0.101;
+            tsmax = 99.9;
+        }
+        MMCollisionInt integrals;
+        integrals.init(tsmin, tsmax);
+
+        size_t ncoeffs = (modes[m] == CK_Mode) ? 4 : 5;
+        vector_fp fits(pairs.size() * ncoeffs), errors(2 * pairs.size());
+        t.fitDiffCoeffs(&integrals, &pairs, 0, pairs.size(), &fits[0],
+                        &errors[0]);
+        const std::vector<vector_fp>& diffcoeffs = t.m_fits->diffcoeffs;
+        ASSERT_EQ(pairs.size(), diffcoeffs.size());
+
+        double T[3] = {gas->minTemp(), 1000.0, gas->maxTemp()};
+        for (size_t ic = 0; ic < pairs.size(); ic++) {
+            for (size_t n = 0; n < 3; n++) {
+                double logt = log(T[n]);
+                double d1 = 0.0, d2 = 0.0;
+                for (size_t i = ncoeffs; i > 0; i--) {
+                    d1 = d1 * logt + fits[ic * ncoeffs + i - 1];
+                    d2 = d2 * logt + diffcoeffs[ic][i-1];
+                }
+                if (modes[m] == CK_Mode) {
+                    d1 = exp(d1);
+                    d2 = exp(d2);
+                }
+                EXPECT_NEAR(d1, d2, 1e-10 * d1) << m << " " << ic;
+            }
+        }
+    }
+}
+
+TEST_F(TransportFitCacheTest, sharedFits)
+{
+    // Transport managers made from the same inputs share one set of fits
+    TestMixTransport t1, t2, ck;
+    t1.init(gas.get());
+    t2.init(gas.get());
+    ck.init(gas.get(), CK_Mode);
+    EXPECT_TRUE(t1.m_fits.get() == t2.m_fits.get());
+    EXPECT_FALSE(t1.m_fits.get() == ck.m_fits.get());
+
+    // A copy shares the fits
+    TestMixTransport t3(t1);
+    EXPECT_TRUE(t1.m_fits.get() == t3.m_fits.get());
+    gas->setState_TPX(1200.0, OneAtm, "H2:1, O2:1, AR:3");
+    EXPECT_DOUBLE_EQ(t1.viscosity(), t3.viscosity());
+    EXPECT_DOUBLE_EQ(t1.thermalConductivity(), t3.thermalConductivity());
+
+    // The fits for a different temperature range are not shared
+    std::auto_ptr<ThermoPhase> h2o2(newPhase("h2o2.xml"));
+    TestMixTransport t4;
+    t4.init(h2o2.get());
+    EXPECT_FALSE(t1.m_fits.get() == t4.m_fits.get());
+
+    // The shared fits are still saved when the cache is enabled later
+    GasTransport::setFitCacheDirectory(".");
+    TestMixTransport t5;
+    t5.init(gas.get());
+    generated.push_back(t5.fitCacheFile());
+    EXPECT_TRUE(t1.m_fits.get() == t5.m_fits.get());
+    std::ifstream f(t5.fitCacheFile().c_str());
+    EXPECT_TRUE(f.good());
+}
+
+//! Logger which saves the messages in a string owned by the caller
+class StringLogger : public Logger
+{
+public:
+    explicit StringLogger(std::string& buffer) : m_buffer(buffer) {}
+
+    virtual void write(const std::string& msg) {
+        m_buffer += msg;
+    }
+
+    std::string& m_buffer;
+};
+
+TEST_F(TransportFitCacheTest, keepsLogger)
+{
+    // Fitting the properties on the calling thread must not release the
+    // calling thread's logger
+    std::string log;
+    setLogger(new StringLogger(log));
+    writelog("before\n");
+    std::auto_ptr<ThermoPhase> h2o2(newPhase("h2o2.xml"));
+    std::auto_ptr<Transport> tran(newDefaultTransportMgr(h2o2.get()));
+    writelog("after\n");
+    setLogger(new Logger());
+    EXPECT_EQ("before\nafter\n", log);
+}
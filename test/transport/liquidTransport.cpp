@@ -0,0 +1,164 @@
+#include "gtest/gtest.h"
+
+#include "cantera/transport/LiquidTransport.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+using namespace Cantera;
+
+class LiquidTransportTest : public testing::Test
+{
+public:
+    LiquidTransportTest() {
+        salt.reset(newPhase("LiKCl-liquid-transport.xml", "LiKCl_liquid"));
+        tran.reset(newTransportMgr("Liquid", salt.get()));
+        liquid = dynamic_cast<LiquidTransport*>(tran.get());
+        nsp = salt->nSpecies();
+        iLi = salt->speciesIndex("LiCl(L)");
+        iK = salt->speciesIndex("KCl(L)");
+    }
+
+    //! Check the mixture properties at the current state of the phase
+    //! against the mixing rules evaluated directly from the parameters in
+    //! the input file
+    void checkProperties() {
+        double T = salt->temperature();
+        double RT = GasConstant * T;
+        vector_fp x(nsp), visc(nsp), ionCond(nsp), d(nsp*nsp);
+        salt->getMoleFractions(&x[0]);
+        double x0 = x[iLi];
+        double x1 = x[iK];
+        tran->getSpeciesViscosities(&visc[0]);
+        tran->getSpeciesIonConductivity(&ionCond[0]);
+
+        // logMoleFractions, with a mixture weighting of 0.8 for LiCl
+        double w0 = 0.8 * x0;
+        double lnVisc = w0 * log(visc[iLi]) + x1 * log(visc[iK])
+            + w0 * x1 * ((-1.0e6 / RT - 800.0 / GasConstant)
+                         + 4.0e5 / RT * w0);
+        EXPECT_NEAR(exp(lnVisc), tran->viscosity(), 1e-13 * exp(lnVisc));
+
+        // moleFractions
+        double sigma = x0 * ionCond[iLi] + x1 * ionCond[iK]
+            + x0 * x1 * ((-50.0 + 0.01 * T) + 20.0 * x0 + 5.0 * x0 * x0)
+            + x1 * x0 * (-30.0);
+        EXPECT_NEAR(sigma, tran->ionConductivity(), 1e-13 * sigma);
+
+        // moleFractionsExpT
+        double lambda = x0 * 0.6 + x1 * 0.45
+            + x0 * x1 * (-0.1 * exp(-1.0e-3 * T) + 0.02 * exp(2.0e-4 * T) * x0);
+        EXPECT_NEAR(lambda, tran->thermalConductivity(), 1e-13 * lambda);
+
+        // pairwiseInteraction
+        tran->getBinaryDiffCoeffs(nsp, &d[0]);
+        double D01 = 4.0e-8 * exp(-2.0e7 / RT);
+        EXPECT_NEAR(D01, d[iLi*nsp + iK], 1e-13 * D01);
+        EXPECT_NEAR(D01, d[iK*nsp + iLi], 1e-13 * D01);
+    }
+
+    std::auto_ptr<ThermoPhase> salt;
+    std::auto_ptr<Transport> tran;
+    LiquidTransport* liquid;
+    size_t nsp, iLi, iK;
+};
+
+TEST_F(LiquidTransportTest, mixingRules)
+{
+    salt->setState_TPX(850.0, OneAtm, "LiCl(L):0.6, KCl(L):0.4");
+    checkProperties();
+    salt->setState_TPX(1000.0, OneAtm, "LiCl(L):0.1, KCl(L):0.9");
+    checkProperties();
+}
+
+TEST_F(LiquidTransportTest, stateChanges)
+{
+    salt->setState_TPX(850.0, OneAtm, "LiCl(L):0.6, KCl(L):0.4");
+    double visc = tran->viscosity();
+    double lambda = tran->thermalConductivity();
+    checkProperties();
+
+    // New composition at the same temperature
+    salt->setMoleFractionsByName("LiCl(L):0.3, KCl(L):0.7");
+    EXPECT_NE(visc, tran->viscosity());
+    checkProperties();
+
+    // New temperature at the same composition
+    salt->setTemperature(900.0);
+    checkProperties();
+
+    // Back to the original state
+    salt->setState_TPX(850.0, OneAtm, "LiCl(L):0.6, KCl(L):0.4");
+    EXPECT_DOUBLE_EQ(visc, tran->viscosity());
+    EXPECT_DOUBLE_EQ(lambda, tran->thermalConductivity());
+}
+
+TEST_F(LiquidTransportTest, batchProperties)
+{
+    const size_t npts = 5;
+    double T[npts] = {800.0, 800.0, 800.0, 900.0, 900.0};
+    vector_fp X(npts * nsp);
+    for (size_t n = 0; n < npts; n++) {
+        X[iLi*npts + n] = 0.2 * n + 0.05;
+        X[iK*npts + n] = 1.0 - X[iLi*npts + n];
+    }
+    salt->setState_TPX(1000.0, OneAtm, "LiCl(L):0.5, KCl(L):0.5");
+    vector_fp visc(npts), ionCond(npts), cond(npts), d(npts*nsp*nsp);
+    liquid->getLiquidTransportProperties(npts, T, OneAtm, &X[0], &visc[0],
+                                         &ionCond[0], &cond[0], &d[0]);
+
+    // The state of the phase is not changed
+    EXPECT_DOUBLE_EQ(1000.0, salt->temperature());
+    EXPECT_DOUBLE_EQ(0.5, salt->moleFraction("LiCl(L)"));
+
+    vector_fp xk(nsp), dk(nsp*nsp);
+    for (size_t n = 0; n < npts; n++) {
+        for (size_t k = 0; k < nsp; k++) {
+            xk[k] = X[k*npts + n];
+        }
+        salt->setState_TPX(T[n], OneAtm, &xk[0]);
+        EXPECT_DOUBLE_EQ(tran->viscosity(), visc[n]) << n;
+        EXPECT_DOUBLE_EQ(tran->ionConductivity(), ionCond[n]) << n;
+        EXPECT_DOUBLE_EQ(tran->thermalConductivity(), cond[n]) << n;
+        tran->getBinaryDiffCoeffs(nsp, &dk[0]);
+        EXPECT_DOUBLE_EQ(dk[iLi*nsp + iK], d[(iLi*nsp + iK)*npts + n]) << n;
+        checkProperties();
+    }
+
+    // Outputs that are not needed may be omitted
+    vector_fp visc2(npts);
+    liquid->getLiquidTransportProperties(npts, T, OneAtm, &X[0], &visc2[0],
+                                         0, 0, 0);
+    for (size_t n = 0; n < npts; n++) {
+        EXPECT_DOUBLE_EQ(visc[n], visc2[n]);
+    }
+}
+
+TEST(LiquidTransportPPN, compositionChanges)
+{
+    std::auto_ptr<ThermoPhase> ions(newPhase("LiKCl-ions-transport.xml",
+                                             "LiKCl_ions"));
+    std::auto_ptr<Transport> tran(newTransportMgr("Liquid", ions.get()));
+    size_t nsp = ions->nSpecies();
+    size_t iLi = ions->speciesIndex("Li+");
+    size_t iK = ions->speciesIndex("K+");
+    size_t iCl = ions->speciesIndex("Cl-");
+    vector_fp d1(nsp*nsp), d2(nsp*nsp), dref(nsp*nsp);
+    ions->setState_TPX(800.0, OneAtm, "Li+:0.3, K+:0.2, Cl-:0.5");
+    tran->getBinaryDiffCoeffs(nsp, &d1[0]);
+
+    // New composition at the same temperature. The Stefan-Maxwell
+    // interaction parameters depend on the composition.
+    ions->setMoleFractionsByName("Li+:0.1, K+:0.4, Cl-:0.5");
+    tran->getBinaryDiffCoeffs(nsp, &d2[0]);
+    EXPECT_NE(d1[iLi*nsp + iK], d2[iLi*nsp + iK]);
+
+    std::auto_ptr<Transport> tran2(newTransportMgr("Liquid", ions.get()));
+    tran2->getBinaryDiffCoeffs(nsp, &dref[0]);
+    size_t pairs[3][2] = {{iLi, iK}, {iLi, iCl}, {iK, iCl}};
+    for (size_t n = 0; n < 3; n++) {
+        size_t i = pairs[n][0];
+        size_t j = pairs[n][1];
+        EXPECT_DOUBLE_EQ(dref[i*nsp + j], d2[i*nsp + j]) << n;
+        EXPECT_DOUBLE_EQ(dref[j*nsp + i], d2[j*nsp + i]) << n;
+    }
+}
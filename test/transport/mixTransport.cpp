@@ -0,0 +1,238 @@
+#include "gtest/gtest.h"
+
+#include "cantera/transport/MixTransport.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/base/ctexceptions.h"
+
+using namespace Cantera;
+
+class MixTransportTest : public testing::TestWithParam<std::string>
+{
+public:
+    MixTransportTest() {
+        gas.reset(newPhase("gri30.xml", "gri30"));
+        tran.reset(newTransportMgr(GetParam(), gas.get()));
+        mix = dynamic_cast<MixTransport*>(tran.get());
+        nsp = gas->nSpecies();
+        ncoeffs = (GetParam() == "CK_Mix") ? 4 : 5;
+    }
+
+    //! Evaluate one of the polynomial fits returned by MixTransport directly
+    double evalPoly(const vector_fp& c, double T) {
+        double logt = log(T);
+        double sum = 0.0;
+        for (size_t n = ncoeffs; n > 0; n--) {
+            sum = sum * logt + c[n-1];
+        }
+        return sum;
+    }
+
+    void setState(double T) {
+        gas->setState_TPX(T, 2 * OneAtm,
+            "CH4:0.05, O2:0.15, N2:0.6, H2O:0.1, CO2:0.05, OH:0.01, H:0.001");
+    }
+
+    std::auto_ptr<ThermoPhase> gas;
+    std::auto_ptr<Transport> tran;
+    MixTransport* mix;
+    size_t nsp, ncoeffs;
+};
+
+TEST_P(MixTransportTest, speciesViscosities)
+{
+    vector_fp c(ncoeffs), visc(nsp);
+    double T[] = {300.0, 1234.5, 2500.0};
+    for (size_t i = 0; i < 3; i++) {
+        setState(T[i]);
+        tran->getSpeciesViscosities(&visc[0]);
+        for (size_t k = 0; k < nsp; k++) {
+            mix->getViscosityPolynomial(k, &c[0]);
+            double expected;
+            if (GetParam() == "CK_Mix") {
+                expected = exp(evalPoly(c, T[i]));
+            } else {
+                expected = pow(sqrt(sqrt(T[i])) * evalPoly(c, T[i]), 2);
+            }
+            EXPECT_NEAR(expected, visc[k], 1e-12 * expected) << "k = " << k;
+        }
+    }
+}
+
+TEST_P(MixTransportTest, binaryDiffCoeffs)
+{
+    vector_fp c(ncoeffs), d(nsp*nsp);
+    double T = 1500.0;
+    setState(T);
+    tran->getBinaryDiffCoeffs(nsp, &d[0]);
+    for (size_t i = 0; i < nsp; i++) {
+        for (size_t j = 0; j < nsp; j++) {
+            mix->getBinDiffusivityPolynomial(i, j, &c[0]);
+            double expected;
+            if (GetParam() == "CK_Mix") {
+                expected = exp(evalPoly(c, T));
+            } else {
+                expected = pow(T, 1.5) * evalPoly(c, T);
+            }
+            expected /= gas->pressure();
+            EXPECT_NEAR(expected, d[nsp*j + i], 1e-12 * expected)
+                    << "i = " << i << ", j = " << j;
+        }
+    }
+}
+
+TEST_P(MixTransportTest, mixtureViscosity)
+{
+    // Wilke mixture rule, Eq. (9-5.13) of Reid, Prausnitz, and Poling
+    vector_fp visc(nsp), X(nsp);
+    const vector_fp& mw = gas->molecularWeights();
+    double T[] = {300.0, 1234.5, 2500.0};
+    for (size_t i = 0; i < 3; i++) {
+        setState(T[i]);
+        gas->getMoleFractions(&X[0]);
+        tran->getSpeciesViscosities(&visc[0]);
+        double expected = 0.0;
+        for (size_t k = 0; k < nsp; k++) {
+            double sum = 0.0;
+            for (size_t j = 0; j < nsp; j++) {
+                double f = 1.0 + sqrt(visc[k] / visc[j]) * pow(mw[j] / mw[k], 0.25);
+                sum += X[j] * f * f / sqrt(8.0 * (1.0 + mw[k] / mw[j]));
+            }
+            expected += X[k] * visc[k] / sum;
+        }
+        EXPECT_NEAR(expected, tran->viscosity(), 1e-12 * expected);
+    }
+}
+
+TEST_P(MixTransportTest, mixDiffCoeffs)
+{
+    vector_fp X(nsp), d(nsp*nsp), dmix(nsp), dmole(nsp), dmass(nsp);
+    const vector_fp& mw = gas->molecularWeights();
+    setState(900.0);
+    gas->getMoleFractions(&X[0]);
+    double mmw = gas->meanMolecularWeight();
+    tran->getBinaryDiffCoeffs(nsp, &d[0]);
+    tran->getMixDiffCoeffs(&dmix[0]);
+    tran->getMixDiffCoeffsMole(&dmole[0]);
+    tran->getMixDiffCoeffsMass(&dmass[0]);
+    for (size_t k = 0; k < nsp; k++) {
+        double sum1 = 0.0, sum2 = 0.0;
+        for (size_t j = 0; j < nsp; j++) {
+            if (j != k) {
+                sum1 += X[j] / d[nsp*k + j];
+                sum2 += X[j] * mw[j] / d[nsp*k + j];
+            }
+        }
+        double xw = X[k] * mw[k];
+        double expected = (mmw - xw) / (mmw * sum1);
+        EXPECT_NEAR(expected, dmix[k], 1e-12 * expected) << "k = " << k;
+        expected = (1 - X[k]) / sum1;
+        EXPECT_NEAR(expected, dmole[k], 1e-12 * expected) << "k = " << k;
+        expected = 1.0 / (sum1 + sum2 * X[k] / (mmw - xw));
+        EXPECT_NEAR(expected, dmass[k], 1e-12 * expected) << "k = " << k;
+    }
+}
+
+TEST_P(MixTransportTest, copy)
+{
+    setState(1100.0);
+    std::auto_ptr<Transport> copy(tran->duplMyselfAsTransport());
+    vector_fp d1(nsp), d2(nsp);
+    tran->getMixDiffCoeffs(&d1[0]);
+    copy->getMixDiffCoeffs(&d2[0]);
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_DOUBLE_EQ(d1[k], d2[k]);
+    }
+    EXPECT_DOUBLE_EQ(tran->viscosity(), copy->viscosity());
+    EXPECT_DOUBLE_EQ(tran->thermalConductivity(), copy->thermalConductivity());
+}
+
+TEST_P(MixTransportTest, traceThreshold)
+{
+    // Most species are present only in trace amounts
+    gas->setState_TPX(1600.0, OneAtm, "CH4:0.02, O2:0.1, N2:0.7, H2O:0.1, "
+                      "CO2:0.05, OH:1e-3, H:1e-4, O:1e-5, CH3:1e-9, HO2:1e-7");
+    vector_fp d0(nsp), d1(nsp), dm0(nsp), dm1(nsp), dw0(nsp), dw1(nsp);
+    tran->getMixDiffCoeffs(&d0[0]);
+    tran->getMixDiffCoeffsMole(&dm0[0]);
+    tran->getMixDiffCoeffsMass(&dw0[0]);
+
+    std::auto_ptr<Transport> tran2(newTransportMgr(GetParam(), gas.get()));
+    GasTransport* gt = dynamic_cast<GasTransport*>(tran2.get());
+    EXPECT_EQ(0.0, gt->traceThreshold());
+    gt->setTraceThreshold(1e-6);
+    EXPECT_EQ(1e-6, gt->traceThreshold());
+    tran2->getMixDiffCoeffs(&d1[0]);
+    tran2->getMixDiffCoeffsMole(&dm1[0]);
+    tran2->getMixDiffCoeffsMass(&dw1[0]);
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(d0[k], d1[k], 1e-4 * d0[k]) << "k = " << k;
+        EXPECT_NEAR(dm0[k], dm1[k], 1e-4 * dm0[k]) << "k = " << k;
+        EXPECT_NEAR(dw0[k], dw1[k], 1e-4 * dw0[k]) << "k = " << k;
+    }
+
+    // Pairs which were skipped are evaluated when all pairs are needed
+    vector_fp b0(nsp*nsp), b1(nsp*nsp);
+    tran->getBinaryDiffCoeffs(nsp, &b0[0]);
+    tran2->getBinaryDiffCoeffs(nsp, &b1[0]);
+    for (size_t i = 0; i < nsp*nsp; i++) {
+        EXPECT_DOUBLE_EQ(b0[i], b1[i]);
+    }
+
+    // With a zero threshold, all pairs are included
+    gas->setState_TPX(1200.0, OneAtm, "CH4:0.02, O2:0.1, N2:0.7, H:1e-9");
+    gt->setTraceThreshold(0.0);
+    tran->getMixDiffCoeffs(&d0[0]);
+    tran2->getMixDiffCoeffs(&d1[0]);
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_DOUBLE_EQ(d0[k], d1[k]);
+    }
+
+    EXPECT_THROW(gt->setTraceThreshold(-1.0), CanteraError);
+    EXPECT_THROW(gt->setTraceThreshold(1.0), CanteraError);
+}
+
+TEST_P(MixTransportTest, traceThresholdTemperatureChange)
+{
+    // Pairs evaluated lazily at one temperature are reevaluated at the next
+    GasTransport* gt = dynamic_cast<GasTransport*>(tran.get());
+    gt->setTraceThreshold(1e-8);
+    vector_fp d1(nsp), d2(nsp);
+    std::auto_ptr<Transport> ref(newTransportMgr(GetParam(), gas.get()));
+    double T[] = {500.0, 1500.0, 900.0};
+    const char* X[] = {"H2:1, O2:1, AR:1e-10", "H2O:1, AR:1, H:1e-3",
+                       "H2:1, O2:1, AR:1e-10"};
+    for (size_t i = 0; i < 3; i++) {
+        gas->setState_TPX(T[i], OneAtm, X[i]);
+        tran->getMixDiffCoeffs(&d1[0]);
+        ref->getMixDiffCoeffs(&d2[0]);
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(d2[k], d1[k], 1e-6 * d2[k]) << "k = " << k;
+        }
+    }
+}
+
+TEST_P(MixTransportTest, traceThresholdRevisitTemperature)
+{
+    // Pairs shared with species evaluated at another temperature in between
+    // are reevaluated when an earlier temperature is revisited
+    GasTransport* gt = dynamic_cast<GasTransport*>(tran.get());
+    gt->setTraceThreshold(1e-6);
+    vector_fp d1(nsp), d2(nsp);
+    std::auto_ptr<Transport> ref(newTransportMgr(GetParam(), gas.get()));
+    double T[] = {1000.0, 1500.0, 1000.0};
+    const char* X[] = {"CH4:1, O2:2, N2:7.52", "H2:1, O2:0.5, N2:3",
+                       "CH4:1, O2:2, N2:7.52"};
+    for (size_t i = 0; i < 3; i++) {
+        gas->setState_TPX(T[i], OneAtm, X[i]);
+        tran->getMixDiffCoeffs(&d1[0]);
+        ref->getMixDiffCoeffs(&d2[0]);
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(d2[k], d1[k], 1e-6 * d2[k]) << "i = " << i << ", k = " << k;
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(MixTransport, MixTransportTest,
+                        testing::Values(std::string("Mix"),
+                                        std::string("CK_Mix")));
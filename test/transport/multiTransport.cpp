@@ -0,0 +1,128 @@
+#include "gtest/gtest.h"
+
+#include "cantera/transport/MultiTransport.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/base/ctexceptions.h"
+
+using namespace Cantera;
+
+class MultiTransportIterativeTest : public testing::TestWithParam<std::string>
+{
+public:
+    MultiTransportIterativeTest() {
+        gas.reset(newPhase("gri30.xml", "gri30"));
+        tran.reset(newTransportMgr(GetParam(), gas.get()));
+        multi = dynamic_cast<MultiTransport*>(tran.get());
+        nsp = gas->nSpecies();
+    }
+
+    //! Compare the thermal conductivity and thermal diffusion coefficients
+    //! from the iterative method with those from the direct method
+    void checkThermal(double T, const std::string& X) {
+        gas->setState_TPX(T, OneAtm, X);
+        vector_fp dt1(nsp), dt2(nsp);
+        multi->setIterativeSolver(false);
+        double lambda1 = tran->thermalConductivity();
+        tran->getThermalDiffCoeffs(&dt1[0]);
+        multi->setIterativeSolver(true, 50, 1e-10);
+        double lambda2 = tran->thermalConductivity();
+        tran->getThermalDiffCoeffs(&dt2[0]);
+
+        EXPECT_NEAR(lambda1, lambda2, 1e-9 * lambda1) << X;
+        double dtmax = 0.0, sum = 0.0;
+        for (size_t k = 0; k < nsp; k++) {
+            dtmax = std::max(dtmax, std::abs(dt1[k]));
+            sum += dt2[k];
+        }
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(dt1[k], dt2[k], 1e-9 * dtmax) << X << ", k = " << k;
+        }
+        EXPECT_NEAR(0.0, sum, 1e-12 * dtmax);
+    }
+
+    //! Maximum difference between the multicomponent diffusion coefficients
+    //! from the series of the given order and from the direct method,
+    //! relative to the largest coefficient
+    double seriesError(size_t order) {
+        vector_fp d1(nsp*nsp), d2(nsp*nsp);
+        multi->setIterativeSolver(false);
+        tran->getMultiDiffCoeffs(nsp, &d1[0]);
+        multi->setIterativeSolver(true, 50, 1e-8, order);
+        tran->getMultiDiffCoeffs(nsp, &d2[0]);
+        double dmax = 0.0, err = 0.0;
+        for (size_t i = 0; i < nsp*nsp; i++) {
+            dmax = std::max(dmax, std::abs(d1[i]));
+            err = std::max(err, std::abs(d2[i] - d1[i]));
+        }
+        return err / dmax;
+    }
+
+    std::auto_ptr<ThermoPhase> gas;
+    std::auto_ptr<Transport> tran;
+    MultiTransport* multi;
+    size_t nsp;
+};
+
+TEST_P(MultiTransportIterativeTest, thermalProperties)
+{
+    checkThermal(300.0, "CH4:1, O2:2, N2:7.52");
+    checkThermal(1500.0, "CH4:0.05, O2:0.15, N2:0.6, H2O:0.1, CO2:0.05, "
+                         "OH:0.01, H:0.001");
+    checkThermal(2200.0, "CO2:1, H2O:2, N2:7.52, OH:0.01, H:0.001, O:0.001");
+    // Nearly pure species and mixtures of monatomic species
+    checkThermal(1000.0, "H2:1");
+    checkThermal(800.0, "AR:1, H:0.2");
+}
+
+TEST_P(MultiTransportIterativeTest, iterationLimit)
+{
+    gas->setState_TPX(1200.0, OneAtm, "CH4:1, O2:2, N2:7.52, H2O:0.5");
+    double lambda = tran->thermalConductivity();
+
+    // A single iteration from the initial guess is not converged, but the
+    // next solution starts from the previous one
+    std::auto_ptr<Transport> tran2(newTransportMgr(GetParam(), gas.get()));
+    MultiTransport* multi2 = dynamic_cast<MultiTransport*>(tran2.get());
+    multi2->setIterativeSolver(true, 1, 1e-10);
+    EXPECT_TRUE(multi2->iterativeSolver());
+    EXPECT_GT(std::abs(tran2->thermalConductivity() - lambda), 1e-6 * lambda);
+    EXPECT_EQ(1u, multi2->lastIterationCount());
+
+    multi2->setIterativeSolver(true, 50, 1e-10);
+    EXPECT_NEAR(lambda, tran2->thermalConductivity(), 1e-9 * lambda);
+    EXPECT_LT(multi2->lastIterationCount(), 50u);
+}
+
+TEST_P(MultiTransportIterativeTest, seriesDiffCoeffs)
+{
+    gas->setState_TPX(1500.0, OneAtm, "CH4:0.05, O2:0.15, N2:0.6, H2O:0.1, "
+                                      "CO2:0.05, OH:0.01, H:0.001");
+    double err0 = seriesError(0);
+    double err1 = seriesError(1);
+    double err2 = seriesError(2);
+    EXPECT_LT(err0, 0.1);
+    EXPECT_LT(err1, 0.1 * err0);
+    EXPECT_LT(err2, 0.1 * err1);
+    EXPECT_LT(seriesError(8), 1e-10);
+}
+
+TEST_P(MultiTransportIterativeTest, seriesBinaryMixture)
+{
+    // For a binary mixture, the first order series is exact
+    gas->setState_TPX(500.0, OneAtm, "H2:0.5, AR:0.5");
+    EXPECT_LT(seriesError(1), 1e-10);
+    gas->setState_TPX(1000.0, OneAtm, "H2:1");
+    EXPECT_LT(seriesError(2), 1e-10);
+}
+
+TEST_P(MultiTransportIterativeTest, invalidOptions)
+{
+    EXPECT_THROW(multi->setIterativeSolver(true, 0), CanteraError);
+    EXPECT_THROW(multi->setIterativeSolver(true, 10, 0.0), CanteraError);
+    EXPECT_FALSE(multi->iterativeSolver());
+}
+
+INSTANTIATE_TEST_CASE_P(MultiTransportIterative, MultiTransportIterativeTest,
+                        testing::Values(std::string("Multi"),
+                                        std::string("CK_Multi")));
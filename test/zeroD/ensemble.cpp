@@ -0,0 +1,112 @@
+#include "gtest/gtest.h"
+#include "cantera/zerodim.h"
+#include "cantera/IdealGasMix.h"
+
+namespace Cantera
+{
+
+class ReactorEnsembleTest : public testing::Test
+{
+public:
+    ReactorEnsembleTest() : ens("h2o2.xml") {
+        for (size_t i = 0; i < 6; i++) {
+            ens.addInitialState(1000 + 50*i, OneAtm * (1 + i),
+                                "H2:2.0, O2:1.0, AR:4.0");
+        }
+        ens.setEndTime(0.01);
+    }
+
+    ReactorEnsemble ens;
+};
+
+TEST_F(ReactorEnsembleTest, compare_to_reactor)
+{
+    ens.setSaveTrajectories(true);
+    ens.run();
+
+    IdealGasMix gas("h2o2.xml");
+    size_t K = gas.nSpecies();
+    for (size_t i = 0; i < ens.nStates(); i++) {
+        ASSERT_TRUE(ens.succeeded(i)) << ens.errorMessage(i);
+        gas.setState_TPX(1000 + 50*i, OneAtm * (1 + i),
+                         "H2:2.0, O2:1.0, AR:4.0");
+        IdealGasConstPressureReactor r;
+        r.insert(gas);
+        ReactorNet net;
+        net.addReactor(r);
+        net.advance(0.01);
+        EXPECT_NEAR(r.temperature(), ens.finalTemperature(i), 1e-4);
+
+        const vector_fp& t = ens.trajectoryTimes(i);
+        const vector_fp& states = ens.trajectory(i);
+        ASSERT_EQ(t.size() * (K + 1), states.size());
+        EXPECT_DOUBLE_EQ(1000 + 50*i, states[0]);
+        EXPECT_GT(ens.ignitionDelay(i), t[0]);
+        EXPECT_LT(ens.ignitionDelay(i), t.back());
+    }
+
+    // Higher temperatures and pressures give shorter ignition delays
+    for (size_t i = 1; i < ens.nStates(); i++) {
+        EXPECT_LT(ens.ignitionDelay(i), ens.ignitionDelay(i-1));
+    }
+}
+
+TEST_F(ReactorEnsembleTest, threads)
+{
+    // The worker threads are only used if Cantera is compiled with
+    // build_thread_safe = 'y'. Otherwise, this checks the serial path twice.
+    ens.setSaveTrajectories(true);
+    ens.setNumThreads(1);
+    ens.run();
+    size_t n = ens.nStates();
+    vector_fp tau(n), Tfinal(n);
+    std::vector<vector_fp> times(n), states(n);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_TRUE(ens.succeeded(i)) << ens.errorMessage(i);
+        tau[i] = ens.ignitionDelay(i);
+        Tfinal[i] = ens.finalTemperature(i);
+        times[i] = ens.trajectoryTimes(i);
+        states[i] = ens.trajectory(i);
+    }
+
+    // Fewer threads than cases, so each worker integrates several cases
+    for (size_t nThreads = 3; nThreads <= 4; nThreads++) {
+        ens.setNumThreads(nThreads);
+        EXPECT_EQ(nThreads, ens.numThreads());
+        ens.run();
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_TRUE(ens.succeeded(i)) << ens.errorMessage(i);
+            EXPECT_DOUBLE_EQ(tau[i], ens.ignitionDelay(i));
+            EXPECT_DOUBLE_EQ(Tfinal[i], ens.finalTemperature(i));
+            ASSERT_EQ(times[i].size(), ens.trajectoryTimes(i).size());
+            ASSERT_EQ(states[i].size(), ens.trajectory(i).size());
+            for (size_t j = 0; j < states[i].size(); j++) {
+                EXPECT_DOUBLE_EQ(states[i][j], ens.trajectory(i)[j]);
+            }
+        }
+    }
+}
+
+TEST_F(ReactorEnsembleTest, failed_case)
+{
+    ens.setLinearSolverType("spam");
+    for (size_t nThreads = 1; nThreads <= 4; nThreads += 3) {
+        ens.setNumThreads(nThreads);
+        ens.run();
+        for (size_t i = 0; i < ens.nStates(); i++) {
+            EXPECT_FALSE(ens.succeeded(i));
+            EXPECT_NE(std::string::npos, ens.errorMessage(i).find("spam"));
+        }
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    printf("Running main() from ensemble.cpp\n");
+    testing::InitGoogleTest(&argc, argv);
+    int result = RUN_ALL_TESTS();
+    Cantera::appdelete();
+    return result;
+}